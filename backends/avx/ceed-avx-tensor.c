@@ -10,6 +10,8 @@
 #include <immintrin.h>
 #include <stdbool.h>
 
+#include "ceed-avx.h"
+
 #ifdef CEED_SCALAR_IS_FP64
 #define rtype __m256d
 #define loadu _mm256_loadu_pd
@@ -249,27 +251,77 @@ static inline int CeedTensorContract_Avx_Single(CeedTensorContract contract, Cee
 }
 
 //------------------------------------------------------------------------------
-// Tensor Contract - Common Sizes
+// Tensor Contract - Register Tile Shapes
 //------------------------------------------------------------------------------
 static int CeedTensorContract_Avx_Blocked_4_8(CeedTensorContract contract, CeedInt A, CeedInt B, CeedInt C, CeedInt J, const CeedScalar *restrict t,
                                               CeedTransposeMode t_mode, const CeedInt add, const CeedScalar *restrict u, CeedScalar *restrict v) {
   return CeedTensorContract_Avx_Blocked(contract, A, B, C, J, t, t_mode, add, u, v, 4, 8);
 }
-static int CeedTensorContract_Avx_Remainder_8_8(CeedTensorContract contract, CeedInt A, CeedInt B, CeedInt C, CeedInt J, const CeedScalar *restrict t,
-                                                CeedTransposeMode t_mode, const CeedInt add, const CeedScalar *restrict u, CeedScalar *restrict v) {
-  return CeedTensorContract_Avx_Remainder(contract, A, B, C, J, t, t_mode, add, u, v, 8, 8);
+static int CeedTensorContract_Avx_Blocked_8_4(CeedTensorContract contract, CeedInt A, CeedInt B, CeedInt C, CeedInt J, const CeedScalar *restrict t,
+                                              CeedTransposeMode t_mode, const CeedInt add, const CeedScalar *restrict u, CeedScalar *restrict v) {
+  return CeedTensorContract_Avx_Blocked(contract, A, B, C, J, t, t_mode, add, u, v, 8, 4);
+}
+static int CeedTensorContract_Avx_Blocked_2_16(CeedTensorContract contract, CeedInt A, CeedInt B, CeedInt C, CeedInt J, const CeedScalar *restrict t,
+                                               CeedTransposeMode t_mode, const CeedInt add, const CeedScalar *restrict u, CeedScalar *restrict v) {
+  return CeedTensorContract_Avx_Blocked(contract, A, B, C, J, t, t_mode, add, u, v, 2, 16);
+}
+static int CeedTensorContract_Avx_Blocked_6_8(CeedTensorContract contract, CeedInt A, CeedInt B, CeedInt C, CeedInt J, const CeedScalar *restrict t,
+                                              CeedTransposeMode t_mode, const CeedInt add, const CeedScalar *restrict u, CeedScalar *restrict v) {
+  return CeedTensorContract_Avx_Blocked(contract, A, B, C, J, t, t_mode, add, u, v, 6, 8);
+}
+static int CeedTensorContract_Avx_Blocked_4_4(CeedTensorContract contract, CeedInt A, CeedInt B, CeedInt C, CeedInt J, const CeedScalar *restrict t,
+                                              CeedTransposeMode t_mode, const CeedInt add, const CeedScalar *restrict u, CeedScalar *restrict v) {
+  return CeedTensorContract_Avx_Blocked(contract, A, B, C, J, t, t_mode, add, u, v, 4, 4);
 }
 static int CeedTensorContract_Avx_Single_4_8(CeedTensorContract contract, CeedInt A, CeedInt B, CeedInt C, CeedInt J, const CeedScalar *restrict t,
                                              CeedTransposeMode t_mode, const CeedInt add, const CeedScalar *restrict u, CeedScalar *restrict v) {
   return CeedTensorContract_Avx_Single(contract, A, B, C, J, t, t_mode, add, u, v, 4, 8);
 }
+static int CeedTensorContract_Avx_Single_8_4(CeedTensorContract contract, CeedInt A, CeedInt B, CeedInt C, CeedInt J, const CeedScalar *restrict t,
+                                             CeedTransposeMode t_mode, const CeedInt add, const CeedScalar *restrict u, CeedScalar *restrict v) {
+  return CeedTensorContract_Avx_Single(contract, A, B, C, J, t, t_mode, add, u, v, 8, 4);
+}
+static int CeedTensorContract_Avx_Single_2_16(CeedTensorContract contract, CeedInt A, CeedInt B, CeedInt C, CeedInt J, const CeedScalar *restrict t,
+                                              CeedTransposeMode t_mode, const CeedInt add, const CeedScalar *restrict u, CeedScalar *restrict v) {
+  return CeedTensorContract_Avx_Single(contract, A, B, C, J, t, t_mode, add, u, v, 2, 16);
+}
+static int CeedTensorContract_Avx_Single_6_8(CeedTensorContract contract, CeedInt A, CeedInt B, CeedInt C, CeedInt J, const CeedScalar *restrict t,
+                                             CeedTransposeMode t_mode, const CeedInt add, const CeedScalar *restrict u, CeedScalar *restrict v) {
+  return CeedTensorContract_Avx_Single(contract, A, B, C, J, t, t_mode, add, u, v, 6, 8);
+}
+static int CeedTensorContract_Avx_Single_4_4(CeedTensorContract contract, CeedInt A, CeedInt B, CeedInt C, CeedInt J, const CeedScalar *restrict t,
+                                             CeedTransposeMode t_mode, const CeedInt add, const CeedScalar *restrict u, CeedScalar *restrict v) {
+  return CeedTensorContract_Avx_Single(contract, A, B, C, J, t, t_mode, add, u, v, 4, 4);
+}
+
+typedef int (*CeedTensorContractKernel_Avx)(CeedTensorContract contract, CeedInt A, CeedInt B, CeedInt C, CeedInt J, const CeedScalar *restrict t,
+                                            CeedTransposeMode t_mode, const CeedInt add, const CeedScalar *restrict u, CeedScalar *restrict v);
+
+typedef struct {
+  CeedInt                      block_size;  // Number of columns in each block of columns
+  CeedTensorContractKernel_Avx Blocked;     // Contraction of blocks of columns
+  CeedTensorContractKernel_Avx Single;      // Contraction for C=1
+} CeedTensorContractTile_Avx;
+
+// Tile shapes, with rows and columns of the output tile held in registers for blocks of columns and for C=1; the first is the default
+static const CeedTensorContractTile_Avx ceed_avx_tiles[] = {
+    {8,  CeedTensorContract_Avx_Blocked_4_8,  CeedTensorContract_Avx_Single_4_8 },
+    {4,  CeedTensorContract_Avx_Blocked_8_4,  CeedTensorContract_Avx_Single_8_4 },
+    {16, CeedTensorContract_Avx_Blocked_2_16, CeedTensorContract_Avx_Single_2_16},
+    {8,  CeedTensorContract_Avx_Blocked_6_8,  CeedTensorContract_Avx_Single_6_8 },
+    {4,  CeedTensorContract_Avx_Blocked_4_4,  CeedTensorContract_Avx_Single_4_4 },
+};
 
 //------------------------------------------------------------------------------
 // Tensor Contract Apply
 //------------------------------------------------------------------------------
 static int CeedTensorContractApply_Avx(CeedTensorContract contract, CeedInt A, CeedInt B, CeedInt C, CeedInt J, const CeedScalar *restrict t,
                                        CeedTransposeMode t_mode, const CeedInt add, const CeedScalar *restrict u, CeedScalar *restrict v) {
-  const CeedInt blk_size = 8;
+  CeedTensorContract_Avx            *impl;
+  const CeedTensorContractTile_Avx *tile;
+
+  CeedCallBackend(CeedTensorContractGetData(contract, &impl));
+  tile = &ceed_avx_tiles[impl->tile];
 
   if (!add) {
     for (CeedInt q = 0; q < A * J * C; q++) v[q] = (CeedScalar)0.0;
@@ -277,21 +329,56 @@ static int CeedTensorContractApply_Avx(CeedTensorContract contract, CeedInt A, C
 
   if (C == 1) {
     // Serial C=1 Case
-    CeedTensorContract_Avx_Single_4_8(contract, A, B, C, J, t, t_mode, true, u, v);
+    tile->Single(contract, A, B, C, J, t, t_mode, true, u, v);
   } else {
-    // Blocks of 8 columns
-    if (C >= blk_size) CeedTensorContract_Avx_Blocked_4_8(contract, A, B, C, J, t, t_mode, true, u, v);
+    // Blocks of columns
+    if (C >= tile->block_size) tile->Blocked(contract, A, B, C, J, t, t_mode, true, u, v);
     // Remainder of columns
-    if (C % blk_size) CeedTensorContract_Avx_Remainder_8_8(contract, A, B, C, J, t, t_mode, true, u, v);
+    if (C % tile->block_size) CeedTensorContract_Avx_Remainder(contract, A, B, C, J, t, t_mode, true, u, v, 8, tile->block_size);
   }
   return CEED_ERROR_SUCCESS;
 }
 
+//------------------------------------------------------------------------------
+// Tensor Contract Tile Shapes
+//------------------------------------------------------------------------------
+static int CeedTensorContractGetNumTiles_Avx(CeedTensorContract contract, CeedInt *num_tiles) {
+  *num_tiles = sizeof(ceed_avx_tiles) / sizeof(ceed_avx_tiles[0]);
+  return CEED_ERROR_SUCCESS;
+}
+
+static int CeedTensorContractSetTile_Avx(CeedTensorContract contract, CeedInt tile) {
+  CeedTensorContract_Avx *impl;
+
+  CeedCallBackend(CeedTensorContractGetData(contract, &impl));
+  impl->tile = tile;
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Tensor Contract Destroy
+//------------------------------------------------------------------------------
+static int CeedTensorContractDestroy_Avx(CeedTensorContract contract) {
+  CeedTensorContract_Avx *impl;
+
+  CeedCallBackend(CeedTensorContractGetData(contract, &impl));
+  CeedCallBackend(CeedFree(&impl));
+  return CEED_ERROR_SUCCESS;
+}
+
 //------------------------------------------------------------------------------
 // Tensor Contract Create
 //------------------------------------------------------------------------------
 int CeedTensorContractCreate_Avx(CeedTensorContract contract) {
-  CeedCallBackend(CeedSetBackendFunction(CeedTensorContractReturnCeed(contract), "TensorContract", contract, "Apply", CeedTensorContractApply_Avx));
+  Ceed                    ceed = CeedTensorContractReturnCeed(contract);
+  CeedTensorContract_Avx *impl;
+
+  CeedCallBackend(CeedCalloc(1, &impl));
+  CeedCallBackend(CeedTensorContractSetData(contract, impl));
+  CeedCallBackend(CeedSetBackendFunction(ceed, "TensorContract", contract, "Apply", CeedTensorContractApply_Avx));
+  CeedCallBackend(CeedSetBackendFunction(ceed, "TensorContract", contract, "GetNumTiles", CeedTensorContractGetNumTiles_Avx));
+  CeedCallBackend(CeedSetBackendFunction(ceed, "TensorContract", contract, "SetTile", CeedTensorContractSetTile_Avx));
+  CeedCallBackend(CeedSetBackendFunction(ceed, "TensorContract", contract, "Destroy", CeedTensorContractDestroy_Avx));
   return CEED_ERROR_SUCCESS;
 }
 
@@ -9,4 +9,8 @@
 #include <ceed.h>
 #include <ceed/backend.h>
 
+typedef struct {
+  CeedInt tile; /* Index of register tile shape */
+} CeedTensorContract_Avx;
+
 CEED_INTERN int CeedTensorContractCreate_Avx(CeedTensorContract contract);
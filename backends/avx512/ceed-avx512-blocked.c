@@ -0,0 +1,42 @@
+// Copyright (c) 2017-2025, Lawrence Livermore National Security, LLC and other CEED contributors.
+// All Rights Reserved. See the top-level LICENSE and NOTICE files for details.
+//
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// This file is part of CEED:  http://github.com/ceed
+
+#include <ceed.h>
+#include <ceed/backend.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "ceed-avx512.h"
+
+//------------------------------------------------------------------------------
+// Backend Init
+//------------------------------------------------------------------------------
+static int CeedInit_Avx512(const char *resource, Ceed ceed) {
+  Ceed ceed_ref;
+
+  CeedCheck(!strcmp(resource, "/cpu/self") || !strcmp(resource, "/cpu/self/avx512") || !strcmp(resource, "/cpu/self/avx512/blocked"), ceed,
+            CEED_ERROR_BACKEND, "AVX-512 backend cannot use resource: %s", resource);
+  CeedCheck(CeedAvx512IsSupported(), ceed, CEED_ERROR_UNSUPPORTED, "AVX-512 backend requires a CPU with AVX-512F support");
+  CeedCallBackend(CeedSetDeterministic(ceed, true));
+
+  // Create reference Ceed that implementation will be dispatched through unless overridden
+  CeedCallBackend(CeedInit("/cpu/self/opt/blocked", &ceed_ref));
+  CeedCallBackend(CeedSetDelegate(ceed, ceed_ref));
+  CeedCallBackend(CeedDestroy(&ceed_ref));
+
+  CeedCallBackend(CeedSetBackendFunction(ceed, "Ceed", ceed, "TensorContractCreate", CeedTensorContractCreate_Avx512));
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Backend Register
+//------------------------------------------------------------------------------
+CEED_INTERN int CeedRegister_Avx512_Blocked(void) {
+  return CeedRegister("/cpu/self/avx512/blocked", CeedInit_Avx512, CeedAvx512IsSupported() ? 29 : CEED_MAX_BACKEND_PRIORITY);
+}
+
+//------------------------------------------------------------------------------
@@ -0,0 +1,223 @@
+// Copyright (c) 2017-2025, Lawrence Livermore National Security, LLC and other CEED contributors.
+// All Rights Reserved. See the top-level LICENSE and NOTICE files for details.
+//
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// This file is part of CEED:  http://github.com/ceed
+
+#include <ceed.h>
+#include <ceed/backend.h>
+#include <immintrin.h>
+#include <stdbool.h>
+
+#include "ceed-avx512.h"
+
+#ifdef CEED_SCALAR_IS_FP64
+#define W 8
+#define rtype __m512d
+#define mtype __mmask8
+#define loadu _mm512_loadu_pd
+#define storeu _mm512_storeu_pd
+#define maskz_loadu _mm512_maskz_loadu_pd
+#define mask_storeu _mm512_mask_storeu_pd
+#define set1 _mm512_set1_pd
+// c += a * b
+#define fmadd(c, a, b) (c) = _mm512_fmadd_pd((a), (b), (c))
+#else
+#define W 16
+#define rtype __m512
+#define mtype __mmask16
+#define loadu _mm512_loadu_ps
+#define storeu _mm512_storeu_ps
+#define maskz_loadu _mm512_maskz_loadu_ps
+#define mask_storeu _mm512_mask_storeu_ps
+#define set1 _mm512_set1_ps
+// c += a * b
+#define fmadd(c, a, b) (c) = _mm512_fmadd_ps((a), (b), (c))
+#endif
+// Mask for first n lanes of a vector
+#define mask_n(n) ((mtype)((n) >= W ? (1u << W) - 1 : (1u << (n)) - 1))
+
+//------------------------------------------------------------------------------
+// Register Tile
+//   out[r * out_stride + k] += sum_b s[r * s_stride_r + b * s_stride_b] * w[b * w_stride_b + k], for r < num_rows and k < CV * W,
+//   with the last vector of columns masked by mask
+//------------------------------------------------------------------------------
+static inline void CeedTensorContract_Avx512_Tile(CeedInt B, const CeedScalar *restrict s, CeedInt s_stride_r, CeedInt s_stride_b,
+                                                  const CeedScalar *restrict w, CeedInt w_stride_b, CeedScalar *restrict out, CeedInt out_stride,
+                                                  CeedInt num_rows, mtype mask, const CeedInt RR, const CeedInt CV) {
+  rtype vv[RR][CV];  // Output tile to be held in registers
+
+  for (CeedInt r = 0; r < num_rows; r++) {
+    for (CeedInt cv = 0; cv < CV - 1; cv++) vv[r][cv] = loadu(&out[r * out_stride + cv * W]);
+    vv[r][CV - 1] = maskz_loadu(mask, &out[r * out_stride + (CV - 1) * W]);
+  }
+  for (CeedInt b = 0; b < B; b++) {
+    rtype ww[CV];
+
+    for (CeedInt cv = 0; cv < CV - 1; cv++) ww[cv] = loadu(&w[b * w_stride_b + cv * W]);
+    ww[CV - 1] = maskz_loadu(mask, &w[b * w_stride_b + (CV - 1) * W]);
+    for (CeedInt r = 0; r < num_rows; r++) {  // unroll
+      const rtype sv = set1(s[r * s_stride_r + b * s_stride_b]);
+
+      for (CeedInt cv = 0; cv < CV; cv++) fmadd(vv[r][cv], sv, ww[cv]);  // unroll
+    }
+  }
+  for (CeedInt r = 0; r < num_rows; r++) {
+    for (CeedInt cv = 0; cv < CV - 1; cv++) storeu(&out[r * out_stride + cv * W], vv[r][cv]);
+    mask_storeu(&out[r * out_stride + (CV - 1) * W], mask, vv[r][CV - 1]);
+  }
+}
+
+//------------------------------------------------------------------------------
+// Tiled Rows
+//   Applies register tiles of RR rows and CV vectors of columns to R rows and K columns, with remaining columns one vector at a time
+//------------------------------------------------------------------------------
+static inline int CeedTensorContract_Avx512_Rows(CeedInt R, CeedInt K, CeedInt B, const CeedScalar *restrict s, CeedInt s_stride_r,
+                                                 CeedInt s_stride_b, const CeedScalar *restrict w, CeedInt w_stride_b, CeedScalar *restrict out,
+                                                 CeedInt out_stride, const CeedInt RR, const CeedInt CV) {
+  const mtype full = mask_n(W);
+
+  // Blocks of RR rows
+  for (CeedInt r = 0; r < (R / RR) * RR; r += RR) {
+    CeedInt k = 0;
+
+    for (; k + CV * W <= K; k += CV * W) {
+      CeedTensorContract_Avx512_Tile(B, &s[r * s_stride_r], s_stride_r, s_stride_b, &w[k], w_stride_b, &out[r * out_stride + k], out_stride, RR, full,
+                                     RR, CV);
+    }
+    for (; k < K; k += W) {
+      CeedTensorContract_Avx512_Tile(B, &s[r * s_stride_r], s_stride_r, s_stride_b, &w[k], w_stride_b, &out[r * out_stride + k], out_stride, RR,
+                                     mask_n(K - k), RR, 1);
+    }
+  }
+  // Remainder of rows
+  const CeedInt r = (R / RR) * RR;
+
+  if (r < R) {
+    CeedInt k = 0;
+
+    for (; k + CV * W <= K; k += CV * W) {
+      CeedTensorContract_Avx512_Tile(B, &s[r * s_stride_r], s_stride_r, s_stride_b, &w[k], w_stride_b, &out[r * out_stride + k], out_stride, R - r,
+                                     full, RR, CV);
+    }
+    for (; k < K; k += W) {
+      CeedTensorContract_Avx512_Tile(B, &s[r * s_stride_r], s_stride_r, s_stride_b, &w[k], w_stride_b, &out[r * out_stride + k], out_stride, R - r,
+                                     mask_n(K - k), RR, 1);
+    }
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Tensor Contract - Register Tile Shapes
+//------------------------------------------------------------------------------
+static int CeedTensorContract_Avx512_Rows_4_2(CeedInt R, CeedInt K, CeedInt B, const CeedScalar *restrict s, CeedInt s_stride_r, CeedInt s_stride_b,
+                                              const CeedScalar *restrict w, CeedInt w_stride_b, CeedScalar *restrict out, CeedInt out_stride) {
+  return CeedTensorContract_Avx512_Rows(R, K, B, s, s_stride_r, s_stride_b, w, w_stride_b, out, out_stride, 4, 2);
+}
+static int CeedTensorContract_Avx512_Rows_8_1(CeedInt R, CeedInt K, CeedInt B, const CeedScalar *restrict s, CeedInt s_stride_r, CeedInt s_stride_b,
+                                              const CeedScalar *restrict w, CeedInt w_stride_b, CeedScalar *restrict out, CeedInt out_stride) {
+  return CeedTensorContract_Avx512_Rows(R, K, B, s, s_stride_r, s_stride_b, w, w_stride_b, out, out_stride, 8, 1);
+}
+static int CeedTensorContract_Avx512_Rows_2_4(CeedInt R, CeedInt K, CeedInt B, const CeedScalar *restrict s, CeedInt s_stride_r, CeedInt s_stride_b,
+                                              const CeedScalar *restrict w, CeedInt w_stride_b, CeedScalar *restrict out, CeedInt out_stride) {
+  return CeedTensorContract_Avx512_Rows(R, K, B, s, s_stride_r, s_stride_b, w, w_stride_b, out, out_stride, 2, 4);
+}
+static int CeedTensorContract_Avx512_Rows_6_2(CeedInt R, CeedInt K, CeedInt B, const CeedScalar *restrict s, CeedInt s_stride_r, CeedInt s_stride_b,
+                                              const CeedScalar *restrict w, CeedInt w_stride_b, CeedScalar *restrict out, CeedInt out_stride) {
+  return CeedTensorContract_Avx512_Rows(R, K, B, s, s_stride_r, s_stride_b, w, w_stride_b, out, out_stride, 6, 2);
+}
+static int CeedTensorContract_Avx512_Rows_8_2(CeedInt R, CeedInt K, CeedInt B, const CeedScalar *restrict s, CeedInt s_stride_r, CeedInt s_stride_b,
+                                              const CeedScalar *restrict w, CeedInt w_stride_b, CeedScalar *restrict out, CeedInt out_stride) {
+  return CeedTensorContract_Avx512_Rows(R, K, B, s, s_stride_r, s_stride_b, w, w_stride_b, out, out_stride, 8, 2);
+}
+
+typedef int (*CeedTensorContractKernel_Avx512)(CeedInt R, CeedInt K, CeedInt B, const CeedScalar *restrict s, CeedInt s_stride_r, CeedInt s_stride_b,
+                                               const CeedScalar *restrict w, CeedInt w_stride_b, CeedScalar *restrict out, CeedInt out_stride);
+
+// Tile shapes, with rows and vectors of columns of the output tile held in registers; the first is the default
+static const CeedTensorContractKernel_Avx512 ceed_avx512_tiles[] = {
+    CeedTensorContract_Avx512_Rows_4_2, CeedTensorContract_Avx512_Rows_8_1, CeedTensorContract_Avx512_Rows_2_4,
+    CeedTensorContract_Avx512_Rows_6_2, CeedTensorContract_Avx512_Rows_8_2,
+};
+
+//------------------------------------------------------------------------------
+// Tensor Contract Apply
+//------------------------------------------------------------------------------
+static int CeedTensorContractApply_Avx512(CeedTensorContract contract, CeedInt A, CeedInt B, CeedInt C, CeedInt J, const CeedScalar *restrict t,
+                                          CeedTransposeMode t_mode, const CeedInt add, const CeedScalar *restrict u, CeedScalar *restrict v) {
+  CeedInt                         t_stride_0 = B, t_stride_1 = 1;
+  CeedTensorContract_Avx512      *impl;
+  CeedTensorContractKernel_Avx512 kernel;
+
+  CeedCallBackend(CeedTensorContractGetData(contract, &impl));
+  kernel = ceed_avx512_tiles[impl->tile];
+  if (t_mode == CEED_TRANSPOSE) {
+    t_stride_0 = 1;
+    t_stride_1 = J;
+  }
+
+  if (!add) {
+    for (CeedInt q = 0; q < A * J * C; q++) v[q] = (CeedScalar)0.0;
+  }
+
+  if (C == 1) {
+    // Serial C=1 Case, vectorized over rows of t with t transposed so rows are contiguous
+    CeedScalar t_b[B * J];
+
+    for (CeedInt b = 0; b < B; b++) {
+      for (CeedInt j = 0; j < J; j++) t_b[b * J + j] = t[j * t_stride_0 + b * t_stride_1];
+    }
+    kernel(A, J, B, u, B, 1, t_b, J, v, J);
+  } else {
+    // Vectorized over columns
+    for (CeedInt a = 0; a < A; a++) kernel(J, C, B, t, t_stride_0, t_stride_1, &u[a * B * C], C, &v[a * J * C], C);
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Tensor Contract Tile Shapes
+//------------------------------------------------------------------------------
+static int CeedTensorContractGetNumTiles_Avx512(CeedTensorContract contract, CeedInt *num_tiles) {
+  *num_tiles = sizeof(ceed_avx512_tiles) / sizeof(ceed_avx512_tiles[0]);
+  return CEED_ERROR_SUCCESS;
+}
+
+static int CeedTensorContractSetTile_Avx512(CeedTensorContract contract, CeedInt tile) {
+  CeedTensorContract_Avx512 *impl;
+
+  CeedCallBackend(CeedTensorContractGetData(contract, &impl));
+  impl->tile = tile;
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Tensor Contract Destroy
+//------------------------------------------------------------------------------
+static int CeedTensorContractDestroy_Avx512(CeedTensorContract contract) {
+  CeedTensorContract_Avx512 *impl;
+
+  CeedCallBackend(CeedTensorContractGetData(contract, &impl));
+  CeedCallBackend(CeedFree(&impl));
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Tensor Contract Create
+//------------------------------------------------------------------------------
+int CeedTensorContractCreate_Avx512(CeedTensorContract contract) {
+  Ceed                       ceed = CeedTensorContractReturnCeed(contract);
+  CeedTensorContract_Avx512 *impl;
+
+  CeedCallBackend(CeedCalloc(1, &impl));
+  CeedCallBackend(CeedTensorContractSetData(contract, impl));
+  CeedCallBackend(CeedSetBackendFunction(ceed, "TensorContract", contract, "Apply", CeedTensorContractApply_Avx512));
+  CeedCallBackend(CeedSetBackendFunction(ceed, "TensorContract", contract, "GetNumTiles", CeedTensorContractGetNumTiles_Avx512));
+  CeedCallBackend(CeedSetBackendFunction(ceed, "TensorContract", contract, "SetTile", CeedTensorContractSetTile_Avx512));
+  CeedCallBackend(CeedSetBackendFunction(ceed, "TensorContract", contract, "Destroy", CeedTensorContractDestroy_Avx512));
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
@@ -0,0 +1,23 @@
+// Copyright (c) 2017-2025, Lawrence Livermore National Security, LLC and other CEED contributors.
+// All Rights Reserved. See the top-level LICENSE and NOTICE files for details.
+//
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// This file is part of CEED:  http://github.com/ceed
+#pragma once
+
+#include <ceed.h>
+#include <ceed/backend.h>
+#include <stdbool.h>
+
+typedef struct {
+  CeedInt tile; /* Index of register tile shape */
+} CeedTensorContract_Avx512;
+
+// Check at runtime if the CPU and operating system support AVX-512F
+static inline bool CeedAvx512IsSupported(void) {
+  __builtin_cpu_init();
+  return __builtin_cpu_supports("avx512f");
+}
+
+CEED_INTERN int CeedTensorContractCreate_Avx512(CeedTensorContract contract);
@@ -65,12 +65,24 @@ static int CeedOperatorSetupFields_Blocked(CeedQFunction qf, CeedOperator op, bo
       CeedCallBackend(CeedElemRestrictionGetType(rstr, &rstr_type));
       switch (rstr_type) {
         case CEED_RESTRICTION_STANDARD: {
-          const CeedInt *offsets = NULL;
+          bool is_structured;
 
-          CeedCallBackend(CeedElemRestrictionGetOffsets(rstr, CEED_MEM_HOST, &offsets));
-          CeedCallBackend(CeedElemRestrictionCreateBlocked(ceed_rstr, num_elem, elem_size, block_size, num_comp, comp_stride, l_size, CEED_MEM_HOST,
-                                                           CEED_COPY_VALUES, offsets, &block_rstr[i + start_e]));
-          CeedCallBackend(CeedElemRestrictionRestoreOffsets(rstr, &offsets));
+          CeedCallBackend(CeedElemRestrictionIsStructured(rstr, &is_structured));
+          if (is_structured) {
+            CeedInt dim, num_elem_1d[3], P_1d;
+
+            // Keep structured restrictions free of offsets
+            CeedCallBackend(CeedElemRestrictionGetStructure(rstr, &dim, num_elem_1d, &P_1d));
+            CeedCallBackend(CeedElemRestrictionCreateBlockedStructured(ceed_rstr, dim, num_elem_1d, P_1d, block_size, num_comp, comp_stride, l_size,
+                                                                       &block_rstr[i + start_e]));
+          } else {
+            const CeedInt *offsets = NULL;
+
+            CeedCallBackend(CeedElemRestrictionGetOffsets(rstr, CEED_MEM_HOST, &offsets));
+            CeedCallBackend(CeedElemRestrictionCreateBlocked(ceed_rstr, num_elem, elem_size, block_size, num_comp, comp_stride, l_size,
+                                                             CEED_MEM_HOST, CEED_COPY_VALUES, offsets, &block_rstr[i + start_e]));
+            CeedCallBackend(CeedElemRestrictionRestoreOffsets(rstr, &offsets));
+          }
         } break;
         case CEED_RESTRICTION_ORIENTED: {
           const bool    *orients = NULL;
@@ -13,6 +13,9 @@
 
 CEED_BACKEND(CeedRegister_Avx_Blocked, 1, "/cpu/self/avx/blocked")
 CEED_BACKEND(CeedRegister_Avx_Serial, 1, "/cpu/self/avx/serial")
+CEED_BACKEND(CeedRegister_Avx512_Blocked, 1, "/cpu/self/avx512/blocked")
+CEED_BACKEND(CeedRegister_Avx512_Serial, 1, "/cpu/self/avx512/serial")
+CEED_BACKEND(CeedRegister_Cpu_Gen, 1, "/cpu/self/gen")
 CEED_BACKEND(CeedRegister_Cuda, 1, "/gpu/cuda/ref")
 CEED_BACKEND(CeedRegister_Cuda_Gen, 1, "/gpu/cuda/gen")
 CEED_BACKEND(CeedRegister_Cuda_Shared, 1, "/gpu/cuda/shared")
@@ -26,7 +29,10 @@ CEED_BACKEND(CeedRegister_Magma, 2, "/gpu/cuda/magma", "/gpu/hip/magma")
 CEED_BACKEND(CeedRegister_Magma_Det, 2, "/gpu/cuda/magma/det", "/gpu/hip/magma/det")
 CEED_BACKEND(CeedRegister_Memcheck_Blocked, 1, "/cpu/self/memcheck/blocked")
 CEED_BACKEND(CeedRegister_Memcheck_Serial, 1, "/cpu/self/memcheck/serial")
+CEED_BACKEND(CeedRegister_Neon_Blocked, 1, "/cpu/self/neon/blocked")
+CEED_BACKEND(CeedRegister_Neon_Serial, 1, "/cpu/self/neon/serial")
 CEED_BACKEND(CeedRegister_Occa, 6, "/cpu/self/occa", "/cpu/openmp/occa", "/gpu/dpcpp/occa", "/gpu/opencl/occa", "/gpu/hip/occa", "/gpu/cuda/occa")
+CEED_BACKEND(CeedRegister_Omp_Blocked, 1, "/cpu/self/omp/blocked")
 CEED_BACKEND(CeedRegister_Opt_Blocked, 1, "/cpu/self/opt/blocked")
 CEED_BACKEND(CeedRegister_Opt_Serial, 1, "/cpu/self/opt/serial")
 CEED_BACKEND(CeedRegister_Ref, 1, "/cpu/self/ref/serial")
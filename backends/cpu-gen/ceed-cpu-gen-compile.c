@@ -0,0 +1,260 @@
+// Copyright (c) 2017-2025, Lawrence Livermore National Security, LLC and other CEED contributors.
+// All Rights Reserved. See the top-level LICENSE and NOTICE files for details.
+//
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// This file is part of CEED:  http://github.com/ceed
+
+#define _POSIX_C_SOURCE 200809L
+#include "ceed-cpu-gen-compile.h"
+
+#include <ceed.h>
+#include <ceed/backend.h>
+#include <ceed/jit-tools.h>
+#include <dlfcn.h>
+#include <errno.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/utsname.h>
+#include <unistd.h>
+
+// Compiler and flags used for the library build, overridden by CEED_CPU_GEN_CC and CEED_CPU_GEN_CFLAGS at runtime
+#ifndef CEED_CPU_GEN_CC
+#define CEED_CPU_GEN_CC "cc"
+#endif
+#ifndef CEED_CPU_GEN_CFLAGS
+#define CEED_CPU_GEN_CFLAGS "-O3 -fPIC -shared"
+#endif
+
+//------------------------------------------------------------------------------
+// Append formatted text to string buffer
+//------------------------------------------------------------------------------
+int CeedStringAppend_Cpu_gen(char **str, const char *format, ...) {
+  size_t  len = *str ? strlen(*str) : 0;
+  int     append_len;
+  va_list args;
+
+  va_start(args, format);
+  append_len = vsnprintf(NULL, 0, format, args);
+  va_end(args);
+  CeedCallBackend(CeedRealloc(len + append_len + 1, str));
+  va_start(args, format);
+  vsnprintf(&(*str)[len], append_len + 1, format, args);
+  va_end(args);
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Append argument to shell command, single quoted with any embedded single quotes escaped
+//------------------------------------------------------------------------------
+static int CeedStringAppendShellArg_Cpu_gen(char **str, const char *prefix, const char *arg) {
+  CeedCallBackend(CeedStringAppend_Cpu_gen(str, " '%s", prefix));
+  for (const char *c = arg; *c;) {
+    const size_t len = strcspn(c, "'");
+
+    CeedCallBackend(CeedStringAppend_Cpu_gen(str, "%.*s", (int)len, c));
+    c += len;
+    if (*c == '\'') {
+      CeedCallBackend(CeedStringAppend_Cpu_gen(str, "'\\''"));
+      c++;
+    }
+  }
+  CeedCallBackend(CeedStringAppend_Cpu_gen(str, "'"));
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Describe compiler and host for JiT cache key
+//
+// Generated code is compiled for the host, e.g. with -march=native, so the CPU model is part of the description.
+//------------------------------------------------------------------------------
+static int CeedGetCompilerInfo_Cpu_gen(const char *cc, const char *options, char **compiler_info) {
+  char  line[1024];
+  FILE *file;
+
+  CeedCallBackend(CeedStringAppend_Cpu_gen(compiler_info, "%s %s\n", cc, options));
+  // -- Compiler version
+  {
+    char *command = NULL;
+
+    CeedCallBackend(CeedStringAppend_Cpu_gen(&command, "%s --version 2>/dev/null", cc));
+    file = popen(command, "r");
+    if (file) {
+      if (fgets(line, sizeof(line), file)) CeedCallBackend(CeedStringAppend_Cpu_gen(compiler_info, "%s", line));
+      pclose(file);
+    }
+    CeedCallBackend(CeedFree(&command));
+  }
+  // -- Host CPU
+  {
+    struct utsname host;
+
+    if (!uname(&host)) CeedCallBackend(CeedStringAppend_Cpu_gen(compiler_info, "%s\n", host.machine));
+  }
+  file = fopen("/proc/cpuinfo", "r");
+  if (file) {
+    while (fgets(line, sizeof(line), file)) {
+      if (!strncmp(line, "model name", 10) || !strncmp(line, "flags", 5) || !strncmp(line, "Features", 8)) {
+        CeedCallBackend(CeedStringAppend_Cpu_gen(compiler_info, "%s", line));
+      }
+      if (line[0] == '\n') break;
+    }
+    fclose(file);
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Compile C source to shared object and load it, reusing a shared object from the JiT cache for identical source, compiler, and options
+//
+// Compiler or loader failures are reported through is_compile_good so the caller can fall back.
+//------------------------------------------------------------------------------
+int CeedTryCompile_Cpu_gen(Ceed ceed, const char *source, bool *is_compile_good, void **module) {
+  bool        is_hit, is_cached;
+  const char *cc = getenv("CEED_CPU_GEN_CC"), *cflags = getenv("CEED_CPU_GEN_CFLAGS");
+  char       *options = NULL, *compiler_info = NULL, *key = NULL, *so_path = NULL;
+
+  *is_compile_good = true;
+  *module          = NULL;
+  if (!cc || !cc[0]) cc = CEED_CPU_GEN_CC;
+  if (!cflags) cflags = CEED_CPU_GEN_CFLAGS;
+
+  // Compiler options
+  CeedCallBackend(CeedStringAppend_Cpu_gen(&options, "%s", cflags));
+  // -- Additional include dirs
+  {
+    CeedInt      num_jit_source_dirs = 0;
+    const char **jit_source_dirs;
+
+    CeedCallBackend(CeedGetJitSourceRoots(ceed, &num_jit_source_dirs, &jit_source_dirs));
+    for (CeedInt i = 0; i < num_jit_source_dirs; i++) CeedCallBackend(CeedStringAppendShellArg_Cpu_gen(&options, "-I", jit_source_dirs[i]));
+    CeedCallBackend(CeedRestoreJitSourceRoots(ceed, &jit_source_dirs));
+  }
+  // -- User defines
+  {
+    CeedInt      num_jit_defines = 0;
+    const char **jit_defines;
+
+    CeedCallBackend(CeedGetJitDefines(ceed, &num_jit_defines, &jit_defines));
+    for (CeedInt i = 0; i < num_jit_defines; i++) CeedCallBackend(CeedStringAppendShellArg_Cpu_gen(&options, "-D", jit_defines[i]));
+    CeedCallBackend(CeedRestoreJitDefines(ceed, &jit_defines));
+  }
+
+  // Look up shared object in JiT cache
+  CeedCallBackend(CeedGetCompilerInfo_Cpu_gen(cc, options, &compiler_info));
+  CeedCallBackend(CeedJitCacheGetKey(ceed, source, compiler_info, &key));
+  CeedCallBackend(CeedJitCacheLookup(ceed, key, ".so", &so_path, &is_hit));
+  is_cached = so_path != NULL;
+  CeedCallBackend(CeedFree(&compiler_info));
+  CeedCallBackend(CeedFree(&key));
+
+  // Compile, if not cached
+  if (!is_hit) {
+    int   fd, status;
+    char *source_path = NULL, *temp_so_path = NULL, *command = NULL, *log = NULL;
+    FILE *pipe;
+
+    CeedDebug256(ceed, CEED_DEBUG_COLOR_ERROR, "---------- ATTEMPTING TO COMPILE JIT SOURCE ----------\n");
+    CeedDebug(ceed, "Source:\n%s\n", source);
+    CeedDebug256(ceed, CEED_DEBUG_COLOR_ERROR, "---------- END OF JIT SOURCE ----------\n");
+
+    // -- Write source to unique temporary file, next to cache entry if caching
+    if (is_cached) {
+      CeedCallBackend(CeedJitCacheCreateTempFile(ceed, so_path, &fd, &source_path));
+      if (!source_path) {
+        // The cache directory is not usable, so compile without caching
+        is_cached = false;
+        CeedCallBackend(CeedFree(&so_path));
+      }
+    }
+    if (!is_cached) {
+      const char *tmp_dir = getenv("TMPDIR");
+
+      CeedCallBackend(CeedStringAppend_Cpu_gen(&source_path, "%s/ceed-cpu-gen-XXXXXX", tmp_dir && tmp_dir[0] ? tmp_dir : "/tmp"));
+      fd = mkstemp(source_path);
+      CeedCheck(fd >= 0, ceed, CEED_ERROR_BACKEND, "Could not create JiT source file %s: %s", source_path, strerror(errno));
+    }
+    {
+      const size_t  source_len = strlen(source);
+      const ssize_t write_len  = write(fd, source, source_len);
+
+      close(fd);
+      CeedCheck(write_len == (ssize_t)source_len, ceed, CEED_ERROR_BACKEND, "Could not write JiT source file %s", source_path);
+    }
+
+    // -- Compile to temporary shared object
+    CeedCallBackend(CeedStringAppend_Cpu_gen(&temp_so_path, "%s.so", source_path));
+    // The compiler and flags are shell words, so a compiler wrapper or several flags may be given; paths are quoted as single arguments
+    CeedCallBackend(CeedStringAppend_Cpu_gen(&command, "%s %s -x c -o", cc, options));
+    CeedCallBackend(CeedStringAppendShellArg_Cpu_gen(&command, "", temp_so_path));
+    CeedCallBackend(CeedStringAppendShellArg_Cpu_gen(&command, "", source_path));
+    CeedCallBackend(CeedStringAppend_Cpu_gen(&command, " 2>&1"));
+    CeedDebug(ceed, "Compile command: %s\n", command);
+    pipe = popen(command, "r");
+    CeedCheck(pipe, ceed, CEED_ERROR_BACKEND, "Could not run JiT compiler: %s", command);
+    {
+      char   line[1024];
+      size_t line_len;
+
+      CeedCallBackend(CeedStringAppend_Cpu_gen(&log, ""));
+      while ((line_len = fread(line, 1, sizeof(line) - 1, pipe)) > 0) {
+        line[line_len] = '\0';
+        CeedCallBackend(CeedStringAppend_Cpu_gen(&log, "%s", line));
+      }
+    }
+    status = pclose(pipe);
+    remove(source_path);
+
+    *is_compile_good = status == 0;
+    if (*is_compile_good) {
+      // -- Move into cache, or load from temporary path if caching is disabled or the entry could not be stored
+      if (is_cached) {
+        bool is_stored;
+
+        CeedCallBackend(CeedJitCacheStoreFile(ceed, temp_so_path, so_path, &is_stored));
+        if (!is_stored) {
+          is_cached = false;
+          CeedCallBackend(CeedFree(&so_path));
+        }
+      }
+      if (!is_cached) CeedCallBackend(CeedStringAppend_Cpu_gen(&so_path, "%s", temp_so_path));
+    } else {
+      remove(temp_so_path);
+      CeedDebug256(ceed, CEED_DEBUG_COLOR_ERROR, "---------- COMPILE ERROR DETECTED ----------\n");
+      CeedDebug(ceed, "Command: %s\nCompile log:\n%s\n", command, log);
+      CeedDebug256(ceed, CEED_DEBUG_COLOR_ERROR, "---------- BACKEND MAY FALLBACK ----------\n");
+    }
+    CeedCallBackend(CeedFree(&source_path));
+    CeedCallBackend(CeedFree(&temp_so_path));
+    CeedCallBackend(CeedFree(&command));
+    CeedCallBackend(CeedFree(&log));
+  } else {
+    CeedDebug256(ceed, CEED_DEBUG_COLOR_SUCCESS, "---------- USING CACHED JIT KERNEL ----------\n");
+    CeedDebug(ceed, "Shared object: %s\n", so_path);
+  }
+
+  // Load shared object
+  if (*is_compile_good) {
+    *module          = dlopen(so_path, RTLD_NOW | RTLD_LOCAL);
+    *is_compile_good = *module != NULL;
+    if (!*is_compile_good) CeedDebug(ceed, "Could not load JiT shared object %s: %s\n", so_path, dlerror());
+    // -- Uncached shared objects are not needed after loading
+    if (!is_cached) remove(so_path);
+  }
+  CeedCallBackend(CeedFree(&options));
+  CeedCallBackend(CeedFree(&so_path));
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Get kernel function pointer from loaded shared object
+//------------------------------------------------------------------------------
+int CeedGetKernel_Cpu_gen(Ceed ceed, void *module, const char *name, void **kernel) {
+  *kernel = dlsym(module, name);
+  CeedCheck(*kernel, ceed, CEED_ERROR_BACKEND, "Could not find JiT kernel %s: %s", name, dlerror());
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
@@ -0,0 +1,16 @@
+// Copyright (c) 2017-2025, Lawrence Livermore National Security, LLC and other CEED contributors.
+// All Rights Reserved. See the top-level LICENSE and NOTICE files for details.
+//
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// This file is part of CEED:  http://github.com/ceed
+#pragma once
+
+#include <ceed.h>
+#include <ceed/backend.h>
+
+CEED_INTERN int CeedStringAppend_Cpu_gen(char **str, const char *format, ...);
+
+CEED_INTERN int CeedTryCompile_Cpu_gen(Ceed ceed, const char *source, bool *is_compile_good, void **module);
+
+CEED_INTERN int CeedGetKernel_Cpu_gen(Ceed ceed, void *module, const char *name, void **kernel);
@@ -0,0 +1,421 @@
+// Copyright (c) 2017-2025, Lawrence Livermore National Security, LLC and other CEED contributors.
+// All Rights Reserved. See the top-level LICENSE and NOTICE files for details.
+//
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// This file is part of CEED:  http://github.com/ceed
+
+#include <ceed.h>
+#include <ceed/backend.h>
+#include <ceed/jit-source/cpu/cpu-types.h>
+#include <ceed/jit-tools.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "ceed-cpu-gen-compile.h"
+#include "ceed-cpu-gen-operator-build.h"
+#include "ceed-cpu-gen.h"
+
+//------------------------------------------------------------------------------
+// Field data for code generation
+//------------------------------------------------------------------------------
+typedef struct {
+  CeedEvalMode        eval_mode;
+  CeedRestrictionType rstr_type;
+  CeedInt             size, num_comp, elem_size, comp_stride, strides[3], P_1d;
+  CeedInt             structured_num_elem[3], structured_P_1d; /* Structure of structured restriction, structured_P_1d is 0 otherwise */
+} CeedFieldInfo_Cpu_gen;
+
+//------------------------------------------------------------------------------
+// Get field data, checking for support
+//------------------------------------------------------------------------------
+static int CeedOperatorFieldGetInfo_Cpu_gen(CeedOperatorField op_field, CeedQFunctionField qf_field, CeedInt *dim, CeedInt *Q_1d,
+                                            CeedFieldInfo_Cpu_gen *info, bool *is_supported) {
+  CeedBasis basis;
+
+  memset(info, 0, sizeof(*info));
+  CeedCallBackend(CeedQFunctionFieldGetEvalMode(qf_field, &info->eval_mode));
+  CeedCallBackend(CeedQFunctionFieldGetSize(qf_field, &info->size));
+  if (info->eval_mode != CEED_EVAL_NONE && info->eval_mode != CEED_EVAL_INTERP && info->eval_mode != CEED_EVAL_GRAD &&
+      info->eval_mode != CEED_EVAL_WEIGHT) {
+    *is_supported = false;
+    return CEED_ERROR_SUCCESS;
+  }
+
+  // Basis, only H^1 tensor product bases with matching quadrature
+  CeedCallBackend(CeedOperatorFieldGetBasis(op_field, &basis));
+  if (info->eval_mode != CEED_EVAL_NONE) {
+    bool        is_tensor;
+    CeedInt     basis_dim, basis_Q_1d;
+    CeedFESpace fe_space;
+
+    CeedCallBackend(CeedBasisIsTensor(basis, &is_tensor));
+    CeedCallBackend(CeedBasisGetFESpace(basis, &fe_space));
+    if (is_tensor && fe_space == CEED_FE_SPACE_H1) {
+      CeedCallBackend(CeedBasisGetDimension(basis, &basis_dim));
+      CeedCallBackend(CeedBasisGetNumNodes1D(basis, &info->P_1d));
+      CeedCallBackend(CeedBasisGetNumQuadraturePoints1D(basis, &basis_Q_1d));
+      if (*dim == 0) {
+        *dim  = basis_dim;
+        *Q_1d = basis_Q_1d;
+      }
+      *is_supported = *is_supported && basis_dim == *dim && basis_Q_1d == *Q_1d;
+    } else {
+      *is_supported = false;
+    }
+  }
+  CeedCallBackend(CeedBasisDestroy(&basis));
+
+  // Restriction, only offset and strided restrictions
+  if (info->eval_mode != CEED_EVAL_WEIGHT) {
+    CeedElemRestriction rstr;
+
+    CeedCallBackend(CeedOperatorFieldGetElemRestriction(op_field, &rstr));
+    CeedCallBackend(CeedElemRestrictionGetType(rstr, &info->rstr_type));
+    CeedCallBackend(CeedElemRestrictionGetNumComponents(rstr, &info->num_comp));
+    CeedCallBackend(CeedElemRestrictionGetElementSize(rstr, &info->elem_size));
+    if (info->rstr_type == CEED_RESTRICTION_STANDARD) {
+      bool is_structured;
+
+      CeedCallBackend(CeedElemRestrictionGetCompStride(rstr, &info->comp_stride));
+      CeedCallBackend(CeedElemRestrictionIsStructured(rstr, &is_structured));
+      if (is_structured) CeedCallBackend(CeedElemRestrictionGetStructure(rstr, NULL, info->structured_num_elem, &info->structured_P_1d));
+    } else if (info->rstr_type == CEED_RESTRICTION_STRIDED) {
+      bool has_backend_strides;
+
+      CeedCallBackend(CeedElemRestrictionHasBackendStrides(rstr, &has_backend_strides));
+      if (has_backend_strides) {
+        info->strides[0] = 1;
+        info->strides[1] = info->elem_size;
+        info->strides[2] = info->elem_size * info->num_comp;
+      } else {
+        CeedCallBackend(CeedElemRestrictionGetStrides(rstr, info->strides));
+      }
+    } else {
+      *is_supported = false;
+    }
+    CeedCallBackend(CeedElemRestrictionDestroy(&rstr));
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Generate L-vector read or write for a field
+//------------------------------------------------------------------------------
+static int CeedOperatorBuildKernelRestriction_Cpu_gen(char **code, CeedInt i, bool is_input, const CeedFieldInfo_Cpu_gen *info, const char *r_name) {
+  const char *field_type = is_input ? "in" : "out", *direction = is_input ? "Read" : "Write";
+  char        d_name[32], args[80];
+
+  // Read is (L-vector, E-vector), write is (E-vector, L-vector)
+  snprintf(d_name, sizeof(d_name), "d_%s_%" CeedInt_FMT, field_type, i);
+  snprintf(args, sizeof(args), "%s, %s", is_input ? d_name : r_name, is_input ? r_name : d_name);
+  if (info->structured_P_1d) {
+    // Structured restrictions compute their offsets in the kernel
+    CeedCallBackend(CeedStringAppend_Cpu_gen(code,
+                                             "    %sLVecStructured_Cpu(%" CeedInt_FMT ", %" CeedInt_FMT ", %" CeedInt_FMT ", %" CeedInt_FMT ", %" CeedInt_FMT
+                                             ", %" CeedInt_FMT ", elem, %s);\n",
+                                             direction, info->num_comp, info->comp_stride, info->elem_size, info->structured_P_1d,
+                                             info->structured_num_elem[0], info->structured_num_elem[1], args));
+  } else if (info->rstr_type == CEED_RESTRICTION_STANDARD) {
+    CeedCallBackend(CeedStringAppend_Cpu_gen(code,
+                                             "    %sLVecStandard_Cpu(%" CeedInt_FMT ", %" CeedInt_FMT ", %" CeedInt_FMT ", elem, indices.%sputs[%" CeedInt_FMT
+                                             "], %s);\n",
+                                             direction, info->num_comp, info->comp_stride, info->elem_size, field_type, i, args));
+  } else {
+    CeedCallBackend(CeedStringAppend_Cpu_gen(code,
+                                             "    %sLVecStrided_Cpu(%" CeedInt_FMT ", %" CeedInt_FMT ", %" CeedInt_FMT ", %" CeedInt_FMT ", %" CeedInt_FMT
+                                             ", elem, %s);\n",
+                                             direction, info->num_comp, info->elem_size, info->strides[0], info->strides[1], info->strides[2], args));
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Build single operator kernel
+//------------------------------------------------------------------------------
+int CeedOperatorBuildKernel_Cpu_gen(CeedOperator op, bool *is_good_build) {
+  bool                  is_supported = true, is_at_points, is_fortran;
+  Ceed                  ceed;
+  CeedInt               Q, Q_1d = 0, dim = 0, num_input_fields, num_output_fields, work_size = 0, offset;
+  char                 *code = NULL, *operator_name = NULL;
+  const char           *source_path, *kernel_name;
+  CeedQFunctionField   *qf_input_fields, *qf_output_fields;
+  CeedQFunction         qf;
+  CeedOperatorField    *op_input_fields, *op_output_fields;
+  CeedFieldInfo_Cpu_gen input_info[CEED_FIELD_MAX], output_info[CEED_FIELD_MAX];
+  CeedOperator_Cpu_gen *data;
+
+  CeedCallBackend(CeedOperatorGetData(op, &data));
+  {
+    bool is_setup_done;
+
+    CeedCallBackend(CeedOperatorIsSetupDone(op, &is_setup_done));
+    if (is_setup_done) {
+      *is_good_build = !data->use_fallback;
+      return CEED_ERROR_SUCCESS;
+    }
+  }
+
+  // Check field compatibility
+  CeedCallBackend(CeedOperatorGetCeed(op, &ceed));
+  CeedCallBackend(CeedOperatorGetQFunction(op, &qf));
+  CeedCallBackend(CeedQFunctionGetSourcePath(qf, &source_path));
+  CeedCallBackend(CeedQFunctionGetKernelName(qf, &kernel_name));
+  CeedCallBackend(CeedOperatorIsAtPoints(op, &is_at_points));
+  CeedCallBackend(CeedQFunctionIsFortran(qf, &is_fortran));
+  CeedCallBackend(CeedOperatorGetFields(op, &num_input_fields, &op_input_fields, &num_output_fields, &op_output_fields));
+  CeedCallBackend(CeedQFunctionGetFields(qf, NULL, &qf_input_fields, NULL, &qf_output_fields));
+  // -- Fortran QFunctions do not run the C source
+  is_supported = source_path && !is_at_points && !is_fortran;
+  for (CeedInt i = 0; i < num_input_fields && is_supported; i++) {
+    CeedCallBackend(CeedOperatorFieldGetInfo_Cpu_gen(op_input_fields[i], qf_input_fields[i], &dim, &Q_1d, &input_info[i], &is_supported));
+  }
+  for (CeedInt i = 0; i < num_output_fields && is_supported; i++) {
+    CeedCallBackend(CeedOperatorFieldGetInfo_Cpu_gen(op_output_fields[i], qf_output_fields[i], &dim, &Q_1d, &output_info[i], &is_supported));
+    is_supported = is_supported && output_info[i].eval_mode != CEED_EVAL_WEIGHT;
+  }
+  // -- Fallback to /cpu/self/opt/blocked for unsupported operators
+  if (!is_supported) {
+    CeedDebug(ceed, "Operator not supported by /cpu/self/gen, using fallback");
+    data->use_fallback = true;
+    *is_good_build     = false;
+    CeedCallBackend(CeedOperatorSetSetupDone(op));
+    CeedCallBackend(CeedDestroy(&ceed));
+    CeedCallBackend(CeedQFunctionDestroy(&qf));
+    return CEED_ERROR_SUCCESS;
+  }
+  CeedCallBackend(CeedOperatorGetNumQuadraturePoints(op, &Q));
+
+  // Basis matrices and work array size
+  for (CeedInt i = 0; i < num_input_fields + num_output_fields; i++) {
+    const bool                   is_input = i < num_input_fields;
+    const CeedInt                j        = is_input ? i : i - num_input_fields;
+    const CeedFieldInfo_Cpu_gen *info     = is_input ? &input_info[j] : &output_info[j];
+    CeedBasis                    basis;
+    const CeedScalar            *B = NULL, *G = NULL;
+
+    CeedCallBackend(CeedOperatorFieldGetBasis(is_input ? op_input_fields[j] : op_output_fields[j], &basis));
+    switch (info->eval_mode) {
+      case CEED_EVAL_GRAD:
+        CeedCallBackend(CeedBasisGetGrad1D(basis, &G));
+        // fall through
+      case CEED_EVAL_INTERP: {
+        CeedInt size = info->num_comp;
+
+        CeedCallBackend(CeedBasisGetInterp1D(basis, &B));
+        for (CeedInt d = 0; d < dim; d++) size *= CeedIntMax(info->P_1d, Q_1d);
+        work_size = CeedIntMax(work_size, size);
+      } break;
+      case CEED_EVAL_WEIGHT:
+        CeedCallBackend(CeedBasisGetQWeights(basis, &B));
+        break;
+      default:
+        break;
+    }
+    if (is_input) {
+      data->B.inputs[j] = B;
+      data->G.inputs[j] = G;
+    } else {
+      data->B.outputs[j] = (CeedScalar *)B;
+      data->G.outputs[j] = (CeedScalar *)G;
+    }
+    CeedCallBackend(CeedBasisDestroy(&basis));
+  }
+
+  // Load template and user QFunction source
+  CeedCallBackend(CeedStringAppend_Cpu_gen(&code,
+                                           "// Standard headers, omitted from JiT source files when loaded\n"
+                                           "#include <math.h>\n"
+                                           "#include <stdbool.h>\n"
+                                           "#include <stddef.h>\n"
+                                           "#include <stdint.h>\n"
+                                           "#include <stdio.h>\n"
+                                           "#include <stdlib.h>\n"
+                                           "#include <string.h>\n\n"));
+  {
+    CeedInt     num_file_paths = 0;
+    char      **file_paths     = NULL;
+    const char *template_path;
+
+    CeedCallBackend(CeedGetJitAbsolutePath(ceed, "ceed/jit-source/cpu/cpu-gen-templates.h", &template_path));
+    CeedCallBackend(CeedStringAppend_Cpu_gen(&code, "// CodeGen operator source\n"));
+    CeedCallBackend(CeedLoadSourceToInitializedBuffer(ceed, template_path, &num_file_paths, &file_paths, &code));
+    CeedCallBackend(CeedStringAppend_Cpu_gen(&code, "\n// User QFunction source\n"));
+    CeedCallBackend(CeedLoadSourceToInitializedBuffer(ceed, source_path, &num_file_paths, &file_paths, &code));
+    for (CeedInt i = 0; i < num_file_paths; i++) CeedCallBackend(CeedFree(&file_paths[i]));
+    CeedCallBackend(CeedFree(&file_paths));
+    CeedCallBackend(CeedFree(&template_path));
+  }
+
+  // Kernel signature
+  CeedCallBackend(CeedStringAppend_Cpu_gen(&operator_name, "CeedKernelCpuGenOperator_%s", kernel_name));
+  CeedCallBackend(CeedStringAppend_Cpu_gen(&code,
+                                           "\n// -----------------------------------------------------------------------------\n"
+                                           "// Operator Kernel\n"
+                                           "//\n"
+                                           "// d_[in,out]_i:   CeedVector host array\n"
+                                           "// r_[in,out]_e_i: Element vector\n"
+                                           "// r_[in,out]_q_i: Quadrature space vector\n"
+                                           "// r_t:            Tensor contraction work arrays\n"
+                                           "// -----------------------------------------------------------------------------\n"
+                                           "int %s(CeedInt num_elem, void *ctx, FieldsInt_Cpu indices, Fields_Cpu fields, Fields_Cpu B, Fields_Cpu G) {\n",
+                                           operator_name));
+
+  // Work arrays
+  {
+    CeedInt total_size = 2 * work_size;
+
+    for (CeedInt i = 0; i < num_input_fields + num_output_fields; i++) {
+      const CeedFieldInfo_Cpu_gen *info = i < num_input_fields ? &input_info[i] : &output_info[i - num_input_fields];
+
+      if (info->eval_mode == CEED_EVAL_INTERP || info->eval_mode == CEED_EVAL_GRAD) total_size += info->num_comp * CeedIntPow(info->P_1d, dim);
+      total_size += info->size * Q;
+    }
+    CeedCallBackend(CeedStringAppend_Cpu_gen(&code,
+                                             "  const CeedInt Q      = %" CeedInt_FMT ";\n"
+                                             "  CeedScalar   *r_work = (CeedScalar *)malloc(%" CeedInt_FMT " * sizeof(CeedScalar));\n"
+                                             "  CeedScalar   *r_t    = r_work;\n\n"
+                                             "  if (!r_work) return 1;\n",
+                                             Q, total_size));
+    offset = 2 * work_size;
+  }
+
+  // Input field setup
+  for (CeedInt i = 0; i < num_input_fields; i++) {
+    const CeedFieldInfo_Cpu_gen *info = &input_info[i];
+    const char                  *field_name;
+
+    CeedCallBackend(CeedQFunctionFieldGetName(qf_input_fields[i], &field_name));
+    CeedCallBackend(CeedStringAppend_Cpu_gen(&code, "  // -- Input field %" CeedInt_FMT ": %s\n", i, field_name));
+    if (info->eval_mode != CEED_EVAL_WEIGHT) {
+      CeedCallBackend(CeedStringAppend_Cpu_gen(&code, "  const CeedScalar *d_in_%" CeedInt_FMT " = fields.inputs[%" CeedInt_FMT "];\n", i, i));
+    }
+    if (info->eval_mode == CEED_EVAL_INTERP || info->eval_mode == CEED_EVAL_GRAD) {
+      CeedCallBackend(CeedStringAppend_Cpu_gen(&code, "  CeedScalar *r_in_e_%" CeedInt_FMT " = &r_work[%" CeedInt_FMT "];\n", i, offset));
+      offset += info->num_comp * CeedIntPow(info->P_1d, dim);
+    }
+    CeedCallBackend(CeedStringAppend_Cpu_gen(&code, "  CeedScalar *r_in_q_%" CeedInt_FMT " = &r_work[%" CeedInt_FMT "];\n", i, offset));
+    offset += info->size * Q;
+    if (info->eval_mode == CEED_EVAL_WEIGHT) {
+      CeedCallBackend(CeedStringAppend_Cpu_gen(&code, "  WeightTensor_Cpu(%" CeedInt_FMT ", %" CeedInt_FMT ", B.inputs[%" CeedInt_FMT "], r_in_q_%" CeedInt_FMT ");\n",
+                                               dim, Q_1d, i, i));
+    }
+  }
+
+  // Output field setup
+  for (CeedInt i = 0; i < num_output_fields; i++) {
+    const CeedFieldInfo_Cpu_gen *info = &output_info[i];
+    const char                  *field_name;
+
+    CeedCallBackend(CeedQFunctionFieldGetName(qf_output_fields[i], &field_name));
+    CeedCallBackend(CeedStringAppend_Cpu_gen(&code, "  // -- Output field %" CeedInt_FMT ": %s\n", i, field_name));
+    CeedCallBackend(CeedStringAppend_Cpu_gen(&code, "  CeedScalar *d_out_%" CeedInt_FMT " = fields.outputs[%" CeedInt_FMT "];\n", i, i));
+    if (info->eval_mode == CEED_EVAL_INTERP || info->eval_mode == CEED_EVAL_GRAD) {
+      CeedCallBackend(CeedStringAppend_Cpu_gen(&code, "  CeedScalar *r_out_e_%" CeedInt_FMT " = &r_work[%" CeedInt_FMT "];\n", i, offset));
+      offset += info->num_comp * CeedIntPow(info->P_1d, dim);
+    }
+    CeedCallBackend(CeedStringAppend_Cpu_gen(&code, "  CeedScalar *r_out_q_%" CeedInt_FMT " = &r_work[%" CeedInt_FMT "];\n", i, offset));
+    offset += info->size * Q;
+  }
+
+  // Element loop
+  CeedCallBackend(CeedStringAppend_Cpu_gen(&code, "\n  for (CeedInt elem = 0; elem < num_elem; elem++) {\n"));
+  for (CeedInt i = 0; i < num_input_fields; i++) {
+    const CeedFieldInfo_Cpu_gen *info = &input_info[i];
+    char                         r_e_name[32], r_q_name[32];
+
+    if (info->eval_mode == CEED_EVAL_WEIGHT) continue;
+    snprintf(r_e_name, sizeof(r_e_name), "r_in_e_%" CeedInt_FMT, i);
+    snprintf(r_q_name, sizeof(r_q_name), "r_in_q_%" CeedInt_FMT, i);
+    CeedCallBackend(CeedStringAppend_Cpu_gen(&code, "    // ---- Input field %" CeedInt_FMT "\n", i));
+    switch (info->eval_mode) {
+      case CEED_EVAL_NONE:
+        CeedCallBackend(CeedOperatorBuildKernelRestriction_Cpu_gen(&code, i, true, info, r_q_name));
+        break;
+      case CEED_EVAL_INTERP:
+        CeedCallBackend(CeedOperatorBuildKernelRestriction_Cpu_gen(&code, i, true, info, r_e_name));
+        CeedCallBackend(CeedStringAppend_Cpu_gen(&code,
+                                                 "    InterpTensor_Cpu(%" CeedInt_FMT ", %" CeedInt_FMT ", %" CeedInt_FMT ", %" CeedInt_FMT
+                                                 ", B.inputs[%" CeedInt_FMT "], %s, %s, r_t);\n",
+                                                 dim, info->num_comp, info->P_1d, Q_1d, i, r_e_name, r_q_name));
+        break;
+      case CEED_EVAL_GRAD:
+        CeedCallBackend(CeedOperatorBuildKernelRestriction_Cpu_gen(&code, i, true, info, r_e_name));
+        CeedCallBackend(CeedStringAppend_Cpu_gen(&code,
+                                                 "    GradTensor_Cpu(%" CeedInt_FMT ", %" CeedInt_FMT ", %" CeedInt_FMT ", %" CeedInt_FMT
+                                                 ", B.inputs[%" CeedInt_FMT "], G.inputs[%" CeedInt_FMT "], %s, %s, r_t);\n",
+                                                 dim, info->num_comp, info->P_1d, Q_1d, i, i, r_e_name, r_q_name));
+        break;
+      default:
+        break;
+    }
+  }
+
+  // -- QFunction
+  CeedCallBackend(CeedStringAppend_Cpu_gen(&code, "    // ---- QFunction\n    {\n      const CeedScalar *in[%" CeedInt_FMT "] = {",
+                                           CeedIntMax(num_input_fields, 1)));
+  for (CeedInt i = 0; i < num_input_fields; i++) {
+    CeedCallBackend(CeedStringAppend_Cpu_gen(&code, "%sr_in_q_%" CeedInt_FMT, i ? ", " : "", i));
+  }
+  CeedCallBackend(CeedStringAppend_Cpu_gen(&code, "};\n      CeedScalar       *out[%" CeedInt_FMT "] = {", CeedIntMax(num_output_fields, 1)));
+  for (CeedInt i = 0; i < num_output_fields; i++) {
+    CeedCallBackend(CeedStringAppend_Cpu_gen(&code, "%sr_out_q_%" CeedInt_FMT, i ? ", " : "", i));
+  }
+  CeedCallBackend(CeedStringAppend_Cpu_gen(&code,
+                                           "};\n      const int ierr = %s(ctx, Q, in, out);\n\n"
+                                           "      if (ierr) {\n        free(r_work);\n        return ierr;\n      }\n    }\n",
+                                           kernel_name));
+
+  // -- Outputs
+  for (CeedInt i = 0; i < num_output_fields; i++) {
+    const CeedFieldInfo_Cpu_gen *info = &output_info[i];
+    char                         r_e_name[32], r_q_name[32];
+
+    snprintf(r_e_name, sizeof(r_e_name), "r_out_e_%" CeedInt_FMT, i);
+    snprintf(r_q_name, sizeof(r_q_name), "r_out_q_%" CeedInt_FMT, i);
+    CeedCallBackend(CeedStringAppend_Cpu_gen(&code, "    // ---- Output field %" CeedInt_FMT "\n", i));
+    switch (info->eval_mode) {
+      case CEED_EVAL_NONE:
+        CeedCallBackend(CeedOperatorBuildKernelRestriction_Cpu_gen(&code, i, false, info, r_q_name));
+        break;
+      case CEED_EVAL_INTERP:
+        CeedCallBackend(CeedStringAppend_Cpu_gen(&code,
+                                                 "    InterpTransposeTensor_Cpu(%" CeedInt_FMT ", %" CeedInt_FMT ", %" CeedInt_FMT ", %" CeedInt_FMT
+                                                 ", B.outputs[%" CeedInt_FMT "], %s, %s, r_t);\n",
+                                                 dim, info->num_comp, info->P_1d, Q_1d, i, r_q_name, r_e_name));
+        CeedCallBackend(CeedOperatorBuildKernelRestriction_Cpu_gen(&code, i, false, info, r_e_name));
+        break;
+      case CEED_EVAL_GRAD:
+        CeedCallBackend(CeedStringAppend_Cpu_gen(&code,
+                                                 "    GradTransposeTensor_Cpu(%" CeedInt_FMT ", %" CeedInt_FMT ", %" CeedInt_FMT ", %" CeedInt_FMT
+                                                 ", B.outputs[%" CeedInt_FMT "], G.outputs[%" CeedInt_FMT "], %s, %s, r_t);\n",
+                                                 dim, info->num_comp, info->P_1d, Q_1d, i, i, r_q_name, r_e_name));
+        CeedCallBackend(CeedOperatorBuildKernelRestriction_Cpu_gen(&code, i, false, info, r_e_name));
+        break;
+      default:
+        break;
+    }
+  }
+  CeedCallBackend(CeedStringAppend_Cpu_gen(&code, "  }\n  free(r_work);\n  return 0;\n}\n"));
+
+  // Compile
+  {
+    bool is_compile_good = false;
+
+    CeedCallBackend(CeedTryCompile_Cpu_gen(ceed, code, &is_compile_good, &data->module));
+    if (is_compile_good) {
+      CeedCallBackend(CeedGetKernel_Cpu_gen(ceed, data->module, operator_name, (void **)&data->op));
+    } else {
+      data->use_fallback = true;
+    }
+  }
+  *is_good_build = !data->use_fallback;
+  CeedCallBackend(CeedOperatorSetSetupDone(op));
+  CeedCallBackend(CeedFree(&code));
+  CeedCallBackend(CeedFree(&operator_name));
+  CeedCallBackend(CeedDestroy(&ceed));
+  CeedCallBackend(CeedQFunctionDestroy(&qf));
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
@@ -0,0 +1,177 @@
+// Copyright (c) 2017-2025, Lawrence Livermore National Security, LLC and other CEED contributors.
+// All Rights Reserved. See the top-level LICENSE and NOTICE files for details.
+//
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// This file is part of CEED:  http://github.com/ceed
+
+#include <ceed.h>
+#include <ceed/backend.h>
+#include <dlfcn.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "ceed-cpu-gen-operator-build.h"
+#include "ceed-cpu-gen.h"
+
+//------------------------------------------------------------------------------
+// Destroy operator
+//------------------------------------------------------------------------------
+static int CeedOperatorDestroy_Cpu_gen(CeedOperator op) {
+  CeedOperator_Cpu_gen *impl;
+
+  CeedCallBackend(CeedOperatorGetData(op, &impl));
+  if (impl->module) dlclose(impl->module);
+  CeedCallBackend(CeedFree(&impl));
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Apply and add to output
+//------------------------------------------------------------------------------
+static int CeedOperatorApplyAdd_Cpu_gen(CeedOperator op, CeedVector input_vec, CeedVector output_vec, CeedRequest *request) {
+  bool                  is_good_build = false, is_structured;
+  Ceed                  ceed;
+  CeedInt               num_elem, num_input_fields, num_output_fields;
+  CeedEvalMode          eval_mode;
+  void                 *qf_ctx = NULL;
+  const CeedScalar     *input_arr  = NULL;
+  CeedScalar           *output_arr = NULL;
+  CeedVector            output_vecs[CEED_FIELD_MAX] = {NULL};
+  CeedQFunctionField   *qf_input_fields, *qf_output_fields;
+  CeedQFunction         qf;
+  CeedOperatorField    *op_input_fields, *op_output_fields;
+  FieldsInt_Cpu         indices = {{NULL}, {NULL}};
+  Fields_Cpu            fields  = {{NULL}, {NULL}};
+  CeedOperator_Cpu_gen *data;
+
+  // Build the operator kernel, falling back on unsupported operators or compiler failure
+  CeedCallBackend(CeedOperatorBuildKernel_Cpu_gen(op, &is_good_build));
+  if (!is_good_build) {
+    CeedOperator op_fallback;
+
+    CeedDebug256(CeedOperatorReturnCeed(op), CEED_DEBUG_COLOR_SUCCESS, "Falling back to /cpu/self/opt/blocked CeedOperator");
+    CeedCallBackend(CeedOperatorGetFallback(op, &op_fallback));
+    CeedCallBackend(CeedOperatorApplyAdd(op_fallback, input_vec, output_vec, request));
+    return CEED_ERROR_SUCCESS;
+  }
+
+  CeedCallBackend(CeedOperatorGetCeed(op, &ceed));
+  CeedCallBackend(CeedOperatorGetData(op, &data));
+  CeedCallBackend(CeedOperatorGetQFunction(op, &qf));
+  CeedCallBackend(CeedOperatorGetNumElements(op, &num_elem));
+  CeedCallBackend(CeedOperatorGetFields(op, &num_input_fields, &op_input_fields, &num_output_fields, &op_output_fields));
+  CeedCallBackend(CeedQFunctionGetFields(qf, NULL, &qf_input_fields, NULL, &qf_output_fields));
+  if (input_vec != CEED_VECTOR_NONE) CeedCallBackend(CeedVectorGetArrayRead(input_vec, CEED_MEM_HOST, &input_arr));
+  if (output_vec != CEED_VECTOR_NONE) CeedCallBackend(CeedVectorGetArray(output_vec, CEED_MEM_HOST, &output_arr));
+
+  // Input vectors and offsets
+  for (CeedInt i = 0; i < num_input_fields; i++) {
+    CeedCallBackend(CeedQFunctionFieldGetEvalMode(qf_input_fields[i], &eval_mode));
+    if (eval_mode != CEED_EVAL_WEIGHT) {
+      CeedVector          vec;
+      CeedElemRestriction rstr;
+      CeedRestrictionType rstr_type;
+
+      CeedCallBackend(CeedOperatorFieldGetVector(op_input_fields[i], &vec));
+      if (vec == CEED_VECTOR_ACTIVE) fields.inputs[i] = input_arr;
+      else CeedCallBackend(CeedVectorGetArrayRead(vec, CEED_MEM_HOST, &fields.inputs[i]));
+      CeedCallBackend(CeedVectorDestroy(&vec));
+      CeedCallBackend(CeedOperatorFieldGetElemRestriction(op_input_fields[i], &rstr));
+      CeedCallBackend(CeedElemRestrictionGetType(rstr, &rstr_type));
+      CeedCallBackend(CeedElemRestrictionIsStructured(rstr, &is_structured));
+      if (rstr_type == CEED_RESTRICTION_STANDARD && !is_structured) {
+        CeedCallBackend(CeedElemRestrictionGetOffsets(rstr, CEED_MEM_HOST, &indices.inputs[i]));
+      }
+      CeedCallBackend(CeedElemRestrictionDestroy(&rstr));
+    }
+  }
+
+  // Output vectors and offsets
+  for (CeedInt i = 0; i < num_output_fields; i++) {
+    CeedVector          vec;
+    CeedElemRestriction rstr;
+    CeedRestrictionType rstr_type;
+
+    CeedCallBackend(CeedOperatorFieldGetVector(op_output_fields[i], &vec));
+    if (vec == CEED_VECTOR_ACTIVE) {
+      fields.outputs[i] = output_arr;
+    } else {
+      // Passive output vectors may be shared between fields
+      for (CeedInt j = 0; j < i; j++) {
+        if (output_vecs[j] == vec) fields.outputs[i] = fields.outputs[j];
+      }
+      if (!fields.outputs[i]) {
+        CeedCallBackend(CeedVectorGetArray(vec, CEED_MEM_HOST, &fields.outputs[i]));
+        CeedCallBackend(CeedVectorReferenceCopy(vec, &output_vecs[i]));
+      }
+    }
+    CeedCallBackend(CeedVectorDestroy(&vec));
+    CeedCallBackend(CeedOperatorFieldGetElemRestriction(op_output_fields[i], &rstr));
+    CeedCallBackend(CeedElemRestrictionGetType(rstr, &rstr_type));
+    CeedCallBackend(CeedElemRestrictionIsStructured(rstr, &is_structured));
+    if (rstr_type == CEED_RESTRICTION_STANDARD && !is_structured) {
+      CeedCallBackend(CeedElemRestrictionGetOffsets(rstr, CEED_MEM_HOST, &indices.outputs[i]));
+    }
+    CeedCallBackend(CeedElemRestrictionDestroy(&rstr));
+  }
+
+  // Apply operator
+  CeedCallBackend(CeedQFunctionGetInnerContextData(qf, CEED_MEM_HOST, &qf_ctx));
+  {
+    const int ierr = data->op(num_elem, qf_ctx, indices, fields, data->B, data->G);
+
+    CeedCheck(!ierr, ceed, CEED_ERROR_BACKEND, "JiT operator kernel returned error code %d", ierr);
+  }
+  CeedCallBackend(CeedQFunctionRestoreInnerContextData(qf, &qf_ctx));
+
+  // Restore arrays and offsets
+  for (CeedInt i = 0; i < num_input_fields; i++) {
+    CeedCallBackend(CeedQFunctionFieldGetEvalMode(qf_input_fields[i], &eval_mode));
+    if (eval_mode != CEED_EVAL_WEIGHT) {
+      CeedVector          vec;
+      CeedElemRestriction rstr;
+
+      CeedCallBackend(CeedOperatorFieldGetVector(op_input_fields[i], &vec));
+      if (vec != CEED_VECTOR_ACTIVE) CeedCallBackend(CeedVectorRestoreArrayRead(vec, &fields.inputs[i]));
+      CeedCallBackend(CeedVectorDestroy(&vec));
+      CeedCallBackend(CeedOperatorFieldGetElemRestriction(op_input_fields[i], &rstr));
+      if (indices.inputs[i]) CeedCallBackend(CeedElemRestrictionRestoreOffsets(rstr, &indices.inputs[i]));
+      CeedCallBackend(CeedElemRestrictionDestroy(&rstr));
+    }
+  }
+  for (CeedInt i = 0; i < num_output_fields; i++) {
+    CeedElemRestriction rstr;
+
+    if (output_vecs[i]) {
+      CeedCallBackend(CeedVectorRestoreArray(output_vecs[i], &fields.outputs[i]));
+      CeedCallBackend(CeedVectorDestroy(&output_vecs[i]));
+    }
+    CeedCallBackend(CeedOperatorFieldGetElemRestriction(op_output_fields[i], &rstr));
+    if (indices.outputs[i]) CeedCallBackend(CeedElemRestrictionRestoreOffsets(rstr, &indices.outputs[i]));
+    CeedCallBackend(CeedElemRestrictionDestroy(&rstr));
+  }
+  if (input_vec != CEED_VECTOR_NONE) CeedCallBackend(CeedVectorRestoreArrayRead(input_vec, &input_arr));
+  if (output_vec != CEED_VECTOR_NONE) CeedCallBackend(CeedVectorRestoreArray(output_vec, &output_arr));
+  CeedCallBackend(CeedDestroy(&ceed));
+  CeedCallBackend(CeedQFunctionDestroy(&qf));
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Create operator
+//------------------------------------------------------------------------------
+int CeedOperatorCreate_Cpu_gen(CeedOperator op) {
+  Ceed                  ceed;
+  CeedOperator_Cpu_gen *impl;
+
+  CeedCallBackend(CeedOperatorGetCeed(op, &ceed));
+  CeedCallBackend(CeedCalloc(1, &impl));
+  CeedCallBackend(CeedOperatorSetData(op, impl));
+  CeedCallBackend(CeedSetBackendFunction(ceed, "Operator", op, "ApplyAdd", CeedOperatorApplyAdd_Cpu_gen));
+  CeedCallBackend(CeedSetBackendFunction(ceed, "Operator", op, "Destroy", CeedOperatorDestroy_Cpu_gen));
+  CeedCallBackend(CeedDestroy(&ceed));
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
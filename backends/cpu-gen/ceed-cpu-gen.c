@@ -0,0 +1,40 @@
+// Copyright (c) 2017-2025, Lawrence Livermore National Security, LLC and other CEED contributors.
+// All Rights Reserved. See the top-level LICENSE and NOTICE files for details.
+//
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// This file is part of CEED:  http://github.com/ceed
+
+#include "ceed-cpu-gen.h"
+
+#include <ceed.h>
+#include <ceed/backend.h>
+#include <string.h>
+
+//------------------------------------------------------------------------------
+// Backend init
+//------------------------------------------------------------------------------
+static int CeedInit_Cpu_gen(const char *resource, Ceed ceed) {
+  Ceed ceed_opt;
+
+  CeedCheck(!strcmp(resource, "/cpu/self") || !strcmp(resource, "/cpu/self/gen"), ceed, CEED_ERROR_BACKEND, "Cpu gen backend cannot use resource: %s",
+            resource);
+  CeedCallBackend(CeedSetDeterministic(ceed, true));
+
+  // Create optimized Ceed that implementation will be dispatched through unless overridden
+  CeedCallBackend(CeedInit("/cpu/self/opt/serial", &ceed_opt));
+  CeedCallBackend(CeedSetDelegate(ceed, ceed_opt));
+  CeedCallBackend(CeedDestroy(&ceed_opt));
+
+  CeedCallBackend(CeedSetOperatorFallbackResource(ceed, "/cpu/self/opt/blocked"));
+
+  CeedCallBackend(CeedSetBackendFunction(ceed, "Ceed", ceed, "OperatorCreate", CeedOperatorCreate_Cpu_gen));
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Register backend
+//------------------------------------------------------------------------------
+CEED_INTERN int CeedRegister_Cpu_Gen(void) { return CeedRegister("/cpu/self/gen", CeedInit_Cpu_gen, 70); }
+
+//------------------------------------------------------------------------------
@@ -0,0 +1,21 @@
+// Copyright (c) 2017-2025, Lawrence Livermore National Security, LLC and other CEED contributors.
+// All Rights Reserved. See the top-level LICENSE and NOTICE files for details.
+//
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// This file is part of CEED:  http://github.com/ceed
+#pragma once
+
+#include <ceed.h>
+#include <ceed/backend.h>
+#include <ceed/jit-source/cpu/cpu-types.h>
+
+typedef struct {
+  bool                   use_fallback;
+  void                  *module;
+  CeedOperatorKernel_Cpu op;
+  Fields_Cpu             B;
+  Fields_Cpu             G;
+} CeedOperator_Cpu_gen;
+
+CEED_INTERN int CeedOperatorCreate_Cpu_gen(CeedOperator op);
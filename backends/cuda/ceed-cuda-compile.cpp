@@ -31,13 +31,20 @@
     CeedChk_Nvrtc(ceed, ierr_q_); \
   } while (0)
 
+// JiT cache entries hold SASS when NVRTC can emit it, otherwise PTX
+#if CUDA_VERSION >= 11010
+#define CEED_CUDA_JIT_CACHE_SUFFIX ".cubin"
+#else
+#define CEED_CUDA_JIT_CACHE_SUFFIX ".ptx"
+#endif
+
 //------------------------------------------------------------------------------
 // Compile CUDA kernel
 //------------------------------------------------------------------------------
 static int CeedCompileCore_Cuda(Ceed ceed, const char *source, const bool throw_error, bool *is_compile_good, CUmodule *module,
                                 const CeedInt num_defines, va_list args) {
   size_t                ptx_size;
-  char                 *ptx;
+  char                 *ptx, *cache_key = NULL;
   const int             num_opts            = 4;
   CeedInt               num_jit_source_dirs = 0, num_jit_defines = 0;
   const char          **opts;
@@ -115,6 +122,35 @@ static int CeedCompileCore_Cuda(Ceed ceed, const char *source, const bool throw_
   // Add string source argument provided in call
   code << source;
 
+  // Load from JiT cache, if available
+  {
+    bool               is_hit;
+    int                rtc_major, rtc_minor;
+    size_t             cached_size;
+    char              *cached_code;
+    std::ostringstream compiler_info;
+
+    CeedCallNvrtc(ceed, nvrtcVersion(&rtc_major, &rtc_minor));
+    compiler_info << "nvrtc " << rtc_major << "." << rtc_minor;
+    for (CeedInt i = 0; i < num_opts + num_jit_source_dirs + num_jit_defines; i++) compiler_info << " " << opts[i];
+    CeedCallBackend(CeedJitCacheGetKey(ceed, code.str().c_str(), compiler_info.str().c_str(), &cache_key));
+    CeedCallBackend(CeedJitCacheRead(ceed, cache_key, CEED_CUDA_JIT_CACHE_SUFFIX, &is_hit, &cached_size, &cached_code));
+    if (is_hit) {
+      for (CeedInt i = 0; i < num_jit_source_dirs; i++) {
+        CeedCallBackend(CeedFree(&opts[num_opts + i]));
+      }
+      for (CeedInt i = 0; i < num_jit_defines; i++) {
+        CeedCallBackend(CeedFree(&opts[num_opts + num_jit_source_dirs + i]));
+      }
+      CeedCallBackend(CeedFree(&opts));
+      CeedCallBackend(CeedFree(&cache_key));
+      CeedCallCuda(ceed, cuModuleLoadData(module, cached_code));
+      CeedCallBackend(CeedFree(&cached_code));
+      *is_compile_good = true;
+      return CEED_ERROR_SUCCESS;
+    }
+  }
+
   // Create Program
   CeedCallNvrtc(ceed, nvrtcCreateProgram(&prog, code.str().c_str(), NULL, 0, NULL, NULL));
 
@@ -157,6 +193,7 @@ static int CeedCompileCore_Cuda(Ceed ceed, const char *source, const bool throw_
       CeedDebug(ceed, "Error: %s\nCompile log:\n%s\n", nvrtcGetErrorString(result), log);
       CeedDebug256(ceed, CEED_DEBUG_COLOR_ERROR, "---------- BACKEND MAY FALLBACK ----------\n");
       CeedCallBackend(CeedFree(&log));
+      CeedCallBackend(CeedFree(&cache_key));
       CeedCallNvrtc(ceed, nvrtcDestroyProgram(&prog));
       return CEED_ERROR_SUCCESS;
       // LCOV_EXCL_STOP
@@ -174,6 +211,9 @@ static int CeedCompileCore_Cuda(Ceed ceed, const char *source, const bool throw_
 #endif
   CeedCallNvrtc(ceed, nvrtcDestroyProgram(&prog));
 
+  CeedCallBackend(CeedJitCacheWrite(ceed, cache_key, CEED_CUDA_JIT_CACHE_SUFFIX, ptx_size, ptx));
+  CeedCallBackend(CeedFree(&cache_key));
+
   CeedCallCuda(ceed, cuModuleLoadData(module, ptx));
   CeedCallBackend(CeedFree(&ptx));
   return CEED_ERROR_SUCCESS;
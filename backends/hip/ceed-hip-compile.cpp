@@ -36,7 +36,7 @@
 static int CeedCompileCore_Hip(Ceed ceed, const char *source, const bool throw_error, bool *is_compile_good, hipModule_t *module,
                                const CeedInt num_defines, va_list args) {
   size_t                 ptx_size;
-  char                  *ptx;
+  char                  *ptx, *cache_key = NULL;
   const int              num_opts            = 4;
   CeedInt                num_jit_source_dirs = 0, num_jit_defines = 0;
   const char           **opts;
@@ -117,6 +117,35 @@ static int CeedCompileCore_Hip(Ceed ceed, const char *source, const bool throw_e
   // Add string source argument provided in call
   code << source;
 
+  // Load from JiT cache, if available
+  {
+    bool               is_hit;
+    int                rtc_major, rtc_minor;
+    size_t             cached_size;
+    char              *cached_code;
+    std::ostringstream compiler_info;
+
+    CeedCallHiprtc(ceed, hiprtcVersion(&rtc_major, &rtc_minor));
+    compiler_info << "hiprtc " << rtc_major << "." << rtc_minor;
+    for (CeedInt i = 0; i < num_opts + num_jit_source_dirs + num_jit_defines; i++) compiler_info << " " << opts[i];
+    CeedCallBackend(CeedJitCacheGetKey(ceed, code.str().c_str(), compiler_info.str().c_str(), &cache_key));
+    CeedCallBackend(CeedJitCacheRead(ceed, cache_key, ".hsaco", &is_hit, &cached_size, &cached_code));
+    if (is_hit) {
+      for (CeedInt i = 0; i < num_jit_source_dirs; i++) {
+        CeedCallBackend(CeedFree(&opts[num_opts + i]));
+      }
+      for (CeedInt i = 0; i < num_jit_defines; i++) {
+        CeedCallBackend(CeedFree(&opts[num_opts + num_jit_source_dirs + i]));
+      }
+      CeedCallBackend(CeedFree(&opts));
+      CeedCallBackend(CeedFree(&cache_key));
+      CeedCallHip(ceed, hipModuleLoadData(module, cached_code));
+      CeedCallBackend(CeedFree(&cached_code));
+      *is_compile_good = true;
+      return CEED_ERROR_SUCCESS;
+    }
+  }
+
   // Create Program
   CeedCallHiprtc(ceed, hiprtcCreateProgram(&prog, code.str().c_str(), NULL, 0, NULL, NULL));
 
@@ -159,6 +188,7 @@ static int CeedCompileCore_Hip(Ceed ceed, const char *source, const bool throw_e
       CeedDebug(ceed, "Error: %s\nCompile log:\n%s\n", hiprtcGetErrorString(result), log);
       CeedDebug256(ceed, CEED_DEBUG_COLOR_ERROR, "---------- BACKEND MAY FALLBACK ----------\n");
       CeedCallBackend(CeedFree(&log));
+      CeedCallBackend(CeedFree(&cache_key));
       CeedCallHiprtc(ceed, hiprtcDestroyProgram(&prog));
       return CEED_ERROR_SUCCESS;
       // LCOV_EXCL_STOP
@@ -170,6 +200,9 @@ static int CeedCompileCore_Hip(Ceed ceed, const char *source, const bool throw_e
   CeedCallHiprtc(ceed, hiprtcGetCode(prog, ptx));
   CeedCallHiprtc(ceed, hiprtcDestroyProgram(&prog));
 
+  CeedCallBackend(CeedJitCacheWrite(ceed, cache_key, ".hsaco", ptx_size, ptx));
+  CeedCallBackend(CeedFree(&cache_key));
+
   CeedCallHip(ceed, hipModuleLoadData(module, ptx));
   CeedCallBackend(CeedFree(&ptx));
   return CEED_ERROR_SUCCESS;
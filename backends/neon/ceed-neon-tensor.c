@@ -0,0 +1,206 @@
+// Copyright (c) 2017-2025, Lawrence Livermore National Security, LLC and other CEED contributors.
+// All Rights Reserved. See the top-level LICENSE and NOTICE files for details.
+//
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// This file is part of CEED:  http://github.com/ceed
+
+#include <arm_neon.h>
+#include <ceed.h>
+#include <ceed/backend.h>
+
+#include "ceed-neon.h"
+
+#ifdef CEED_SCALAR_IS_FP64
+#define W 2
+#define rtype float64x2_t
+#define loadu vld1q_f64
+#define storeu vst1q_f64
+#define set1 vdupq_n_f64
+// c += a * b
+#define fmadd(c, a, b) (c) = vfmaq_f64((c), (a), (b))
+#else
+#define W 4
+#define rtype float32x4_t
+#define loadu vld1q_f32
+#define storeu vst1q_f32
+#define set1 vdupq_n_f32
+// c += a * b
+#define fmadd(c, a, b) (c) = vfmaq_f32((c), (a), (b))
+#endif
+
+//------------------------------------------------------------------------------
+// Register Tile
+//   out[r * out_stride + k] += sum_b s[r * s_stride_r + b * s_stride_b] * w[b * w_stride_b + k], for r < num_rows and k < CV * W
+//------------------------------------------------------------------------------
+static inline void CeedTensorContract_Neon_Tile(CeedInt B, const CeedScalar *restrict s, CeedInt s_stride_r, CeedInt s_stride_b,
+                                                const CeedScalar *restrict w, CeedInt w_stride_b, CeedScalar *restrict out, CeedInt out_stride,
+                                                CeedInt num_rows, const CeedInt RR, const CeedInt CV) {
+  rtype vv[RR][CV];  // Output tile to be held in registers
+
+  for (CeedInt r = 0; r < num_rows; r++) {
+    for (CeedInt cv = 0; cv < CV; cv++) vv[r][cv] = loadu(&out[r * out_stride + cv * W]);
+  }
+  for (CeedInt b = 0; b < B; b++) {
+    rtype ww[CV];
+
+    for (CeedInt cv = 0; cv < CV; cv++) ww[cv] = loadu(&w[b * w_stride_b + cv * W]);
+    for (CeedInt r = 0; r < num_rows; r++) {  // unroll
+      const rtype sv = set1(s[r * s_stride_r + b * s_stride_b]);
+
+      for (CeedInt cv = 0; cv < CV; cv++) fmadd(vv[r][cv], sv, ww[cv]);  // unroll
+    }
+  }
+  for (CeedInt r = 0; r < num_rows; r++) {
+    for (CeedInt cv = 0; cv < CV; cv++) storeu(&out[r * out_stride + cv * W], vv[r][cv]);
+  }
+}
+
+//------------------------------------------------------------------------------
+// Tiled Rows
+//   Applies register tiles of RR rows and CV vectors of columns to R rows and K columns, with remaining columns one vector at a time
+//   and the final partial vector of columns in scalar arithmetic
+//------------------------------------------------------------------------------
+static inline int CeedTensorContract_Neon_Rows(CeedInt R, CeedInt K, CeedInt B, const CeedScalar *restrict s, CeedInt s_stride_r, CeedInt s_stride_b,
+                                               const CeedScalar *restrict w, CeedInt w_stride_b, CeedScalar *restrict out, CeedInt out_stride,
+                                               const CeedInt RR, const CeedInt CV) {
+  for (CeedInt r = 0; r < R; r += RR) {
+    const CeedInt num_rows = R - r < RR ? R - r : RR;
+    CeedInt       k        = 0;
+
+    if (num_rows == RR) {
+      for (; k + CV * W <= K; k += CV * W) {
+        CeedTensorContract_Neon_Tile(B, &s[r * s_stride_r], s_stride_r, s_stride_b, &w[k], w_stride_b, &out[r * out_stride + k], out_stride, RR, RR,
+                                     CV);
+      }
+    } else {
+      for (; k + CV * W <= K; k += CV * W) {
+        CeedTensorContract_Neon_Tile(B, &s[r * s_stride_r], s_stride_r, s_stride_b, &w[k], w_stride_b, &out[r * out_stride + k], out_stride,
+                                     num_rows, RR, CV);
+      }
+    }
+    for (; k + W <= K; k += W) {
+      CeedTensorContract_Neon_Tile(B, &s[r * s_stride_r], s_stride_r, s_stride_b, &w[k], w_stride_b, &out[r * out_stride + k], out_stride, num_rows,
+                                   RR, 1);
+    }
+    for (CeedInt i = r; i < r + num_rows; i++) {
+      for (CeedInt b = 0; b < B; b++) {
+        for (CeedInt kk = k; kk < K; kk++) out[i * out_stride + kk] += s[i * s_stride_r + b * s_stride_b] * w[b * w_stride_b + kk];
+      }
+    }
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Tensor Contract - Register Tile Shapes
+//------------------------------------------------------------------------------
+static int CeedTensorContract_Neon_Rows_4_4(CeedInt R, CeedInt K, CeedInt B, const CeedScalar *restrict s, CeedInt s_stride_r, CeedInt s_stride_b,
+                                            const CeedScalar *restrict w, CeedInt w_stride_b, CeedScalar *restrict out, CeedInt out_stride) {
+  return CeedTensorContract_Neon_Rows(R, K, B, s, s_stride_r, s_stride_b, w, w_stride_b, out, out_stride, 4, 4);
+}
+static int CeedTensorContract_Neon_Rows_8_2(CeedInt R, CeedInt K, CeedInt B, const CeedScalar *restrict s, CeedInt s_stride_r, CeedInt s_stride_b,
+                                            const CeedScalar *restrict w, CeedInt w_stride_b, CeedScalar *restrict out, CeedInt out_stride) {
+  return CeedTensorContract_Neon_Rows(R, K, B, s, s_stride_r, s_stride_b, w, w_stride_b, out, out_stride, 8, 2);
+}
+static int CeedTensorContract_Neon_Rows_2_8(CeedInt R, CeedInt K, CeedInt B, const CeedScalar *restrict s, CeedInt s_stride_r, CeedInt s_stride_b,
+                                            const CeedScalar *restrict w, CeedInt w_stride_b, CeedScalar *restrict out, CeedInt out_stride) {
+  return CeedTensorContract_Neon_Rows(R, K, B, s, s_stride_r, s_stride_b, w, w_stride_b, out, out_stride, 2, 8);
+}
+static int CeedTensorContract_Neon_Rows_6_4(CeedInt R, CeedInt K, CeedInt B, const CeedScalar *restrict s, CeedInt s_stride_r, CeedInt s_stride_b,
+                                            const CeedScalar *restrict w, CeedInt w_stride_b, CeedScalar *restrict out, CeedInt out_stride) {
+  return CeedTensorContract_Neon_Rows(R, K, B, s, s_stride_r, s_stride_b, w, w_stride_b, out, out_stride, 6, 4);
+}
+static int CeedTensorContract_Neon_Rows_4_2(CeedInt R, CeedInt K, CeedInt B, const CeedScalar *restrict s, CeedInt s_stride_r, CeedInt s_stride_b,
+                                            const CeedScalar *restrict w, CeedInt w_stride_b, CeedScalar *restrict out, CeedInt out_stride) {
+  return CeedTensorContract_Neon_Rows(R, K, B, s, s_stride_r, s_stride_b, w, w_stride_b, out, out_stride, 4, 2);
+}
+
+typedef int (*CeedTensorContractKernel_Neon)(CeedInt R, CeedInt K, CeedInt B, const CeedScalar *restrict s, CeedInt s_stride_r, CeedInt s_stride_b,
+                                             const CeedScalar *restrict w, CeedInt w_stride_b, CeedScalar *restrict out, CeedInt out_stride);
+
+// Tile shapes, with rows and vectors of columns of the output tile held in the 32 vector registers; the first is the default
+static const CeedTensorContractKernel_Neon ceed_neon_tiles[] = {
+    CeedTensorContract_Neon_Rows_4_4, CeedTensorContract_Neon_Rows_8_2, CeedTensorContract_Neon_Rows_2_8,
+    CeedTensorContract_Neon_Rows_6_4, CeedTensorContract_Neon_Rows_4_2,
+};
+
+//------------------------------------------------------------------------------
+// Tensor Contract Apply
+//------------------------------------------------------------------------------
+static int CeedTensorContractApply_Neon(CeedTensorContract contract, CeedInt A, CeedInt B, CeedInt C, CeedInt J, const CeedScalar *restrict t,
+                                        CeedTransposeMode t_mode, const CeedInt add, const CeedScalar *restrict u, CeedScalar *restrict v) {
+  CeedInt                       t_stride_0 = B, t_stride_1 = 1;
+  CeedTensorContract_Neon      *impl;
+  CeedTensorContractKernel_Neon kernel;
+
+  CeedCallBackend(CeedTensorContractGetData(contract, &impl));
+  kernel = ceed_neon_tiles[impl->tile];
+  if (t_mode == CEED_TRANSPOSE) {
+    t_stride_0 = 1;
+    t_stride_1 = J;
+  }
+
+  if (!add) {
+    for (CeedInt q = 0; q < A * J * C; q++) v[q] = (CeedScalar)0.0;
+  }
+
+  if (C == 1) {
+    // Serial C=1 Case, vectorized over rows of t with t transposed so rows are contiguous
+    CeedScalar t_b[B * J];
+
+    for (CeedInt b = 0; b < B; b++) {
+      for (CeedInt j = 0; j < J; j++) t_b[b * J + j] = t[j * t_stride_0 + b * t_stride_1];
+    }
+    kernel(A, J, B, u, B, 1, t_b, J, v, J);
+  } else {
+    // Vectorized over columns
+    for (CeedInt a = 0; a < A; a++) kernel(J, C, B, t, t_stride_0, t_stride_1, &u[a * B * C], C, &v[a * J * C], C);
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Tensor Contract Tile Shapes
+//------------------------------------------------------------------------------
+static int CeedTensorContractGetNumTiles_Neon(CeedTensorContract contract, CeedInt *num_tiles) {
+  *num_tiles = sizeof(ceed_neon_tiles) / sizeof(ceed_neon_tiles[0]);
+  return CEED_ERROR_SUCCESS;
+}
+
+static int CeedTensorContractSetTile_Neon(CeedTensorContract contract, CeedInt tile) {
+  CeedTensorContract_Neon *impl;
+
+  CeedCallBackend(CeedTensorContractGetData(contract, &impl));
+  impl->tile = tile;
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Tensor Contract Destroy
+//------------------------------------------------------------------------------
+static int CeedTensorContractDestroy_Neon(CeedTensorContract contract) {
+  CeedTensorContract_Neon *impl;
+
+  CeedCallBackend(CeedTensorContractGetData(contract, &impl));
+  CeedCallBackend(CeedFree(&impl));
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Tensor Contract Create
+//------------------------------------------------------------------------------
+int CeedTensorContractCreate_Neon(CeedTensorContract contract) {
+  Ceed                     ceed = CeedTensorContractReturnCeed(contract);
+  CeedTensorContract_Neon *impl;
+
+  CeedCallBackend(CeedCalloc(1, &impl));
+  CeedCallBackend(CeedTensorContractSetData(contract, impl));
+  CeedCallBackend(CeedSetBackendFunction(ceed, "TensorContract", contract, "Apply", CeedTensorContractApply_Neon));
+  CeedCallBackend(CeedSetBackendFunction(ceed, "TensorContract", contract, "GetNumTiles", CeedTensorContractGetNumTiles_Neon));
+  CeedCallBackend(CeedSetBackendFunction(ceed, "TensorContract", contract, "SetTile", CeedTensorContractSetTile_Neon));
+  CeedCallBackend(CeedSetBackendFunction(ceed, "TensorContract", contract, "Destroy", CeedTensorContractDestroy_Neon));
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
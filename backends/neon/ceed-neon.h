@@ -0,0 +1,16 @@
+// Copyright (c) 2017-2025, Lawrence Livermore National Security, LLC and other CEED contributors.
+// All Rights Reserved. See the top-level LICENSE and NOTICE files for details.
+//
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// This file is part of CEED:  http://github.com/ceed
+#pragma once
+
+#include <ceed.h>
+#include <ceed/backend.h>
+
+typedef struct {
+  CeedInt tile; /* Index of register tile shape */
+} CeedTensorContract_Neon;
+
+CEED_INTERN int CeedTensorContractCreate_Neon(CeedTensorContract contract);
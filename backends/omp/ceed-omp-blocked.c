@@ -0,0 +1,80 @@
+// Copyright (c) 2017-2025, Lawrence Livermore National Security, LLC and other CEED contributors.
+// All Rights Reserved. See the top-level LICENSE and NOTICE files for details.
+//
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// This file is part of CEED:  http://github.com/ceed
+
+#include <ceed.h>
+#include <ceed/backend.h>
+#include <omp.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "../opt/ceed-opt.h"
+#if defined(CEED_OMP_USE_AVX)
+#include "../avx/ceed-avx.h"
+#endif
+#if defined(CEED_OMP_USE_AVX512)
+#include "../avx512/ceed-avx512.h"
+#endif
+#if defined(CEED_OMP_USE_NEON)
+#include "../neon/ceed-neon.h"
+#endif
+
+//------------------------------------------------------------------------------
+// Backend Destroy
+//------------------------------------------------------------------------------
+static int CeedDestroy_Omp(Ceed ceed) {
+  Ceed_Opt *data;
+
+  CeedCallBackend(CeedGetData(ceed, &data));
+  CeedCallBackend(CeedFree(&data));
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Backend Init
+//------------------------------------------------------------------------------
+static int CeedInit_Omp_Blocked(const char *resource, Ceed ceed) {
+  int (*tensor_contract_create)(CeedTensorContract) = CeedTensorContractCreate_Opt;
+  Ceed      ceed_ref;
+  Ceed_Opt *data;
+
+  CeedCheck(!strcmp(resource, "/cpu/self") || !strcmp(resource, "/cpu/self/omp") || !strcmp(resource, "/cpu/self/omp/blocked"), ceed,
+            CEED_ERROR_BACKEND, "OpenMP backend cannot use resource: %s", resource);
+  CeedCallBackend(CeedSetDeterministic(ceed, true));
+
+  // Create reference Ceed that implementation will be dispatched through unless overridden
+  CeedCallBackend(CeedInit("/cpu/self/ref/serial", &ceed_ref));
+  CeedCallBackend(CeedSetDelegate(ceed, ceed_ref));
+  CeedCallBackend(CeedDestroy(&ceed_ref));
+
+  // Use the fastest tensor contraction compiled and supported by this CPU, as the SIMD backends do
+#if defined(CEED_OMP_USE_NEON)
+  tensor_contract_create = CeedTensorContractCreate_Neon;
+#elif defined(CEED_OMP_USE_AVX)
+  tensor_contract_create = CeedTensorContractCreate_Avx;
+#endif
+#if defined(CEED_OMP_USE_AVX512)
+  if (CeedAvx512IsSupported()) tensor_contract_create = CeedTensorContractCreate_Avx512;
+#endif
+
+  CeedCallBackend(CeedSetBackendFunction(ceed, "Ceed", ceed, "Destroy", CeedDestroy_Omp));
+  CeedCallBackend(CeedSetBackendFunction(ceed, "Ceed", ceed, "TensorContractCreate", tensor_contract_create));
+  CeedCallBackend(CeedSetBackendFunction(ceed, "Ceed", ceed, "OperatorCreate", CeedOperatorCreate_Opt));
+
+  // Set block size and number of threads
+  CeedCallBackend(CeedCalloc(1, &data));
+  data->block_size  = 8;
+  data->num_threads = omp_get_max_threads();
+  CeedCallBackend(CeedSetData(ceed, data));
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Backend Register
+//------------------------------------------------------------------------------
+CEED_INTERN int CeedRegister_Omp_Blocked(void) { return CeedRegister("/cpu/self/omp/blocked", CeedInit_Omp_Blocked, 28); }
+
+//------------------------------------------------------------------------------
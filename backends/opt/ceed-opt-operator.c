@@ -5,11 +5,14 @@
 //
 // This file is part of CEED:  http://github.com/ceed
 
+#define _POSIX_C_SOURCE 200809L
 #include <ceed.h>
 #include <ceed/backend.h>
 #include <stdbool.h>
 #include <stdint.h>
+#include <stdlib.h>
 #include <string.h>
+#include <time.h>
 
 #include "ceed-opt.h"
 
@@ -65,12 +68,24 @@ static int CeedOperatorSetupFields_Opt(CeedQFunction qf, CeedOperator op, bool i
       CeedCallBackend(CeedElemRestrictionGetType(rstr, &rstr_type));
       switch (rstr_type) {
         case CEED_RESTRICTION_STANDARD: {
-          const CeedInt *offsets = NULL;
+          bool is_structured;
 
-          CeedCallBackend(CeedElemRestrictionGetOffsets(rstr, CEED_MEM_HOST, &offsets));
-          CeedCallBackend(CeedElemRestrictionCreateBlocked(ceed_rstr, num_elem, elem_size, block_size, num_comp, comp_stride, l_size, CEED_MEM_HOST,
-                                                           CEED_COPY_VALUES, offsets, &block_rstr[i + start_e]));
-          CeedCallBackend(CeedElemRestrictionRestoreOffsets(rstr, &offsets));
+          CeedCallBackend(CeedElemRestrictionIsStructured(rstr, &is_structured));
+          if (is_structured) {
+            CeedInt dim, num_elem_1d[3], P_1d;
+
+            // Keep structured restrictions free of offsets
+            CeedCallBackend(CeedElemRestrictionGetStructure(rstr, &dim, num_elem_1d, &P_1d));
+            CeedCallBackend(CeedElemRestrictionCreateBlockedStructured(ceed_rstr, dim, num_elem_1d, P_1d, block_size, num_comp, comp_stride, l_size,
+                                                                       &block_rstr[i + start_e]));
+          } else {
+            const CeedInt *offsets = NULL;
+
+            CeedCallBackend(CeedElemRestrictionGetOffsets(rstr, CEED_MEM_HOST, &offsets));
+            CeedCallBackend(CeedElemRestrictionCreateBlocked(ceed_rstr, num_elem, elem_size, block_size, num_comp, comp_stride, l_size,
+                                                             CEED_MEM_HOST, CEED_COPY_VALUES, offsets, &block_rstr[i + start_e]));
+            CeedCallBackend(CeedElemRestrictionRestoreOffsets(rstr, &offsets));
+          }
         } break;
         case CEED_RESTRICTION_ORIENTED: {
           const bool    *orients = NULL;
@@ -199,6 +214,16 @@ static int CeedOperatorSetupFields_Opt(CeedQFunction qf, CeedOperator op, bool i
   return CEED_ERROR_SUCCESS;
 }
 
+//------------------------------------------------------------------------------
+// Check if the fused element block kernel is enabled with CEED_OPT_FUSED
+//   The fused kernel calls the QFunction user function directly rather than through CeedQFunctionApply(), so it is opt-in
+//------------------------------------------------------------------------------
+static bool CeedOperatorFusedIsEnabled_Opt(void) {
+  const char *is_enabled = getenv("CEED_OPT_FUSED");
+
+  return is_enabled && (!strcmp(is_enabled, "1") || !strcmp(is_enabled, "on"));
+}
+
 //------------------------------------------------------------------------------
 // Setup Operator
 //------------------------------------------------------------------------------
@@ -224,7 +249,10 @@ static int CeedOperatorSetup_Opt(CeedOperator op) {
   CeedCallBackend(CeedQFunctionIsIdentity(qf, &impl->is_identity_qf));
   CeedCallBackend(CeedOperatorGetFields(op, &num_input_fields, &op_input_fields, &num_output_fields, &op_output_fields));
   CeedCallBackend(CeedQFunctionGetFields(qf, NULL, &qf_input_fields, NULL, &qf_output_fields));
-  const CeedInt block_size = ceed_impl->block_size;
+
+  // Autotuned block size and tensor contraction tiles
+  if (ceed_impl->block_size > 1) CeedCallBackend(CeedOperatorAutotune_Opt(op, &impl->block_size));
+  const CeedInt block_size = impl->block_size;
 
   // Allocate
   CeedCallBackend(CeedCalloc(num_input_fields + num_output_fields, &impl->block_rstr));
@@ -266,6 +294,72 @@ static int CeedOperatorSetup_Opt(CeedOperator op) {
     }
   }
 
+  // Fused element block kernel, if enabled and block loop restrictions are all offset or strided
+  impl->is_fused = !impl->is_identity_qf && CeedOperatorFusedIsEnabled_Opt();
+  for (CeedInt i = 0; i < num_input_fields + num_output_fields && impl->is_fused; i++) {
+    bool                is_active = true;
+    CeedRestrictionType rstr_type;
+
+    if (!impl->block_rstr[i]) continue;
+    if (i < num_input_fields) {
+      CeedVector vec;
+
+      CeedCallBackend(CeedOperatorFieldGetVector(op_input_fields[i], &vec));
+      is_active = vec == CEED_VECTOR_ACTIVE;
+      CeedCallBackend(CeedVectorDestroy(&vec));
+    }
+    if (!is_active) continue;
+    CeedCallBackend(CeedElemRestrictionGetType(impl->block_rstr[i], &rstr_type));
+    impl->is_fused = rstr_type == CEED_RESTRICTION_STANDARD || rstr_type == CEED_RESTRICTION_STRIDED;
+  }
+
+  // Compressed storage of passive inputs for the fused element block kernel
+  CeedCallBackend(CeedCalloc(CEED_FIELD_MAX, &impl->storage_in));
+  for (CeedInt i = 0; i < num_input_fields && impl->is_fused; i++) {
+    CeedEvalMode    eval_mode;
+    CeedStorageType storage;
+    CeedVector      vec;
+
+    CeedCallBackend(CeedQFunctionFieldGetEvalMode(qf_input_fields[i], &eval_mode));
+    CeedCallBackend(CeedOperatorFieldGetVector(op_input_fields[i], &vec));
+    CeedCallBackend(CeedOperatorFieldGetStorage(op_input_fields[i], &storage));
+    if (storage == CEED_STORAGE_FP32 && CEED_SCALAR_TYPE == CEED_SCALAR_FP32) storage = CEED_STORAGE_SCALAR;
+    if (vec != CEED_VECTOR_ACTIVE && eval_mode != CEED_EVAL_WEIGHT) impl->storage_in[i] = storage;
+    impl->has_compressed_in = impl->has_compressed_in || impl->storage_in[i] != CEED_STORAGE_SCALAR;
+    CeedCallBackend(CeedVectorDestroy(&vec));
+  }
+  if (impl->has_compressed_in) {
+    CeedCallBackend(CeedCalloc(CEED_FIELD_MAX, &impl->e_data_compressed));
+    CeedCallBackend(CeedCalloc(CEED_FIELD_MAX, &impl->compressed_states));
+  }
+
+  // Element block coloring, so threads of the fused kernel scatter directly into the output L-vectors one color at a time
+  if (impl->is_fused && impl->num_threads > 1) {
+    bool                is_colorable = true;
+    CeedElemRestriction rstr_out     = NULL;
+
+    // Outputs must share a single restriction
+    for (CeedInt i = 0; i < num_output_fields && is_colorable; i++) {
+      CeedElemRestriction rstr;
+
+      if (impl->skip_rstr_out[i]) continue;
+      CeedCallBackend(CeedOperatorFieldGetElemRestriction(op_output_fields[i], &rstr));
+      if (!rstr_out) CeedCallBackend(CeedElemRestrictionReferenceCopy(rstr, &rstr_out));
+      is_colorable = rstr == rstr_out;
+      CeedCallBackend(CeedElemRestrictionDestroy(&rstr));
+    }
+    if (rstr_out && is_colorable) {
+      const CeedInt *color_offsets, *color_blocks;
+
+      CeedCallBackend(CeedElemRestrictionGetColoring(rstr_out, CEED_COLORING_BALANCED, block_size, &impl->num_colors, &color_offsets, &color_blocks));
+      CeedCallBackend(CeedCalloc(impl->num_colors + 1, &impl->color_offsets));
+      memcpy(impl->color_offsets, color_offsets, (impl->num_colors + 1) * sizeof(CeedInt));
+      CeedCallBackend(CeedCalloc(CeedIntMax(color_offsets[impl->num_colors], 1), &impl->color_blocks));
+      memcpy(impl->color_blocks, color_blocks, color_offsets[impl->num_colors] * sizeof(CeedInt));
+    }
+    CeedCallBackend(CeedElemRestrictionDestroy(&rstr_out));
+  }
+
   CeedCallBackend(CeedOperatorSetSetupDone(op));
   CeedCallBackend(CeedQFunctionDestroy(&qf));
   return CEED_ERROR_SUCCESS;
@@ -436,12 +530,883 @@ static inline int CeedOperatorRestoreInputs_Opt(CeedInt num_input_fields, CeedQF
   return CEED_ERROR_SUCCESS;
 }
 
+//------------------------------------------------------------------------------
+// Setup Per-Thread Tiles and Work Vectors
+//   Work vectors for one element block are laid out in a single aligned tile per thread, with aliased work vectors sharing tile space.
+//   Passive input E-vectors and passive CEED_EVAL_NONE input Q-vectors point into the full E-vectors and take no tile space, unless passive inputs
+//   are stored compressed and decompressed into the tile.
+//------------------------------------------------------------------------------
+static int CeedOperatorSetupThreads_Opt(CeedOperator op, CeedOperatorApplyData_Opt *data, CeedOperator_Opt *impl) {
+  Ceed          ceed;
+  bool          needs_tile[4 * CEED_FIELD_MAX] = {0};
+  const CeedInt num_inputs = impl->num_inputs, num_outputs = impl->num_outputs, num_threads = CeedIntMax(impl->num_threads, 1);
+  const CeedInt align      = CEED_ALIGN / sizeof(CeedScalar);
+  CeedInt       num_slots = 2 * (num_inputs + num_outputs), root[4 * CEED_FIELD_MAX];
+  CeedSize      lengths[4 * CEED_FIELD_MAX] = {0}, tile_offsets[4 * CEED_FIELD_MAX] = {0};
+  CeedVector    work_vecs[4 * CEED_FIELD_MAX];
+
+  CeedCallBackend(CeedOperatorGetCeed(op, &ceed));
+
+  // Slots are input E-vector and Q-vector pairs followed by output E-vector and Q-vector pairs
+  for (CeedInt i = 0; i < num_inputs; i++) {
+    work_vecs[2 * i]      = impl->e_vecs_in[i];
+    work_vecs[2 * i + 1]  = impl->q_vecs_in[i];
+    needs_tile[2 * i]     = data->is_active_in[i] || impl->storage_in[i] != CEED_STORAGE_SCALAR;
+    needs_tile[2 * i + 1] = data->is_active_in[i] || data->eval_modes_in[i] != CEED_EVAL_NONE;
+  }
+  for (CeedInt i = 0; i < num_outputs; i++) {
+    work_vecs[2 * (num_inputs + i)]      = impl->e_vecs_out[i];
+    work_vecs[2 * (num_inputs + i) + 1] = impl->q_vecs_out[i];
+    needs_tile[2 * (num_inputs + i)]     = true;
+    needs_tile[2 * (num_inputs + i) + 1] = true;
+  }
+
+  // Tile layout
+  for (CeedInt s = 0; s < num_slots; s++) {
+    const bool is_q_vec = s % 2, is_input = s < 2 * num_inputs;
+
+    root[s] = s;
+    if (!work_vecs[s]) continue;
+    // Work vectors shared between fields
+    for (CeedInt r = 0; r < s && root[s] == s; r++) {
+      if (work_vecs[r] == work_vecs[s]) root[s] = root[r];
+    }
+    // Active CEED_EVAL_NONE Q-vectors alias their E-vectors; for identity QFunctions the output E-vector joins the shared Q-vector instead
+    if (is_q_vec && needs_tile[s - 1]) {
+      const CeedEvalMode eval_mode = is_input ? data->eval_modes_in[s / 2] : data->eval_modes_out[s / 2 - num_inputs];
+
+      if (eval_mode == CEED_EVAL_NONE) {
+        if (root[s] == s) root[s] = root[s - 1];
+        else root[s - 1] = root[s];
+      }
+    }
+  }
+  impl->tile_size = 0;
+  for (CeedInt s = 0; s < num_slots; s++) {
+    if (!work_vecs[s] || root[s] != s || !needs_tile[s]) continue;
+    CeedCallBackend(CeedVectorGetLength(work_vecs[s], &lengths[s]));
+    tile_offsets[s] = impl->tile_size;
+    impl->tile_size += ((lengths[s] + align - 1) / align) * align;
+  }
+
+  // Thread local tiles and work vectors
+  CeedCallBackend(CeedCalloc(num_threads, &impl->threads));
+  for (CeedInt t = 0; t < num_threads; t++) {
+    CeedOperatorThread_Opt *thread = &impl->threads[t];
+    CeedVector             *thread_vecs[4 * CEED_FIELD_MAX];
+    CeedScalar            **thread_tiles[4 * CEED_FIELD_MAX];
+
+    for (CeedInt i = 0; i < num_inputs; i++) {
+      thread_vecs[2 * i]      = &thread->e_vecs_in[i];
+      thread_vecs[2 * i + 1]  = &thread->q_vecs_in[i];
+      thread_tiles[2 * i]     = &thread->e_tiles_in[i];
+      thread_tiles[2 * i + 1] = &thread->q_tiles_in[i];
+    }
+    for (CeedInt i = 0; i < num_outputs; i++) {
+      thread_vecs[2 * (num_inputs + i)]      = &thread->e_vecs_out[i];
+      thread_vecs[2 * (num_inputs + i) + 1]  = &thread->q_vecs_out[i];
+      thread_tiles[2 * (num_inputs + i)]     = &thread->e_tiles_out[i];
+      thread_tiles[2 * (num_inputs + i) + 1] = &thread->q_tiles_out[i];
+    }
+    CeedCallBackend(CeedMalloc(CeedIntMax(impl->tile_size, 1), &thread->tile));
+    memset(thread->tile, 0, impl->tile_size * sizeof(CeedScalar));
+    for (CeedInt s = 0; s < num_slots; s++) {
+      if (!work_vecs[s]) continue;
+      if (root[s] != s) {
+        CeedCallBackend(CeedVectorReferenceCopy(*thread_vecs[root[s]], thread_vecs[s]));
+        *thread_tiles[s] = *thread_tiles[root[s]];
+        continue;
+      }
+      if (needs_tile[s]) {
+        *thread_tiles[s] = &thread->tile[tile_offsets[s]];
+        CeedCallBackend(CeedVectorCreate(ceed, lengths[s], thread_vecs[s]));
+        CeedCallBackend(CeedVectorSetArray(*thread_vecs[s], CEED_MEM_HOST, CEED_USE_POINTER, *thread_tiles[s]));
+      } else {
+        CeedSize length;
+
+        CeedCallBackend(CeedVectorGetLength(work_vecs[s], &length));
+        CeedCallBackend(CeedVectorCreate(ceed, length, thread_vecs[s]));
+      }
+    }
+    // Quadrature weights
+    for (CeedInt i = 0; i < num_inputs; i++) {
+      const CeedScalar *q_weight;
+
+      if (data->eval_modes_in[i] != CEED_EVAL_WEIGHT) continue;
+      CeedCallBackend(CeedVectorGetArrayRead(impl->q_vecs_in[i], CEED_MEM_HOST, &q_weight));
+      memcpy(thread->q_tiles_in[i], q_weight, lengths[2 * i + 1] * sizeof(CeedScalar));
+      CeedCallBackend(CeedVectorRestoreArrayRead(impl->q_vecs_in[i], &q_weight));
+    }
+    // Active input L-vector view
+    for (CeedInt i = 0; i < num_inputs && !thread->l_vec_in; i++) {
+      if (data->is_active_in[i] && impl->block_rstr[i]) {
+        CeedCallBackend(CeedElemRestrictionCreateVector(impl->block_rstr[i], &thread->l_vec_in, NULL));
+      }
+    }
+    // Output L-vector accumulators, not needed with element block coloring
+    for (CeedInt i = 0; i < num_outputs && num_threads > 1 && !impl->num_colors; i++) {
+      if (impl->skip_rstr_out[i]) continue;
+      CeedCallBackend(CeedElemRestrictionCreateVector(impl->block_rstr[i + num_inputs], &thread->l_vecs_out[i], NULL));
+    }
+  }
+  CeedDebug(ceed, "Opt operator element block tile: %" CeedSize_FMT " bytes per thread\n", impl->tile_size * (CeedSize)sizeof(CeedScalar));
+  CeedCallBackend(CeedDestroy(&ceed));
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Get Data for Element Block Loop
+//   Getters taking references are not thread safe, so field data is fetched before the element block loop
+//------------------------------------------------------------------------------
+static int CeedOperatorGetApplyData_Opt(CeedOperator op, CeedQFunction qf, CeedInt Q, CeedOperator_Opt *impl, CeedOperatorApplyData_Opt *data) {
+  CeedInt             num_input_fields, num_output_fields;
+  CeedQFunctionField *qf_input_fields, *qf_output_fields;
+  CeedOperatorField  *op_input_fields, *op_output_fields;
+
+  CeedCallBackend(CeedOperatorGetFields(op, &num_input_fields, &op_input_fields, &num_output_fields, &op_output_fields));
+  CeedCallBackend(CeedQFunctionGetFields(qf, NULL, &qf_input_fields, NULL, &qf_output_fields));
+  for (CeedInt i = 0; i < num_input_fields; i++) {
+    CeedVector vec;
+
+    CeedCallBackend(CeedQFunctionFieldGetEvalMode(qf_input_fields[i], &data->eval_modes_in[i]));
+    CeedCallBackend(CeedOperatorFieldGetVector(op_input_fields[i], &vec));
+    data->is_active_in[i] = vec == CEED_VECTOR_ACTIVE;
+    CeedCallBackend(CeedVectorDestroy(&vec));
+    if (data->eval_modes_in[i] == CEED_EVAL_WEIGHT) continue;
+    CeedCallBackend(CeedQFunctionFieldGetSize(qf_input_fields[i], &data->q_sizes_in[i]));
+    data->q_sizes_in[i] *= Q;
+    if (data->eval_modes_in[i] != CEED_EVAL_NONE) {
+      CeedInt             elem_size, num_comp;
+      CeedElemRestriction elem_rstr;
+
+      CeedCallBackend(CeedOperatorFieldGetElemRestriction(op_input_fields[i], &elem_rstr));
+      CeedCallBackend(CeedElemRestrictionGetElementSize(elem_rstr, &elem_size));
+      CeedCallBackend(CeedElemRestrictionDestroy(&elem_rstr));
+      CeedCallBackend(CeedOperatorFieldGetBasis(op_input_fields[i], &data->bases_in[i]));
+      CeedCallBackend(CeedBasisGetNumComponents(data->bases_in[i], &num_comp));
+      data->e_sizes_in[i] = elem_size * num_comp;
+    }
+  }
+  for (CeedInt i = 0; i < num_output_fields; i++) {
+    CeedCallBackend(CeedQFunctionFieldGetEvalMode(qf_output_fields[i], &data->eval_modes_out[i]));
+    CeedCheck(data->eval_modes_out[i] != CEED_EVAL_WEIGHT, CeedOperatorReturnCeed(op), CEED_ERROR_BACKEND,
+              "CEED_EVAL_WEIGHT cannot be an output evaluation mode");
+    if (data->eval_modes_out[i] != CEED_EVAL_NONE) CeedCallBackend(CeedOperatorFieldGetBasis(op_output_fields[i], &data->bases_out[i]));
+  }
+  CeedCallBackend(CeedOperatorGetCollectStats(op, &data->collect_stats));
+  if (!impl->is_identity_qf) {
+    CeedCallBackend(CeedQFunctionSetImmutable(qf));
+    CeedCallBackend(CeedQFunctionGetUserFunction(qf, &data->f));
+    CeedCallBackend(CeedQFunctionGetContextData(qf, CEED_MEM_HOST, &data->ctx_data));
+  }
+
+  // Restriction data for fused gather and scatter
+  if (impl->is_fused) {
+    for (CeedInt i = 0; i < num_input_fields + num_output_fields; i++) {
+      const bool           is_input = i < num_input_fields;
+      CeedOperatorRstr_Opt *rstr_data = is_input ? &data->rstr_in[i] : &data->rstr_out[i - num_input_fields];
+      CeedRestrictionType  rstr_type;
+      CeedElemRestriction  block_rstr = impl->block_rstr[i];
+
+      if (is_input ? (!data->is_active_in[i] || !block_rstr || impl->skip_rstr_in[i]) : impl->skip_rstr_out[i - num_input_fields]) continue;
+      CeedCallBackend(CeedElemRestrictionGetNumElements(block_rstr, &rstr_data->num_elem));
+      CeedCallBackend(CeedElemRestrictionGetElementSize(block_rstr, &rstr_data->elem_size));
+      CeedCallBackend(CeedElemRestrictionGetNumComponents(block_rstr, &rstr_data->num_comp));
+      CeedCallBackend(CeedElemRestrictionGetType(block_rstr, &rstr_type));
+      if (rstr_type == CEED_RESTRICTION_STRIDED) {
+        bool has_backend_strides;
+
+        CeedCallBackend(CeedElemRestrictionHasBackendStrides(block_rstr, &has_backend_strides));
+        if (has_backend_strides) {
+          rstr_data->strides[0] = 1;
+          rstr_data->strides[1] = rstr_data->elem_size;
+          rstr_data->strides[2] = rstr_data->elem_size * rstr_data->num_comp;
+        } else {
+          CeedCallBackend(CeedElemRestrictionGetStrides(block_rstr, rstr_data->strides));
+        }
+      } else {
+        bool is_structured;
+
+        CeedCallBackend(CeedElemRestrictionGetCompStride(block_rstr, &rstr_data->comp_stride));
+        CeedCallBackend(CeedElemRestrictionIsStructured(block_rstr, &is_structured));
+        // Structured restrictions compute their offsets in the gather and scatter, so no offsets are materialized
+        if (is_structured) CeedCallBackend(CeedElemRestrictionGetStructure(block_rstr, NULL, rstr_data->num_elem_1d, &rstr_data->P_1d));
+        else CeedCallBackend(CeedElemRestrictionGetOffsets(block_rstr, CEED_MEM_HOST, &rstr_data->offsets));
+      }
+    }
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Restore Data for Element Block Loop
+//------------------------------------------------------------------------------
+static int CeedOperatorRestoreApplyData_Opt(CeedQFunction qf, CeedOperator_Opt *impl, CeedOperatorApplyData_Opt *data) {
+  for (CeedInt i = 0; i < impl->num_inputs; i++) {
+    CeedCallBackend(CeedBasisDestroy(&data->bases_in[i]));
+    if (data->rstr_in[i].offsets) CeedCallBackend(CeedElemRestrictionRestoreOffsets(impl->block_rstr[i], &data->rstr_in[i].offsets));
+  }
+  for (CeedInt i = 0; i < impl->num_outputs; i++) {
+    CeedCallBackend(CeedBasisDestroy(&data->bases_out[i]));
+    if (data->rstr_out[i].offsets) {
+      CeedCallBackend(CeedElemRestrictionRestoreOffsets(impl->block_rstr[i + impl->num_inputs], &data->rstr_out[i].offsets));
+    }
+  }
+  if (!impl->is_identity_qf) CeedCallBackend(CeedQFunctionRestoreContextData(qf, &data->ctx_data));
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Get the current monotonic time, in nanoseconds
+//------------------------------------------------------------------------------
+static CeedSize CeedOperatorGetTime_Opt(void) {
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (CeedSize)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+//------------------------------------------------------------------------------
+// Apply QFunction User Function to Element Block
+//   QFunction applications on worker threads are not seen by the interface, so they are counted per thread for operator statistics
+//------------------------------------------------------------------------------
+static inline int CeedOperatorApplyQFunction_Opt(CeedInt Q, const CeedScalar *const *in, CeedScalar *const *out, CeedOperatorApplyData_Opt *data,
+                                                 CeedOperatorThread_Opt *thread) {
+  const CeedSize start_ns = data->collect_stats ? CeedOperatorGetTime_Opt() : 0;
+
+  CeedCallBackend(data->f(data->ctx_data, Q, in, out));
+  if (data->collect_stats) {
+    thread->qf_num_calls += 1;
+    thread->qf_num_points += Q;
+    thread->qf_time_ns += CeedOperatorGetTime_Opt() - start_ns;
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Add Thread Local QFunction Statistics to Operator
+//   Called after the element block loop, so the statistics are added by the thread applying the operator; times are summed over threads
+//------------------------------------------------------------------------------
+static int CeedOperatorAddThreadStats_Opt(CeedOperator op, CeedOperatorApplyData_Opt *data, CeedOperator_Opt *impl) {
+  CeedSize num_calls = 0, num_points = 0, time_ns = 0;
+
+  if (!data->collect_stats) return CEED_ERROR_SUCCESS;
+  for (CeedInt t = 0; t < CeedIntMax(impl->num_threads, 1); t++) {
+    CeedOperatorThread_Opt *thread = &impl->threads[t];
+
+    num_calls += thread->qf_num_calls;
+    num_points += thread->qf_num_points;
+    time_ns += thread->qf_time_ns;
+    thread->qf_num_calls = thread->qf_num_points = thread->qf_time_ns = 0;
+  }
+  CeedCallBackend(CeedOperatorAddQFunctionStats(op, num_calls, num_points, time_ns));
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Sum Thread Local Output L-vectors
+//   Thread local outputs are summed in thread order, so results are reproducible for a fixed number of threads
+//------------------------------------------------------------------------------
+static int CeedOperatorSumThreadOutputs_Opt(CeedOperator op, CeedVector out_vec, CeedOperator_Opt *impl) {
+  const CeedInt      num_threads = impl->num_threads;
+  CeedOperatorField *op_output_fields;
+
+  CeedCallBackend(CeedOperatorGetFields(op, NULL, NULL, NULL, &op_output_fields));
+  for (CeedInt i = 0; i < impl->num_outputs; i++) {
+    bool               is_active;
+    CeedSize           l_size;
+    CeedScalar        *out_array;
+    const CeedScalar **thread_arrays;
+    CeedVector         vec;
+
+    if (impl->skip_rstr_out[i]) continue;
+    CeedCallBackend(CeedOperatorFieldGetVector(op_output_fields[i], &vec));
+    is_active = vec == CEED_VECTOR_ACTIVE;
+    if (is_active) vec = out_vec;
+    CeedCallBackend(CeedVectorGetLength(impl->threads[0].l_vecs_out[i], &l_size));
+    CeedCallBackend(CeedCalloc(num_threads, &thread_arrays));
+    for (CeedInt t = 0; t < num_threads; t++) {
+      CeedCallBackend(CeedVectorGetArrayRead(impl->threads[t].l_vecs_out[i], CEED_MEM_HOST, &thread_arrays[t]));
+    }
+    CeedCallBackend(CeedVectorGetArray(vec, CEED_MEM_HOST, &out_array));
+    CeedPragmaOMP(parallel for num_threads(num_threads) schedule(static))
+    for (CeedSize j = 0; j < l_size; j++) {
+      CeedScalar sum = 0.0;
+
+      for (CeedInt t = 0; t < num_threads; t++) sum += thread_arrays[t][j];
+      out_array[j] += sum;
+    }
+    CeedCallBackend(CeedVectorRestoreArray(vec, &out_array));
+    for (CeedInt t = 0; t < num_threads; t++) CeedCallBackend(CeedVectorRestoreArrayRead(impl->threads[t].l_vecs_out[i], &thread_arrays[t]));
+    CeedCallBackend(CeedFree(&thread_arrays));
+    if (!is_active) CeedCallBackend(CeedVectorDestroy(&vec));
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Apply Operator to Range of Element Blocks
+//   Only thread local objects are modified; field data is prefetched by caller
+//------------------------------------------------------------------------------
+static int CeedOperatorApplyAddBlocks_Opt(CeedInt block_start, CeedInt block_end, CeedInt Q, CeedInt block_size, CeedOperatorApplyData_Opt *data,
+                                          CeedOperator_Opt *impl, CeedOperatorThread_Opt *thread) {
+  const CeedInt num_inputs = impl->num_inputs, num_outputs = impl->num_outputs;
+
+  // Zero output accumulators
+  for (CeedInt i = 0; i < num_outputs; i++) {
+    if (thread->l_vecs_out[i]) CeedCallBackend(CeedVectorSetValue(thread->l_vecs_out[i], 0.0));
+  }
+
+  for (CeedInt b = block_start; b < block_end; b++) {
+    const CeedInt e = b * block_size;
+
+    // Input restriction and basis
+    for (CeedInt i = 0; i < num_inputs; i++) {
+      const bool is_active = data->is_active_in[i];
+
+      if (is_active && impl->block_rstr[i] && !impl->skip_rstr_in[i]) {
+        CeedCallBackend(
+            CeedElemRestrictionApplyBlock(impl->block_rstr[i], b, CEED_NOTRANSPOSE, thread->l_vec_in, thread->e_vecs_in[i], CEED_REQUEST_IMMEDIATE));
+      }
+      switch (data->eval_modes_in[i]) {
+        case CEED_EVAL_NONE:
+          if (!is_active) {
+            CeedCallBackend(
+                CeedVectorSetArray(thread->q_vecs_in[i], CEED_MEM_HOST, CEED_USE_POINTER, &data->e_data[i][(CeedSize)e * data->q_sizes_in[i]]));
+          }
+          break;
+        case CEED_EVAL_INTERP:
+        case CEED_EVAL_GRAD:
+        case CEED_EVAL_DIV:
+        case CEED_EVAL_CURL:
+          if (!is_active) {
+            CeedCallBackend(
+                CeedVectorSetArray(thread->e_vecs_in[i], CEED_MEM_HOST, CEED_USE_POINTER, &data->e_data[i][(CeedSize)e * data->e_sizes_in[i]]));
+          }
+          CeedCallBackend(
+              CeedBasisApply(data->bases_in[i], block_size, CEED_NOTRANSPOSE, data->eval_modes_in[i], thread->e_vecs_in[i], thread->q_vecs_in[i]));
+          break;
+        case CEED_EVAL_WEIGHT:
+          break;  // No action
+      }
+    }
+
+    // Q function
+    if (!impl->is_identity_qf) {
+      const CeedScalar *in[CEED_FIELD_MAX];
+      CeedScalar       *out[CEED_FIELD_MAX];
+
+      for (CeedInt i = 0; i < num_inputs; i++) CeedCallBackend(CeedVectorGetArrayRead(thread->q_vecs_in[i], CEED_MEM_HOST, &in[i]));
+      for (CeedInt i = 0; i < num_outputs; i++) CeedCallBackend(CeedVectorGetArrayWrite(thread->q_vecs_out[i], CEED_MEM_HOST, &out[i]));
+      CeedCallBackend(CeedOperatorApplyQFunction_Opt(Q * block_size, in, out, data, thread));
+      for (CeedInt i = 0; i < num_inputs; i++) CeedCallBackend(CeedVectorRestoreArrayRead(thread->q_vecs_in[i], &in[i]));
+      for (CeedInt i = 0; i < num_outputs; i++) CeedCallBackend(CeedVectorRestoreArray(thread->q_vecs_out[i], &out[i]));
+    }
+
+    // Output basis and restriction
+    for (CeedInt i = 0; i < num_outputs; i++) {
+      const CeedEvalMode eval_mode = data->eval_modes_out[i];
+
+      if (eval_mode != CEED_EVAL_NONE) {
+        if (impl->apply_add_basis_out[i]) {
+          CeedCallBackend(CeedBasisApplyAdd(data->bases_out[i], block_size, CEED_TRANSPOSE, eval_mode, thread->q_vecs_out[i], thread->e_vecs_out[i]));
+        } else {
+          CeedCallBackend(CeedBasisApply(data->bases_out[i], block_size, CEED_TRANSPOSE, eval_mode, thread->q_vecs_out[i], thread->e_vecs_out[i]));
+        }
+      }
+      if (impl->skip_rstr_out[i]) continue;
+      CeedCallBackend(CeedElemRestrictionApplyBlock(impl->block_rstr[i + num_inputs], b, CEED_TRANSPOSE, thread->e_vecs_out[i], thread->l_vecs_out[i],
+                                                    CEED_REQUEST_IMMEDIATE));
+    }
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Threaded Operator Apply
+//   Element blocks are split into contiguous ranges, one per thread, and each thread accumulates into its own output L-vectors.
+//------------------------------------------------------------------------------
+static int CeedOperatorApplyAddThreaded_Opt(CeedOperator op, CeedVector in_vec, CeedVector out_vec) {
+  int                       ierr = CEED_ERROR_SUCCESS;
+  Ceed                      ceed;
+  CeedInt                   Q, num_input_fields, num_elem;
+  const CeedScalar         *in_array = NULL;
+  CeedQFunctionField       *qf_input_fields;
+  CeedQFunction             qf;
+  CeedOperatorField        *op_input_fields;
+  CeedOperator_Opt         *impl;
+  CeedOperatorApplyData_Opt data = {0};
+
+  CeedCallBackend(CeedOperatorGetCeed(op, &ceed));
+  CeedCallBackend(CeedOperatorGetData(op, &impl));
+  CeedCallBackend(CeedOperatorGetNumElements(op, &num_elem));
+  CeedCallBackend(CeedOperatorGetNumQuadraturePoints(op, &Q));
+  CeedCallBackend(CeedOperatorGetQFunction(op, &qf));
+  CeedCallBackend(CeedOperatorGetFields(op, &num_input_fields, &op_input_fields, NULL, NULL));
+  CeedCallBackend(CeedQFunctionGetFields(qf, NULL, &qf_input_fields, NULL, NULL));
+  const CeedInt block_size  = impl->block_size;
+  const CeedInt num_blocks  = (num_elem / block_size) + !!(num_elem % block_size);
+  const CeedInt num_threads = impl->num_threads;
+
+  // Input Evecs and Restriction
+  CeedCallBackend(CeedOperatorSetupInputs_Opt(num_input_fields, qf_input_fields, op_input_fields, in_vec, data.e_data, impl, CEED_REQUEST_IMMEDIATE));
+
+  // Prefetch field data and setup thread local work vectors
+  CeedCallBackend(CeedOperatorGetApplyData_Opt(op, qf, Q, impl, &data));
+  if (!impl->threads) CeedCallBackend(CeedOperatorSetupThreads_Opt(op, &data, impl));
+
+  // Thread local views
+  if (in_vec != CEED_VECTOR_NONE && impl->threads[0].l_vec_in) CeedCallBackend(CeedVectorGetArrayRead(in_vec, CEED_MEM_HOST, &in_array));
+  for (CeedInt t = 0; t < num_threads && in_array; t++) {
+    CeedCallBackend(CeedVectorSetArray(impl->threads[t].l_vec_in, CEED_MEM_HOST, CEED_USE_POINTER, (CeedScalar *)in_array));
+  }
+
+  // Loop through element blocks
+  CeedPragmaOMP(parallel for num_threads(num_threads) schedule(static, 1))
+  for (CeedInt t = 0; t < num_threads; t++) {
+    const CeedInt block_start = (CeedInt)(((CeedSize)num_blocks * t) / num_threads);
+    const CeedInt block_end   = (CeedInt)(((CeedSize)num_blocks * (t + 1)) / num_threads);
+    const int     ierr_t      = CeedOperatorApplyAddBlocks_Opt(block_start, block_end, Q, block_size, &data, impl, &impl->threads[t]);
+
+    if (ierr_t != CEED_ERROR_SUCCESS) {
+      CeedPragmaCritical(CeedOperatorApplyAddThreaded_Opt)
+      ierr = ierr_t;
+    }
+  }
+  CeedCallBackend(ierr);
+  CeedCallBackend(CeedOperatorAddThreadStats_Opt(op, &data, impl));
+
+  // Release views
+  if (in_array) {
+    for (CeedInt t = 0; t < num_threads; t++) CeedCallBackend(CeedVectorTakeArray(impl->threads[t].l_vec_in, CEED_MEM_HOST, NULL));
+    CeedCallBackend(CeedVectorRestoreArrayRead(in_vec, &in_array));
+  }
+
+  // Sum thread local outputs
+  CeedCallBackend(CeedOperatorSumThreadOutputs_Opt(op, out_vec, impl));
+
+  // Cleanup
+  CeedCallBackend(CeedOperatorRestoreApplyData_Opt(qf, impl, &data));
+  CeedCallBackend(CeedOperatorRestoreInputs_Opt(num_input_fields, qf_input_fields, op_input_fields, data.e_data, impl));
+  CeedCallBackend(CeedDestroy(&ceed));
+  CeedCallBackend(CeedQFunctionDestroy(&qf));
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Fused Gather and Scatter
+//   Same element block layout as the blocked reference restrictions; padding elements are discarded on scatter
+//------------------------------------------------------------------------------
+static inline void CeedOperatorStructuredOrigins_Opt(const CeedOperatorRstr_Opt *rstr, CeedInt block_size, CeedInt e, CeedInt *origins) {
+  const CeedInt *num_elem_1d = rstr->num_elem_1d, P_1d = rstr->P_1d;
+  const CeedInt  num_nodes_x = num_elem_1d[0] * (P_1d - 1) + 1, num_nodes_y = num_elem_1d[1] * (P_1d - 1) + 1;
+
+  // L-vector offset of the first node of each element, with padding repeating the last element
+  for (CeedInt j = 0; j < block_size; j++) {
+    const CeedInt elem = CeedIntMin(e + j, rstr->num_elem - 1);
+    const CeedInt e_x = elem % num_elem_1d[0], e_y = (elem / num_elem_1d[0]) % num_elem_1d[1], e_z = elem / (num_elem_1d[0] * num_elem_1d[1]);
+
+    origins[j] = (P_1d - 1) * (e_x + num_nodes_x * (e_y + num_nodes_y * e_z));
+  }
+}
+
+static inline CeedInt CeedOperatorStructuredNodeOffset_Opt(const CeedOperatorRstr_Opt *rstr, CeedInt n) {
+  const CeedInt P_1d = rstr->P_1d, num_nodes_x = rstr->num_elem_1d[0] * (P_1d - 1) + 1, num_nodes_y = rstr->num_elem_1d[1] * (P_1d - 1) + 1;
+
+  return n % P_1d + num_nodes_x * ((n / P_1d) % P_1d + num_nodes_y * (n / (P_1d * P_1d)));
+}
+
+static inline void CeedOperatorGatherBlock_Opt(const CeedOperatorRstr_Opt *rstr, CeedInt block_size, CeedInt e, const CeedScalar *__restrict__ uu,
+                                               CeedScalar *__restrict__ vv) {
+  const CeedInt elem_size = rstr->elem_size, num_comp = rstr->num_comp;
+
+  if (rstr->offsets) {
+    const CeedInt *__restrict__ offsets = &rstr->offsets[(CeedSize)e * elem_size];
+
+    for (CeedInt k = 0; k < num_comp; k++) {
+      const CeedSize comp_offset = (CeedSize)k * rstr->comp_stride;
+
+      CeedPragmaSIMD for (CeedInt i = 0; i < elem_size * block_size; i++) vv[k * elem_size * block_size + i] = uu[offsets[i] + comp_offset];
+    }
+  } else if (rstr->P_1d) {
+    CeedInt origins[block_size];
+
+    CeedOperatorStructuredOrigins_Opt(rstr, block_size, e, origins);
+    for (CeedInt n = 0; n < elem_size; n++) {
+      const CeedInt node_offset = CeedOperatorStructuredNodeOffset_Opt(rstr, n);
+
+      for (CeedInt k = 0; k < num_comp; k++) {
+        const CeedSize comp_offset = (CeedSize)k * rstr->comp_stride + node_offset;
+
+        CeedPragmaSIMD for (CeedInt j = 0; j < block_size; j++) vv[(k * elem_size + n) * block_size + j] = uu[origins[j] + comp_offset];
+      }
+    }
+  } else {
+    const CeedInt *strides = rstr->strides;
+
+    for (CeedInt k = 0; k < num_comp; k++) {
+      for (CeedInt n = 0; n < elem_size; n++) {
+        CeedPragmaSIMD for (CeedInt j = 0; j < block_size; j++) {
+          vv[(k * elem_size + n) * block_size + j] =
+              uu[n * strides[0] + k * strides[1] + CeedIntMin(e + j, rstr->num_elem - 1) * (CeedSize)strides[2]];
+        }
+      }
+    }
+  }
+}
+
+static inline void CeedOperatorScatterBlock_Opt(const CeedOperatorRstr_Opt *rstr, CeedInt block_size, CeedInt e, const CeedScalar *__restrict__ uu,
+                                                CeedScalar *__restrict__ vv) {
+  const CeedInt elem_size = rstr->elem_size, num_comp = rstr->num_comp, block_end = CeedIntMin(block_size, rstr->num_elem - e);
+
+  if (rstr->offsets) {
+    const CeedInt *__restrict__ offsets = &rstr->offsets[(CeedSize)e * elem_size];
+
+    for (CeedInt k = 0; k < num_comp; k++) {
+      const CeedSize comp_offset = (CeedSize)k * rstr->comp_stride;
+
+      for (CeedInt i = 0; i < elem_size * block_size; i += block_size) {
+        for (CeedInt j = i; j < i + block_end; j++) vv[offsets[j] + comp_offset] += uu[k * elem_size * block_size + j];
+      }
+    }
+  } else if (rstr->P_1d) {
+    CeedInt origins[block_size];
+
+    CeedOperatorStructuredOrigins_Opt(rstr, block_size, e, origins);
+    for (CeedInt n = 0; n < elem_size; n++) {
+      const CeedInt node_offset = CeedOperatorStructuredNodeOffset_Opt(rstr, n);
+
+      for (CeedInt k = 0; k < num_comp; k++) {
+        const CeedSize comp_offset = (CeedSize)k * rstr->comp_stride + node_offset;
+
+        // Elements in a block may share nodes, so the scatter is not vectorized
+        for (CeedInt j = 0; j < block_end; j++) vv[origins[j] + comp_offset] += uu[(k * elem_size + n) * block_size + j];
+      }
+    }
+  } else {
+    const CeedInt *strides = rstr->strides;
+
+    for (CeedInt k = 0; k < num_comp; k++) {
+      for (CeedInt n = 0; n < elem_size; n++) {
+        CeedPragmaSIMD for (CeedInt j = 0; j < block_end; j++) {
+          vv[n * strides[0] + k * strides[1] + (e + j) * (CeedSize)strides[2]] += uu[(k * elem_size + n) * block_size + j];
+        }
+      }
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+// Compressed Storage Conversions
+//   bfloat16 keeps the upper half of the single precision bit pattern, rounded to nearest even
+//------------------------------------------------------------------------------
+static inline uint16_t CeedScalarToBF16_Opt(CeedScalar value) {
+  const float x = (float)value;
+  uint32_t    bits;
+
+  memcpy(&bits, &x, sizeof(bits));
+  if ((bits & 0x7fffffff) > 0x7f800000) return (uint16_t)((bits >> 16) | 0x40);  // Keep NaN quiet
+  return (uint16_t)((bits + 0x7fff + ((bits >> 16) & 1)) >> 16);
+}
+
+static inline CeedScalar CeedBF16ToScalar_Opt(uint16_t value) {
+  const uint32_t bits = (uint32_t)value << 16;
+  float          x;
+
+  memcpy(&x, &bits, sizeof(x));
+  return (CeedScalar)x;
+}
+
+static inline void CeedCompress_Opt(CeedStorageType storage, CeedSize length, const CeedScalar *in, void *out) {
+  switch (storage) {
+    case CEED_STORAGE_FP32:
+      for (CeedSize j = 0; j < length; j++) ((float *)out)[j] = (float)in[j];
+      break;
+    case CEED_STORAGE_BF16:
+      for (CeedSize j = 0; j < length; j++) ((uint16_t *)out)[j] = CeedScalarToBF16_Opt(in[j]);
+      break;
+    case CEED_STORAGE_SCALAR:
+      break;  // Not compressed
+  }
+}
+
+static inline void CeedDecompressBlock_Opt(CeedStorageType storage, CeedSize start, CeedInt length, const void *in, CeedScalar *out) {
+  switch (storage) {
+    case CEED_STORAGE_FP32: {
+      const float *in_fp32 = &((const float *)in)[start];
+
+      CeedPragmaSIMD for (CeedInt j = 0; j < length; j++) out[j] = (CeedScalar)in_fp32[j];
+    } break;
+    case CEED_STORAGE_BF16: {
+      const uint16_t *in_bf16 = &((const uint16_t *)in)[start];
+
+      CeedPragmaSIMD for (CeedInt j = 0; j < length; j++) out[j] = CeedBF16ToScalar_Opt(in_bf16[j]);
+    } break;
+    case CEED_STORAGE_SCALAR:
+      break;  // Not compressed
+  }
+}
+
+//------------------------------------------------------------------------------
+// Setup Compressed Passive Inputs
+//   Passive input full E-vectors are compressed once per change of the input vector, so the element block loop reads fewer bytes for them
+//------------------------------------------------------------------------------
+static int CeedOperatorSetupCompressedInputs_Opt(CeedOperator_Opt *impl, CeedOperatorApplyData_Opt *data) {
+  for (CeedInt i = 0; i < impl->num_inputs; i++) {
+    const CeedStorageType storage = impl->storage_in[i];
+
+    data->storage_in[i] = storage;
+    if (storage == CEED_STORAGE_SCALAR) continue;
+    if (!impl->e_data_compressed[i] || impl->compressed_states[i] != impl->input_states[i]) {
+      CeedSize length;
+
+      CeedCallBackend(CeedVectorGetLength(impl->e_vecs_full[i], &length));
+      if (!impl->e_data_compressed[i]) {
+        CeedCallBackend(CeedMallocArray(length, storage == CEED_STORAGE_FP32 ? sizeof(float) : sizeof(uint16_t), &impl->e_data_compressed[i]));
+      }
+      CeedCompress_Opt(storage, length, data->e_data[i], impl->e_data_compressed[i]);
+      impl->compressed_states[i] = impl->input_states[i];
+    }
+    data->e_data_compressed[i] = impl->e_data_compressed[i];
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Apply Fused Operator to Range of Element Blocks
+//   The range indexes block_list if it is not NULL, otherwise it is a range of element blocks.
+//   Gather, basis action, QFunction, and scatter work on the thread local tile, so element block data stays in cache between stages.
+//   With several right hand sides, each element block is applied to all of them in turn, so passive inputs, offsets, and basis matrices are
+//   read once per block; passive inputs are not modified by the QFunction, so their basis action is only computed for the first right hand side.
+//------------------------------------------------------------------------------
+static int CeedOperatorApplyAddFusedBlocks_Opt(CeedInt block_start, CeedInt block_end, const CeedInt *block_list, CeedInt Q, CeedInt block_size,
+                                               CeedInt num_vecs, const CeedScalar **l_arrays_in, CeedScalar **l_arrays_out,
+                                               CeedOperatorApplyData_Opt *data, CeedOperator_Opt *impl, CeedOperatorThread_Opt *thread) {
+  const CeedInt num_inputs = impl->num_inputs, num_outputs = impl->num_outputs;
+
+  for (CeedInt k = block_start; k < block_end; k++) {
+    const CeedInt     e = (block_list ? block_list[k] : k) * block_size;
+    const CeedScalar *in[CEED_FIELD_MAX];
+
+    for (CeedInt r = 0; r < num_vecs; r++) {
+      // Input gather and basis
+      for (CeedInt i = 0; i < num_inputs; i++) {
+        const bool is_active     = data->is_active_in[i];
+        const bool is_compressed = !is_active && data->e_data_compressed[i];
+
+        if (r > 0 && !is_active) continue;
+        if (is_active && data->rstr_in[i].num_elem) {
+          CeedOperatorGatherBlock_Opt(&data->rstr_in[i], block_size, e, l_arrays_in[r], thread->e_tiles_in[i]);
+        }
+        if (is_compressed) {
+          const CeedInt size = data->eval_modes_in[i] == CEED_EVAL_NONE ? data->q_sizes_in[i] : data->e_sizes_in[i];
+
+          CeedDecompressBlock_Opt(data->storage_in[i], (CeedSize)e * size, size * block_size, data->e_data_compressed[i], thread->e_tiles_in[i]);
+        }
+        in[i] = thread->q_tiles_in[i];
+        switch (data->eval_modes_in[i]) {
+          case CEED_EVAL_NONE:
+            if (!is_active && !is_compressed) in[i] = &data->e_data[i][(CeedSize)e * data->q_sizes_in[i]];
+            break;
+          case CEED_EVAL_INTERP:
+          case CEED_EVAL_GRAD:
+          case CEED_EVAL_DIV:
+          case CEED_EVAL_CURL:
+            if (!is_active && !is_compressed) {
+              CeedCallBackend(
+                  CeedVectorSetArray(thread->e_vecs_in[i], CEED_MEM_HOST, CEED_USE_POINTER, &data->e_data[i][(CeedSize)e * data->e_sizes_in[i]]));
+            }
+            CeedCallBackend(
+                CeedBasisApply(data->bases_in[i], block_size, CEED_NOTRANSPOSE, data->eval_modes_in[i], thread->e_vecs_in[i], thread->q_vecs_in[i]));
+            break;
+          case CEED_EVAL_WEIGHT:
+            break;  // No action
+        }
+      }
+
+      // Q function
+      CeedCallBackend(CeedOperatorApplyQFunction_Opt(Q * block_size, in, thread->q_tiles_out, data, thread));
+
+      // Output basis and scatter
+      for (CeedInt i = 0; i < num_outputs; i++) {
+        const CeedEvalMode eval_mode = data->eval_modes_out[i];
+
+        if (eval_mode != CEED_EVAL_NONE) {
+          if (impl->apply_add_basis_out[i]) {
+            CeedCallBackend(
+                CeedBasisApplyAdd(data->bases_out[i], block_size, CEED_TRANSPOSE, eval_mode, thread->q_vecs_out[i], thread->e_vecs_out[i]));
+          } else {
+            CeedCallBackend(CeedBasisApply(data->bases_out[i], block_size, CEED_TRANSPOSE, eval_mode, thread->q_vecs_out[i], thread->e_vecs_out[i]));
+          }
+        }
+        if (impl->skip_rstr_out[i]) continue;
+        CeedOperatorScatterBlock_Opt(&data->rstr_out[i], block_size, e, thread->e_tiles_out[i], l_arrays_out[r * CEED_FIELD_MAX + i]);
+      }
+    }
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Fused Operator Apply
+//   With one thread, the scatter sums directly into the output L-vectors.
+//   With element block coloring, threads apply the element blocks of one color at a time, which share no output L-vector entries, and also
+//   scatter directly into the output L-vectors; otherwise each thread scatters into its own accumulators.
+//   Several right hand sides are not supported with thread accumulators, as they hold a single right hand side.
+//------------------------------------------------------------------------------
+static int CeedOperatorApplyAddFused_Opt(CeedOperator op, CeedInt num_vecs, CeedVector *in_vecs, CeedVector *out_vecs) {
+  int                       ierr = CEED_ERROR_SUCCESS;
+  Ceed                      ceed;
+  CeedInt                   Q, num_input_fields, num_output_fields, num_elem;
+  const CeedScalar        **in_arrays;
+  CeedScalar              **out_arrays;
+  CeedVector               *field_vecs;
+  CeedQFunctionField       *qf_input_fields;
+  CeedQFunction             qf;
+  CeedOperatorField        *op_input_fields, *op_output_fields;
+  CeedOperator_Opt         *impl;
+  CeedOperatorApplyData_Opt data = {0};
+
+  CeedCallBackend(CeedOperatorGetCeed(op, &ceed));
+  CeedCallBackend(CeedOperatorGetData(op, &impl));
+  CeedCallBackend(CeedOperatorGetNumElements(op, &num_elem));
+  CeedCallBackend(CeedOperatorGetNumQuadraturePoints(op, &Q));
+  CeedCallBackend(CeedOperatorGetQFunction(op, &qf));
+  CeedCallBackend(CeedOperatorGetFields(op, &num_input_fields, &op_input_fields, &num_output_fields, &op_output_fields));
+  CeedCallBackend(CeedQFunctionGetFields(qf, NULL, &qf_input_fields, NULL, NULL));
+  const CeedInt block_size  = impl->block_size;
+  const CeedInt num_blocks  = (num_elem / block_size) + !!(num_elem % block_size);
+  const CeedInt num_threads      = CeedIntMax(impl->num_threads, 1);
+  const bool    has_thread_accum = num_threads > 1 && !impl->num_colors;
+
+  CeedCheck(!has_thread_accum || num_vecs == 1, ceed, CEED_ERROR_BACKEND, "Threaded fused apply without coloring supports only one right hand side");
+
+  // Input Evecs and Restriction
+  CeedCallBackend(
+      CeedOperatorSetupInputs_Opt(num_input_fields, qf_input_fields, op_input_fields, in_vecs[0], data.e_data, impl, CEED_REQUEST_IMMEDIATE));
+
+  // Prefetch field data and setup thread local tiles
+  CeedCallBackend(CeedOperatorGetApplyData_Opt(op, qf, Q, impl, &data));
+  if (!impl->threads) CeedCallBackend(CeedOperatorSetupThreads_Opt(op, &data, impl));
+  if (impl->has_compressed_in) CeedCallBackend(CeedOperatorSetupCompressedInputs_Opt(impl, &data));
+
+  // Input and output arrays
+  CeedCallBackend(CeedCalloc(num_vecs, &in_arrays));
+  for (CeedInt r = 0; r < num_vecs; r++) {
+    for (CeedInt i = 0; i < num_input_fields && !in_arrays[r]; i++) {
+      if (data.rstr_in[i].num_elem && in_vecs[r] != CEED_VECTOR_NONE) {
+        CeedCallBackend(CeedVectorGetArrayRead(in_vecs[r], CEED_MEM_HOST, &in_arrays[r]));
+      }
+    }
+  }
+  CeedCallBackend(CeedCalloc(CeedIntMax(num_threads, num_vecs) * CEED_FIELD_MAX, &out_arrays));
+  CeedCallBackend(CeedCalloc(num_vecs * CEED_FIELD_MAX, &field_vecs));
+  for (CeedInt r = 0; r < num_vecs; r++) {
+    for (CeedInt i = 0; i < num_output_fields; i++) {
+      const CeedInt m = r * CEED_FIELD_MAX + i;
+
+      if (impl->skip_rstr_out[i]) continue;
+      if (has_thread_accum) {
+        for (CeedInt t = 0; t < num_threads; t++) {
+          CeedCallBackend(CeedVectorSetValue(impl->threads[t].l_vecs_out[i], 0.0));
+          CeedCallBackend(CeedVectorGetArray(impl->threads[t].l_vecs_out[i], CEED_MEM_HOST, &out_arrays[t * CEED_FIELD_MAX + i]));
+        }
+      } else {
+        CeedVector vec;
+
+        CeedCallBackend(CeedOperatorFieldGetVector(op_output_fields[i], &vec));
+        if (vec == CEED_VECTOR_ACTIVE) vec = out_vecs[r];
+        // Outputs sharing an L-vector share its array
+        for (CeedInt j = 0; j < m; j++) {
+          if (field_vecs[j] == vec) out_arrays[m] = out_arrays[j];
+        }
+        if (!out_arrays[m]) CeedCallBackend(CeedVectorGetArray(vec, CEED_MEM_HOST, &out_arrays[m]));
+        field_vecs[m] = vec;
+      }
+    }
+  }
+
+  // Loop through element blocks
+  if (impl->num_colors && num_threads > 1) {
+    for (CeedInt c = 0; c < impl->num_colors; c++) {
+      const CeedInt color_start = impl->color_offsets[c], num_color_blocks = impl->color_offsets[c + 1] - color_start;
+
+      CeedPragmaOMP(parallel for num_threads(num_threads) schedule(static, 1))
+      for (CeedInt t = 0; t < num_threads; t++) {
+        const CeedInt block_start = color_start + (CeedInt)(((CeedSize)num_color_blocks * t) / num_threads);
+        const CeedInt block_end   = color_start + (CeedInt)(((CeedSize)num_color_blocks * (t + 1)) / num_threads);
+        const int     ierr_t      = CeedOperatorApplyAddFusedBlocks_Opt(block_start, block_end, impl->color_blocks, Q, block_size, num_vecs,
+                                                                        in_arrays, out_arrays, &data, impl, &impl->threads[t]);
+
+        if (ierr_t != CEED_ERROR_SUCCESS) {
+          CeedPragmaCritical(CeedOperatorApplyAddFused_Opt)
+          ierr = ierr_t;
+        }
+      }
+    }
+  } else {
+    CeedPragmaOMP(parallel for num_threads(num_threads) schedule(static, 1))
+    for (CeedInt t = 0; t < num_threads; t++) {
+      const CeedInt block_start = (CeedInt)(((CeedSize)num_blocks * t) / num_threads);
+      const CeedInt block_end   = (CeedInt)(((CeedSize)num_blocks * (t + 1)) / num_threads);
+      const int     ierr_t      = CeedOperatorApplyAddFusedBlocks_Opt(block_start, block_end, NULL, Q, block_size, num_vecs, in_arrays,
+                                                                      &out_arrays[t * CEED_FIELD_MAX], &data, impl, &impl->threads[t]);
+
+      if (ierr_t != CEED_ERROR_SUCCESS) {
+        CeedPragmaCritical(CeedOperatorApplyAddFused_Opt)
+        ierr = ierr_t;
+      }
+    }
+  }
+  CeedCallBackend(ierr);
+  CeedCallBackend(CeedOperatorAddThreadStats_Opt(op, &data, impl));
+
+  // Restore arrays
+  for (CeedInt r = 0; r < num_vecs; r++) {
+    if (in_arrays[r]) CeedCallBackend(CeedVectorRestoreArrayRead(in_vecs[r], &in_arrays[r]));
+  }
+  for (CeedInt r = 0; r < num_vecs; r++) {
+    for (CeedInt i = 0; i < num_output_fields; i++) {
+      const CeedInt m = r * CEED_FIELD_MAX + i;
+
+      if (impl->skip_rstr_out[i]) continue;
+      if (has_thread_accum) {
+        for (CeedInt t = 0; t < num_threads; t++) {
+          CeedCallBackend(CeedVectorRestoreArray(impl->threads[t].l_vecs_out[i], &out_arrays[t * CEED_FIELD_MAX + i]));
+        }
+      } else {
+        bool is_shared = false;
+
+        for (CeedInt j = m + 1; j < num_vecs * CEED_FIELD_MAX; j++) is_shared = is_shared || field_vecs[j] == field_vecs[m];
+        if (!is_shared) CeedCallBackend(CeedVectorRestoreArray(field_vecs[m], &out_arrays[m]));
+      }
+    }
+  }
+  for (CeedInt m = 0; m < num_vecs * CEED_FIELD_MAX; m++) {
+    bool is_active = false;
+
+    for (CeedInt r = 0; r < num_vecs; r++) is_active = is_active || field_vecs[m] == out_vecs[r];
+    if (field_vecs[m] && !is_active) CeedCallBackend(CeedVectorDestroy(&field_vecs[m]));
+  }
+  CeedCallBackend(CeedFree(&field_vecs));
+  CeedCallBackend(CeedFree(&out_arrays));
+  CeedCallBackend(CeedFree(&in_arrays));
+
+  // Sum thread local outputs
+  if (has_thread_accum) CeedCallBackend(CeedOperatorSumThreadOutputs_Opt(op, out_vecs[0], impl));
+
+  // Cleanup
+  CeedCallBackend(CeedOperatorRestoreApplyData_Opt(qf, impl, &data));
+  CeedCallBackend(CeedOperatorRestoreInputs_Opt(num_input_fields, qf_input_fields, op_input_fields, data.e_data, impl));
+  CeedCallBackend(CeedDestroy(&ceed));
+  CeedCallBackend(CeedQFunctionDestroy(&qf));
+  return CEED_ERROR_SUCCESS;
+}
+
 //------------------------------------------------------------------------------
 // Operator Apply
 //------------------------------------------------------------------------------
 static int CeedOperatorApplyAdd_Opt(CeedOperator op, CeedVector in_vec, CeedVector out_vec, CeedRequest *request) {
-  Ceed                ceed;
-  Ceed_Opt           *ceed_impl;
   CeedInt             Q, num_input_fields, num_output_fields, num_elem;
   CeedEvalMode        eval_mode;
   CeedScalar         *e_data[2 * CEED_FIELD_MAX] = {0};
@@ -453,12 +1418,9 @@ static int CeedOperatorApplyAdd_Opt(CeedOperator op, CeedVector in_vec, CeedVect
   // Setup
   CeedCallBackend(CeedOperatorSetup_Opt(op));
 
-  CeedCallBackend(CeedOperatorGetCeed(op, &ceed));
-  CeedCallBackend(CeedGetData(ceed, &ceed_impl));
-  CeedCallBackend(CeedDestroy(&ceed));
   CeedCallBackend(CeedOperatorGetData(op, &impl));
   CeedCallBackend(CeedOperatorGetNumElements(op, &num_elem));
-  const CeedInt block_size = ceed_impl->block_size;
+  const CeedInt block_size = impl->block_size;
   const CeedInt num_blocks = (num_elem / block_size) + !!(num_elem % block_size);
 
   // Restriction only operator
@@ -470,6 +1432,12 @@ static int CeedOperatorApplyAdd_Opt(CeedOperator op, CeedVector in_vec, CeedVect
     return CEED_ERROR_SUCCESS;
   }
 
+  // Fused element block loop
+  if (impl->is_fused) return CeedOperatorApplyAddFused_Opt(op, 1, &in_vec, &out_vec);
+
+  // Threaded element block loop
+  if (impl->num_threads > 1) return CeedOperatorApplyAddThreaded_Opt(op, in_vec, out_vec);
+
   CeedCallBackend(CeedOperatorGetNumQuadraturePoints(op, &Q));
   CeedCallBackend(CeedOperatorGetQFunction(op, &qf));
   CeedCallBackend(CeedOperatorGetFields(op, &num_input_fields, &op_input_fields, &num_output_fields, &op_output_fields));
@@ -513,21 +1481,40 @@ static int CeedOperatorApplyAdd_Opt(CeedOperator op, CeedVector in_vec, CeedVect
 }
 
 //------------------------------------------------------------------------------
-// Core code for linear QFunction assembly
+// Operator Apply to Multiple Vectors
+//------------------------------------------------------------------------------
+static int CeedOperatorApplyAddMulti_Opt(CeedOperator op, CeedInt num_vecs, CeedVector *in_vecs, CeedVector *out_vecs) {
+  CeedOperator_Opt *impl;
+
+  // Setup
+  CeedCallBackend(CeedOperatorSetup_Opt(op));
+  CeedCallBackend(CeedOperatorGetData(op, &impl));
+
+  // Fused element block loop over all vectors
+  if (impl->is_fused && (impl->num_threads <= 1 || impl->num_colors)) return CeedOperatorApplyAddFused_Opt(op, num_vecs, in_vecs, out_vecs);
+
+  // One vector at a time otherwise
+  for (CeedInt r = 0; r < num_vecs; r++) CeedCallBackend(CeedOperatorApplyAdd_Opt(op, in_vecs[r], out_vecs[r], CEED_REQUEST_IMMEDIATE));
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Core code for linear QFunction assembly, either for all elements or for the elements in elem_range only
 //------------------------------------------------------------------------------
-static inline int CeedOperatorLinearAssembleQFunctionCore_Opt(CeedOperator op, bool build_objects, CeedVector *assembled, CeedElemRestriction *rstr,
-                                                              CeedRequest *request) {
+static inline int CeedOperatorLinearAssembleQFunctionCore_Opt(CeedOperator op, bool build_objects, const CeedInt *elem_range, CeedVector *assembled,
+                                                              CeedElemRestriction *rstr, CeedRequest *request) {
   Ceed                ceed;
-  Ceed_Opt           *ceed_impl;
   CeedInt             qf_size_in, qf_size_out, Q, num_input_fields, num_output_fields, num_elem;
-  CeedScalar         *l_vec_array, *e_data[2 * CEED_FIELD_MAX] = {0};
+  CeedScalar         *l_vec_array, *assembled_array = NULL, *e_data[2 * CEED_FIELD_MAX] = {0};
   CeedQFunctionField *qf_input_fields, *qf_output_fields;
   CeedQFunction       qf;
   CeedOperatorField  *op_input_fields, *op_output_fields;
   CeedOperator_Opt   *impl;
 
+  // Setup
+  CeedCallBackend(CeedOperatorSetup_Opt(op));
+
   CeedCallBackend(CeedOperatorGetCeed(op, &ceed));
-  CeedCallBackend(CeedGetData(ceed, &ceed_impl));
   CeedCallBackend(CeedOperatorGetData(op, &impl));
   qf_size_in  = impl->qf_size_in;
   qf_size_out = impl->qf_size_out;
@@ -537,14 +1524,11 @@ static inline int CeedOperatorLinearAssembleQFunctionCore_Opt(CeedOperator op, b
   CeedCallBackend(CeedOperatorGetQFunction(op, &qf));
   CeedCallBackend(CeedOperatorGetFields(op, &num_input_fields, &op_input_fields, &num_output_fields, &op_output_fields));
   CeedCallBackend(CeedQFunctionGetFields(qf, NULL, &qf_input_fields, NULL, &qf_output_fields));
-  const CeedInt       block_size = ceed_impl->block_size;
+  const CeedInt       block_size = impl->block_size;
   const CeedInt       num_blocks = (num_elem / block_size) + !!(num_elem % block_size);
   CeedVector          l_vec      = impl->qf_l_vec;
   CeedElemRestriction block_rstr = impl->qf_block_rstr;
 
-  // Setup
-  CeedCallBackend(CeedOperatorSetup_Opt(op));
-
   // Check for restriction only operator
   CeedCheck(!impl->is_identity_rstr_op, ceed, CEED_ERROR_BACKEND, "Assembling restriction only operators is not supported");
 
@@ -619,8 +1603,16 @@ static inline int CeedOperatorLinearAssembleQFunctionCore_Opt(CeedOperator op, b
   }
 
   // Loop through elements
-  CeedCallBackend(CeedVectorSetValue(*assembled, 0.0));
-  for (CeedInt e = 0; e < num_blocks * block_size; e += block_size) {
+  if (elem_range) {
+    CeedCheck(0 <= elem_range[0] && elem_range[0] <= elem_range[1] && elem_range[1] <= num_elem, ceed, CEED_ERROR_BACKEND,
+              "Invalid element range [%" CeedInt_FMT ", %" CeedInt_FMT ") for operator with %" CeedInt_FMT " elements", elem_range[0], elem_range[1],
+              num_elem);
+    CeedCallBackend(CeedVectorGetArrayWrite(*assembled, CEED_MEM_HOST, &assembled_array));
+  } else {
+    CeedCallBackend(CeedVectorSetValue(*assembled, 0.0));
+  }
+  for (CeedInt e = elem_range ? (elem_range[0] / block_size) * block_size : 0; e < (elem_range ? elem_range[1] : num_blocks * block_size);
+       e += block_size) {
     CeedCallBackend(CeedVectorGetArray(l_vec, CEED_MEM_HOST, &l_vec_array));
 
     // Input basis apply
@@ -705,8 +1697,23 @@ static inline int CeedOperatorLinearAssembleQFunctionCore_Opt(CeedOperator op, b
 
     // Assemble into assembled vector
     CeedCallBackend(CeedVectorRestoreArray(l_vec, &l_vec_array));
-    CeedCallBackend(CeedElemRestrictionApplyBlock(block_rstr, e / block_size, CEED_TRANSPOSE, l_vec, *assembled, request));
+    if (elem_range) {
+      // Copy out the elements of this block that are in range, using the layout of the full assembled vector
+      const CeedInt     num_comp = qf_size_in * qf_size_out;
+      const CeedScalar *l_vec_read_array;
+
+      CeedCallBackend(CeedVectorGetArrayRead(l_vec, CEED_MEM_HOST, &l_vec_read_array));
+      for (CeedInt j = CeedIntMax(elem_range[0] - e, 0); j < CeedIntMin(block_size, elem_range[1] - e); j++) {
+        CeedScalar *elem_array = &assembled_array[(CeedSize)(e + j - elem_range[0]) * num_comp * Q];
+
+        for (CeedInt k = 0; k < num_comp * Q; k++) elem_array[k] = l_vec_read_array[k * block_size + j];
+      }
+      CeedCallBackend(CeedVectorRestoreArrayRead(l_vec, &l_vec_read_array));
+    } else {
+      CeedCallBackend(CeedElemRestrictionApplyBlock(block_rstr, e / block_size, CEED_TRANSPOSE, l_vec, *assembled, request));
+    }
   }
+  if (elem_range) CeedCallBackend(CeedVectorRestoreArray(*assembled, &assembled_array));
 
   // Reset output Qvecs
   for (CeedInt out = 0; out < num_output_fields; out++) {
@@ -729,14 +1736,24 @@ static inline int CeedOperatorLinearAssembleQFunctionCore_Opt(CeedOperator op, b
 // Assemble Linear QFunction
 //------------------------------------------------------------------------------
 static int CeedOperatorLinearAssembleQFunction_Opt(CeedOperator op, CeedVector *assembled, CeedElemRestriction *rstr, CeedRequest *request) {
-  return CeedOperatorLinearAssembleQFunctionCore_Opt(op, true, assembled, rstr, request);
+  return CeedOperatorLinearAssembleQFunctionCore_Opt(op, true, NULL, assembled, rstr, request);
 }
 
 //------------------------------------------------------------------------------
 // Update Assembled Linear QFunction
 //------------------------------------------------------------------------------
 static int CeedOperatorLinearAssembleQFunctionUpdate_Opt(CeedOperator op, CeedVector assembled, CeedElemRestriction rstr, CeedRequest *request) {
-  return CeedOperatorLinearAssembleQFunctionCore_Opt(op, false, &assembled, &rstr, request);
+  return CeedOperatorLinearAssembleQFunctionCore_Opt(op, false, NULL, &assembled, &rstr, request);
+}
+
+//------------------------------------------------------------------------------
+// Assemble Linear QFunction for a Range of Elements
+//------------------------------------------------------------------------------
+static int CeedOperatorLinearAssembleQFunctionElements_Opt(CeedOperator op, CeedInt elem_start, CeedInt elem_end, CeedVector assembled,
+                                                           CeedRequest *request) {
+  const CeedInt elem_range[2] = {elem_start, elem_end};
+
+  return CeedOperatorLinearAssembleQFunctionCore_Opt(op, false, elem_range, &assembled, NULL, request);
 }
 
 //------------------------------------------------------------------------------
@@ -753,6 +1770,12 @@ static int CeedOperatorDestroy_Opt(CeedOperator op) {
   CeedCallBackend(CeedFree(&impl->block_rstr));
   CeedCallBackend(CeedFree(&impl->e_vecs_full));
   CeedCallBackend(CeedFree(&impl->input_states));
+  for (CeedInt i = 0; impl->e_data_compressed && i < impl->num_inputs; i++) CeedCallBackend(CeedFree(&impl->e_data_compressed[i]));
+  CeedCallBackend(CeedFree(&impl->e_data_compressed));
+  CeedCallBackend(CeedFree(&impl->compressed_states));
+  CeedCallBackend(CeedFree(&impl->storage_in));
+  CeedCallBackend(CeedFree(&impl->color_offsets));
+  CeedCallBackend(CeedFree(&impl->color_blocks));
   CeedCallBackend(CeedFree(&impl->skip_rstr_in));
   CeedCallBackend(CeedFree(&impl->skip_rstr_out));
   CeedCallBackend(CeedFree(&impl->apply_add_basis_out));
@@ -775,6 +1798,24 @@ static int CeedOperatorDestroy_Opt(CeedOperator op) {
   CeedCallBackend(CeedVectorDestroy(&impl->qf_l_vec));
   CeedCallBackend(CeedElemRestrictionDestroy(&impl->qf_block_rstr));
 
+  // Thread local data
+  for (CeedInt t = 0; impl->threads && t < CeedIntMax(impl->num_threads, 1); t++) {
+    CeedOperatorThread_Opt *thread = &impl->threads[t];
+
+    for (CeedInt i = 0; i < impl->num_inputs; i++) {
+      CeedCallBackend(CeedVectorDestroy(&thread->e_vecs_in[i]));
+      CeedCallBackend(CeedVectorDestroy(&thread->q_vecs_in[i]));
+    }
+    for (CeedInt i = 0; i < impl->num_outputs; i++) {
+      CeedCallBackend(CeedVectorDestroy(&thread->e_vecs_out[i]));
+      CeedCallBackend(CeedVectorDestroy(&thread->q_vecs_out[i]));
+      CeedCallBackend(CeedVectorDestroy(&thread->l_vecs_out[i]));
+    }
+    CeedCallBackend(CeedVectorDestroy(&thread->l_vec_in));
+    CeedCallBackend(CeedFree(&thread->tile));
+  }
+  CeedCallBackend(CeedFree(&impl->threads));
+
   CeedCallBackend(CeedFree(&impl));
   return CEED_ERROR_SUCCESS;
 }
@@ -789,16 +1830,18 @@ int CeedOperatorCreate_Opt(CeedOperator op) {
 
   CeedCallBackend(CeedOperatorGetCeed(op, &ceed));
   CeedCallBackend(CeedGetData(ceed, &ceed_impl));
-  const CeedInt block_size = ceed_impl->block_size;
-
   CeedCallBackend(CeedCalloc(1, &impl));
+  impl->block_size  = ceed_impl->block_size;
+  impl->num_threads = ceed_impl->num_threads;
   CeedCallBackend(CeedOperatorSetData(op, impl));
 
-  CeedCheck(block_size == 1 || block_size == 8, ceed, CEED_ERROR_BACKEND, "Opt backend cannot use blocksize: %" CeedInt_FMT, block_size);
+  CeedCheck(impl->block_size >= 1, ceed, CEED_ERROR_BACKEND, "Opt backend cannot use blocksize: %" CeedInt_FMT, impl->block_size);
 
   CeedCallBackend(CeedSetBackendFunction(ceed, "Operator", op, "LinearAssembleQFunction", CeedOperatorLinearAssembleQFunction_Opt));
   CeedCallBackend(CeedSetBackendFunction(ceed, "Operator", op, "LinearAssembleQFunctionUpdate", CeedOperatorLinearAssembleQFunctionUpdate_Opt));
+  CeedCallBackend(CeedSetBackendFunction(ceed, "Operator", op, "LinearAssembleQFunctionElements", CeedOperatorLinearAssembleQFunctionElements_Opt));
   CeedCallBackend(CeedSetBackendFunction(ceed, "Operator", op, "ApplyAdd", CeedOperatorApplyAdd_Opt));
+  CeedCallBackend(CeedSetBackendFunction(ceed, "Operator", op, "ApplyAddMulti", CeedOperatorApplyAddMulti_Opt));
   CeedCallBackend(CeedSetBackendFunction(ceed, "Operator", op, "Destroy", CeedOperatorDestroy_Opt));
   CeedCallBackend(CeedDestroy(&ceed));
   return CEED_ERROR_SUCCESS;
@@ -48,11 +48,117 @@ static int CeedTensorContractApply_Opt(CeedTensorContract contract, CeedInt A, C
   return CEED_ERROR_SUCCESS;
 }
 
+//------------------------------------------------------------------------------
+// Tensor Contract Even-Odd Core loop
+//------------------------------------------------------------------------------
+static inline int CeedTensorContractApplyEvenOdd_Core_Opt(CeedInt A, CeedInt B, CeedInt C, CeedInt J, const CeedScalar *restrict t_even,
+                                                          const CeedScalar *restrict t_odd, CeedInt t_stride_0, CeedInt t_stride_1, CeedInt parity,
+                                                          const CeedInt add, const CeedScalar *restrict u, CeedScalar *restrict v,
+                                                          CeedScalar *restrict work) {
+  const CeedInt B_half = (B + 1) / 2, J_half = (J + 1) / 2;
+  CeedScalar   *u_even = work, *u_odd = &work[B_half * C], *v_even = &work[2 * B_half * C], *v_odd = &work[(2 * B_half + J_half) * C];
+
+  for (CeedInt a = 0; a < A; a++) {
+    // Fold mirrored entries of u, with the middle entry for odd B only in the even part
+    for (CeedInt b = 0; b < B / 2; b++) {
+      for (CeedInt c = 0; c < C; c++) {
+        u_even[b * C + c] = u[(a * B + b) * C + c] + u[(a * B + B - 1 - b) * C + c];
+        u_odd[b * C + c]  = u[(a * B + b) * C + c] - u[(a * B + B - 1 - b) * C + c];
+      }
+    }
+    if (B % 2) {
+      for (CeedInt c = 0; c < C; c++) {
+        u_even[(B / 2) * C + c] = u[(a * B + B / 2) * C + c];
+        u_odd[(B / 2) * C + c]  = 0.0;
+      }
+    }
+
+    // Contract halves
+    for (CeedInt q = 0; q < J_half * C; q++) v_even[q] = 0.0;
+    for (CeedInt q = 0; q < J_half * C; q++) v_odd[q] = 0.0;
+    for (CeedInt b = 0; b < B_half; b++) {
+      for (CeedInt j = 0; j < J_half; j++) {
+        const CeedScalar t_e = t_even[j * t_stride_0 + b * t_stride_1], t_o = t_odd[j * t_stride_0 + b * t_stride_1];
+
+        for (CeedInt c = 0; c < C; c++) {
+          v_even[j * C + c] += t_e * u_even[b * C + c];
+          v_odd[j * C + c] += t_o * u_odd[b * C + c];
+        }
+      }
+    }
+
+    // Unfold into mirrored entries of v, with the middle entry for odd J only written once
+    if (!add) {
+      for (CeedInt q = 0; q < J * C; q++) v[a * J * C + q] = 0.0;
+    }
+    for (CeedInt j = 0; j < J / 2; j++) {
+      for (CeedInt c = 0; c < C; c++) {
+        v[(a * J + j) * C + c] += v_even[j * C + c] + v_odd[j * C + c];
+        v[(a * J + J - 1 - j) * C + c] += parity * (v_even[j * C + c] - v_odd[j * C + c]);
+      }
+    }
+    if (J % 2) {
+      for (CeedInt c = 0; c < C; c++) v[(a * J + J / 2) * C + c] += v_even[(J / 2) * C + c] + v_odd[(J / 2) * C + c];
+    }
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Tensor Contract Apply Even-Odd
+//------------------------------------------------------------------------------
+static int CeedTensorContractApplyEvenOdd_Opt(CeedTensorContract contract, CeedInt A, CeedInt B, CeedInt C, CeedInt J,
+                                              const CeedScalar *restrict t_even, const CeedScalar *restrict t_odd, CeedInt parity,
+                                              CeedTransposeMode t_mode, const CeedInt add, const CeedScalar *restrict u, CeedScalar *restrict v) {
+  const CeedInt B_half = (B + 1) / 2, J_half = (J + 1) / 2;
+  int           ierr;
+  CeedInt       t_stride_0 = B_half, t_stride_1 = 1;
+  CeedScalar   *work;
+  Ceed          ceed = CeedTensorContractReturnCeed(contract);
+
+  if (t_mode == CEED_TRANSPOSE) {
+    t_stride_0 = 1;
+    t_stride_1 = J_half;
+    // Halves of the transpose of a centro-antisymmetric matrix are exchanged
+    if (parity < 0) {
+      const CeedScalar *t_swap = t_even;
+
+      t_even = t_odd;
+      t_odd  = t_swap;
+    }
+  }
+
+  if (C == 1 || B < 5 || J < 5) {
+    // Folding does not pay off for small matrices and does not vectorize without the last index, so apply the full matrix rebuilt from its halves
+    CeedCallBackend(CeedGetScratch(ceed, J * B, &work));
+    for (CeedInt j = 0; j < J_half; j++) {
+      for (CeedInt b = 0; b < B_half; b++) {
+        const CeedScalar t_e = t_even[j * t_stride_0 + b * t_stride_1], t_o = t_odd[j * t_stride_0 + b * t_stride_1];
+
+        work[j * B + b]                   = t_e + t_o;
+        work[j * B + B - 1 - b]           = t_e - t_o;
+        work[(J - 1 - j) * B + B - 1 - b] = parity * (t_e + t_o);
+        work[(J - 1 - j) * B + b]         = parity * (t_e - t_o);
+      }
+    }
+    ierr = CeedTensorContractApply_Opt(contract, A, B, C, J, work, CEED_NOTRANSPOSE, add, u, v);
+  } else {
+    // Folded u and v for one index a
+    CeedCallBackend(CeedGetScratch(ceed, 2 * (B_half + J_half) * C, &work));
+    ierr = CeedTensorContractApplyEvenOdd_Core_Opt(A, B, C, J, t_even, t_odd, t_stride_0, t_stride_1, parity, add, u, v, work);
+  }
+  // Restore scratch before returning any error
+  CeedCallBackend(CeedRestoreScratch(ceed, &work));
+  return ierr;
+}
+
 //------------------------------------------------------------------------------
 // Tensor Contract Create
 //------------------------------------------------------------------------------
 int CeedTensorContractCreate_Opt(CeedTensorContract contract) {
   CeedCallBackend(CeedSetBackendFunction(CeedTensorContractReturnCeed(contract), "TensorContract", contract, "Apply", CeedTensorContractApply_Opt));
+  CeedCallBackend(
+      CeedSetBackendFunction(CeedTensorContractReturnCeed(contract), "TensorContract", contract, "ApplyEvenOdd", CeedTensorContractApplyEvenOdd_Opt));
   return CEED_ERROR_SUCCESS;
 }
 
@@ -0,0 +1,366 @@
+// Copyright (c) 2017-2025, Lawrence Livermore National Security, LLC and other CEED contributors.
+// All Rights Reserved. See the top-level LICENSE and NOTICE files for details.
+//
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// This file is part of CEED:  http://github.com/ceed
+
+#define _POSIX_C_SOURCE 200809L
+#include <ceed.h>
+#include <ceed/backend.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "ceed-opt.h"
+
+// Maximum number of tuned bases held in memory
+#define CEED_OPT_TUNING_MAX_ENTRIES 256
+// Minimum time for each benchmark, in nanoseconds
+#define CEED_OPT_TUNING_MIN_TIME 1000000
+
+typedef struct {
+  char    resource[CEED_MAX_RESOURCE_LEN];
+  CeedInt dim, P_1d, Q_1d, num_comp;
+  CeedInt block_size, tile;
+} CeedOptTuningEntry;
+
+static pthread_mutex_t    ceed_opt_tuning_lock = PTHREAD_MUTEX_INITIALIZER;
+static bool               ceed_opt_tuning_is_loaded;
+static CeedInt            ceed_opt_tuning_num_entries;
+static CeedOptTuningEntry ceed_opt_tuning_entries[CEED_OPT_TUNING_MAX_ENTRIES];
+
+// Candidate element block sizes
+static const CeedInt ceed_opt_tuning_block_sizes[] = {4, 8, 16, 32};
+
+//------------------------------------------------------------------------------
+// Check if autotuning is enabled with CEED_AUTOTUNE
+//------------------------------------------------------------------------------
+static bool CeedOptTuningIsEnabled(void) {
+  const char *is_enabled = getenv("CEED_AUTOTUNE");
+
+  return is_enabled && (!strcmp(is_enabled, "1") || !strcmp(is_enabled, "on"));
+}
+
+//------------------------------------------------------------------------------
+// Check that a directory is writable and that only this user can modify it, as for the JiT cache
+//------------------------------------------------------------------------------
+static bool CeedOptTuningIsPrivateDir(const char *dir) {
+  struct stat dir_stat;
+
+  return !lstat(dir, &dir_stat) && S_ISDIR(dir_stat.st_mode) && dir_stat.st_uid == getuid() && !(dir_stat.st_mode & (S_IWGRP | S_IWOTH)) &&
+         !access(dir, W_OK);
+}
+
+//------------------------------------------------------------------------------
+// Get tuning file path
+//   The file is CEED_TUNING_FILE, or tuning-<hostname>.txt in $XDG_CACHE_HOME/ceed or $HOME/.cache/ceed, creating the directory if needed.
+//   Returns false if there is no suitable path or its directory is not private to this user, in which case results are kept in memory only.
+//------------------------------------------------------------------------------
+static bool CeedOptTuningGetFile(char *path, size_t path_len) {
+  const char *env_file = getenv("CEED_TUNING_FILE"), *xdg_dir = getenv("XDG_CACHE_HOME"), *home_dir = getenv("HOME");
+  char        host[256] = "localhost";
+  int         dir_len;
+
+  if (env_file && env_file[0]) {
+    const char *slash = strrchr(env_file, '/');
+    bool        is_private;
+    char        end;
+
+    if (snprintf(path, path_len, "%s", env_file) >= (int)path_len) return false;
+    if (!slash) return CeedOptTuningIsPrivateDir(".");
+
+    // Check the directory of the file, ending the path after it while checking
+    dir_len       = slash == env_file ? 1 : (int)(slash - env_file);
+    end           = path[dir_len];
+    path[dir_len] = '\0';
+    is_private    = CeedOptTuningIsPrivateDir(path);
+    path[dir_len] = end;
+    return is_private;
+  }
+  if (xdg_dir && xdg_dir[0]) dir_len = snprintf(path, path_len, "%s/ceed", xdg_dir);
+  else if (home_dir && home_dir[0]) dir_len = snprintf(path, path_len, "%s/.cache/ceed", home_dir);
+  else return false;
+  if (dir_len <= 0 || dir_len >= (int)path_len) return false;
+
+  // Create each directory in path, private to this user
+  for (char *c = &path[1];; c++) {
+    if (*c == '/' || *c == '\0') {
+      const char end = *c;
+
+      *c = '\0';
+      mkdir(path, 0700);
+      *c = end;
+      if (end == '\0') break;
+    }
+  }
+  if (!CeedOptTuningIsPrivateDir(path)) return false;
+  gethostname(host, sizeof(host) - 1);
+  host[sizeof(host) - 1] = '\0';
+  return snprintf(&path[dir_len], path_len - dir_len, "/tuning-%s.txt", host) < (int)(path_len - dir_len);
+}
+
+//------------------------------------------------------------------------------
+// Find entry in tuning table
+//------------------------------------------------------------------------------
+static CeedOptTuningEntry *CeedOptTuningFind(const CeedOptTuningEntry *key) {
+  for (CeedInt i = 0; i < ceed_opt_tuning_num_entries; i++) {
+    CeedOptTuningEntry *entry = &ceed_opt_tuning_entries[i];
+
+    if (entry->dim == key->dim && entry->P_1d == key->P_1d && entry->Q_1d == key->Q_1d && entry->num_comp == key->num_comp &&
+        !strcmp(entry->resource, key->resource)) {
+      return entry;
+    }
+  }
+  return NULL;
+}
+
+//------------------------------------------------------------------------------
+// Add entry to tuning table, replacing any entry with the same key
+//------------------------------------------------------------------------------
+static void CeedOptTuningInsert(const CeedOptTuningEntry *entry) {
+  CeedOptTuningEntry *existing = CeedOptTuningFind(entry);
+
+  if (existing) *existing = *entry;
+  else if (ceed_opt_tuning_num_entries < CEED_OPT_TUNING_MAX_ENTRIES) ceed_opt_tuning_entries[ceed_opt_tuning_num_entries++] = *entry;
+}
+
+//------------------------------------------------------------------------------
+// Read entries from tuning file, with later lines overriding earlier ones
+//------------------------------------------------------------------------------
+static void CeedOptTuningRead(const char *path) {
+  char  line[CEED_MAX_RESOURCE_LEN + 128];
+  FILE *file;
+
+  file = fopen(path, "r");
+  if (!file) return;
+  while (fgets(line, sizeof(line), file)) {
+    CeedOptTuningEntry entry;
+
+    if (line[0] == '#') continue;
+    if (sscanf(line, "%1023s %" CeedInt_FMT " %" CeedInt_FMT " %" CeedInt_FMT " %" CeedInt_FMT " %" CeedInt_FMT " %" CeedInt_FMT, entry.resource,
+               &entry.dim, &entry.P_1d, &entry.Q_1d, &entry.num_comp, &entry.block_size, &entry.tile) != 7) {
+      continue;
+    }
+    if (entry.block_size < 1 || entry.tile < 0) continue;
+    CeedOptTuningInsert(&entry);
+  }
+  fclose(file);
+}
+
+//------------------------------------------------------------------------------
+// Load tuning file
+//------------------------------------------------------------------------------
+static void CeedOptTuningLoad(void) {
+  char path[CEED_MAX_RESOURCE_LEN * 4];
+
+  ceed_opt_tuning_is_loaded = true;
+  if (CeedOptTuningGetFile(path, sizeof(path))) CeedOptTuningRead(path);
+}
+
+//------------------------------------------------------------------------------
+// Save entry to tuning file
+//   Several processes, such as MPI ranks, may tune at the same time, so the file is rewritten while holding an exclusive lock on <file>.lock.
+//   Entries saved by other processes are read back first, then all entries are written to a temporary file that atomically replaces the file.
+//------------------------------------------------------------------------------
+static void CeedOptTuningSave(const CeedOptTuningEntry *entry) {
+  char         path[CEED_MAX_RESOURCE_LEN * 4], lock_path[CEED_MAX_RESOURCE_LEN * 4 + 8], temp_path[CEED_MAX_RESOURCE_LEN * 4 + 8];
+  bool         is_written = false;
+  int          lock_fd, temp_fd;
+  struct flock lock = {.l_type = F_WRLCK, .l_whence = SEEK_SET};
+  FILE        *file;
+
+  if (!CeedOptTuningGetFile(path, sizeof(path))) return;
+  snprintf(lock_path, sizeof(lock_path), "%s.lock", path);
+  snprintf(temp_path, sizeof(temp_path), "%s.XXXXXX", path);
+  lock_fd = open(lock_path, O_RDWR | O_CREAT, 0600);
+  if (lock_fd < 0) return;
+  if (fcntl(lock_fd, F_SETLKW, &lock)) {
+    close(lock_fd);
+    return;
+  }
+
+  // Merge entries saved by other processes, keeping the new entry
+  CeedOptTuningRead(path);
+  CeedOptTuningInsert(entry);
+
+  // Write all entries and replace file
+  temp_fd = mkstemp(temp_path);
+  if (temp_fd >= 0) {
+    file = fdopen(temp_fd, "w");
+    if (file) {
+      fprintf(file, "# libCEED CPU autotuning: resource dim P_1d Q_1d num_comp block_size tile\n");
+      for (CeedInt i = 0; i < ceed_opt_tuning_num_entries; i++) {
+        const CeedOptTuningEntry *e = &ceed_opt_tuning_entries[i];
+
+        fprintf(file, "%s %" CeedInt_FMT " %" CeedInt_FMT " %" CeedInt_FMT " %" CeedInt_FMT " %" CeedInt_FMT " %" CeedInt_FMT "\n", e->resource,
+                e->dim, e->P_1d, e->Q_1d, e->num_comp, e->block_size, e->tile);
+      }
+      is_written = !ferror(file);
+      is_written = !fclose(file) && is_written;
+    } else {
+      close(temp_fd);
+    }
+    if (!is_written || rename(temp_path, path)) unlink(temp_path);
+  }
+  close(lock_fd);
+}
+
+//------------------------------------------------------------------------------
+// Get the current monotonic time, in nanoseconds
+//------------------------------------------------------------------------------
+static CeedSize CeedOptTuningGetTime(void) {
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (CeedSize)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+//------------------------------------------------------------------------------
+// Benchmark interpolation and gradient, in both directions, for each candidate block size and contraction tile
+//------------------------------------------------------------------------------
+static int CeedOptTuningBenchmark(CeedBasis basis, CeedTensorContract contract, CeedInt *block_size, CeedInt *tile) {
+  Ceed          ceed;
+  CeedInt       dim, num_comp, num_nodes, num_qpts, num_tiles;
+  const CeedInt max_block_size = ceed_opt_tuning_block_sizes[sizeof(ceed_opt_tuning_block_sizes) / sizeof(CeedInt) - 1];
+  double        best_cost      = -1.0;
+  CeedVector    e_vec, q_vec;
+
+  CeedCallBackend(CeedBasisGetCeed(basis, &ceed));
+  CeedCallBackend(CeedBasisGetDimension(basis, &dim));
+  CeedCallBackend(CeedBasisGetNumComponents(basis, &num_comp));
+  CeedCallBackend(CeedBasisGetNumNodes(basis, &num_nodes));
+  CeedCallBackend(CeedBasisGetNumQuadraturePoints(basis, &num_qpts));
+  CeedCallBackend(CeedTensorContractGetNumTiles(contract, &num_tiles));
+  CeedCallBackend(CeedVectorCreate(ceed, (CeedSize)max_block_size * num_comp * num_nodes, &e_vec));
+  CeedCallBackend(CeedVectorCreate(ceed, (CeedSize)max_block_size * num_comp * num_qpts * dim, &q_vec));
+  CeedCallBackend(CeedVectorSetValue(e_vec, 1.0));
+  CeedCallBackend(CeedVectorSetValue(q_vec, 1.0));
+
+  for (size_t b = 0; b < sizeof(ceed_opt_tuning_block_sizes) / sizeof(CeedInt); b++) {
+    const CeedInt num_elem = ceed_opt_tuning_block_sizes[b];
+
+    for (CeedInt t = 0; t < num_tiles; t++) {
+      CeedInt  num_reps = 1;
+      CeedSize time     = 0;
+      double   cost;
+
+      CeedCallBackend(CeedTensorContractSetTile(contract, t));
+      // Repeat until timing is long enough to be meaningful
+      while (time < CEED_OPT_TUNING_MIN_TIME) {
+        const CeedSize start = CeedOptTuningGetTime();
+
+        for (CeedInt r = 0; r < num_reps; r++) {
+          CeedCallBackend(CeedBasisApply(basis, num_elem, CEED_NOTRANSPOSE, CEED_EVAL_INTERP, e_vec, q_vec));
+          CeedCallBackend(CeedBasisApply(basis, num_elem, CEED_TRANSPOSE, CEED_EVAL_INTERP, q_vec, e_vec));
+          CeedCallBackend(CeedBasisApply(basis, num_elem, CEED_NOTRANSPOSE, CEED_EVAL_GRAD, e_vec, q_vec));
+          CeedCallBackend(CeedBasisApply(basis, num_elem, CEED_TRANSPOSE, CEED_EVAL_GRAD, q_vec, e_vec));
+        }
+        time = CeedOptTuningGetTime() - start;
+        if (time < CEED_OPT_TUNING_MIN_TIME) num_reps *= 2;
+      }
+      cost = (double)time / ((double)num_reps * num_elem);
+      if (best_cost < 0.0 || cost < best_cost) {
+        best_cost   = cost;
+        *block_size = num_elem;
+        *tile       = t;
+      }
+    }
+  }
+  CeedCallBackend(CeedVectorDestroy(&e_vec));
+  CeedCallBackend(CeedVectorDestroy(&q_vec));
+  CeedCallBackend(CeedDestroy(&ceed));
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Look up tuned block size and contraction tile for tensor basis, benchmarking on first use
+//------------------------------------------------------------------------------
+static int CeedOptTuningGetBasis(const char *resource, CeedBasis basis, CeedTensorContract contract, CeedInt *block_size, CeedInt *tile) {
+  int                ierr;
+  CeedInt            num_tiles;
+  CeedOptTuningEntry key, *entry;
+
+  CeedCallBackend(CeedBasisGetDimension(basis, &key.dim));
+  CeedCallBackend(CeedBasisGetNumNodes1D(basis, &key.P_1d));
+  CeedCallBackend(CeedBasisGetNumQuadraturePoints1D(basis, &key.Q_1d));
+  CeedCallBackend(CeedBasisGetNumComponents(basis, &key.num_comp));
+  snprintf(key.resource, sizeof(key.resource), "%s", resource);
+
+  pthread_mutex_lock(&ceed_opt_tuning_lock);
+  if (!ceed_opt_tuning_is_loaded) CeedOptTuningLoad();
+  entry = CeedOptTuningFind(&key);
+  if (entry) {
+    key.block_size = entry->block_size;
+    key.tile       = entry->tile;
+    ierr           = CEED_ERROR_SUCCESS;
+  } else {
+    ierr = CeedOptTuningBenchmark(basis, contract, &key.block_size, &key.tile);
+    if (!ierr) {
+      CeedOptTuningInsert(&key);
+      CeedOptTuningSave(&key);
+    }
+  }
+  pthread_mutex_unlock(&ceed_opt_tuning_lock);
+  CeedCallBackend(ierr);
+
+  // Tuning file may come from a build with different tile shapes
+  CeedCallBackend(CeedTensorContractGetNumTiles(contract, &num_tiles));
+  if (key.tile >= num_tiles) key.tile = 0;
+  *block_size = key.block_size;
+  *tile       = key.tile;
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Autotune operator
+//   Each tensor basis uses its tuned contraction tile, and the operator uses the block size tuned for the basis with the most element nodes.
+//   The block size is left unchanged unless autotuning is enabled with CEED_AUTOTUNE.
+//------------------------------------------------------------------------------
+int CeedOperatorAutotune_Opt(CeedOperator op, CeedInt *block_size) {
+  Ceed               ceed, ceed_parent;
+  const char        *resource;
+  CeedInt            num_input_fields, num_output_fields, max_size = 0;
+  CeedOperatorField *op_input_fields, *op_output_fields;
+
+  if (!CeedOptTuningIsEnabled()) return CEED_ERROR_SUCCESS;
+
+  // Tuning is per user facing backend, which the operator backend may be a delegate of
+  CeedCallBackend(CeedOperatorGetCeed(op, &ceed));
+  CeedCallBackend(CeedGetParent(ceed, &ceed_parent));
+  CeedCallBackend(CeedGetResource(ceed_parent, &resource));
+  CeedCallBackend(CeedOperatorGetFields(op, &num_input_fields, &op_input_fields, &num_output_fields, &op_output_fields));
+  for (CeedInt i = 0; i < num_input_fields + num_output_fields; i++) {
+    bool               is_tensor = false;
+    CeedBasis          basis;
+    CeedTensorContract contract = NULL;
+
+    CeedCallBackend(CeedOperatorFieldGetBasis(i < num_input_fields ? op_input_fields[i] : op_output_fields[i - num_input_fields], &basis));
+    if (basis != CEED_BASIS_NONE) CeedCallBackend(CeedBasisIsTensor(basis, &is_tensor));
+    if (is_tensor) CeedCallBackend(CeedBasisGetTensorContract(basis, &contract));
+    if (contract) {
+      CeedInt num_comp, num_nodes, basis_block_size, tile;
+
+      CeedCallBackend(CeedOptTuningGetBasis(resource, basis, contract, &basis_block_size, &tile));
+      CeedCallBackend(CeedTensorContractSetTile(contract, tile));
+      CeedCallBackend(CeedBasisGetNumComponents(basis, &num_comp));
+      CeedCallBackend(CeedBasisGetNumNodes(basis, &num_nodes));
+      if (num_comp * num_nodes > max_size) {
+        max_size    = num_comp * num_nodes;
+        *block_size = basis_block_size;
+      }
+    }
+    CeedCallBackend(CeedBasisDestroy(&basis));
+  }
+  CeedCallBackend(CeedDestroy(&ceed_parent));
+  CeedCallBackend(CeedDestroy(&ceed));
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
@@ -13,6 +13,7 @@
 
 typedef struct {
   CeedInt block_size;
+  CeedInt num_threads; /* Number of threads for element block loop, serial if <= 1 */
 } Ceed_Opt;
 
 typedef struct {
@@ -20,21 +21,70 @@ typedef struct {
 } CeedBasis_Opt;
 
 typedef struct {
-  bool                 is_identity_qf, is_identity_rstr_op;
-  bool                *skip_rstr_in, *skip_rstr_out, *apply_add_basis_out;
-  CeedElemRestriction *block_rstr;   /* Blocked versions of restrictions */
-  CeedVector          *e_vecs_full;  /* Full E-vectors, inputs followed by outputs */
-  uint64_t            *input_states; /* State counter of inputs */
-  CeedVector          *e_vecs_in;    /* Element block input E-vectors  */
-  CeedVector          *e_vecs_out;   /* Element block output E-vectors */
-  CeedVector          *q_vecs_in;    /* Element block input Q-vectors  */
-  CeedVector          *q_vecs_out;   /* Element block output Q-vectors */
-  CeedInt              num_inputs, num_outputs;
-  CeedInt              qf_size_in, qf_size_out;
-  CeedVector           qf_l_vec;
-  CeedElemRestriction  qf_block_rstr;
+  CeedScalar *tile;                        /* Aligned element block work space backing the E-vectors and Q-vectors below */
+  CeedScalar *e_tiles_in[CEED_FIELD_MAX];  /* Element block input E-vector data in tile, NULL for passive inputs */
+  CeedScalar *e_tiles_out[CEED_FIELD_MAX]; /* Element block output E-vector data in tile */
+  CeedScalar *q_tiles_in[CEED_FIELD_MAX];  /* Element block input Q-vector data in tile, NULL for passive CEED_EVAL_NONE inputs */
+  CeedScalar *q_tiles_out[CEED_FIELD_MAX]; /* Element block output Q-vector data in tile */
+  CeedVector  e_vecs_in[CEED_FIELD_MAX];   /* Element block input E-vectors  */
+  CeedVector  e_vecs_out[CEED_FIELD_MAX];  /* Element block output E-vectors */
+  CeedVector  q_vecs_in[CEED_FIELD_MAX];   /* Element block input Q-vectors  */
+  CeedVector  q_vecs_out[CEED_FIELD_MAX];  /* Element block output Q-vectors */
+  CeedVector  l_vec_in;                    /* View of active input L-vector */
+  CeedVector  l_vecs_out[CEED_FIELD_MAX];  /* Thread local output L-vector accumulators */
+  CeedSize    qf_num_calls, qf_num_points; /* QFunction applications and quadrature points since statistics were last added to the operator */
+  CeedSize    qf_time_ns;                  /* QFunction wall time since statistics were last added to the operator */
+} CeedOperatorThread_Opt;
+
+typedef struct {
+  const CeedInt *offsets; /* Blocked offsets, NULL for strided and structured restrictions */
+  CeedInt        num_elem, elem_size, num_comp, comp_stride;
+  CeedInt        strides[3];
+  CeedInt        num_elem_1d[3], P_1d; /* Elements in each dimension and nodes per dimension of structured restrictions, P_1d is 0 otherwise */
+} CeedOperatorRstr_Opt;
+
+typedef struct {
+  bool                 collect_stats; /* Whether QFunction applications are timed for operator statistics */
+  bool                 is_active_in[CEED_FIELD_MAX];
+  CeedInt              e_sizes_in[CEED_FIELD_MAX], q_sizes_in[CEED_FIELD_MAX];
+  CeedEvalMode         eval_modes_in[CEED_FIELD_MAX], eval_modes_out[CEED_FIELD_MAX];
+  CeedBasis            bases_in[CEED_FIELD_MAX], bases_out[CEED_FIELD_MAX];
+  CeedOperatorRstr_Opt rstr_in[CEED_FIELD_MAX], rstr_out[CEED_FIELD_MAX]; /* Restriction data for fused gather and scatter */
+  CeedQFunctionUser    f;
+  void                *ctx_data;
+  CeedScalar          *e_data[2 * CEED_FIELD_MAX];        /* Full E-vector data of passive inputs */
+  CeedStorageType      storage_in[CEED_FIELD_MAX];        /* Storage format of passive input full E-vectors */
+  const void          *e_data_compressed[CEED_FIELD_MAX]; /* Compressed full E-vector data of passive inputs, NULL if stored as CeedScalar */
+} CeedOperatorApplyData_Opt;
+
+typedef struct {
+  bool                    is_identity_qf, is_identity_rstr_op, is_fused, has_compressed_in;
+  bool                   *skip_rstr_in, *skip_rstr_out, *apply_add_basis_out;
+  CeedElemRestriction    *block_rstr;         /* Blocked versions of restrictions */
+  CeedVector             *e_vecs_full;        /* Full E-vectors, inputs followed by outputs */
+  uint64_t               *input_states;       /* State counter of inputs */
+  CeedStorageType        *storage_in;         /* Storage format of passive input full E-vectors for fused apply */
+  void                  **e_data_compressed;  /* Compressed copies of passive input full E-vectors for fused apply */
+  uint64_t               *compressed_states;  /* State counter of inputs when compressed copies were made */
+  CeedVector             *e_vecs_in;          /* Element block input E-vectors  */
+  CeedVector             *e_vecs_out;         /* Element block output E-vectors */
+  CeedVector             *q_vecs_in;          /* Element block input Q-vectors  */
+  CeedVector             *q_vecs_out;         /* Element block output Q-vectors */
+  CeedInt                 num_inputs, num_outputs;
+  CeedInt                 qf_size_in, qf_size_out;
+  CeedVector              qf_l_vec;
+  CeedElemRestriction     qf_block_rstr;
+  CeedInt                 block_size;    /* Number of elements in each element block, autotuned at setup if enabled */
+  CeedInt                 num_threads;
+  CeedSize                tile_size;     /* Number of scalars in each thread local tile */
+  CeedOperatorThread_Opt *threads;       /* Per-thread tiles and work vectors for fused or threaded apply */
+  CeedInt                 num_colors;    /* Number of element block colors for threaded fused apply, 0 to use thread local accumulators */
+  CeedInt                *color_offsets; /* Start of each color in color_blocks */
+  CeedInt                *color_blocks;  /* Element blocks sorted by color */
 } CeedOperator_Opt;
 
 CEED_INTERN int CeedTensorContractCreate_Opt(CeedTensorContract contract);
 
+CEED_INTERN int CeedOperatorAutotune_Opt(CeedOperator op, CeedInt *block_size);
+
 CEED_INTERN int CeedOperatorCreate_Opt(CeedOperator op);
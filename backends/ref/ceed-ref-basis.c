@@ -13,6 +13,38 @@
 
 #include "ceed-ref.h"
 
+//------------------------------------------------------------------------------
+// Tensor Contract Apply
+//   Uses the even-odd decomposition of the 1D matrix when it is centro-symmetric or centro-antisymmetric and the contraction implements it
+//------------------------------------------------------------------------------
+static inline int CeedBasisTensorContractApply_Ref(CeedBasis basis, CeedTensorContract contract, CeedInt A, CeedInt B, CeedInt C, CeedInt J,
+                                                   const CeedScalar *t, CeedTransposeMode t_mode, const CeedInt add, const CeedScalar *u,
+                                                   CeedScalar *v) {
+  bool              has_even_odd;
+  CeedInt           parity = 1;
+  const CeedScalar *interp_1d, *grad_1d, *t_even = NULL, *t_odd = NULL;
+  CeedBasis_Ref    *impl;
+
+  CeedCallBackend(CeedTensorContractHasEvenOdd(contract, &has_even_odd));
+  if (!has_even_odd) return CeedTensorContractApply(contract, A, B, C, J, t, t_mode, add, u, v);
+  CeedCallBackend(CeedBasisGetData(basis, &impl));
+  CeedCallBackend(CeedBasisGetInterp1D(basis, &interp_1d));
+  CeedCallBackend(CeedBasisGetGrad1D(basis, &grad_1d));
+  if (t == interp_1d) {
+    CeedCallBackend(CeedBasisGetInterp1DEvenOdd(basis, &t_even, &t_odd));
+  } else if (t == grad_1d) {
+    CeedCallBackend(CeedBasisGetGrad1DEvenOdd(basis, &t_even, &t_odd));
+    parity = -1;
+  } else if (t == impl->collo_grad_1d) {
+    t_even = impl->collo_grad_1d_even;
+    t_odd  = impl->collo_grad_1d_odd;
+    parity = -1;
+  }
+  if (t_even) CeedCallBackend(CeedTensorContractApplyEvenOdd(contract, A, B, C, J, t_even, t_odd, parity, t_mode, add, u, v));
+  else CeedCallBackend(CeedTensorContractApply(contract, A, B, C, J, t, t_mode, add, u, v));
+  return CEED_ERROR_SUCCESS;
+}
+
 //------------------------------------------------------------------------------
 // Basis Apply
 //------------------------------------------------------------------------------
@@ -64,17 +96,24 @@ static int CeedBasisApplyCore_Ref(CeedBasis basis, bool apply_add, CeedInt num_e
             P = Q_1d;
             Q = P_1d;
           }
-          CeedInt           pre = num_comp * CeedIntPow(P, dim - 1), post = num_elem;
-          CeedScalar        tmp[2][num_elem * num_comp * Q * CeedIntPow(P > Q ? P : Q, dim - 1)];
+          int               ierr     = CEED_ERROR_SUCCESS;
+          CeedInt           pre      = num_comp * CeedIntPow(P, dim - 1), post = num_elem;
+          const CeedSize    tmp_size = (CeedSize)num_elem * num_comp * Q * CeedIntPow(P > Q ? P : Q, dim - 1);
+          CeedScalar       *tmp[2];
           const CeedScalar *interp_1d;
 
           CeedCallBackend(CeedBasisGetInterp1D(basis, &interp_1d));
-          for (CeedInt d = 0; d < dim; d++) {
-            CeedCallBackend(CeedTensorContractApply(contract, pre, P, post, Q, interp_1d, t_mode, add && (d == dim - 1), d == 0 ? u : tmp[d % 2],
-                                                    d == dim - 1 ? v : tmp[(d + 1) % 2]));
+          CeedCallBackend(CeedGetScratch(CeedBasisReturnCeed(basis), 2 * tmp_size, &tmp[0]));
+          tmp[1] = &tmp[0][tmp_size];
+          for (CeedInt d = 0; d < dim && !ierr; d++) {
+            ierr = CeedBasisTensorContractApply_Ref(basis, contract, pre, P, post, Q, interp_1d, t_mode, add && (d == dim - 1), d == 0 ? u : tmp[d % 2],
+                                                    d == dim - 1 ? v : tmp[(d + 1) % 2]);
             pre /= P;
             post *= Q;
           }
+          // Restore scratch before returning any error
+          CeedCallBackend(CeedRestoreScratch(CeedBasisReturnCeed(basis), &tmp[0]));
+          CeedCallBackend(ierr);
         }
       } break;
       // Evaluate the gradient to/from quadrature points
@@ -94,16 +133,21 @@ static int CeedBasisApplyCore_Ref(CeedBasis basis, bool apply_add, CeedInt num_e
 
         CeedCallBackend(CeedBasisGetInterp1D(basis, &interp_1d));
         if (impl->collo_grad_1d) {
-          CeedScalar tmp[2][num_elem * num_comp * Q * CeedIntPow(P > Q ? P : Q, dim - 1)];
-          CeedScalar interp[num_elem * num_comp * Q * CeedIntPow(P > Q ? P : Q, dim - 1)];
+          int            ierr     = CEED_ERROR_SUCCESS;
+          const CeedSize tmp_size = (CeedSize)num_elem * num_comp * Q * CeedIntPow(P > Q ? P : Q, dim - 1);
+          CeedScalar    *tmp[2], *interp;
+
+          CeedCallBackend(CeedGetScratch(CeedBasisReturnCeed(basis), 3 * tmp_size, &tmp[0]));
+          tmp[1] = &tmp[0][tmp_size];
+          interp = &tmp[0][2 * tmp_size];
 
           // Interpolate to quadrature points (NoTranspose)
           //  or Grad to quadrature points (Transpose)
-          for (CeedInt d = 0; d < dim; d++) {
-            CeedCallBackend(CeedTensorContractApply(contract, pre, P, post, Q, (t_mode == CEED_NOTRANSPOSE ? interp_1d : impl->collo_grad_1d), t_mode,
-                                                    (t_mode == CEED_TRANSPOSE) && (d > 0),
+          for (CeedInt d = 0; d < dim && !ierr; d++) {
+            ierr = CeedBasisTensorContractApply_Ref(basis, contract, pre, P, post, Q, (t_mode == CEED_NOTRANSPOSE ? interp_1d : impl->collo_grad_1d),
+                                                    t_mode, (t_mode == CEED_TRANSPOSE) && (d > 0),
                                                     (t_mode == CEED_NOTRANSPOSE ? (d == 0 ? u : tmp[d % 2]) : &u[d * num_qpts * num_comp * num_elem]),
-                                                    (t_mode == CEED_NOTRANSPOSE ? (d == dim - 1 ? interp : tmp[(d + 1) % 2]) : interp)));
+                                                    (t_mode == CEED_NOTRANSPOSE ? (d == dim - 1 ? interp : tmp[(d + 1) % 2]) : interp));
             pre /= P;
             post *= Q;
           }
@@ -115,15 +159,17 @@ static int CeedBasisApplyCore_Ref(CeedBasis basis, bool apply_add, CeedInt num_e
             Q = P_1d;
           }
           pre = num_comp * CeedIntPow(P, dim - 1), post = num_elem;
-          for (CeedInt d = 0; d < dim; d++) {
-            CeedCallBackend(CeedTensorContractApply(
-                contract, pre, P, post, Q, (t_mode == CEED_NOTRANSPOSE ? impl->collo_grad_1d : interp_1d), t_mode,
-                (t_mode == CEED_NOTRANSPOSE && apply_add) || (t_mode == CEED_TRANSPOSE && (d == dim - 1)),
-                (t_mode == CEED_NOTRANSPOSE ? interp : (d == 0 ? interp : tmp[d % 2])),
-                (t_mode == CEED_NOTRANSPOSE ? &v[d * num_qpts * num_comp * num_elem] : (d == dim - 1 ? v : tmp[(d + 1) % 2]))));
+          for (CeedInt d = 0; d < dim && !ierr; d++) {
+            ierr = CeedBasisTensorContractApply_Ref(basis, contract, pre, P, post, Q, (t_mode == CEED_NOTRANSPOSE ? impl->collo_grad_1d : interp_1d),
+                                                    t_mode, (t_mode == CEED_NOTRANSPOSE && apply_add) || (t_mode == CEED_TRANSPOSE && (d == dim - 1)),
+                                                    (t_mode == CEED_NOTRANSPOSE ? interp : (d == 0 ? interp : tmp[d % 2])),
+                                                    (t_mode == CEED_NOTRANSPOSE ? &v[d * num_qpts * num_comp * num_elem] : (d == dim - 1 ? v : tmp[(d + 1) % 2])));
             pre /= P;
             post *= Q;
           }
+          // Restore scratch before returning any error
+          CeedCallBackend(CeedRestoreScratch(CeedBasisReturnCeed(basis), &tmp[0]));
+          CeedCallBackend(ierr);
         } else if (impl->has_collo_interp) {  // Qpts collocated with nodes
           const CeedScalar *grad_1d;
 
@@ -133,9 +179,9 @@ static int CeedBasisApplyCore_Ref(CeedBasis basis, bool apply_add, CeedInt num_e
           CeedInt pre = num_comp * CeedIntPow(P, dim - 1), post = num_elem;
 
           for (CeedInt d = 0; d < dim; d++) {
-            CeedCallBackend(CeedTensorContractApply(contract, pre, P, post, Q, grad_1d, t_mode, add && (d > 0),
-                                                    t_mode == CEED_NOTRANSPOSE ? u : &u[d * num_comp * num_qpts * num_elem],
-                                                    t_mode == CEED_TRANSPOSE ? v : &v[d * num_comp * num_qpts * num_elem]));
+            CeedCallBackend(CeedBasisTensorContractApply_Ref(basis, contract, pre, P, post, Q, grad_1d, t_mode, add && (d > 0),
+                                                             t_mode == CEED_NOTRANSPOSE ? u : &u[d * num_comp * num_qpts * num_elem],
+                                                             t_mode == CEED_TRANSPOSE ? v : &v[d * num_comp * num_qpts * num_elem]));
             pre /= P;
             post *= Q;
           }
@@ -148,21 +194,28 @@ static int CeedBasisApplyCore_Ref(CeedBasis basis, bool apply_add, CeedInt num_e
             P = Q_1d;
             Q = P_1d;
           }
-          CeedScalar tmp[2][num_elem * num_comp * Q * CeedIntPow(P > Q ? P : Q, dim - 1)];
+          int            ierr     = CEED_ERROR_SUCCESS;
+          const CeedSize tmp_size = (CeedSize)num_elem * num_comp * Q * CeedIntPow(P > Q ? P : Q, dim - 1);
+          CeedScalar    *tmp[2];
+
+          CeedCallBackend(CeedGetScratch(CeedBasisReturnCeed(basis), 2 * tmp_size, &tmp[0]));
+          tmp[1] = &tmp[0][tmp_size];
 
           // Dim**2 contractions, apply grad when pass == dim
-          for (CeedInt p = 0; p < dim; p++) {
+          for (CeedInt p = 0; p < dim && !ierr; p++) {
             CeedInt pre = num_comp * CeedIntPow(P, dim - 1), post = num_elem;
 
-            for (CeedInt d = 0; d < dim; d++) {
-              CeedCallBackend(CeedTensorContractApply(
-                  contract, pre, P, post, Q, (p == d) ? grad_1d : interp_1d, t_mode, add && (d == dim - 1),
-                  (d == 0 ? (t_mode == CEED_NOTRANSPOSE ? u : &u[p * num_comp * num_qpts * num_elem]) : tmp[d % 2]),
-                  (d == dim - 1 ? (t_mode == CEED_TRANSPOSE ? v : &v[p * num_comp * num_qpts * num_elem]) : tmp[(d + 1) % 2])));
+            for (CeedInt d = 0; d < dim && !ierr; d++) {
+              ierr = CeedBasisTensorContractApply_Ref(basis, contract, pre, P, post, Q, (p == d) ? grad_1d : interp_1d, t_mode, add && (d == dim - 1),
+                                                      (d == 0 ? (t_mode == CEED_NOTRANSPOSE ? u : &u[p * num_comp * num_qpts * num_elem]) : tmp[d % 2]),
+                                                      (d == dim - 1 ? (t_mode == CEED_TRANSPOSE ? v : &v[p * num_comp * num_qpts * num_elem]) : tmp[(d + 1) % 2]));
               pre /= P;
               post *= Q;
             }
           }
+          // Restore scratch before returning any error
+          CeedCallBackend(CeedRestoreScratch(CeedBasisReturnCeed(basis), &tmp[0]));
+          CeedCallBackend(ierr);
         }
       } break;
       // Retrieve interpolation weights
@@ -268,6 +321,8 @@ static int CeedBasisDestroyTensor_Ref(CeedBasis basis) {
 
   CeedCallBackend(CeedBasisGetData(basis, &impl));
   CeedCallBackend(CeedFree(&impl->collo_grad_1d));
+  CeedCallBackend(CeedFree(&impl->collo_grad_1d_even));
+  CeedCallBackend(CeedFree(&impl->collo_grad_1d_odd));
   CeedCallBackend(CeedFree(&impl));
   return CEED_ERROR_SUCCESS;
 }
@@ -301,6 +356,7 @@ int CeedBasisCreateTensorH1_Ref(CeedInt dim, CeedInt P_1d, CeedInt Q_1d, const C
   if (Q_1d >= P_1d && !impl->has_collo_interp) {
     CeedCallBackend(CeedMalloc(Q_1d * Q_1d, &impl->collo_grad_1d));
     CeedCallBackend(CeedBasisGetCollocatedGrad(basis, impl->collo_grad_1d));
+    CeedCallBackend(CeedMatrixFoldEvenOdd(impl->collo_grad_1d, Q_1d, Q_1d, -1, &impl->collo_grad_1d_even, &impl->collo_grad_1d_odd));
   }
   CeedCallBackend(CeedBasisSetData(basis, impl));
 
@@ -7,12 +7,148 @@
 
 #include <ceed.h>
 #include <ceed/backend.h>
+#include <pthread.h>
 #include <stdbool.h>
 #include <stdlib.h>
 #include <string.h>
 
 #include "ceed-ref.h"
 
+/// Minimum number of L-vector nodes for which the transpose gather is threaded
+#define CEED_RESTRICTION_OMP_MIN_NODES 16384
+
+// Serializes building transpose maps, which may be first needed by concurrent applications of a restriction
+static pthread_mutex_t ceed_ref_transpose_lock = PTHREAD_MUTEX_INITIALIZER;
+
+//------------------------------------------------------------------------------
+// Create transpose offsets and indices
+//------------------------------------------------------------------------------
+static int CeedElemRestrictionSetupTransposeCore_Ref(CeedElemRestriction rstr) {
+  bool                    *is_node;
+  CeedSize                 l_size;
+  CeedInt                  num_elem, elem_size, num_block, block_size, num_comp, num_nodes = 0;
+  CeedInt                 *ind_to_offset, *l_vec_indices, *t_offsets, *t_indices;
+  bool                    *t_orients = NULL;
+  CeedRestrictionType      rstr_type;
+  CeedElemRestriction_Ref *impl;
+
+  CeedCallBackend(CeedElemRestrictionGetData(rstr, &impl));
+  CeedCallBackend(CeedElemRestrictionGetNumElements(rstr, &num_elem));
+  CeedCallBackend(CeedElemRestrictionGetElementSize(rstr, &elem_size));
+  CeedCallBackend(CeedElemRestrictionGetNumBlocks(rstr, &num_block));
+  CeedCallBackend(CeedElemRestrictionGetBlockSize(rstr, &block_size));
+  CeedCallBackend(CeedElemRestrictionGetNumComponents(rstr, &num_comp));
+  CeedCallBackend(CeedElemRestrictionGetLVectorSize(rstr, &l_size));
+  CeedCallBackend(CeedElemRestrictionGetType(rstr, &rstr_type));
+  const CeedInt block_entries = block_size * elem_size, size_indices = num_block * block_entries;
+
+  // Count num_nodes, skipping padding elements
+  CeedCallBackend(CeedCalloc(l_size, &is_node));
+  for (CeedInt i = 0; i < size_indices; i++) {
+    if ((i / block_entries) * block_size + i % block_size < num_elem) is_node[impl->offsets[i]] = 1;
+  }
+  for (CeedSize i = 0; i < l_size; i++) num_nodes += is_node[i];
+
+  // L-vector offsets array
+  CeedCallBackend(CeedCalloc(l_size, &ind_to_offset));
+  CeedCallBackend(CeedCalloc(num_nodes, &l_vec_indices));
+  for (CeedInt i = 0, j = 0; i < l_size; i++) {
+    if (is_node[i]) {
+      l_vec_indices[j] = i;
+      ind_to_offset[i] = j++;
+    }
+  }
+  CeedCallBackend(CeedFree(&is_node));
+
+  // Compute transpose offsets and indices
+  CeedCallBackend(CeedCalloc(num_nodes + 1, &t_offsets));
+  CeedCallBackend(CeedMalloc(num_elem * elem_size, &t_indices));
+  if (rstr_type == CEED_RESTRICTION_ORIENTED) CeedCallBackend(CeedMalloc(num_elem * elem_size, &t_orients));
+  // -- Count node multiplicity
+  for (CeedInt i = 0; i < size_indices; i++) {
+    if ((i / block_entries) * block_size + i % block_size < num_elem) t_offsets[ind_to_offset[impl->offsets[i]] + 1]++;
+  }
+  // -- Convert to running sum
+  for (CeedInt i = 1; i <= num_nodes; i++) t_offsets[i] += t_offsets[i - 1];
+  // -- List all E-vector indices associated with each L-vector node, in element order
+  for (CeedInt i = 0; i < size_indices; i++) {
+    const CeedInt block = i / block_entries;
+
+    if (block * block_size + i % block_size < num_elem) {
+      const CeedInt t_ind = t_offsets[ind_to_offset[impl->offsets[i]]]++;
+
+      t_indices[t_ind] = block * block_entries * num_comp + i % block_entries;
+      if (t_orients) t_orients[t_ind] = impl->orients[i];
+    }
+  }
+  // -- Reset running sum
+  for (CeedInt i = num_nodes; i > 0; i--) t_offsets[i] = t_offsets[i - 1];
+  t_offsets[0] = 0;
+  CeedCallBackend(CeedFree(&ind_to_offset));
+
+  impl->num_nodes     = num_nodes;
+  impl->l_vec_indices = l_vec_indices;
+  impl->t_indices     = t_indices;
+  impl->t_orients     = t_orients;
+  impl->t_offsets     = t_offsets;
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Create transpose offsets and indices on first use
+//   Only full range transpose applications use the map, so restrictions applied one element block at a time, as in the opt backends, never
+//   build it
+//------------------------------------------------------------------------------
+static int CeedElemRestrictionSetupTranspose_Ref(CeedElemRestriction rstr) {
+  int                      ierr = CEED_ERROR_SUCCESS;
+  CeedElemRestriction_Ref *impl;
+
+  CeedCallBackend(CeedElemRestrictionGetData(rstr, &impl));
+  pthread_mutex_lock(&ceed_ref_transpose_lock);
+  if (!impl->t_offsets) ierr = CeedElemRestrictionSetupTransposeCore_Ref(rstr);
+  pthread_mutex_unlock(&ceed_ref_transpose_lock);
+  return ierr;
+}
+
+//------------------------------------------------------------------------------
+// L-vector offset of the first node of an element of a structured restriction
+//------------------------------------------------------------------------------
+static inline CeedInt CeedElemRestrictionStructuredOrigin_Ref(const CeedInt num_elem_1d[3], const CeedInt P_1d, const CeedInt elem) {
+  const CeedInt e_x = elem % num_elem_1d[0], e_y = (elem / num_elem_1d[0]) % num_elem_1d[1], e_z = elem / (num_elem_1d[0] * num_elem_1d[1]);
+  const CeedInt num_nodes_x = num_elem_1d[0] * (P_1d - 1) + 1, num_nodes_y = num_elem_1d[1] * (P_1d - 1) + 1;
+
+  return (P_1d - 1) * (e_x + num_nodes_x * (e_y + num_nodes_y * e_z));
+}
+
+//------------------------------------------------------------------------------
+// Create offsets for structured restriction
+//------------------------------------------------------------------------------
+static int CeedElemRestrictionSetupStructuredOffsets_Ref(CeedElemRestriction rstr) {
+  CeedInt                  num_elem, elem_size, num_block, block_size, num_elem_1d[3], P_1d;
+  CeedInt                 *offsets;
+  CeedElemRestriction_Ref *impl;
+
+  CeedCallBackend(CeedElemRestrictionGetData(rstr, &impl));
+  CeedCallBackend(CeedElemRestrictionGetNumElements(rstr, &num_elem));
+  CeedCallBackend(CeedElemRestrictionGetElementSize(rstr, &elem_size));
+  CeedCallBackend(CeedElemRestrictionGetNumBlocks(rstr, &num_block));
+  CeedCallBackend(CeedElemRestrictionGetBlockSize(rstr, &block_size));
+  CeedCallBackend(CeedElemRestrictionGetStructure(rstr, NULL, num_elem_1d, &P_1d));
+
+  // Same blocked layout as the offsets given to CeedElemRestrictionCreateBlocked, with padding repeating the last element
+  CeedCallBackend(CeedMalloc(CeedIntMax(num_block * block_size * elem_size, 1), &offsets));
+  for (CeedInt b = 0; b < num_block; b++) {
+    for (CeedInt j = 0; j < block_size; j++) {
+      const CeedInt origin = CeedElemRestrictionStructuredOrigin_Ref(num_elem_1d, P_1d, CeedIntMin(b * block_size + j, num_elem - 1));
+
+      for (CeedInt n = 0; n < elem_size; n++) offsets[(b * elem_size + n) * block_size + j] = origin + impl->stencil[n];
+    }
+  }
+  impl->offsets_owned = offsets;
+  impl->offsets       = offsets;
+  return CEED_ERROR_SUCCESS;
+}
+
 //------------------------------------------------------------------------------
 // Core ElemRestriction Apply Code
 //------------------------------------------------------------------------------
@@ -74,6 +210,31 @@ static inline int CeedElemRestrictionApplyOffsetNoTranspose_Ref_Core(CeedElemRes
   return CEED_ERROR_SUCCESS;
 }
 
+static inline int CeedElemRestrictionApplyStructuredNoTranspose_Ref_Core(CeedElemRestriction rstr, const CeedInt num_comp, const CeedInt block_size,
+                                                                         const CeedInt comp_stride, const CeedInt start, const CeedInt stop,
+                                                                         const CeedInt num_elem, const CeedInt elem_size, const CeedSize v_offset,
+                                                                         const CeedScalar *__restrict__ uu, CeedScalar *__restrict__ vv) {
+  // Structured restriction, offsets are the element origin plus a stencil shared by all elements
+  CeedInt                  num_elem_1d[3], P_1d;
+  CeedElemRestriction_Ref *impl;
+
+  CeedCallBackend(CeedElemRestrictionGetData(rstr, &impl));
+  CeedCallBackend(CeedElemRestrictionGetStructure(rstr, NULL, num_elem_1d, &P_1d));
+  for (CeedSize e = start * block_size; e < stop * block_size; e += block_size) {
+    CeedInt origin[block_size];
+
+    for (CeedInt j = 0; j < block_size; j++) origin[j] = CeedElemRestrictionStructuredOrigin_Ref(num_elem_1d, P_1d, CeedIntMin(e + j, num_elem - 1));
+    for (CeedSize k = 0; k < num_comp; k++) {
+      for (CeedSize n = 0; n < elem_size; n++) {
+        CeedPragmaSIMD for (CeedSize j = 0; j < block_size; j++) {
+          vv[elem_size * (k * block_size + e * num_comp) + n * block_size + j - v_offset] = uu[origin[j] + impl->stencil[n] + k * comp_stride];
+        }
+      }
+    }
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
 static inline int CeedElemRestrictionApplyOrientedNoTranspose_Ref_Core(CeedElemRestriction rstr, const CeedInt num_comp, const CeedInt block_size,
                                                                        const CeedInt comp_stride, const CeedInt start, const CeedInt stop,
                                                                        const CeedInt num_elem, const CeedInt elem_size, const CeedSize v_offset,
@@ -241,6 +402,36 @@ static inline int CeedElemRestrictionApplyOffsetTranspose_Ref_Core(CeedElemRestr
   return CEED_ERROR_SUCCESS;
 }
 
+static inline int CeedElemRestrictionApplyStructuredTranspose_Ref_Core(CeedElemRestriction rstr, const CeedInt num_comp, const CeedInt block_size,
+                                                                       const CeedInt comp_stride, const CeedInt start, const CeedInt stop,
+                                                                       const CeedInt num_elem, const CeedInt elem_size, const CeedSize v_offset,
+                                                                       const CeedScalar *__restrict__ uu, CeedScalar *__restrict__ vv) {
+  // Structured restriction, offsets are the element origin plus a stencil shared by all elements
+  CeedInt                  num_elem_1d[3], P_1d;
+  CeedElemRestriction_Ref *impl;
+
+  CeedCallBackend(CeedElemRestrictionGetData(rstr, &impl));
+  CeedCallBackend(CeedElemRestrictionGetStructure(rstr, NULL, num_elem_1d, &P_1d));
+  for (CeedSize e = start * block_size; e < stop * block_size; e += block_size) {
+    // Iteration bound set to discard padding elements
+    const CeedInt num_active = CeedIntMin(block_size, num_elem - e);
+    CeedInt       origin[block_size];
+
+    for (CeedInt j = 0; j < num_active; j++) origin[j] = CeedElemRestrictionStructuredOrigin_Ref(num_elem_1d, P_1d, e + j);
+    for (CeedSize k = 0; k < num_comp; k++) {
+      for (CeedSize n = 0; n < elem_size; n++) {
+        for (CeedSize j = 0; j < num_active; j++) {
+          CeedScalar vv_loc;
+
+          vv_loc = uu[elem_size * (k * block_size + e * num_comp) + n * block_size + j - v_offset];
+          CeedPragmaAtomic vv[origin[j] + impl->stencil[n] + k * comp_stride] += vv_loc;
+        }
+      }
+    }
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
 static inline int CeedElemRestrictionApplyOrientedTranspose_Ref_Core(CeedElemRestriction rstr, const CeedInt num_comp, const CeedInt block_size,
                                                                      const CeedInt comp_stride, const CeedInt start, const CeedInt stop,
                                                                      const CeedInt num_elem, const CeedInt elem_size, const CeedSize v_offset,
@@ -265,6 +456,37 @@ static inline int CeedElemRestrictionApplyOrientedTranspose_Ref_Core(CeedElemRes
   return CEED_ERROR_SUCCESS;
 }
 
+static inline int CeedElemRestrictionApplyOffsetTransposeGather_Ref_Core(CeedElemRestriction rstr, const CeedInt num_comp, const CeedInt block_size,
+                                                                         const CeedInt comp_stride, const CeedInt elem_size, bool use_signs,
+                                                                         const CeedScalar *__restrict__ uu, CeedScalar *__restrict__ vv) {
+  // Restriction with offsets and optional orientations, each L-vector node gathers from its E-vector entries
+  CeedElemRestriction_Ref *impl;
+
+  CeedCallBackend(CeedElemRestrictionGetData(rstr, &impl));
+  CeedCallBackend(CeedElemRestrictionSetupTranspose_Ref(rstr));
+  {
+    const CeedInt   num_nodes     = impl->num_nodes;
+    const CeedInt  *l_vec_indices = impl->l_vec_indices, *t_offsets = impl->t_offsets, *t_indices = impl->t_indices;
+    const bool     *t_orients     = use_signs ? impl->t_orients : NULL;
+    const CeedSize  e_comp_stride = block_size * (CeedSize)elem_size;
+
+    CeedPragmaOMP(parallel for schedule(static) if (num_nodes >= CEED_RESTRICTION_OMP_MIN_NODES))
+    for (CeedInt i = 0; i < num_nodes; i++) {
+      for (CeedSize k = 0; k < num_comp; k++) {
+        CeedScalar vv_loc = 0.0;
+
+        if (t_orients) {
+          for (CeedInt j = t_offsets[i]; j < t_offsets[i + 1]; j++) vv_loc += uu[t_indices[j] + k * e_comp_stride] * (t_orients[j] ? -1.0 : 1.0);
+        } else {
+          for (CeedInt j = t_offsets[i]; j < t_offsets[i + 1]; j++) vv_loc += uu[t_indices[j] + k * e_comp_stride];
+        }
+        vv[l_vec_indices[i] + k * comp_stride] += vv_loc;
+      }
+    }
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
 static inline int CeedElemRestrictionApplyCurlOrientedTranspose_Ref_Core(CeedElemRestriction rstr, const CeedInt num_comp, const CeedInt block_size,
                                                                          const CeedInt comp_stride, const CeedInt start, const CeedInt stop,
                                                                          const CeedInt num_elem, const CeedInt elem_size, const CeedSize v_offset,
@@ -396,12 +618,14 @@ static inline int CeedElemRestrictionApplyAtPointsInElement_Ref_Core(CeedElemRes
 static inline int CeedElemRestrictionApply_Ref_Core(CeedElemRestriction rstr, const CeedInt num_comp, const CeedInt block_size,
                                                     const CeedInt comp_stride, const CeedInt start, const CeedInt stop, CeedTransposeMode t_mode,
                                                     bool use_signs, bool use_orients, CeedVector u, CeedVector v, CeedRequest *request) {
-  CeedInt             num_elem, elem_size;
-  CeedSize            v_offset = 0;
-  CeedRestrictionType rstr_type;
-  const CeedScalar   *uu;
-  CeedScalar         *vv;
+  CeedInt                  num_elem, elem_size;
+  CeedSize                 v_offset = 0;
+  CeedRestrictionType      rstr_type;
+  const CeedScalar        *uu;
+  CeedScalar              *vv;
+  CeedElemRestriction_Ref *impl;
 
+  CeedCallBackend(CeedElemRestrictionGetData(rstr, &impl));
   CeedCallBackend(CeedElemRestrictionGetNumElements(rstr, &num_elem));
   CeedCallBackend(CeedElemRestrictionGetElementSize(rstr, &elem_size));
   v_offset = start * block_size * elem_size * (CeedSize)num_comp;
@@ -421,17 +645,31 @@ static inline int CeedElemRestrictionApply_Ref_Core(CeedElemRestriction rstr, co
     // uu has shape [elem_size, num_comp, num_elem], row-major
     // vv has shape [nnodes, num_comp]
     // Sum into for transpose mode
+    // Offset based restrictions applied to all elements gather into each L-vector node instead of scattering from each element
+    // Operators that transpose one element block at a time, as in the opt backends, keep the scatter loop
+    const bool is_full_range = start == 0 && stop * block_size >= num_elem;
+
     switch (rstr_type) {
       case CEED_RESTRICTION_STRIDED:
         CeedCallBackend(
             CeedElemRestrictionApplyStridedTranspose_Ref_Core(rstr, num_comp, block_size, start, stop, num_elem, elem_size, v_offset, uu, vv));
         break;
       case CEED_RESTRICTION_STANDARD:
-        CeedCallBackend(CeedElemRestrictionApplyOffsetTranspose_Ref_Core(rstr, num_comp, block_size, comp_stride, start, stop, num_elem, elem_size,
-                                                                         v_offset, uu, vv));
+        if (impl->stencil) {
+          CeedCallBackend(CeedElemRestrictionApplyStructuredTranspose_Ref_Core(rstr, num_comp, block_size, comp_stride, start, stop, num_elem,
+                                                                               elem_size, v_offset, uu, vv));
+        } else if (is_full_range) {
+          CeedCallBackend(CeedElemRestrictionApplyOffsetTransposeGather_Ref_Core(rstr, num_comp, block_size, comp_stride, elem_size, false, uu, vv));
+        } else {
+          CeedCallBackend(CeedElemRestrictionApplyOffsetTranspose_Ref_Core(rstr, num_comp, block_size, comp_stride, start, stop, num_elem, elem_size,
+                                                                           v_offset, uu, vv));
+        }
         break;
       case CEED_RESTRICTION_ORIENTED:
-        if (use_signs) {
+        if (is_full_range) {
+          CeedCallBackend(
+              CeedElemRestrictionApplyOffsetTransposeGather_Ref_Core(rstr, num_comp, block_size, comp_stride, elem_size, use_signs, uu, vv));
+        } else if (use_signs) {
           CeedCallBackend(CeedElemRestrictionApplyOrientedTranspose_Ref_Core(rstr, num_comp, block_size, comp_stride, start, stop, num_elem,
                                                                              elem_size, v_offset, uu, vv));
         } else {
@@ -446,6 +684,8 @@ static inline int CeedElemRestrictionApply_Ref_Core(CeedElemRestriction rstr, co
         } else if (use_orients) {
           CeedCallBackend(CeedElemRestrictionApplyCurlOrientedUnsignedTranspose_Ref_Core(rstr, num_comp, block_size, comp_stride, start, stop,
                                                                                          num_elem, elem_size, v_offset, uu, vv));
+        } else if (is_full_range) {
+          CeedCallBackend(CeedElemRestrictionApplyOffsetTransposeGather_Ref_Core(rstr, num_comp, block_size, comp_stride, elem_size, false, uu, vv));
         } else {
           CeedCallBackend(CeedElemRestrictionApplyOffsetTranspose_Ref_Core(rstr, num_comp, block_size, comp_stride, start, stop, num_elem, elem_size,
                                                                            v_offset, uu, vv));
@@ -467,8 +707,13 @@ static inline int CeedElemRestrictionApply_Ref_Core(CeedElemRestriction rstr, co
             CeedElemRestrictionApplyStridedNoTranspose_Ref_Core(rstr, num_comp, block_size, start, stop, num_elem, elem_size, v_offset, uu, vv));
         break;
       case CEED_RESTRICTION_STANDARD:
-        CeedCallBackend(CeedElemRestrictionApplyOffsetNoTranspose_Ref_Core(rstr, num_comp, block_size, comp_stride, start, stop, num_elem, elem_size,
-                                                                           v_offset, uu, vv));
+        if (impl->stencil) {
+          CeedCallBackend(CeedElemRestrictionApplyStructuredNoTranspose_Ref_Core(rstr, num_comp, block_size, comp_stride, start, stop, num_elem,
+                                                                                 elem_size, v_offset, uu, vv));
+        } else {
+          CeedCallBackend(CeedElemRestrictionApplyOffsetNoTranspose_Ref_Core(rstr, num_comp, block_size, comp_stride, start, stop, num_elem,
+                                                                             elem_size, v_offset, uu, vv));
+        }
         break;
       case CEED_RESTRICTION_ORIENTED:
         if (use_signs) {
@@ -694,6 +939,15 @@ static int CeedElemRestrictionGetOffsets_Ref(CeedElemRestriction rstr, CeedMemTy
 
   CeedCheck(mem_type == CEED_MEM_HOST, CeedElemRestrictionReturnCeed(rstr), CEED_ERROR_BACKEND, "Can only provide to HOST memory");
 
+  // Structured restriction only builds offsets when requested; the check is inside the critical section, as another thread may be building them
+  if (impl->stencil) {
+    int ierr = CEED_ERROR_SUCCESS;
+
+    CeedPragmaCritical(CeedElemRestrictionSetupStructuredOffsets_Ref) {
+      if (!impl->offsets) ierr = CeedElemRestrictionSetupStructuredOffsets_Ref(rstr);
+    }
+    CeedCallBackend(ierr);
+  }
   *offsets = impl->offsets;
   return CEED_ERROR_SUCCESS;
 }
@@ -736,6 +990,11 @@ static int CeedElemRestrictionDestroy_Ref(CeedElemRestriction rstr) {
   CeedCallBackend(CeedFree(&impl->offsets_owned));
   CeedCallBackend(CeedFree(&impl->orients_owned));
   CeedCallBackend(CeedFree(&impl->curl_orients_owned));
+  CeedCallBackend(CeedFree(&impl->l_vec_indices));
+  CeedCallBackend(CeedFree(&impl->t_offsets));
+  CeedCallBackend(CeedFree(&impl->t_indices));
+  CeedCallBackend(CeedFree(&impl->t_orients));
+  CeedCallBackend(CeedFree(&impl->stencil));
   CeedCallBackend(CeedFree(&impl));
   return CEED_ERROR_SUCCESS;
 }
@@ -745,6 +1004,7 @@ static int CeedElemRestrictionDestroy_Ref(CeedElemRestriction rstr) {
 //------------------------------------------------------------------------------
 int CeedElemRestrictionCreate_Ref(CeedMemType mem_type, CeedCopyMode copy_mode, const CeedInt *offsets, const bool *orients,
                                   const CeedInt8 *curl_orients, CeedElemRestriction rstr) {
+  bool                     is_structured;
   Ceed                     ceed;
   CeedInt                  num_elem, elem_size, num_block, block_size, num_comp, comp_stride, num_points = 0, num_offsets;
   CeedRestrictionType      rstr_type;
@@ -758,6 +1018,7 @@ int CeedElemRestrictionCreate_Ref(CeedMemType mem_type, CeedCopyMode copy_mode,
   CeedCallBackend(CeedElemRestrictionGetNumComponents(rstr, &num_comp));
   CeedCallBackend(CeedElemRestrictionGetCompStride(rstr, &comp_stride));
   CeedCallBackend(CeedElemRestrictionGetType(rstr, &rstr_type));
+  CeedCallBackend(CeedElemRestrictionIsStructured(rstr, &is_structured));
 
   CeedCheck(mem_type == CEED_MEM_HOST, ceed, CEED_ERROR_BACKEND, "Only MemType = HOST supported");
 
@@ -794,7 +1055,18 @@ int CeedElemRestrictionCreate_Ref(CeedMemType mem_type, CeedCopyMode copy_mode,
   }
 
   // Offsets data
-  if (rstr_type != CEED_RESTRICTION_STRIDED) {
+  if (is_structured) {
+    CeedInt  num_elem_1d[3], P_1d, num_nodes_x, num_nodes_y;
+    CeedInt *stencil;
+
+    // Structured restriction only stores the offsets of the nodes of an element from its first node
+    CeedCallBackend(CeedElemRestrictionGetStructure(rstr, NULL, num_elem_1d, &P_1d));
+    num_nodes_x = num_elem_1d[0] * (P_1d - 1) + 1;
+    num_nodes_y = num_elem_1d[1] * (P_1d - 1) + 1;
+    CeedCallBackend(CeedMalloc(elem_size, &stencil));
+    for (CeedInt n = 0; n < elem_size; n++) stencil[n] = n % P_1d + num_nodes_x * ((n / P_1d) % P_1d + num_nodes_y * (n / (P_1d * P_1d)));
+    impl->stencil = stencil;
+  } else if (rstr_type != CEED_RESTRICTION_STRIDED) {
     const char *resource;
 
     // Check indices for ref or memcheck backends
@@ -910,3 +1182,11 @@ int CeedElemRestrictionCreate_Ref(CeedMemType mem_type, CeedCopyMode copy_mode,
 }
 
 //------------------------------------------------------------------------------
+// ElemRestriction Create Structured
+//------------------------------------------------------------------------------
+int CeedElemRestrictionCreateStructured_Ref(CeedElemRestriction rstr) {
+  CeedCallBackend(CeedElemRestrictionCreate_Ref(CEED_MEM_HOST, CEED_COPY_VALUES, NULL, NULL, NULL, rstr));
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
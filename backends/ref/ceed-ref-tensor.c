@@ -37,6 +37,52 @@ static int CeedTensorContractApply_Ref(CeedTensorContract contract, CeedInt A, C
   return CEED_ERROR_SUCCESS;
 }
 
+//------------------------------------------------------------------------------
+// Tensor Contract Apply Even-Odd
+//------------------------------------------------------------------------------
+static int CeedTensorContractApplyEvenOdd_Ref(CeedTensorContract contract, CeedInt A, CeedInt B, CeedInt C, CeedInt J,
+                                              const CeedScalar *restrict t_even, const CeedScalar *restrict t_odd, CeedInt parity,
+                                              CeedTransposeMode t_mode, const CeedInt add, const CeedScalar *restrict u, CeedScalar *restrict v) {
+  const CeedInt B_half = (B + 1) / 2, J_half = (J + 1) / 2;
+  CeedInt       t_stride_0 = B_half, t_stride_1 = 1;
+
+  if (t_mode == CEED_TRANSPOSE) {
+    t_stride_0 = 1;
+    t_stride_1 = J_half;
+    // Halves of the transpose of a centro-antisymmetric matrix are exchanged
+    if (parity < 0) {
+      const CeedScalar *t_swap = t_even;
+
+      t_even = t_odd;
+      t_odd  = t_swap;
+    }
+  }
+
+  for (CeedInt a = 0; a < A; a++) {
+    for (CeedInt j = 0; j < J_half; j++) {
+      for (CeedInt c = 0; c < C; c++) {
+        CeedScalar v_even = 0.0, v_odd = 0.0;
+
+        // Fold mirrored entries of u, with the middle entry for odd B only in the even part
+        for (CeedInt b = 0; b < B_half; b++) {
+          const CeedScalar u_0 = u[(a * B + b) * C + c], u_1 = u[(a * B + B - 1 - b) * C + c];
+
+          v_even += t_even[j * t_stride_0 + b * t_stride_1] * (2 * b + 1 == B ? u_0 : u_0 + u_1);
+          v_odd += t_odd[j * t_stride_0 + b * t_stride_1] * (u_0 - u_1);
+        }
+        // Unfold into mirrored entries of v, with the middle entry for odd J only written once
+        if (!add) v[(a * J + j) * C + c] = 0.0;
+        v[(a * J + j) * C + c] += v_even + v_odd;
+        if (2 * j + 1 != J) {
+          if (!add) v[(a * J + J - 1 - j) * C + c] = 0.0;
+          v[(a * J + J - 1 - j) * C + c] += parity * (v_even - v_odd);
+        }
+      }
+    }
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
 //------------------------------------------------------------------------------
 // Tensor Contract Destroy
 //------------------------------------------------------------------------------
@@ -50,6 +96,7 @@ int CeedTensorContractCreate_Ref(CeedTensorContract contract) {
 
   CeedCallBackend(CeedTensorContractGetCeed(contract, &ceed));
   CeedCallBackend(CeedSetBackendFunction(ceed, "TensorContract", contract, "Apply", CeedTensorContractApply_Ref));
+  CeedCallBackend(CeedSetBackendFunction(ceed, "TensorContract", contract, "ApplyEvenOdd", CeedTensorContractApplyEvenOdd_Ref));
   CeedCallBackend(CeedSetBackendFunction(ceed, "TensorContract", contract, "Destroy", CeedTensorContractDestroy_Ref));
   CeedCallBackend(CeedDestroy(&ceed));
   return CEED_ERROR_SUCCESS;
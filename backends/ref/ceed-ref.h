@@ -27,12 +27,19 @@ typedef struct {
   const CeedInt8 *curl_orients; /* Tridiagonal matrix (row-major) for a general transformation during restriction */
   const CeedInt8 *curl_orients_borrowed;
   const CeedInt8 *curl_orients_owned;
+  CeedInt         num_nodes;     /* Number of L-vector nodes in the transpose map */
+  const CeedInt  *l_vec_indices; /* L-vector index of each node in the transpose map */
+  const CeedInt  *t_offsets;     /* Transpose map offsets, built on the first full range transpose application */
+  const CeedInt  *t_indices;     /* E-vector indices, for the first component, contributing to each node */
+  const bool     *t_orients;     /* Orientation of each transpose map entry, if it exists */
+  const CeedInt  *stencil;       /* L-vector offsets of element nodes from the first node, for structured restriction without offsets */
   int (*Apply)(CeedElemRestriction, CeedInt, CeedInt, CeedInt, CeedInt, CeedInt, CeedTransposeMode, bool, bool, CeedVector, CeedVector,
                CeedRequest *);
 } CeedElemRestriction_Ref;
 
 typedef struct {
   CeedScalar *collo_grad_1d;
+  CeedScalar *collo_grad_1d_even, *collo_grad_1d_odd;
   bool        has_collo_interp;
 } CeedBasis_Ref;
 
@@ -66,6 +73,7 @@ CEED_INTERN int CeedVectorCreate_Ref(CeedSize n, CeedVector vec);
 
 CEED_INTERN int CeedElemRestrictionCreate_Ref(CeedMemType mem_type, CeedCopyMode copy_mode, const CeedInt *offsets, const bool *orients,
                                               const CeedInt8 *curl_orients, CeedElemRestriction r);
+CEED_INTERN int CeedElemRestrictionCreateStructured_Ref(CeedElemRestriction r);
 
 CEED_INTERN int CeedBasisCreateTensorH1_Ref(CeedInt dim, CeedInt P_1d, CeedInt Q_1d, const CeedScalar *interp_1d, const CeedScalar *grad_1d,
                                             const CeedScalar *q_ref_1d, const CeedScalar *q_weight_1d, CeedBasis basis);
@@ -0,0 +1,336 @@
+// Copyright (c) 2017-2025, Lawrence Livermore National Security, LLC and other CEED contributors.
+// All Rights Reserved. See the top-level LICENSE and NOTICE files for details.
+//
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// This file is part of CEED:  http://github.com/ceed
+
+//                        libCEED Benchmark Problems
+//
+// This benchmark times the CEED benchmark problems BP1-BP6 with libCEED alone, without PETSc or MPI.
+// The operators are built from the gallery QFunctions on a structured hexahedral mesh of the unit cube.
+// For each backend, problem, polynomial degree, and mesh size, the benchmark times operator application, diagonal assembly, and full assembly,
+// with warm up runs before the timed repetitions.
+//
+// Each run is written to stdout as one JSON object per line, which `postprocess_base.py` reads along with the PETSc benchmark logs.
+//
+// Build with:
+//
+//     make build/ceed-bps
+//
+// or build and run for the compiled backends, or those set with `BACKENDS`, writing `benchmarks/ceed-bps-output.json`, with:
+//
+//     make bench-ceed-bps
+//
+// Sample runs:
+//
+//     build/ceed-bps
+//     build/ceed-bps -ceed /cpu/self/opt/blocked -ceed /cpu/self/xsmm/blocked -problem 1 -problem 3
+//     build/ceed-bps -ceed /gpu/cuda -p_min 2 -p_max 6 -max_dofs 10000000 > ceed-bps-output.json
+
+/// @file
+/// libCEED benchmark problems BP1-BP6 without PETSc or MPI
+
+#define _POSIX_C_SOURCE 200809L
+#include <ceed.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#define MAX_BACKENDS 32
+#define NUM_BPS 6
+
+// Benchmark problem definitions
+typedef struct {
+  CeedInt      num_comp, q_data_size, q_extra;
+  CeedQuadMode quad_mode;
+  const char  *setup_name, *apply_name, *in_name, *out_name;
+} BPData;
+
+static const BPData bp_data[NUM_BPS] = {
+    {1, 1, 1, CEED_GAUSS,         "Mass3DBuild",    "MassApply",             "u",  "v" },
+    {3, 1, 1, CEED_GAUSS,         "Mass3DBuild",    "Vector3MassApply",      "u",  "v" },
+    {1, 6, 1, CEED_GAUSS,         "Poisson3DBuild", "Poisson3DApply",        "du", "dv"},
+    {3, 6, 1, CEED_GAUSS,         "Poisson3DBuild", "Vector3Poisson3DApply", "du", "dv"},
+    {1, 6, 0, CEED_GAUSS_LOBATTO, "Poisson3DBuild", "Poisson3DApply",        "du", "dv"},
+    {3, 6, 0, CEED_GAUSS_LOBATTO, "Poisson3DBuild", "Vector3Poisson3DApply", "du", "dv"},
+};
+
+// Benchmark options
+typedef struct {
+  CeedInt  warmup, repetitions, q_extra;
+  CeedSize max_assembly_entries;
+  char     hostname[256];
+} BenchmarkOptions;
+
+// Auxiliary functions
+static double Wtime(void);
+static void   BuildCartesianRestriction(Ceed ceed, const CeedInt num_xyz[3], CeedInt degree, CeedInt num_comp, CeedInt *size,
+                                        CeedElemRestriction *restriction);
+static void   SetCartesianMeshCoords(const CeedInt num_xyz[3], CeedVector mesh_coords);
+static void   RunBenchmark(Ceed ceed, const char *resource, CeedInt bp, CeedInt degree, const CeedInt num_xyz[3], const BenchmarkOptions *options);
+
+// Main benchmark driver
+int main(int argc, const char *argv[]) {
+  const char      *resources[MAX_BACKENDS];
+  CeedInt          num_resources = 0, problems[NUM_BPS], num_problems = 0, p_min = 1, p_max = 8;
+  CeedSize         min_dofs = 1000, max_dofs = 3 * (1 << 20);
+  BenchmarkOptions options = {.warmup = 2, .repetitions = 10, .q_extra = -1, .max_assembly_entries = 1 << 24};
+
+  // Process command line arguments.
+  for (int ia = 1; ia < argc; ia++) {
+    int next_arg = ((ia + 1) < argc), parse_error = 0;
+
+    if (!strcmp(argv[ia], "-h")) {
+      printf("Usage: %s [options]\n", argv[0]);
+      printf("  -ceed <resource>              libCEED backend to benchmark, may be repeated (default: /cpu/self)\n");
+      printf("  -problem <1-6>                benchmark problem to run, may be repeated (default: all)\n");
+      printf("  -p_min <p>, -p_max <p>        range of polynomial degrees (default: 1 to 8)\n");
+      printf("  -q_extra <q>                  extra 1D quadrature points (default: 1 for BP1-BP4, 0 for BP5-BP6)\n");
+      printf("  -min_dofs <n>, -max_dofs <n>  range of problem sizes in unknowns (default: 1000 to 3145728)\n");
+      printf("  -warmup <n>                   untimed runs before timing (default: 2)\n");
+      printf("  -repetitions <n>              timed runs (default: 10)\n");
+      printf("  -max_assembly_entries <n>     largest full assembly to time, in coordinate entries (default: 16777216)\n");
+      return 0;
+    } else if (!strcmp(argv[ia], "-c") || !strcmp(argv[ia], "-ceed")) {
+      parse_error = next_arg && num_resources < MAX_BACKENDS ? resources[num_resources++] = argv[++ia], 0 : 1;
+    } else if (!strcmp(argv[ia], "-problem")) {
+      parse_error = next_arg && num_problems < NUM_BPS ? problems[num_problems++] = atoi(argv[++ia]), 0 : 1;
+      if (!parse_error) parse_error = problems[num_problems - 1] < 1 || problems[num_problems - 1] > NUM_BPS;
+    } else if (!strcmp(argv[ia], "-p_min")) {
+      parse_error = next_arg ? p_min = atoi(argv[++ia]), 0 : 1;
+    } else if (!strcmp(argv[ia], "-p_max")) {
+      parse_error = next_arg ? p_max = atoi(argv[++ia]), 0 : 1;
+    } else if (!strcmp(argv[ia], "-q_extra")) {
+      parse_error = next_arg ? options.q_extra = atoi(argv[++ia]), 0 : 1;
+    } else if (!strcmp(argv[ia], "-min_dofs")) {
+      parse_error = next_arg ? min_dofs = atoll(argv[++ia]), 0 : 1;
+    } else if (!strcmp(argv[ia], "-max_dofs")) {
+      parse_error = next_arg ? max_dofs = atoll(argv[++ia]), 0 : 1;
+    } else if (!strcmp(argv[ia], "-warmup")) {
+      parse_error = next_arg ? options.warmup = atoi(argv[++ia]), 0 : 1;
+    } else if (!strcmp(argv[ia], "-repetitions")) {
+      parse_error = next_arg ? options.repetitions = atoi(argv[++ia]), 0 : 1;
+    } else if (!strcmp(argv[ia], "-max_assembly_entries")) {
+      parse_error = next_arg ? options.max_assembly_entries = atoll(argv[++ia]), 0 : 1;
+    } else {
+      parse_error = 1;
+    }
+    if (parse_error || options.repetitions < 1 || p_min < 1 || p_max < p_min) {
+      fprintf(stderr, "Error parsing command line option %s, use -h for help.\n", argv[ia]);
+      return 1;
+    }
+  }
+  if (num_resources == 0) resources[num_resources++] = "/cpu/self";
+  if (num_problems == 0) {
+    for (CeedInt i = 0; i < NUM_BPS; i++) problems[num_problems++] = i + 1;
+  }
+  if (gethostname(options.hostname, sizeof(options.hostname))) strcpy(options.hostname, "unknown");
+  options.hostname[sizeof(options.hostname) - 1] = '\0';
+
+  // Sweep backends, problems, degrees, and mesh sizes
+  for (CeedInt r = 0; r < num_resources; r++) {
+    Ceed ceed;
+
+    CeedInit(resources[r], &ceed);
+    for (CeedInt b = 0; b < num_problems; b++) {
+      const CeedInt num_comp = bp_data[problems[b] - 1].num_comp;
+
+      for (CeedInt degree = p_min; degree <= p_max; degree++) {
+        // Double the number of elements, cycling through the dimensions, until the problem is too large
+        CeedInt num_xyz[3] = {1, 1, 1};
+
+        for (CeedInt s = 0;; s++) {
+          CeedSize num_dofs = num_comp;
+
+          for (CeedInt d = 0; d < 3; d++) num_dofs *= num_xyz[d] * degree + 1;
+          if (num_dofs > max_dofs) break;
+          if (num_dofs >= min_dofs) RunBenchmark(ceed, resources[r], problems[b], degree, num_xyz, &options);
+          num_xyz[s % 3] *= 2;
+        }
+      }
+    }
+    CeedDestroy(&ceed);
+  }
+  return 0;
+}
+
+// Time one benchmark problem on one mesh
+static void RunBenchmark(Ceed ceed, const char *resource, CeedInt bp, CeedInt degree, const CeedInt num_xyz[3], const BenchmarkOptions *options) {
+  const BPData       *data      = &bp_data[bp - 1];
+  const CeedInt       q_extra   = options->q_extra >= 0 ? options->q_extra : data->q_extra;
+  const CeedInt       p         = degree + 1, q = p + q_extra, num_elem = num_xyz[0] * num_xyz[1] * num_xyz[2];
+  const CeedInt       elem_qpts = q * q * q;
+  CeedInt             mesh_size, sol_size;
+  CeedSize            flops, num_entries = (CeedSize)num_elem * CeedIntPow(data->num_comp * p * p * p, 2);
+  CeedMemType         mem_type;
+  CeedScalar          norm;
+  CeedBasis           mesh_basis, sol_basis;
+  CeedElemRestriction mesh_restriction, sol_restriction, q_data_restriction;
+  CeedQFunction       qf_setup, qf_apply;
+  CeedOperator        op_setup, op_apply;
+  CeedVector          mesh_coords, q_data, u, v;
+  double              apply_time, diagonal_time, assemble_time = -1.0, assemble_symbolic_time = -1.0;
+
+  // Bases, restrictions, and mesh
+  CeedBasisCreateTensorH1Lagrange(ceed, 3, 3, 2, q, data->quad_mode, &mesh_basis);
+  CeedBasisCreateTensorH1Lagrange(ceed, 3, data->num_comp, p, q, data->quad_mode, &sol_basis);
+  BuildCartesianRestriction(ceed, num_xyz, 1, 3, &mesh_size, &mesh_restriction);
+  BuildCartesianRestriction(ceed, num_xyz, degree, data->num_comp, &sol_size, &sol_restriction);
+  CeedElemRestrictionCreateStrided(ceed, num_elem, elem_qpts, data->q_data_size, (CeedSize)data->q_data_size * elem_qpts * num_elem,
+                                   CEED_STRIDES_BACKEND, &q_data_restriction);
+  CeedVectorCreate(ceed, mesh_size, &mesh_coords);
+  SetCartesianMeshCoords(num_xyz, mesh_coords);
+
+  // Geometric factors
+  CeedQFunctionCreateInteriorByName(ceed, data->setup_name, &qf_setup);
+  CeedOperatorCreate(ceed, qf_setup, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, &op_setup);
+  CeedOperatorSetField(op_setup, "dx", mesh_restriction, mesh_basis, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_setup, "weights", CEED_ELEMRESTRICTION_NONE, mesh_basis, CEED_VECTOR_NONE);
+  CeedOperatorSetField(op_setup, "qdata", q_data_restriction, CEED_BASIS_NONE, CEED_VECTOR_ACTIVE);
+  CeedVectorCreate(ceed, (CeedSize)data->q_data_size * elem_qpts * num_elem, &q_data);
+  CeedOperatorApply(op_setup, mesh_coords, q_data, CEED_REQUEST_IMMEDIATE);
+
+  // Benchmark operator
+  CeedQFunctionCreateInteriorByName(ceed, data->apply_name, &qf_apply);
+  CeedOperatorCreate(ceed, qf_apply, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, &op_apply);
+  CeedOperatorSetField(op_apply, data->in_name, sol_restriction, sol_basis, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_apply, "qdata", q_data_restriction, CEED_BASIS_NONE, q_data);
+  CeedOperatorSetField(op_apply, data->out_name, sol_restriction, sol_basis, CEED_VECTOR_ACTIVE);
+  CeedOperatorGetFlopsEstimate(op_apply, &flops);
+  CeedVectorCreate(ceed, sol_size, &u);
+  CeedVectorCreate(ceed, sol_size, &v);
+  CeedVectorSetValue(u, 1.0);
+
+  // Operator application; the norm waits for asynchronous backends to finish
+  for (CeedInt i = 0; i < options->warmup; i++) CeedOperatorApply(op_apply, u, v, CEED_REQUEST_IMMEDIATE);
+  CeedVectorNorm(v, CEED_NORM_MAX, &norm);
+  apply_time = Wtime();
+  for (CeedInt i = 0; i < options->repetitions; i++) CeedOperatorApply(op_apply, u, v, CEED_REQUEST_IMMEDIATE);
+  CeedVectorNorm(v, CEED_NORM_MAX, &norm);
+  apply_time = (Wtime() - apply_time) / options->repetitions;
+
+  // Diagonal assembly
+  for (CeedInt i = 0; i < options->warmup; i++) CeedOperatorLinearAssembleDiagonal(op_apply, v, CEED_REQUEST_IMMEDIATE);
+  CeedVectorNorm(v, CEED_NORM_MAX, &norm);
+  diagonal_time = Wtime();
+  for (CeedInt i = 0; i < options->repetitions; i++) CeedOperatorLinearAssembleDiagonal(op_apply, v, CEED_REQUEST_IMMEDIATE);
+  CeedVectorNorm(v, CEED_NORM_MAX, &norm);
+  diagonal_time = (Wtime() - diagonal_time) / options->repetitions;
+
+  // Full assembly, for problems small enough to store
+  if (num_entries <= options->max_assembly_entries) {
+    CeedInt   *rows, *cols;
+    CeedVector values;
+
+    assemble_symbolic_time = Wtime();
+    CeedOperatorLinearAssembleSymbolic(op_apply, &num_entries, &rows, &cols);
+    assemble_symbolic_time = Wtime() - assemble_symbolic_time;
+    CeedVectorCreate(ceed, num_entries, &values);
+    for (CeedInt i = 0; i < options->warmup; i++) CeedOperatorLinearAssemble(op_apply, values);
+    CeedVectorNorm(values, CEED_NORM_MAX, &norm);
+    assemble_time = Wtime();
+    for (CeedInt i = 0; i < options->repetitions; i++) CeedOperatorLinearAssemble(op_apply, values);
+    CeedVectorNorm(values, CEED_NORM_MAX, &norm);
+    assemble_time = (Wtime() - assemble_time) / options->repetitions;
+    CeedVectorDestroy(&values);
+    free(rows);
+    free(cols);
+  }
+
+  // Report run
+  CeedGetPreferredMemType(ceed, &mem_type);
+  printf("{\"code\": \"libCEED\", \"test\": \"libCEED CEED Benchmark Problem %" CeedInt_FMT "\", \"bp\": \"%" CeedInt_FMT "\", ", bp, bp);
+  printf("\"case\": \"%s\", \"backend\": \"%s\", \"backend_memtype\": \"%s\", ", data->num_comp == 1 ? "scalar" : "vector", resource,
+         CeedMemTypes[mem_type]);
+  printf("\"hostname\": \"%s\", \"num_procs\": 1, \"num_procs_node\": 1, ", options->hostname);
+  printf("\"degree\": %" CeedInt_FMT ", \"quadrature_pts\": %" CeedInt_FMT ", \"num_elem\": %" CeedInt_FMT ", ", degree, q, num_elem);
+  printf("\"num_unknowns\": %" CeedInt_FMT ", \"dof_per_node\": %" CeedInt_FMT ", ", sol_size, data->num_comp);
+  printf("\"warmup\": %" CeedInt_FMT ", \"repetitions\": %" CeedInt_FMT ", \"flops_per_apply\": %" CeedSize_FMT ", ", options->warmup,
+         options->repetitions, flops);
+  printf("\"apply_time\": %.6e, \"apply_dps\": %.6e, \"apply_gdofs\": %.6e, \"apply_gflops\": %.6e, ", apply_time, sol_size / apply_time,
+         1e-9 * sol_size / apply_time, 1e-9 * flops / apply_time);
+  printf("\"assemble_diagonal_time\": %.6e, \"assemble_diagonal_gdofs\": %.6e", diagonal_time, 1e-9 * sol_size / diagonal_time);
+  if (assemble_time >= 0) {
+    printf(", \"assemble_symbolic_time\": %.6e, \"assemble_time\": %.6e, \"assemble_entries\": %" CeedSize_FMT, assemble_symbolic_time, assemble_time,
+           num_entries);
+  }
+  printf("}\n");
+  fflush(stdout);
+
+  // Cleanup
+  CeedVectorDestroy(&u);
+  CeedVectorDestroy(&v);
+  CeedVectorDestroy(&q_data);
+  CeedVectorDestroy(&mesh_coords);
+  CeedOperatorDestroy(&op_apply);
+  CeedOperatorDestroy(&op_setup);
+  CeedQFunctionDestroy(&qf_apply);
+  CeedQFunctionDestroy(&qf_setup);
+  CeedElemRestrictionDestroy(&sol_restriction);
+  CeedElemRestrictionDestroy(&mesh_restriction);
+  CeedElemRestrictionDestroy(&q_data_restriction);
+  CeedBasisDestroy(&sol_basis);
+  CeedBasisDestroy(&mesh_basis);
+}
+
+// Wall clock time in seconds
+static double Wtime(void) {
+  struct timespec t;
+
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return t.tv_sec + 1e-9 * t.tv_nsec;
+}
+
+// Restriction for a structured hexahedral mesh with interlaced components
+static void BuildCartesianRestriction(Ceed ceed, const CeedInt num_xyz[3], CeedInt degree, CeedInt num_comp, CeedInt *size,
+                                      CeedElemRestriction *restriction) {
+  const CeedInt p = degree + 1, num_nodes = p * p * p, num_elem = num_xyz[0] * num_xyz[1] * num_xyz[2];
+  CeedInt       nd[3], scalar_size = 1;
+  CeedInt      *elem_nodes = malloc(sizeof(CeedInt) * num_elem * num_nodes);
+
+  for (CeedInt d = 0; d < 3; d++) {
+    nd[d] = num_xyz[d] * degree + 1;
+    scalar_size *= nd[d];
+  }
+  *size = scalar_size * num_comp;
+  for (CeedInt e = 0; e < num_elem; e++) {
+    CeedInt e_xyz[3], re = e;
+
+    for (CeedInt d = 0; d < 3; d++) {
+      e_xyz[d] = re % num_xyz[d];
+      re /= num_xyz[d];
+    }
+    for (CeedInt l_node = 0; l_node < num_nodes; l_node++) {
+      CeedInt g_node = 0, g_node_stride = 1, r_node = l_node;
+
+      for (CeedInt d = 0; d < 3; d++) {
+        g_node += (e_xyz[d] * degree + r_node % p) * g_node_stride;
+        g_node_stride *= nd[d];
+        r_node /= p;
+      }
+      elem_nodes[e * num_nodes + l_node] = num_comp * g_node;
+    }
+  }
+  CeedElemRestrictionCreate(ceed, num_elem, num_nodes, num_comp, 1, *size, CEED_MEM_HOST, CEED_COPY_VALUES, elem_nodes, restriction);
+  free(elem_nodes);
+}
+
+// Coordinates of the vertices of a structured mesh of the unit cube, interlaced
+static void SetCartesianMeshCoords(const CeedInt num_xyz[3], CeedVector mesh_coords) {
+  const CeedInt nd[3] = {num_xyz[0] + 1, num_xyz[1] + 1, num_xyz[2] + 1}, num_nodes = nd[0] * nd[1] * nd[2];
+  CeedScalar   *coords;
+
+  CeedVectorGetArrayWrite(mesh_coords, CEED_MEM_HOST, &coords);
+  for (CeedInt i = 0; i < num_nodes; i++) {
+    CeedInt r_node = i;
+
+    for (CeedInt d = 0; d < 3; d++) {
+      coords[3 * i + d] = (CeedScalar)(r_node % nd[d]) / num_xyz[d];
+      r_node /= nd[d];
+    }
+  }
+  CeedVectorRestoreArray(mesh_coords, &coords);
+}
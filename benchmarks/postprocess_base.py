@@ -12,6 +12,7 @@
 
 import pandas as pd
 import fileinput
+import json
 import pprint
 
 
@@ -33,8 +34,16 @@ def read_logs(files=None):
 
     runs = []
     for line in fileinput.input(files):
+        # JSON records from ceed-bps, one run per line
+        if line.lstrip().startswith('{'):
+            data = data_default.copy()
+            data.update(json.loads(line))
+            data['file'] = fileinput.filename()
+            # Operator applications stand in for CG iterations
+            data.setdefault('cg_iteration_dps', data.get('apply_dps'))
+            runs.append(data)
         # Legacy header contains number of MPI tasks
-        if 'Running the tests using a total of' in line:
+        elif 'Running the tests using a total of' in line:
             data = data_default.copy()
             data['num_procs'] = int(
                 line.split(
@@ -221,6 +221,10 @@ static PetscErrorCode RunWithDM(RunParams rp, DM dm, const char *ceed_resource)
 
   // -- Performance logging
   PetscCall(PetscLogStagePush(rp->solve_stage));
+  if (rp->stream_bandwidth > 0) {
+    CeedOperatorSetCollectStats(ceed_data->op_apply, true);
+    CeedOperatorResetStats(ceed_data->op_apply);
+  }
 
   // -- Solve
   my_rt_start = MPI_Wtime();
@@ -274,6 +278,20 @@ static PetscErrorCode RunWithDM(RunParams rp, DM dm, const char *ceed_resource)
       PetscCall(PetscPrintf(rp->comm, "    DoFs/Sec in CG                          : %g (%g) million\n", 1e-6 * g_size * its / rt_max,
                             1e-6 * g_size * its / rt_min));
     }
+    if (!rp->test_mode && rp->stream_bandwidth > 0) {
+      CeedSize bytes;
+      double   bandwidth;
+
+      // Compulsory traffic of operator applications, summed over ranks
+      CeedOperatorGetBytesEstimate(ceed_data->op_apply, &bytes);
+      CeedOperatorGetRoofline(ceed_data->op_apply, 0.0, NULL, &bandwidth, NULL);
+      PetscCall(MPI_Allreduce(MPI_IN_PLACE, &bandwidth, 1, MPI_DOUBLE, MPI_SUM, rp->comm));
+      PetscCall(PetscPrintf(rp->comm,
+                            "    Operator Compulsory Bytes (rank 0)      : %" CeedSize_FMT "\n"
+                            "    Operator Bandwidth                      : %g GB/s\n"
+                            "    Fraction of STREAM Bandwidth            : %g\n",
+                            bytes, 1e-9 * bandwidth, 1e-9 * bandwidth / rp->stream_bandwidth));
+    }
   }
 
   if (rp->write_solution) {
@@ -408,6 +426,9 @@ int main(int argc, char **argv) {
   }
   PetscCall(PetscGetHostName(hostname, sizeof hostname));
   PetscCall(PetscOptionsString("-hostname", "Hostname for output", NULL, hostname, hostname, sizeof(hostname), NULL));
+  rp->stream_bandwidth = 0;
+  PetscCall(PetscOptionsReal("-stream_bandwidth", "Measured STREAM bandwidth of all ranks in GB/s, to report the achieved fraction for the operator",
+                             NULL, rp->stream_bandwidth, &rp->stream_bandwidth, NULL));
   rp->read_mesh = PETSC_FALSE;
   PetscCall(PetscOptionsString("-mesh", "Read mesh from file", NULL, filename, filename, sizeof(filename), &rp->read_mesh));
   rp->filename = filename;
@@ -77,6 +77,7 @@ struct RunParams_ {
   char         *filename, *hostname;
   PetscInt      local_nodes, degree, q_extra, dim, num_comp_u, *mesh_elem;
   PetscInt      ksp_max_it_clip[2];
+  PetscReal     stream_bandwidth;
   PetscMPIInt   ranks_per_node;
   BPType        bp_choice;
   PetscLogStage solve_stage;
@@ -15,6 +15,15 @@
 
 CEED_INTERN const char *CeedJitSourceRootDefault;
 
+CEED_INTERN int CeedElemRestrictionGetIndexBytes(CeedElemRestriction rstr, CeedSize *bytes);
+
+CEED_INTERN int CeedOperatorStatsGetCurrent(CeedOperator *op, CeedSize *start_ns);
+CEED_INTERN int CeedOperatorStatsRecordElemRestriction(CeedOperator op, CeedElemRestriction rstr, CeedTransposeMode t_mode, CeedInt num_block,
+                                                       CeedSize start_ns);
+CEED_INTERN int CeedOperatorStatsRecordBasis(CeedOperator op, CeedBasis basis, CeedInt num_elem, CeedTransposeMode t_mode, CeedEvalMode eval_mode,
+                                             bool is_add, CeedSize start_ns);
+CEED_INTERN int CeedOperatorStatsRecordQFunction(CeedOperator op, CeedQFunction qf, CeedInt Q, CeedSize start_ns);
+
 /** @defgroup CeedUser Public API for Ceed
     @ingroup Ceed
 */
@@ -82,14 +91,52 @@ typedef struct {
   Ceed  delegate;
 } ObjDelegate;
 
-// Work vector tracking
-typedef struct CeedWorkVectors_private *CeedWorkVectors;
-struct CeedWorkVectors_private {
+// Work vector tracking, bucketed by size class floor(log2(length))
+#define CEED_WORK_VECTOR_NUM_CLASSES 64
+typedef struct {
   CeedInt     num_vecs, max_vecs;
   bool       *is_in_use;
   CeedVector *vecs;
+  CeedSize   *lengths;
+  CeedSize   *last_used; /* Value of work vector clock when last checked out, for LRU trimming */
+} CeedWorkVectorBucket;
+
+typedef struct CeedWorkVectors_private *CeedWorkVectors;
+struct CeedWorkVectors_private {
+  CeedWorkVectorBucket buckets[CEED_WORK_VECTOR_NUM_CLASSES];
+  CeedSize             clock;
+  CeedSize             num_hits, num_misses;
+  CeedSize             num_bytes, max_bytes; /* Bytes held by all work vectors, and budget above which unused vectors are trimmed */
 };
 
+// Reference counts are updated atomically, as objects may be shared with the host task queue worker
+#ifdef __STDC_NO_ATOMICS__
+typedef int CeedRefCount;
+#else
+typedef _Atomic int CeedRefCount;
+#endif
+
+// Statistics counters are updated atomically for the same reason
+#ifdef __STDC_NO_ATOMICS__
+typedef CeedSize CeedCounter;
+#else
+typedef _Atomic CeedSize CeedCounter;
+#endif
+
+// Statistics for one stage of CeedOperator application
+typedef struct {
+  CeedCounter num_calls;
+  CeedCounter time_ns; /* Wall time, in nanoseconds */
+  CeedCounter bytes;   /* Estimated bytes read and written */
+  CeedCounter flops;   /* Estimated floating point operations */
+} CeedOperatorStageStats;
+
+// Host task queue for asynchronous requests
+typedef struct CeedTaskQueue_private *CeedTaskQueue;
+
+// Per-thread scratch arenas for basis and assembly temporaries
+typedef struct CeedScratch_private *CeedScratch;
+
 struct Ceed_private {
   const char  *resource;
   Ceed         delegate;
@@ -102,6 +149,7 @@ struct Ceed_private {
   CeedInt      num_jit_source_roots, max_jit_source_roots, num_jit_source_roots_readers;
   char       **jit_defines;
   CeedInt      num_jit_defines, max_jit_defines, num_jit_defines_readers;
+  CeedCounter  jit_cache_num_hits, jit_cache_num_misses;
   int (*Error)(Ceed, const char *, int, const char *, int, const char *, va_list *);
   int (*SetStream)(Ceed, void *);
   int (*GetPreferredMemType)(CeedMemType *);
@@ -110,6 +158,7 @@ struct Ceed_private {
   int (*ElemRestrictionCreate)(CeedMemType, CeedCopyMode, const CeedInt *, const bool *, const CeedInt8 *, CeedElemRestriction);
   int (*ElemRestrictionCreateAtPoints)(CeedMemType, CeedCopyMode, const CeedInt *, const bool *, const CeedInt8 *, CeedElemRestriction);
   int (*ElemRestrictionCreateBlocked)(CeedMemType, CeedCopyMode, const CeedInt *, const bool *, const CeedInt8 *, CeedElemRestriction);
+  int (*ElemRestrictionCreateStructured)(CeedElemRestriction);
   int (*BasisCreateTensorH1)(CeedInt, CeedInt, CeedInt, const CeedScalar *, const CeedScalar *, const CeedScalar *, const CeedScalar *, CeedBasis);
   int (*BasisCreateH1)(CeedElemTopology, CeedInt, CeedInt, CeedInt, const CeedScalar *, const CeedScalar *, const CeedScalar *, const CeedScalar *,
                        CeedBasis);
@@ -123,7 +172,7 @@ struct Ceed_private {
   int (*OperatorCreate)(CeedOperator);
   int (*OperatorCreateAtPoints)(CeedOperator);
   int (*CompositeOperatorCreate)(CeedOperator);
-  int             ref_count;
+  CeedRefCount    ref_count;
   void           *data;
   bool            is_debug;
   bool            has_valid_op_fallback_resource;
@@ -131,6 +180,8 @@ struct Ceed_private {
   char            err_msg[CEED_MAX_RESOURCE_LEN];
   FOffset        *f_offsets;
   CeedWorkVectors work_vectors;
+  CeedTaskQueue   task_queue;
+  CeedScratch     scratch;
 };
 
 struct CeedVector_private {
@@ -149,17 +200,23 @@ struct CeedVector_private {
   int (*RestoreArray)(CeedVector);
   int (*RestoreArrayRead)(CeedVector);
   int (*Norm)(CeedVector, CeedNormType, CeedScalar *);
+  int (*Dot)(CeedVector, CeedVector, CeedScalar *);
+  int (*MDot)(CeedVector, CeedInt, CeedVector *, CeedScalar *);
   int (*Scale)(CeedVector, CeedScalar);
   int (*AXPY)(CeedVector, CeedScalar, CeedVector);
   int (*AXPBY)(CeedVector, CeedScalar, CeedScalar, CeedVector);
+  int (*MAXPY)(CeedVector, CeedInt, const CeedScalar *, CeedVector *);
+  int (*AXPYNorm)(CeedVector, CeedScalar, CeedVector, CeedNormType, CeedScalar *);
   int (*PointwiseMult)(CeedVector, CeedVector, CeedVector);
   int (*Reciprocal)(CeedVector);
   int (*Destroy)(CeedVector);
-  int      ref_count;
-  CeedSize length;
-  uint64_t state;
-  uint64_t num_readers;
-  void    *data;
+  CeedRefCount  ref_count;
+  CeedSize      length;
+  uint64_t      state;
+  uint64_t      num_readers;
+  CeedRefCount  num_pending_tasks; /* Number of host task queue requests using this vector that have not completed */
+  CeedTaskQueue task_queue;        /* Host task queue of the most recent request using this vector */
+  void         *data;
 };
 
 struct CeedElemRestriction_private {
@@ -175,23 +232,33 @@ struct CeedElemRestriction_private {
   int (*GetOrientations)(CeedElemRestriction, CeedMemType, const bool **);
   int (*GetCurlOrientations)(CeedElemRestriction, CeedMemType, const CeedInt8 **);
   int (*Destroy)(CeedElemRestriction);
-  int      ref_count;
-  CeedInt  num_elem;    /* number of elements */
-  CeedInt  elem_size;   /* number of nodes per element */
-  CeedInt  num_points;  /* number of points, for points restriction */
-  CeedInt  num_comp;    /* number of components */
-  CeedInt  comp_stride; /* Component stride for L-vector ordering */
-  CeedSize l_size;      /* size of the L-vector, can be used for checking for correct vector sizes */
-  CeedSize e_size;      /* minimum size of the E-vector, can be used for checking for correct vector sizes */
-  CeedInt  block_size;  /* number of elements in a batch */
-  CeedInt  num_block;   /* number of blocks of elements */
-  CeedInt *strides;     /* strides between [nodes, components, elements] */
-  CeedInt  l_layout[3]; /* L-vector layout [nodes, components, elements] */
-  CeedInt  e_layout[3]; /* E-vector layout [nodes, components, elements] */
+  CeedRefCount ref_count;
+  CeedInt      num_elem;    /* number of elements */
+  CeedInt      elem_size;   /* number of nodes per element */
+  CeedInt      num_points;  /* number of points, for points restriction */
+  CeedInt      num_comp;    /* number of components */
+  CeedInt      comp_stride; /* Component stride for L-vector ordering */
+  CeedSize     l_size;      /* size of the L-vector, can be used for checking for correct vector sizes */
+  CeedSize     e_size;      /* minimum size of the E-vector, can be used for checking for correct vector sizes */
+  CeedInt      block_size;  /* number of elements in a batch */
+  CeedInt      num_block;   /* number of blocks of elements */
+  CeedInt     *strides;     /* strides between [nodes, components, elements] */
+  CeedInt      l_layout[3]; /* L-vector layout [nodes, components, elements] */
+  CeedInt      e_layout[3]; /* E-vector layout [nodes, components, elements] */
   CeedRestrictionType
-           rstr_type;   /* initialized in element restriction constructor for default, oriented, curl-oriented, or strided element restriction */
-  uint64_t num_readers; /* number of instances of offset read only access */
-  void    *data;        /* place for the backend to store any data */
+               rstr_type;   /* initialized in element restriction constructor for default, oriented, curl-oriented, or strided element restriction */
+  uint64_t     num_readers; /* number of instances of offset read only access */
+  void        *data;        /* place for the backend to store any data */
+
+  CeedColoringType coloring_type;       /* strategy of cached element block coloring */
+  CeedInt          coloring_block_size; /* block size of cached element block coloring, 0 if not computed */
+  CeedInt          num_colors;          /* number of colors in cached element block coloring */
+  CeedInt         *color_offsets;       /* offsets of each color in color_blocks */
+  CeedInt         *color_blocks;        /* element blocks sorted by color */
+
+  CeedInt structured_dim;         /* dimension of structured Cartesian restriction, 0 if offsets are explicit */
+  CeedInt structured_num_elem[3]; /* number of elements in each dimension of structured restriction */
+  CeedInt structured_P_1d;        /* number of nodes in each dimension of an element of structured restriction */
 };
 
 struct CeedBasis_private {
@@ -201,7 +268,7 @@ struct CeedBasis_private {
   int (*ApplyAtPoints)(CeedBasis, CeedInt, const CeedInt *, CeedTransposeMode, CeedEvalMode, CeedVector, CeedVector, CeedVector);
   int (*ApplyAddAtPoints)(CeedBasis, CeedInt, const CeedInt *, CeedTransposeMode, CeedEvalMode, CeedVector, CeedVector, CeedVector);
   int (*Destroy)(CeedBasis);
-  int                ref_count;
+  CeedRefCount       ref_count;
   bool               is_tensor_basis; /* flag for tensor basis */
   CeedInt            dim;             /* topological dimension */
   CeedElemTopology   topo;            /* element topology */
@@ -222,6 +289,10 @@ struct CeedBasis_private {
   CeedScalar *div; /* row-major matrix of shape [Q, P] expressing the divergence of basis functions at quadrature points for H(div) discretizations */
   CeedScalar *curl; /* row-major matrix of shape [curl_dim * Q, P], curl_dim = 1 if dim < 3 else dim, expressing the curl of basis functions at
                        quadrature points for H(curl) discretizations */
+  CeedScalar *interp_1d_even;  /* even half of centro-symmetric interp_1d, of shape [ceil(Q1d / 2), ceil(P1d / 2)], or NULL */
+  CeedScalar *interp_1d_odd;   /* odd half of centro-symmetric interp_1d, of shape [ceil(Q1d / 2), ceil(P1d / 2)], or NULL */
+  CeedScalar *grad_1d_even;    /* even half of centro-antisymmetric grad_1d, of shape [ceil(Q1d / 2), ceil(P1d / 2)], or NULL */
+  CeedScalar *grad_1d_odd;     /* odd half of centro-antisymmetric grad_1d, of shape [ceil(Q1d / 2), ceil(P1d / 2)], or NULL */
   CeedVector  vec_chebyshev;
   CeedBasis   basis_chebyshev; /* basis interpolating from nodes to Chebyshev polynomial coefficients */
   void       *data;            /* place for the backend to store any data */
@@ -231,9 +302,13 @@ struct CeedTensorContract_private {
   Ceed ceed;
   int (*Apply)(CeedTensorContract, CeedInt, CeedInt, CeedInt, CeedInt, const CeedScalar *restrict, CeedTransposeMode, const CeedInt,
                const CeedScalar *restrict, CeedScalar *restrict);
+  int (*ApplyEvenOdd)(CeedTensorContract, CeedInt, CeedInt, CeedInt, CeedInt, const CeedScalar *restrict, const CeedScalar *restrict, CeedInt,
+                      CeedTransposeMode, const CeedInt, const CeedScalar *restrict, CeedScalar *restrict);
+  int (*GetNumTiles)(CeedTensorContract, CeedInt *);
+  int (*SetTile)(CeedTensorContract, CeedInt);
   int (*Destroy)(CeedTensorContract);
-  int   ref_count;
-  void *data;
+  CeedRefCount ref_count;
+  void        *data;
 };
 
 struct CeedQFunctionField_private {
@@ -248,7 +323,7 @@ struct CeedQFunction_private {
   int (*SetCUDAUserFunction)(CeedQFunction, void *);
   int (*SetHIPUserFunction)(CeedQFunction, void *);
   int (*Destroy)(CeedQFunction);
-  int                  ref_count;
+  CeedRefCount         ref_count;
   CeedInt              vec_length; /* Number of quadrature points must be padded to a multiple of vec_length */
   CeedQFunctionField  *input_fields;
   CeedQFunctionField  *output_fields;
@@ -269,8 +344,8 @@ struct CeedQFunction_private {
 };
 
 struct CeedQFunctionContext_private {
-  Ceed ceed;
-  int  ref_count;
+  Ceed         ceed;
+  CeedRefCount ref_count;
   int (*HasValidData)(CeedQFunctionContext, bool *);
   int (*HasBorrowedDataOfType)(CeedQFunctionContext, CeedMemType, bool *);
   int (*SetData)(CeedQFunctionContext, CeedMemType, CeedCopyMode, void *);
@@ -321,11 +396,12 @@ struct CeedOperatorField_private {
   CeedBasis           basis;      /* Basis or CEED_BASIS_NONE for collocated fields */
   CeedVector          vec;        /* State vector for passive fields or CEED_VECTOR_NONE for no vector */
   const char         *field_name; /* matching QFunction field name */
+  CeedStorageType     storage;    /* Storage format for passive input data */
 };
 
 struct CeedQFunctionAssemblyData_private {
   Ceed                ceed;
-  int                 ref_count;
+  CeedRefCount        ref_count;
   bool                is_setup;
   bool                reuse_data;
   bool                needs_data_update;
@@ -347,9 +423,10 @@ struct CeedOperatorAssemblyData_private {
 struct CeedOperator_private {
   Ceed         ceed;
   CeedOperator op_fallback, op_fallback_parent;
-  int          ref_count;
+  CeedRefCount ref_count;
   int (*LinearAssembleQFunction)(CeedOperator, CeedVector *, CeedElemRestriction *, CeedRequest *);
   int (*LinearAssembleQFunctionUpdate)(CeedOperator, CeedVector, CeedElemRestriction, CeedRequest *);
+  int (*LinearAssembleQFunctionElements)(CeedOperator, CeedInt, CeedInt, CeedVector, CeedRequest *);
   int (*LinearAssembleDiagonal)(CeedOperator, CeedVector, CeedRequest *);
   int (*LinearAssembleAddDiagonal)(CeedOperator, CeedVector, CeedRequest *);
   int (*LinearAssemblePointBlockDiagonal)(CeedOperator, CeedVector, CeedRequest *);
@@ -362,6 +439,7 @@ struct CeedOperator_private {
   int (*ApplyComposite)(CeedOperator, CeedVector, CeedVector, CeedRequest *);
   int (*ApplyAdd)(CeedOperator, CeedVector, CeedVector, CeedRequest *);
   int (*ApplyAddComposite)(CeedOperator, CeedVector, CeedVector, CeedRequest *);
+  int (*ApplyAddMulti)(CeedOperator, CeedInt, CeedVector *, CeedVector *);
   int (*ApplyJacobian)(CeedOperator, CeedVector, CeedVector, CeedVector, CeedVector, CeedRequest *);
   int (*Destroy)(CeedOperator);
   CeedOperatorField        *input_fields;
@@ -382,12 +460,30 @@ struct CeedOperator_private {
   bool                      has_restriction;
   CeedQFunctionAssemblyData qf_assembled;
   CeedOperatorAssemblyData  op_assembled;
+  CeedInt                   csr_block_size;  /* Block size of compressed sparse row assembly pattern */
+  CeedSize                  csr_num_values;  /* Number of compressed sparse row values */
+  CeedSize                 *csr_row_offsets; /* Block row offsets of compressed sparse row assembly pattern */
+  CeedInt                  *csr_cols;        /* Block column indices of compressed sparse row assembly pattern */
   CeedOperator             *sub_operators;
   CeedInt                   num_suboperators;
+  bool                      is_concurrent;          /* Apply independent sub-operators of a composite operator concurrently */
+  bool                      is_deterministic;       /* Also order concurrent sub-operators by overlap of their active outputs */
+  CeedInt                   num_sub_groups;         /* Number of groups of sub-operators that may be applied concurrently */
+  CeedInt                  *sub_group_offsets;      /* Offsets into sub_group_indices for each group */
+  CeedInt                  *sub_group_indices;      /* Sub-operator indices ordered by group */
+  CeedInt                  *sub_threads;            /* Thread that applied each entry of sub_group_indices concurrently */
+  CeedSize                 *sub_output_offsets;     /* Offsets into sub_output_indices for each sub-operator */
+  CeedSize                 *sub_output_indices;     /* Active output L-vector entries of each sub-operator */
+  int                       num_concurrent_threads; /* Number of per-thread input views and output buffers */
+  CeedVector               *concurrent_in_views;    /* Per-thread views of the input for concurrent application */
+  CeedVector               *concurrent_out_buffers; /* Per-thread output buffers for concurrent application, zero between applications */
   void                     *data;
   CeedInt                   num_context_labels;
   CeedInt                   max_context_labels;
   CeedContextFieldLabel    *context_labels;
   CeedElemRestriction       rstr_points, first_points_rstr;
   CeedVector                point_coords;
+  bool                      collect_stats; /* Collect per stage statistics during application */
+  CeedInt                   num_stats;     /* Number of entries in stats */
+  CeedOperatorStageStats   *stats; /* Operator, QFunction, restriction and basis totals, then restriction and basis for each input and output field */
 };
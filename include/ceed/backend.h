@@ -180,7 +180,7 @@ CEED_INTERN int CeedMallocArray(size_t n, size_t unit, void *p);
 CEED_INTERN int CeedCallocArray(size_t n, size_t unit, void *p);
 CEED_INTERN int CeedReallocArray(size_t n, size_t unit, void *p);
 CEED_INTERN int CeedStringAllocCopy(const char *source, char **copy);
-CEED_INTERN int CeedFree(void *p);
+CEED_EXTERN int CeedFree(void *p);
 
 CEED_INTERN int CeedSetHostBoolArray(const bool *source_array, CeedCopyMode copy_mode, CeedSize num_values, const bool **target_array_owned,
                                      const bool **target_array_borrowed, const bool **target_array);
@@ -258,6 +258,16 @@ CEED_EXTERN int CeedGetWorkVector(Ceed ceed, CeedSize len, CeedVector *vec);
 CEED_EXTERN int CeedRestoreWorkVector(Ceed ceed, CeedVector *vec);
 CEED_EXTERN int CeedClearWorkVectors(Ceed ceed, CeedSize min_len);
 CEED_EXTERN int CeedGetWorkVectorMemoryUsage(Ceed ceed, CeedScalar *usage_mb);
+CEED_EXTERN int CeedGetWorkVectorStats(Ceed ceed, CeedSize *num_hits, CeedSize *num_misses, CeedSize *num_bytes);
+CEED_EXTERN int CeedGetScratchArray(Ceed ceed, size_t n, size_t unit, void *p);
+#define CeedGetScratch(ceed, n, p) CeedGetScratchArray((ceed), (n), sizeof(**(p)), p)
+CEED_EXTERN int CeedRestoreScratch(Ceed ceed, void *p);
+CEED_EXTERN int CeedGetScratchStats(Ceed ceed, CeedSize *num_allocs, CeedSize *num_bytes);
+CEED_EXTERN int CeedClearScratch(Ceed ceed);
+CEED_EXTERN int CeedRequestSubmit(Ceed ceed, int (*Run)(CeedOperator, CeedVector, CeedVector), CeedOperator op, CeedVector in, CeedVector out,
+                                  CeedRequest *request, bool *is_submitted);
+CEED_EXTERN int CeedRequestSynchronize(Ceed ceed);
+CEED_EXTERN int CeedRequestSynchronizeVector(CeedVector vec);
 CEED_EXTERN int CeedGetJitSourceRoots(Ceed ceed, CeedInt *num_source_roots, const char ***jit_source_roots);
 CEED_EXTERN int CeedRestoreJitSourceRoots(Ceed ceed, const char ***jit_source_roots);
 CEED_EXTERN int CeedGetJitDefines(Ceed ceed, CeedInt *num_defines, const char ***jit_defines);
@@ -296,6 +306,8 @@ CEED_EXTERN int CeedElemRestrictionIsAtPoints(CeedElemRestriction rstr, bool *is
 CEED_EXTERN int CeedElemRestrictionAtPointsAreCompatible(CeedElemRestriction rstr_a, CeedElemRestriction rstr_b, bool *are_compatible);
 CEED_EXTERN int CeedElemRestrictionGetStrides(CeedElemRestriction rstr, CeedInt strides[3]);
 CEED_EXTERN int CeedElemRestrictionHasBackendStrides(CeedElemRestriction rstr, bool *has_backend_strides);
+CEED_EXTERN int CeedElemRestrictionIsStructured(CeedElemRestriction rstr, bool *is_structured);
+CEED_EXTERN int CeedElemRestrictionGetStructure(CeedElemRestriction rstr, CeedInt *dim, CeedInt num_elem_1d[3], CeedInt *P_1d);
 CEED_EXTERN int CeedElemRestrictionGetOffsets(CeedElemRestriction rstr, CeedMemType mem_type, const CeedInt **offsets);
 CEED_EXTERN int CeedElemRestrictionRestoreOffsets(CeedElemRestriction rstr, const CeedInt **offsets);
 CEED_EXTERN int CeedElemRestrictionGetOrientations(CeedElemRestriction rstr, CeedMemType mem_type, const bool **orients);
@@ -312,6 +324,7 @@ CEED_EXTERN int CeedElemRestrictionGetData(CeedElemRestriction rstr, void *data)
 CEED_EXTERN int CeedElemRestrictionSetData(CeedElemRestriction rstr, void *data);
 CEED_EXTERN int CeedElemRestrictionReference(CeedElemRestriction rstr);
 CEED_EXTERN int CeedElemRestrictionGetFlopsEstimate(CeedElemRestriction rstr, CeedTransposeMode t_mode, CeedSize *flops);
+CEED_EXTERN int CeedElemRestrictionGetBytesEstimate(CeedElemRestriction rstr, CeedTransposeMode t_mode, CeedSize *bytes);
 
 /**
   Specify type of FE space.
@@ -332,12 +345,16 @@ CEED_EXTERN const char *const CeedFESpaces[];
 CEED_EXTERN int CeedBasisGetCollocatedGrad(CeedBasis basis, CeedScalar *colo_grad_1d);
 CEED_EXTERN int CeedBasisGetChebyshevInterp1D(CeedBasis basis, CeedScalar *chebyshev_interp_1d);
 CEED_EXTERN int CeedBasisIsTensor(CeedBasis basis, bool *is_tensor);
+CEED_EXTERN int CeedBasisGetInterp1DEvenOdd(CeedBasis basis, const CeedScalar **interp_1d_even, const CeedScalar **interp_1d_odd);
+CEED_EXTERN int CeedBasisGetGrad1DEvenOdd(CeedBasis basis, const CeedScalar **grad_1d_even, const CeedScalar **grad_1d_odd);
 CEED_EXTERN int CeedBasisGetData(CeedBasis basis, void *data);
 CEED_EXTERN int CeedBasisSetData(CeedBasis basis, void *data);
 CEED_EXTERN int CeedBasisReference(CeedBasis basis);
 CEED_EXTERN int CeedBasisGetNumQuadratureComponents(CeedBasis basis, CeedEvalMode eval_mode, CeedInt *q_comp);
 CEED_EXTERN int CeedBasisGetFlopsEstimate(CeedBasis basis, CeedTransposeMode t_mode, CeedEvalMode eval_mode, bool is_at_points, CeedInt num_points,
                                           CeedSize *flops);
+CEED_EXTERN int CeedBasisGetBytesEstimate(CeedBasis basis, CeedTransposeMode t_mode, CeedEvalMode eval_mode, bool is_at_points, CeedInt num_points,
+                                          CeedSize *bytes);
 CEED_EXTERN int CeedBasisGetFESpace(CeedBasis basis, CeedFESpace *fe_space);
 CEED_EXTERN int CeedBasisGetTopologyDimension(CeedElemTopology topo, CeedInt *dim);
 CEED_EXTERN int CeedBasisGetTensorContract(CeedBasis basis, CeedTensorContract *contract);
@@ -349,9 +366,16 @@ CEED_EXTERN int CeedBasisCreateH1Fallback(Ceed ceed, CeedElemTopology topo, Ceed
 CEED_EXTERN int  CeedTensorContractCreate(Ceed ceed, CeedTensorContract *contract);
 CEED_EXTERN int  CeedTensorContractApply(CeedTensorContract contract, CeedInt A, CeedInt B, CeedInt C, CeedInt J, const CeedScalar *__restrict__ t,
                                          CeedTransposeMode t_mode, const CeedInt Add, const CeedScalar *__restrict__ u, CeedScalar *__restrict__ v);
+CEED_EXTERN int  CeedTensorContractApplyEvenOdd(CeedTensorContract contract, CeedInt A, CeedInt B, CeedInt C, CeedInt J,
+                                                const CeedScalar *__restrict__ t_even, const CeedScalar *__restrict__ t_odd, CeedInt parity,
+                                                CeedTransposeMode t_mode, const CeedInt add, const CeedScalar *__restrict__ u,
+                                                CeedScalar *__restrict__ v);
 CEED_EXTERN int  CeedTensorContractStridedApply(CeedTensorContract contract, CeedInt A, CeedInt B, CeedInt C, CeedInt D, CeedInt J,
                                                 const CeedScalar *__restrict__ t, CeedTransposeMode t_mode, const CeedInt add,
                                                 const CeedScalar *__restrict__ u, CeedScalar *__restrict__ v);
+CEED_EXTERN int  CeedTensorContractHasEvenOdd(CeedTensorContract contract, bool *has_even_odd);
+CEED_EXTERN int  CeedTensorContractGetNumTiles(CeedTensorContract contract, CeedInt *num_tiles);
+CEED_EXTERN int  CeedTensorContractSetTile(CeedTensorContract contract, CeedInt tile);
 CEED_EXTERN int  CeedTensorContractGetCeed(CeedTensorContract contract, Ceed *ceed);
 CEED_EXTERN Ceed CeedTensorContractReturnCeed(CeedTensorContract contract);
 CEED_EXTERN int  CeedTensorContractGetData(CeedTensorContract contract, void *data);
@@ -377,6 +401,7 @@ CEED_EXTERN int CeedQFunctionGetInnerContext(CeedQFunction qf, CeedQFunctionCont
 CEED_EXTERN int CeedQFunctionGetInnerContextData(CeedQFunction qf, CeedMemType mem_type, void *data);
 CEED_EXTERN int CeedQFunctionRestoreInnerContextData(CeedQFunction qf, void *data);
 CEED_EXTERN int CeedQFunctionIsIdentity(CeedQFunction qf, bool *is_identity);
+CEED_EXTERN int CeedQFunctionIsFortran(CeedQFunction qf, bool *is_fortran);
 CEED_EXTERN int CeedQFunctionIsContextWritable(CeedQFunction qf, bool *is_writable);
 CEED_EXTERN int CeedQFunctionGetData(CeedQFunction qf, void *data);
 CEED_EXTERN int CeedQFunctionSetData(CeedQFunction qf, void *data);
@@ -384,6 +409,7 @@ CEED_EXTERN int CeedQFunctionIsImmutable(CeedQFunction qf, bool *is_immutable);
 CEED_EXTERN int CeedQFunctionSetImmutable(CeedQFunction qf);
 CEED_EXTERN int CeedQFunctionReference(CeedQFunction qf);
 CEED_EXTERN int CeedQFunctionGetFlopsEstimate(CeedQFunction qf, CeedSize *flops);
+CEED_EXTERN int CeedQFunctionGetBytesEstimate(CeedQFunction qf, CeedSize *bytes);
 
 CEED_EXTERN int  CeedQFunctionContextGetCeed(CeedQFunctionContext ctx, Ceed *ceed);
 CEED_EXTERN Ceed CeedQFunctionContextReturnCeed(CeedQFunctionContext ctx);
@@ -463,12 +489,15 @@ CEED_EXTERN int CeedOperatorGetFallbackParent(CeedOperator op, CeedOperator *par
 CEED_EXTERN int CeedOperatorGetFallbackParentCeed(CeedOperator op, Ceed *parent);
 CEED_INTERN int CeedSingleOperatorAssemble(CeedOperator op, CeedInt offset, CeedVector values);
 CEED_EXTERN int CeedOperatorSetSetupDone(CeedOperator op);
+CEED_EXTERN int CeedOperatorGetCollectStats(CeedOperator op, bool *collect_stats);
+CEED_EXTERN int CeedOperatorAddQFunctionStats(CeedOperator op, CeedSize num_calls, CeedSize num_points, CeedSize time_ns);
 
 CEED_INTERN int CeedMatrixMatrixMultiply(Ceed ceed, const CeedScalar *mat_A, const CeedScalar *mat_B, CeedScalar *mat_C, CeedInt m, CeedInt n,
                                          CeedInt kk);
 CEED_EXTERN int CeedQRFactorization(Ceed ceed, CeedScalar *mat, CeedScalar *tau, CeedInt m, CeedInt n);
 CEED_EXTERN int CeedHouseholderApplyQ(CeedScalar *mat_A, const CeedScalar *mat_Q, const CeedScalar *tau, CeedTransposeMode t_mode, CeedInt m,
                                       CeedInt n, CeedInt k, CeedInt row, CeedInt col);
+CEED_EXTERN int CeedMatrixFoldEvenOdd(const CeedScalar *mat, CeedInt m, CeedInt n, CeedInt parity, CeedScalar **mat_even, CeedScalar **mat_odd);
 CEED_EXTERN int CeedMatrixPseudoinverse(Ceed ceed, const CeedScalar *mat, CeedInt m, CeedInt n, CeedScalar *mat_pinv);
 CEED_EXTERN int CeedSymmetricSchurDecomposition(Ceed ceed, CeedScalar *mat, CeedScalar *lambda, CeedInt n);
 CEED_EXTERN int CeedSimultaneousDiagonalization(Ceed ceed, CeedScalar *mat_A, CeedScalar *mat_B, CeedScalar *x, CeedScalar *lambda, CeedInt n);
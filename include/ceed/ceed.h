@@ -108,6 +108,7 @@ CEED_EXTERN int CeedGetResource(Ceed ceed, const char **resource);
 CEED_EXTERN int CeedIsDeterministic(Ceed ceed, bool *is_deterministic);
 CEED_EXTERN int CeedAddJitSourceRoot(Ceed ceed, const char *jit_source_root);
 CEED_EXTERN int CeedAddJitDefine(Ceed ceed, const char *jit_define);
+CEED_EXTERN int CeedGetJitCacheStats(Ceed ceed, CeedSize *num_hits, CeedSize *num_misses);
 CEED_EXTERN int CeedView(Ceed ceed, FILE *stream);
 CEED_EXTERN int CeedDestroy(Ceed *ceed);
 CEED_EXTERN int CeedErrorImpl(Ceed ceed, const char *filename, int lineno, const char *func, int ecode, const char *format, ...);
@@ -177,6 +178,10 @@ CEED_EXTERN const char *const  CeedEvalModes[];
 CEED_EXTERN const char *const  CeedQuadModes[];
 CEED_EXTERN const char *const  CeedElemTopologies[];
 CEED_EXTERN const char *const  CeedContextFieldTypes[];
+CEED_EXTERN const char *const  CeedStorageTypes[];
+CEED_EXTERN const char *const  CeedColoringTypes[];
+CEED_EXTERN const char *const  CeedReorderTypes[];
+CEED_EXTERN const char *const  CeedStageTypes[];
 
 CEED_EXTERN int CeedGetPreferredMemType(Ceed ceed, CeedMemType *type);
 
@@ -195,9 +200,13 @@ CEED_EXTERN int  CeedVectorGetArrayWrite(CeedVector vec, CeedMemType mem_type, C
 CEED_EXTERN int  CeedVectorRestoreArray(CeedVector vec, CeedScalar **array);
 CEED_EXTERN int  CeedVectorRestoreArrayRead(CeedVector vec, const CeedScalar **array);
 CEED_EXTERN int  CeedVectorNorm(CeedVector vec, CeedNormType type, CeedScalar *norm);
+CEED_EXTERN int  CeedVectorDot(CeedVector x, CeedVector y, CeedScalar *result);
+CEED_EXTERN int  CeedVectorMDot(CeedVector x, CeedInt num_vecs, CeedVector *y, CeedScalar *results);
 CEED_EXTERN int  CeedVectorScale(CeedVector x, CeedScalar alpha);
 CEED_EXTERN int  CeedVectorAXPY(CeedVector y, CeedScalar alpha, CeedVector x);
 CEED_EXTERN int  CeedVectorAXPBY(CeedVector y, CeedScalar alpha, CeedScalar beta, CeedVector x);
+CEED_EXTERN int  CeedVectorMAXPY(CeedVector y, CeedInt num_vecs, const CeedScalar *alpha, CeedVector *x);
+CEED_EXTERN int  CeedVectorAXPYNorm(CeedVector y, CeedScalar alpha, CeedVector x, CeedNormType norm_type, CeedScalar *norm);
 CEED_EXTERN int  CeedVectorPointwiseMult(CeedVector w, CeedVector x, CeedVector y);
 CEED_EXTERN int  CeedVectorReciprocal(CeedVector vec);
 CEED_EXTERN int  CeedVectorViewRange(CeedVector vec, CeedSize start, CeedSize stop, CeedInt step, const char *fp_fmt, FILE *stream);
@@ -251,6 +260,8 @@ CEED_EXTERN int  CeedElemRestrictionCreateCurlOriented(Ceed ceed, CeedInt num_el
                                                        const CeedInt8 *curl_orients, CeedElemRestriction *rstr);
 CEED_EXTERN int  CeedElemRestrictionCreateStrided(Ceed ceed, CeedInt num_elem, CeedInt elem_size, CeedInt num_comp, CeedSize l_size,
                                                   const CeedInt strides[3], CeedElemRestriction *rstr);
+CEED_EXTERN int  CeedElemRestrictionCreateStructured(Ceed ceed, CeedInt dim, const CeedInt *num_elem_1d, CeedInt P_1d, CeedInt num_comp,
+                                                     CeedInt comp_stride, CeedSize l_size, CeedElemRestriction *rstr);
 CEED_EXTERN int  CeedElemRestrictionCreateAtPoints(Ceed ceed, CeedInt num_elem, CeedInt num_points, CeedInt num_comp, CeedSize l_size,
                                                    CeedMemType mem_type, CeedCopyMode copy_mode, const CeedInt *offsets, CeedElemRestriction *rstr);
 CEED_EXTERN int  CeedElemRestrictionCreateBlocked(Ceed ceed, CeedInt num_elem, CeedInt elem_size, CeedInt block_size, CeedInt num_comp,
@@ -264,6 +275,8 @@ CEED_EXTERN int  CeedElemRestrictionCreateBlockedCurlOriented(Ceed ceed, CeedInt
                                                               const CeedInt *offsets, const CeedInt8 *curl_orients, CeedElemRestriction *rstr);
 CEED_EXTERN int  CeedElemRestrictionCreateBlockedStrided(Ceed ceed, CeedInt num_elem, CeedInt elem_size, CeedInt block_size, CeedInt num_comp,
                                                          CeedSize l_size, const CeedInt strides[3], CeedElemRestriction *rstr);
+CEED_EXTERN int  CeedElemRestrictionCreateBlockedStructured(Ceed ceed, CeedInt dim, const CeedInt *num_elem_1d, CeedInt P_1d, CeedInt block_size,
+                                                            CeedInt num_comp, CeedInt comp_stride, CeedSize l_size, CeedElemRestriction *rstr);
 CEED_EXTERN int  CeedElemRestrictionCreateUnsignedCopy(CeedElemRestriction rstr, CeedElemRestriction *rstr_unsigned);
 CEED_EXTERN int  CeedElemRestrictionCreateUnorientedCopy(CeedElemRestriction rstr, CeedElemRestriction *rstr_unoriented);
 CEED_EXTERN int  CeedElemRestrictionReferenceCopy(CeedElemRestriction rstr, CeedElemRestriction *rstr_copy);
@@ -289,6 +302,11 @@ CEED_EXTERN int  CeedElemRestrictionGetNumComponents(CeedElemRestriction rstr, C
 CEED_EXTERN int  CeedElemRestrictionGetNumBlocks(CeedElemRestriction rstr, CeedInt *num_block);
 CEED_EXTERN int  CeedElemRestrictionGetBlockSize(CeedElemRestriction rstr, CeedInt *block_size);
 CEED_EXTERN int  CeedElemRestrictionGetMultiplicity(CeedElemRestriction rstr, CeedVector mult);
+CEED_EXTERN int  CeedElemRestrictionGetColoring(CeedElemRestriction rstr, CeedColoringType coloring_type, CeedInt block_size, CeedInt *num_colors,
+                                                const CeedInt **color_offsets, const CeedInt **color_blocks);
+CEED_EXTERN int  CeedElemRestrictionComputeReordering(CeedElemRestriction rstr, CeedReorderType reorder_type, CeedInt dim,
+                                                      const CeedScalar *elem_coords, CeedInt *elem_perm, CeedInt *node_perm,
+                                                      CeedScalar *gather_stride_before, CeedScalar *gather_stride_after);
 CEED_EXTERN int  CeedElemRestrictionView(CeedElemRestriction rstr, FILE *stream);
 CEED_EXTERN int  CeedElemRestrictionDestroy(CeedElemRestriction *rstr);
 
@@ -422,6 +440,8 @@ CEED_EXTERN int  CeedCompositeOperatorAddSub(CeedOperator composite_op, CeedOper
 CEED_EXTERN int  CeedCompositeOperatorGetNumSub(CeedOperator op, CeedInt *num_suboperators);
 CEED_EXTERN int  CeedCompositeOperatorGetSubList(CeedOperator op, CeedOperator **sub_operators);
 CEED_EXTERN int  CeedCompositeOperatorGetSubByName(CeedOperator op, const char *op_name, CeedOperator *sub_op);
+CEED_EXTERN int  CeedCompositeOperatorSetConcurrent(CeedOperator op, bool is_concurrent, bool is_deterministic);
+CEED_EXTERN int  CeedCompositeOperatorGetConcurrent(CeedOperator op, bool *is_concurrent, bool *is_deterministic);
 CEED_EXTERN int  CeedOperatorCheckReady(CeedOperator op);
 CEED_EXTERN int  CeedOperatorGetActiveVectorLengths(CeedOperator op, CeedSize *input_size, CeedSize *output_size);
 CEED_EXTERN int  CeedOperatorSetQFunctionAssemblyReuse(CeedOperator op, bool reuse_assembly_data);
@@ -436,6 +456,9 @@ CEED_EXTERN int  CeedOperatorLinearAssembleAddPointBlockDiagonal(CeedOperator op
 CEED_EXTERN int  CeedOperatorLinearAssemblePointBlockDiagonalSymbolic(CeedOperator op, CeedSize *num_entries, CeedInt **rows, CeedInt **cols);
 CEED_EXTERN int  CeedOperatorLinearAssembleSymbolic(CeedOperator op, CeedSize *num_entries, CeedInt **rows, CeedInt **cols);
 CEED_EXTERN int  CeedOperatorLinearAssemble(CeedOperator op, CeedVector values);
+CEED_EXTERN int  CeedOperatorLinearAssembleSymbolicCSR(CeedOperator op, CeedInt block_size, CeedSize *num_block_rows, CeedSize **row_offsets,
+                                                       CeedInt **cols);
+CEED_EXTERN int  CeedOperatorLinearAssembleCSR(CeedOperator op, CeedVector values);
 CEED_EXTERN int  CeedCompositeOperatorGetMultiplicity(CeedOperator op, CeedInt num_skip_indices, CeedInt *skip_indices, CeedVector mult);
 CEED_EXTERN int  CeedOperatorMultigridLevelCreate(CeedOperator op_fine, CeedVector p_mult_fine, CeedElemRestriction rstr_coarse,
                                                   CeedBasis basis_coarse, CeedOperator *op_coarse, CeedOperator *op_prolong,
@@ -449,6 +472,12 @@ CEED_EXTERN int  CeedOperatorMultigridLevelCreateH1(CeedOperator op_fine, CeedVe
 CEED_EXTERN int  CeedOperatorCreateFDMElementInverse(CeedOperator op, CeedOperator *fdm_inv, CeedRequest *request);
 CEED_EXTERN int  CeedOperatorSetName(CeedOperator op, const char *name);
 CEED_EXTERN int  CeedOperatorGetName(CeedOperator op, const char **name);
+CEED_EXTERN int  CeedOperatorSetFieldStorage(CeedOperator op, const char *field_name, CeedStorageType storage);
+CEED_EXTERN int  CeedOperatorSetCollectStats(CeedOperator op, bool collect_stats);
+CEED_EXTERN int  CeedOperatorGetStats(CeedOperator op, CeedStageType stage, const char *field_name, CeedSize *num_calls, double *time,
+                                      CeedSize *bytes, CeedSize *flops);
+CEED_EXTERN int  CeedOperatorResetStats(CeedOperator op);
+CEED_EXTERN int  CeedOperatorGetRoofline(CeedOperator op, double stream_bandwidth, double *intensity, double *bandwidth, double *fraction);
 CEED_EXTERN int  CeedOperatorView(CeedOperator op, FILE *stream);
 CEED_EXTERN int  CeedOperatorViewTerse(CeedOperator op, FILE *stream);
 CEED_EXTERN int  CeedOperatorGetCeed(CeedOperator op, Ceed *ceed);
@@ -456,6 +485,7 @@ CEED_EXTERN Ceed CeedOperatorReturnCeed(CeedOperator op);
 CEED_EXTERN int  CeedOperatorGetNumElements(CeedOperator op, CeedInt *num_elem);
 CEED_EXTERN int  CeedOperatorGetNumQuadraturePoints(CeedOperator op, CeedInt *num_qpts);
 CEED_EXTERN int  CeedOperatorGetFlopsEstimate(CeedOperator op, CeedSize *flops);
+CEED_EXTERN int  CeedOperatorGetBytesEstimate(CeedOperator op, CeedSize *bytes);
 CEED_EXTERN int  CeedOperatorGetContext(CeedOperator op, CeedQFunctionContext *ctx);
 CEED_EXTERN int  CeedOperatorGetContextFieldLabel(CeedOperator op, const char *field_name, CeedContextFieldLabel *field_label);
 CEED_EXTERN int  CeedOperatorSetContextDouble(CeedOperator op, CeedContextFieldLabel field_label, double *values);
@@ -469,6 +499,8 @@ CEED_EXTERN int  CeedOperatorGetContextBooleanRead(CeedOperator op, CeedContextF
 CEED_EXTERN int  CeedOperatorRestoreContextBooleanRead(CeedOperator op, CeedContextFieldLabel field_label, const bool **values);
 CEED_EXTERN int  CeedOperatorApply(CeedOperator op, CeedVector in, CeedVector out, CeedRequest *request);
 CEED_EXTERN int  CeedOperatorApplyAdd(CeedOperator op, CeedVector in, CeedVector out, CeedRequest *request);
+CEED_EXTERN int  CeedOperatorApplyMulti(CeedOperator op, CeedInt num_vecs, CeedVector *in, CeedVector *out);
+CEED_EXTERN int  CeedOperatorApplyAddMulti(CeedOperator op, CeedInt num_vecs, CeedVector *in, CeedVector *out);
 CEED_EXTERN int  CeedOperatorAssemblyDataStrip(CeedOperator op);
 CEED_EXTERN int  CeedOperatorDestroy(CeedOperator *op);
 
@@ -477,6 +509,7 @@ CEED_EXTERN int CeedOperatorFieldGetName(CeedOperatorField op_field, const char
 CEED_EXTERN int CeedOperatorFieldGetElemRestriction(CeedOperatorField op_field, CeedElemRestriction *rstr);
 CEED_EXTERN int CeedOperatorFieldGetBasis(CeedOperatorField op_field, CeedBasis *basis);
 CEED_EXTERN int CeedOperatorFieldGetVector(CeedOperatorField op_field, CeedVector *vec);
+CEED_EXTERN int CeedOperatorFieldGetStorage(CeedOperatorField op_field, CeedStorageType *storage);
 CEED_EXTERN int CeedOperatorFieldGetData(CeedOperatorField op_field, const char **field_name, CeedElemRestriction *rstr, CeedBasis *basis,
                                          CeedVector *vec);
 
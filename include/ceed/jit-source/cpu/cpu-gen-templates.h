@@ -0,0 +1,237 @@
+// Copyright (c) 2017-2025, Lawrence Livermore National Security, LLC and other CEED contributors.
+// All Rights Reserved. See the top-level LICENSE and NOTICE files for details.
+//
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// This file is part of CEED:  http://github.com/ceed
+
+/// @file
+/// Internal header for CPU backend code generation templates for JiT source
+///
+/// All size arguments are literal constants in the generated operator, so these helpers are specialized by the compiler once inlined.
+#include <ceed/types.h>
+
+#include "cpu-types.h"
+
+//------------------------------------------------------------------------------
+// L-vector -> E-vector, offsets provided
+//------------------------------------------------------------------------------
+CEED_QFUNCTION_HELPER void ReadLVecStandard_Cpu(const CeedInt num_comp, const CeedInt comp_stride, const CeedInt elem_size, const CeedInt elem,
+                                                const CeedInt *restrict indices, const CeedScalar *restrict d_u, CeedScalar *restrict r_u) {
+  for (CeedInt node = 0; node < elem_size; node++) {
+    const CeedInt ind = indices[node + elem * elem_size];
+
+    for (CeedInt comp = 0; comp < num_comp; comp++) r_u[comp * elem_size + node] = d_u[ind + comp_stride * comp];
+  }
+}
+
+//------------------------------------------------------------------------------
+// L-vector -> E-vector, strided
+//------------------------------------------------------------------------------
+CEED_QFUNCTION_HELPER void ReadLVecStrided_Cpu(const CeedInt num_comp, const CeedInt elem_size, const CeedInt stride_node, const CeedInt stride_comp,
+                                               const CeedInt stride_elem, const CeedInt elem, const CeedScalar *restrict d_u,
+                                               CeedScalar *restrict r_u) {
+  for (CeedInt comp = 0; comp < num_comp; comp++) {
+    for (CeedInt node = 0; node < elem_size; node++) {
+      r_u[comp * elem_size + node] = d_u[node * stride_node + comp * stride_comp + elem * stride_elem];
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+// L-vector -> E-vector, structured Cartesian restriction
+//
+// Offsets are the element origin plus the lexicographic node offset, so no indices are read.
+//------------------------------------------------------------------------------
+CEED_QFUNCTION_HELPER CeedInt StructuredOffset_Cpu(const CeedInt P_1d, const CeedInt num_elem_x, const CeedInt num_elem_y, const CeedInt elem,
+                                                   const CeedInt node) {
+  const CeedInt num_nodes_x = num_elem_x * (P_1d - 1) + 1, num_nodes_y = num_elem_y * (P_1d - 1) + 1;
+  const CeedInt e_x = elem % num_elem_x, e_y = (elem / num_elem_x) % num_elem_y, e_z = elem / (num_elem_x * num_elem_y);
+
+  return (P_1d - 1) * (e_x + num_nodes_x * (e_y + num_nodes_y * e_z)) + node % P_1d +
+         num_nodes_x * ((node / P_1d) % P_1d + num_nodes_y * (node / (P_1d * P_1d)));
+}
+
+CEED_QFUNCTION_HELPER void ReadLVecStructured_Cpu(const CeedInt num_comp, const CeedInt comp_stride, const CeedInt elem_size, const CeedInt P_1d,
+                                                  const CeedInt num_elem_x, const CeedInt num_elem_y, const CeedInt elem,
+                                                  const CeedScalar *restrict d_u, CeedScalar *restrict r_u) {
+  for (CeedInt node = 0; node < elem_size; node++) {
+    const CeedInt ind = StructuredOffset_Cpu(P_1d, num_elem_x, num_elem_y, elem, node);
+
+    for (CeedInt comp = 0; comp < num_comp; comp++) r_u[comp * elem_size + node] = d_u[ind + comp_stride * comp];
+  }
+}
+
+//------------------------------------------------------------------------------
+// E-vector -> L-vector, offsets provided
+//------------------------------------------------------------------------------
+CEED_QFUNCTION_HELPER void WriteLVecStandard_Cpu(const CeedInt num_comp, const CeedInt comp_stride, const CeedInt elem_size, const CeedInt elem,
+                                                 const CeedInt *restrict indices, const CeedScalar *restrict r_v, CeedScalar *restrict d_v) {
+  for (CeedInt node = 0; node < elem_size; node++) {
+    const CeedInt ind = indices[node + elem * elem_size];
+
+    for (CeedInt comp = 0; comp < num_comp; comp++) d_v[ind + comp_stride * comp] += r_v[comp * elem_size + node];
+  }
+}
+
+//------------------------------------------------------------------------------
+// E-vector -> L-vector, structured Cartesian restriction
+//------------------------------------------------------------------------------
+CEED_QFUNCTION_HELPER void WriteLVecStructured_Cpu(const CeedInt num_comp, const CeedInt comp_stride, const CeedInt elem_size, const CeedInt P_1d,
+                                                   const CeedInt num_elem_x, const CeedInt num_elem_y, const CeedInt elem,
+                                                   const CeedScalar *restrict r_v, CeedScalar *restrict d_v) {
+  for (CeedInt node = 0; node < elem_size; node++) {
+    const CeedInt ind = StructuredOffset_Cpu(P_1d, num_elem_x, num_elem_y, elem, node);
+
+    for (CeedInt comp = 0; comp < num_comp; comp++) d_v[ind + comp_stride * comp] += r_v[comp * elem_size + node];
+  }
+}
+
+//------------------------------------------------------------------------------
+// E-vector -> L-vector, strided
+//------------------------------------------------------------------------------
+CEED_QFUNCTION_HELPER void WriteLVecStrided_Cpu(const CeedInt num_comp, const CeedInt elem_size, const CeedInt stride_node, const CeedInt stride_comp,
+                                                const CeedInt stride_elem, const CeedInt elem, const CeedScalar *restrict r_v,
+                                                CeedScalar *restrict d_v) {
+  for (CeedInt comp = 0; comp < num_comp; comp++) {
+    for (CeedInt node = 0; node < elem_size; node++) {
+      d_v[node * stride_node + comp * stride_comp + elem * stride_elem] += r_v[comp * elem_size + node];
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+// Tensor contraction
+//
+// Contract the middle index of u, shape [A][B][C], with t to give v, shape [A][J][C].
+// t has shape [J][B], or [B][J] when transposed.
+//------------------------------------------------------------------------------
+CEED_QFUNCTION_HELPER void ContractTensor_Cpu(const CeedInt A, const CeedInt B, const CeedInt C, const CeedInt J, const CeedScalar *restrict t,
+                                              const bool is_transpose, const bool add, const CeedScalar *restrict u, CeedScalar *restrict v) {
+  const CeedInt t_stride_0 = is_transpose ? 1 : B, t_stride_1 = is_transpose ? J : 1;
+
+  if (!add) {
+    for (CeedInt i = 0; i < A * J * C; i++) v[i] = 0.0;
+  }
+  for (CeedInt a = 0; a < A; a++) {
+    for (CeedInt b = 0; b < B; b++) {
+      for (CeedInt j = 0; j < J; j++) {
+        const CeedScalar t_jb = t[j * t_stride_0 + b * t_stride_1];
+
+        for (CeedInt c = 0; c < C; c++) v[(a * J + j) * C + c] += t_jb * u[(a * B + b) * C + c];
+      }
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+// Tensor basis work array size, for each of the two scratch arrays
+//------------------------------------------------------------------------------
+CEED_QFUNCTION_HELPER CeedInt TensorWorkSize_Cpu(const CeedInt dim, const CeedInt num_comp, const CeedInt P_1d, const CeedInt Q_1d) {
+  CeedInt size = num_comp;
+
+  for (CeedInt d = 0; d < dim; d++) size *= P_1d > Q_1d ? P_1d : Q_1d;
+  return size;
+}
+
+//------------------------------------------------------------------------------
+// Tensor interpolation, nodes to quadrature points or the transpose
+//------------------------------------------------------------------------------
+CEED_QFUNCTION_HELPER void InterpTensorCore_Cpu(const CeedInt dim, const CeedInt num_comp, const CeedInt P, const CeedInt Q, const bool is_transpose,
+                                                const CeedScalar *restrict interp_1d, const CeedScalar *restrict r_u, CeedScalar *restrict r_v,
+                                                CeedScalar *restrict r_t) {
+  const CeedInt work_size = TensorWorkSize_Cpu(dim, num_comp, P, Q);
+  CeedInt       pre = num_comp, post = 1;
+
+  for (CeedInt d = 0; d < dim - 1; d++) pre *= P;
+  for (CeedInt d = 0; d < dim; d++) {
+    ContractTensor_Cpu(pre, P, post, Q, interp_1d, is_transpose, false, d == 0 ? r_u : &r_t[(d % 2) * work_size],
+                       d == dim - 1 ? r_v : &r_t[((d + 1) % 2) * work_size]);
+    pre /= P;
+    post *= Q;
+  }
+}
+
+CEED_QFUNCTION_HELPER void InterpTensor_Cpu(const CeedInt dim, const CeedInt num_comp, const CeedInt P_1d, const CeedInt Q_1d,
+                                            const CeedScalar *restrict interp_1d, const CeedScalar *restrict r_u, CeedScalar *restrict r_v,
+                                            CeedScalar *restrict r_t) {
+  InterpTensorCore_Cpu(dim, num_comp, P_1d, Q_1d, false, interp_1d, r_u, r_v, r_t);
+}
+
+CEED_QFUNCTION_HELPER void InterpTransposeTensor_Cpu(const CeedInt dim, const CeedInt num_comp, const CeedInt P_1d, const CeedInt Q_1d,
+                                                     const CeedScalar *restrict interp_1d, const CeedScalar *restrict r_u, CeedScalar *restrict r_v,
+                                                     CeedScalar *restrict r_t) {
+  InterpTensorCore_Cpu(dim, num_comp, Q_1d, P_1d, true, interp_1d, r_u, r_v, r_t);
+}
+
+//------------------------------------------------------------------------------
+// Tensor gradient, nodes to quadrature points
+//
+// r_v has shape [dim][num_comp][Q_1d^dim].
+//------------------------------------------------------------------------------
+CEED_QFUNCTION_HELPER void GradTensor_Cpu(const CeedInt dim, const CeedInt num_comp, const CeedInt P_1d, const CeedInt Q_1d,
+                                          const CeedScalar *restrict interp_1d, const CeedScalar *restrict grad_1d, const CeedScalar *restrict r_u,
+                                          CeedScalar *restrict r_v, CeedScalar *restrict r_t) {
+  const CeedInt work_size = TensorWorkSize_Cpu(dim, num_comp, P_1d, Q_1d);
+  CeedInt       num_qpts  = 1;
+
+  for (CeedInt d = 0; d < dim; d++) num_qpts *= Q_1d;
+  for (CeedInt p = 0; p < dim; p++) {
+    CeedInt pre = num_comp, post = 1;
+
+    for (CeedInt d = 0; d < dim - 1; d++) pre *= P_1d;
+    for (CeedInt d = 0; d < dim; d++) {
+      ContractTensor_Cpu(pre, P_1d, post, Q_1d, p == d ? grad_1d : interp_1d, false, false, d == 0 ? r_u : &r_t[(d % 2) * work_size],
+                         d == dim - 1 ? &r_v[p * num_comp * num_qpts] : &r_t[((d + 1) % 2) * work_size]);
+      pre /= P_1d;
+      post *= Q_1d;
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+// Tensor gradient transpose, quadrature points to nodes
+//
+// r_u has shape [dim][num_comp][Q_1d^dim].
+//------------------------------------------------------------------------------
+CEED_QFUNCTION_HELPER void GradTransposeTensor_Cpu(const CeedInt dim, const CeedInt num_comp, const CeedInt P_1d, const CeedInt Q_1d,
+                                                   const CeedScalar *restrict interp_1d, const CeedScalar *restrict grad_1d,
+                                                   const CeedScalar *restrict r_u, CeedScalar *restrict r_v, CeedScalar *restrict r_t) {
+  const CeedInt work_size = TensorWorkSize_Cpu(dim, num_comp, P_1d, Q_1d);
+  CeedInt       num_qpts = 1, num_nodes = num_comp;
+
+  for (CeedInt d = 0; d < dim; d++) {
+    num_qpts *= Q_1d;
+    num_nodes *= P_1d;
+  }
+  for (CeedInt i = 0; i < num_nodes; i++) r_v[i] = 0.0;
+  for (CeedInt p = 0; p < dim; p++) {
+    CeedInt pre = num_comp, post = 1;
+
+    for (CeedInt d = 0; d < dim - 1; d++) pre *= Q_1d;
+    for (CeedInt d = 0; d < dim; d++) {
+      ContractTensor_Cpu(pre, Q_1d, post, P_1d, p == d ? grad_1d : interp_1d, true, d == dim - 1,
+                         d == 0 ? &r_u[p * num_comp * num_qpts] : &r_t[(d % 2) * work_size], d == dim - 1 ? r_v : &r_t[((d + 1) % 2) * work_size]);
+      pre /= Q_1d;
+      post *= P_1d;
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+// Tensor quadrature weights
+//------------------------------------------------------------------------------
+CEED_QFUNCTION_HELPER void WeightTensor_Cpu(const CeedInt dim, const CeedInt Q_1d, const CeedScalar *restrict q_weight_1d, CeedScalar *restrict r_w) {
+  CeedInt num_qpts = 1;
+
+  for (CeedInt d = 0; d < dim; d++) num_qpts *= Q_1d;
+  for (CeedInt i = 0; i < num_qpts; i++) {
+    CeedInt stride = 1;
+
+    r_w[i] = 1.0;
+    for (CeedInt d = 0; d < dim; d++) {
+      r_w[i] *= q_weight_1d[(i / stride) % Q_1d];
+      stride *= Q_1d;
+    }
+  }
+}
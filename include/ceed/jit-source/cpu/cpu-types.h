@@ -0,0 +1,26 @@
+// Copyright (c) 2017-2025, Lawrence Livermore National Security, LLC and other CEED contributors.
+// All Rights Reserved. See the top-level LICENSE and NOTICE files for details.
+//
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// This file is part of CEED:  http://github.com/ceed
+
+/// @file
+/// Internal header for CPU code generation type definitions
+#pragma once
+
+#include <ceed/types.h>
+
+#define CEED_CPU_NUMBER_FIELDS 16
+
+typedef struct {
+  const CeedScalar *inputs[CEED_CPU_NUMBER_FIELDS];
+  CeedScalar       *outputs[CEED_CPU_NUMBER_FIELDS];
+} Fields_Cpu;
+
+typedef struct {
+  const CeedInt *inputs[CEED_CPU_NUMBER_FIELDS];
+  const CeedInt *outputs[CEED_CPU_NUMBER_FIELDS];
+} FieldsInt_Cpu;
+
+typedef int (*CeedOperatorKernel_Cpu)(CeedInt num_elem, void *ctx, FieldsInt_Cpu indices, Fields_Cpu fields, Fields_Cpu B, Fields_Cpu G);
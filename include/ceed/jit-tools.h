@@ -20,3 +20,9 @@ CEED_EXTERN int CeedLoadSourceToInitializedBuffer(Ceed ceed, const char *source_
 CEED_EXTERN int CeedPathConcatenate(Ceed ceed, const char *base_file_path, const char *relative_file_path, char **new_file_path);
 CEED_EXTERN int CeedGetJitRelativePath(const char *absolute_file_path, const char **relative_file_path);
 CEED_EXTERN int CeedGetJitAbsolutePath(Ceed ceed, const char *relative_file_path, const char **absolute_file_path);
+CEED_EXTERN int CeedJitCacheGetKey(Ceed ceed, const char *source, const char *compiler_info, char **key);
+CEED_EXTERN int CeedJitCacheLookup(Ceed ceed, const char *key, const char *suffix, char **entry_path, bool *is_hit);
+CEED_EXTERN int CeedJitCacheCreateTempFile(Ceed ceed, const char *entry_path, int *fd, char **temp_path);
+CEED_EXTERN int CeedJitCacheStoreFile(Ceed ceed, const char *temp_path, const char *entry_path, bool *is_stored);
+CEED_EXTERN int CeedJitCacheRead(Ceed ceed, const char *key, const char *suffix, bool *is_hit, size_t *size, char **data);
+CEED_EXTERN int CeedJitCacheWrite(Ceed ceed, const char *key, const char *suffix, size_t size, const char *data);
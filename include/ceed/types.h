@@ -254,4 +254,46 @@ typedef enum {
   CEED_CONTEXT_FIELD_BOOL = 3,
 } CeedContextFieldType;
 
+/// Storage format for passive `CeedOperator` input data
+/// @ingroup CeedOperator
+typedef enum {
+  /// Store as CeedScalar
+  CEED_STORAGE_SCALAR = 0,
+  /// Store in single precision
+  CEED_STORAGE_FP32 = 1,
+  /// Store in bfloat16, with the exponent range of single precision and 8 significant bits
+  CEED_STORAGE_BF16 = 2,
+} CeedStorageType;
+
+/// Strategy for coloring the element blocks of a `CeedElemRestriction`
+/// @ingroup CeedElemRestriction
+typedef enum {
+  /// First fit greedy coloring in element block order
+  CEED_COLORING_GREEDY = 0,
+  /// Greedy coloring followed by moving element blocks from large colors to small ones, for a similar amount of work per color
+  CEED_COLORING_BALANCED = 1,
+} CeedColoringType;
+
+/// Strategy for reordering the elements and L-vector nodes of a `CeedElemRestriction` to improve memory locality
+/// @ingroup CeedElemRestriction
+typedef enum {
+  /// Reverse Cuthill-McKee ordering of the graph of elements sharing L-vector nodes
+  CEED_REORDER_RCM = 0,
+  /// Morton (Z-order) space filling curve through the element centroids
+  CEED_REORDER_MORTON = 1,
+} CeedReorderType;
+
+/// Stage of `CeedOperator` application for statistics collected with @ref CeedOperatorSetCollectStats()
+/// @ingroup CeedOperator
+typedef enum {
+  /// Whole `CeedOperator` application
+  CEED_STAGE_OPERATOR = 0,
+  /// `CeedElemRestriction` application, from L-vectors for input fields and to L-vectors for output fields
+  CEED_STAGE_RESTRICTION = 1,
+  /// `CeedBasis` application
+  CEED_STAGE_BASIS = 2,
+  /// `CeedQFunction` application
+  CEED_STAGE_QFUNCTION = 3,
+} CeedStageType;
+
 #endif  // CEED_QFUNCTION_DEFS_H
@@ -985,6 +985,50 @@ int CeedBasisGetFlopsEstimate(CeedBasis basis, CeedTransposeMode t_mode, CeedEva
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Estimate number of bytes of memory traffic per element required to apply `CeedBasis` in `t_mode` and `eval_mode`
+
+  The estimate counts the element values and quadrature point values read and written.
+  The basis matrices are shared by all elements and are assumed to remain in cache.
+
+  @param[in]  basis        `CeedBasis` to estimate bytes for
+  @param[in]  t_mode       Apply basis or transpose
+  @param[in]  eval_mode    @ref CeedEvalMode
+  @param[in]  is_at_points Evaluate the basis at points or quadrature points
+  @param[in]  num_points   Number of points basis is evaluated at
+  @param[out] bytes        Address of variable to hold bytes estimate
+
+  @ref Backend
+**/
+int CeedBasisGetBytesEstimate(CeedBasis basis, CeedTransposeMode t_mode, CeedEvalMode eval_mode, bool is_at_points, CeedInt num_points,
+                              CeedSize *bytes) {
+  bool    is_tensor;
+  CeedInt num_comp, q_comp, num_nodes, num_qpts;
+
+  CeedCall(CeedBasisIsTensor(basis, &is_tensor));
+  CeedCheck(!is_at_points || is_tensor, CeedBasisReturnCeed(basis), CEED_ERROR_INCOMPATIBLE, "Can only evaluate tensor-product bases at points");
+  CeedCall(CeedBasisGetNumComponents(basis, &num_comp));
+  CeedCall(CeedBasisGetNumQuadratureComponents(basis, eval_mode, &q_comp));
+  CeedCall(CeedBasisGetNumNodes(basis, &num_nodes));
+  if (is_at_points) num_qpts = num_points;
+  else CeedCall(CeedBasisGetNumQuadraturePoints(basis, &num_qpts));
+  switch (eval_mode) {
+    case CEED_EVAL_NONE:
+      *bytes = 0;
+      break;
+    case CEED_EVAL_INTERP:
+    case CEED_EVAL_GRAD:
+    case CEED_EVAL_DIV:
+    case CEED_EVAL_CURL:
+      *bytes = (CeedSize)(num_nodes * num_comp + num_qpts * num_comp * q_comp) * sizeof(CeedScalar);
+      break;
+    case CEED_EVAL_WEIGHT:
+      *bytes = (CeedSize)num_qpts * sizeof(CeedScalar);
+      break;
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
 /**
   @brief Get `CeedFESpace` for a `CeedBasis`
 
@@ -1075,6 +1119,51 @@ int CeedMatrixMatrixMultiply(Ceed ceed, const CeedScalar *mat_A, const CeedScala
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Fold a centro-symmetric or centro-antisymmetric matrix into even and odd halves
+
+  For a row-major `m x n` matrix with `mat[i][j] = parity * mat[m - 1 - i][n - 1 - j]`, the even and odd halves are the row-major
+    `ceil(m / 2) x ceil(n / 2)` matrices
+    `mat_even[i][j] = (mat[i][j] + mat[i][n - 1 - j]) / 2` and `mat_odd[i][j] = (mat[i][j] - mat[i][n - 1 - j]) / 2`,
+  used by @ref CeedTensorContractApplyEvenOdd() to apply the matrix with half of the multiply-adds.
+  The symmetry must hold to within rounding, `(m + n) * CEED_EPSILON` relative to the largest entry, so folding does not perturb nearly symmetric matrices.
+  If the matrix does not have this symmetry or is zero, `mat_even` and `mat_odd` are set to `NULL`.
+
+  @param[in]  mat      Row-major matrix
+  @param[in]  m        Number of rows
+  @param[in]  n        Number of columns
+  @param[in]  parity   1 for a centro-symmetric matrix, -1 for a centro-antisymmetric matrix
+  @param[out] mat_even Address to store newly allocated even half, or `NULL`
+  @param[out] mat_odd  Address to store newly allocated odd half, or `NULL`
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Utility
+**/
+int CeedMatrixFoldEvenOdd(const CeedScalar *mat, CeedInt m, CeedInt n, CeedInt parity, CeedScalar **mat_even, CeedScalar **mat_odd) {
+  const CeedInt m_half = (m + 1) / 2, n_half = (n + 1) / 2;
+  bool          is_symmetric = true;
+  CeedScalar    max_abs      = 0.0;
+
+  *mat_even = NULL;
+  *mat_odd  = NULL;
+  for (CeedInt i = 0; i < m * n; i++) max_abs = fmax(max_abs, fabs(mat[i]));
+  if (max_abs == 0.0) return CEED_ERROR_SUCCESS;
+  // Entry i of the row-major matrix is mirrored by entry m * n - 1 - i; rounding in the entries of symmetric bases grows with the matrix size
+  for (CeedInt i = 0; i < m * n; i++) is_symmetric = is_symmetric && fabs(mat[i] - parity * mat[m * n - 1 - i]) <= (m + n) * CEED_EPSILON * max_abs;
+  if (!is_symmetric) return CEED_ERROR_SUCCESS;
+
+  CeedCall(CeedCalloc(m_half * n_half, mat_even));
+  CeedCall(CeedCalloc(m_half * n_half, mat_odd));
+  for (CeedInt i = 0; i < m_half; i++) {
+    for (CeedInt j = 0; j < n_half; j++) {
+      (*mat_even)[i * n_half + j] = (mat[i * n + j] + mat[i * n + n - 1 - j]) / 2;
+      (*mat_odd)[i * n_half + j]  = (mat[i * n + j] - mat[i * n + n - 1 - j]) / 2;
+    }
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
 /**
   @brief Return QR Factorization of a matrix
 
@@ -1492,6 +1581,9 @@ int CeedBasisCreateTensorH1(Ceed ceed, CeedInt dim, CeedInt num_comp, CeedInt P_
   CeedCall(CeedCalloc(Q_1d * P_1d, &(*basis)->grad_1d));
   if (interp_1d) memcpy((*basis)->interp_1d, interp_1d, Q_1d * P_1d * sizeof(interp_1d[0]));
   if (grad_1d) memcpy((*basis)->grad_1d, grad_1d, Q_1d * P_1d * sizeof(grad_1d[0]));
+  // Even-odd decomposition for symmetric nodes and quadrature points
+  if (interp_1d) CeedCall(CeedMatrixFoldEvenOdd(interp_1d, Q_1d, P_1d, 1, &(*basis)->interp_1d_even, &(*basis)->interp_1d_odd));
+  if (grad_1d) CeedCall(CeedMatrixFoldEvenOdd(grad_1d, Q_1d, P_1d, -1, &(*basis)->grad_1d_even, &(*basis)->grad_1d_odd));
   CeedCall(ceed->BasisCreateTensorH1(dim, P_1d, Q_1d, interp_1d, grad_1d, q_ref_1d, q_weight_1d, *basis));
   return CEED_ERROR_SUCCESS;
 }
@@ -1942,9 +2034,14 @@ int CeedBasisView(CeedBasis basis, FILE *stream) {
   @ref User
 **/
 int CeedBasisApply(CeedBasis basis, CeedInt num_elem, CeedTransposeMode t_mode, CeedEvalMode eval_mode, CeedVector u, CeedVector v) {
+  CeedSize     start_ns;
+  CeedOperator op_stats;
+
   CeedCall(CeedBasisApplyCheckDims(basis, num_elem, t_mode, eval_mode, u, v));
   CeedCheck(basis->Apply, CeedBasisReturnCeed(basis), CEED_ERROR_UNSUPPORTED, "Backend does not support CeedBasisApply");
+  CeedCall(CeedOperatorStatsGetCurrent(&op_stats, &start_ns));
   CeedCall(basis->Apply(basis, num_elem, t_mode, eval_mode, u, v));
+  if (op_stats) CeedCall(CeedOperatorStatsRecordBasis(op_stats, basis, num_elem, t_mode, eval_mode, false, start_ns));
   return CEED_ERROR_SUCCESS;
 }
 
@@ -1970,10 +2067,15 @@ int CeedBasisApply(CeedBasis basis, CeedInt num_elem, CeedTransposeMode t_mode,
   @ref User
 **/
 int CeedBasisApplyAdd(CeedBasis basis, CeedInt num_elem, CeedTransposeMode t_mode, CeedEvalMode eval_mode, CeedVector u, CeedVector v) {
+  CeedSize     start_ns;
+  CeedOperator op_stats;
+
   CeedCheck(t_mode == CEED_TRANSPOSE, CeedBasisReturnCeed(basis), CEED_ERROR_UNSUPPORTED, "CeedBasisApplyAdd only supports CEED_TRANSPOSE");
   CeedCall(CeedBasisApplyCheckDims(basis, num_elem, t_mode, eval_mode, u, v));
   CeedCheck(basis->ApplyAdd, CeedBasisReturnCeed(basis), CEED_ERROR_UNSUPPORTED, "Backend does not implement CeedBasisApplyAdd");
+  CeedCall(CeedOperatorStatsGetCurrent(&op_stats, &start_ns));
   CeedCall(basis->ApplyAdd(basis, num_elem, t_mode, eval_mode, u, v));
+  if (op_stats) CeedCall(CeedOperatorStatsRecordBasis(op_stats, basis, num_elem, t_mode, eval_mode, true, start_ns));
   return CEED_ERROR_SUCCESS;
 }
 
@@ -2313,6 +2415,55 @@ int CeedBasisGetGrad1D(CeedBasis basis, const CeedScalar **grad_1d) {
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Get the even and odd halves of the 1D interpolation matrix of a tensor product `CeedBasis`
+
+  These are set by @ref CeedBasisCreateTensorH1() when the 1D interpolation matrix is centro-symmetric, as for symmetric nodes and quadrature points
+    such as Gauss and Gauss-Lobatto, and are `NULL` otherwise.
+  See @ref CeedMatrixFoldEvenOdd().
+
+  @param[in]  basis          `CeedBasis`
+  @param[out] interp_1d_even Variable to store even half of interpolation matrix, or `NULL`
+  @param[out] interp_1d_odd  Variable to store odd half of interpolation matrix, or `NULL`
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedBasisGetInterp1DEvenOdd(CeedBasis basis, const CeedScalar **interp_1d_even, const CeedScalar **interp_1d_odd) {
+  bool is_tensor_basis;
+
+  CeedCall(CeedBasisIsTensor(basis, &is_tensor_basis));
+  CeedCheck(is_tensor_basis, CeedBasisReturnCeed(basis), CEED_ERROR_MINOR, "CeedBasis is not a tensor product CeedBasis");
+  *interp_1d_even = basis->interp_1d_even;
+  *interp_1d_odd  = basis->interp_1d_odd;
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Get the even and odd halves of the 1D gradient matrix of a tensor product `CeedBasis`
+
+  These are set by @ref CeedBasisCreateTensorH1() when the 1D gradient matrix is centro-antisymmetric and are `NULL` otherwise.
+  See @ref CeedMatrixFoldEvenOdd().
+
+  @param[in]  basis        `CeedBasis`
+  @param[out] grad_1d_even Variable to store even half of gradient matrix, or `NULL`
+  @param[out] grad_1d_odd  Variable to store odd half of gradient matrix, or `NULL`
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedBasisGetGrad1DEvenOdd(CeedBasis basis, const CeedScalar **grad_1d_even, const CeedScalar **grad_1d_odd) {
+  bool is_tensor_basis;
+
+  CeedCall(CeedBasisIsTensor(basis, &is_tensor_basis));
+  CeedCheck(is_tensor_basis, CeedBasisReturnCeed(basis), CEED_ERROR_MINOR, "CeedBasis is not a tensor product CeedBasis");
+  *grad_1d_even = basis->grad_1d_even;
+  *grad_1d_odd  = basis->grad_1d_odd;
+  return CEED_ERROR_SUCCESS;
+}
+
 /**
   @brief Get divergence matrix of a `CeedBasis`
 
@@ -2363,8 +2514,12 @@ int CeedBasisDestroy(CeedBasis *basis) {
   CeedCall(CeedFree(&(*basis)->q_weight_1d));
   CeedCall(CeedFree(&(*basis)->interp));
   CeedCall(CeedFree(&(*basis)->interp_1d));
+  CeedCall(CeedFree(&(*basis)->interp_1d_even));
+  CeedCall(CeedFree(&(*basis)->interp_1d_odd));
   CeedCall(CeedFree(&(*basis)->grad));
   CeedCall(CeedFree(&(*basis)->grad_1d));
+  CeedCall(CeedFree(&(*basis)->grad_1d_even));
+  CeedCall(CeedFree(&(*basis)->grad_1d_odd));
   CeedCall(CeedFree(&(*basis)->div));
   CeedCall(CeedFree(&(*basis)->curl));
   CeedCall(CeedVectorDestroy(&(*basis)->vec_chebyshev));
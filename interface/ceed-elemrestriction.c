@@ -10,6 +10,7 @@
 #include <ceed/backend.h>
 #include <stdbool.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 
 /// @file
@@ -98,6 +99,445 @@ int CeedPermutePadCurlOrients(const CeedInt8 *curl_orients, CeedInt8 *block_curl
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Mark the colors of the element blocks sharing an L-vector entry with element block `b`
+
+  @param[in]     b            Element block
+  @param[in]     stamp        Value marking a color as forbidden
+  @param[in]     rstr         `CeedElemRestriction`
+  @param[in]     block_size   Number of elements in each element block
+  @param[in]     offsets      Offsets array of `rstr`
+  @param[in]     entry_start  Start of the list of element blocks for each L-vector entry in `entry_blocks`
+  @param[in]     entry_blocks Element blocks touching each L-vector entry
+  @param[in]     colors       Color of each element block, negative if not yet colored
+  @param[in,out] forbidden    Array set to `stamp` for the colors of neighboring element blocks
+
+  @ref Developer
+**/
+static inline void CeedElemRestrictionMarkNeighborColors(CeedInt b, CeedInt stamp, CeedElemRestriction rstr, CeedInt block_size,
+                                                         const CeedInt *offsets, const CeedSize *entry_start, const CeedInt *entry_blocks,
+                                                         const CeedInt *colors, CeedInt *forbidden) {
+  const CeedInt elem_end = CeedIntMin((b + 1) * block_size, rstr->num_elem);
+
+  for (CeedInt i = b * block_size * rstr->elem_size; i < elem_end * rstr->elem_size; i++) {
+    for (CeedInt k = 0; k < rstr->num_comp; k++) {
+      const CeedSize entry = offsets[i] + (CeedSize)k * rstr->comp_stride;
+
+      for (CeedSize j = entry_start[entry]; j < entry_start[entry + 1]; j++) {
+        const CeedInt neighbor = entry_blocks[j];
+
+        if (neighbor != b && colors[neighbor] >= 0) forbidden[colors[neighbor]] = stamp;
+      }
+    }
+  }
+}
+
+/**
+  @brief Compute and cache a coloring of the element blocks of a `CeedElemRestriction`
+
+  @param[in,out] rstr          `CeedElemRestriction`
+  @param[in]     coloring_type Coloring strategy
+  @param[in]     block_size    Number of consecutive elements colored together
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedElemRestrictionComputeColoring(CeedElemRestriction rstr, CeedColoringType coloring_type, CeedInt block_size) {
+  const CeedInt num_elem   = rstr->num_elem, elem_size = rstr->elem_size, num_comp = rstr->num_comp, comp_stride = rstr->comp_stride;
+  const CeedInt num_block  = num_elem / block_size + !!(num_elem % block_size);
+  CeedInt       num_colors = 0, *colors, *color_counts;
+
+  CeedCall(CeedFree(&rstr->color_offsets));
+  CeedCall(CeedFree(&rstr->color_blocks));
+  rstr->coloring_block_size = 0;
+  CeedCall(CeedCalloc(num_block, &colors));
+  if (rstr->rstr_type == CEED_RESTRICTION_STRIDED) {
+    // Elements of strided restrictions do not share L-vector entries
+    num_colors = num_block > 0;
+  } else {
+    const CeedSize l_size = rstr->l_size;
+    const CeedInt *offsets;
+    CeedInt       *entry_blocks, *last_block, *forbidden;
+    CeedSize      *entry_start;
+
+    CeedCall(CeedElemRestrictionGetOffsets(rstr, CEED_MEM_HOST, &offsets));
+
+    // Element blocks touching each L-vector entry, stored in compressed rows
+    CeedCall(CeedCalloc(l_size + 1, &entry_start));
+    CeedCall(CeedMalloc(l_size, &last_block));
+    for (CeedSize i = 0; i < l_size; i++) last_block[i] = -1;
+    for (CeedInt b = 0; b < num_block; b++) {
+      for (CeedInt i = b * block_size * elem_size; i < CeedIntMin((b + 1) * block_size, num_elem) * elem_size; i++) {
+        for (CeedInt k = 0; k < num_comp; k++) {
+          const CeedSize entry = offsets[i] + (CeedSize)k * comp_stride;
+
+          if (last_block[entry] != b) entry_start[entry + 1]++;
+          last_block[entry] = b;
+        }
+      }
+    }
+    for (CeedSize i = 0; i < l_size; i++) entry_start[i + 1] += entry_start[i];
+    CeedCall(CeedMalloc(CeedIntMax(entry_start[l_size], 1), &entry_blocks));
+    for (CeedSize i = 0; i < l_size; i++) last_block[i] = -1;
+    for (CeedInt b = 0; b < num_block; b++) {
+      for (CeedInt i = b * block_size * elem_size; i < CeedIntMin((b + 1) * block_size, num_elem) * elem_size; i++) {
+        for (CeedInt k = 0; k < num_comp; k++) {
+          const CeedSize entry = offsets[i] + (CeedSize)k * comp_stride;
+
+          if (last_block[entry] != b) entry_blocks[entry_start[entry]++] = b;
+          last_block[entry] = b;
+        }
+      }
+    }
+    for (CeedSize i = l_size; i > 0; i--) entry_start[i] = entry_start[i - 1];
+    entry_start[0] = 0;
+    CeedCall(CeedFree(&last_block));
+
+    // First fit greedy coloring
+    CeedCall(CeedMalloc(CeedIntMax(num_block, 1), &forbidden));
+    for (CeedInt b = 0; b < num_block; b++) {
+      colors[b]    = -1;
+      forbidden[b] = -1;
+    }
+    for (CeedInt b = 0; b < num_block; b++) {
+      CeedInt color = 0;
+
+      CeedElemRestrictionMarkNeighborColors(b, b, rstr, block_size, offsets, entry_start, entry_blocks, colors, forbidden);
+      while (forbidden[color] == b) color++;
+      colors[b]  = color;
+      num_colors = CeedIntMax(num_colors, color + 1);
+    }
+
+    // Balance by moving element blocks from colors larger than the average to the smallest admissible color
+    if (coloring_type == CEED_COLORING_BALANCED && num_colors > 1) {
+      const CeedInt target = num_block / num_colors + !!(num_block % num_colors);
+
+      CeedCall(CeedCalloc(num_colors, &color_counts));
+      for (CeedInt b = 0; b < num_block; b++) color_counts[colors[b]]++;
+      for (CeedInt b = 0; b < num_block; b++) {
+        CeedInt color = colors[b];
+
+        if (color_counts[color] <= target) continue;
+        CeedElemRestrictionMarkNeighborColors(b, num_block + b, rstr, block_size, offsets, entry_start, entry_blocks, colors, forbidden);
+        for (CeedInt c = 0; c < num_colors; c++) {
+          if (forbidden[c] != num_block + b && color_counts[c] < color_counts[color]) color = c;
+        }
+        if (color_counts[color] < target) {
+          color_counts[colors[b]]--;
+          color_counts[color]++;
+          colors[b] = color;
+        }
+      }
+      CeedCall(CeedFree(&color_counts));
+    }
+    CeedCall(CeedFree(&forbidden));
+    CeedCall(CeedFree(&entry_start));
+    CeedCall(CeedFree(&entry_blocks));
+    CeedCall(CeedElemRestrictionRestoreOffsets(rstr, &offsets));
+  }
+
+  // Element blocks sorted by color, in increasing order within each color
+  CeedCall(CeedCalloc(num_colors + 1, &rstr->color_offsets));
+  CeedCall(CeedCalloc(CeedIntMax(num_block, 1), &rstr->color_blocks));
+  CeedCall(CeedCalloc(CeedIntMax(num_colors, 1), &color_counts));
+  for (CeedInt b = 0; b < num_block; b++) rstr->color_offsets[colors[b] + 1]++;
+  for (CeedInt c = 0; c < num_colors; c++) rstr->color_offsets[c + 1] += rstr->color_offsets[c];
+  for (CeedInt b = 0; b < num_block; b++) rstr->color_blocks[rstr->color_offsets[colors[b]] + color_counts[colors[b]]++] = b;
+  rstr->coloring_type       = coloring_type;
+  rstr->coloring_block_size = block_size;
+  rstr->num_colors          = num_colors;
+  CeedCall(CeedFree(&color_counts));
+  CeedCall(CeedFree(&colors));
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Order the elements of a `CeedElemRestriction` by reverse Cuthill-McKee on the graph of elements sharing L-vector nodes
+
+  @param[in]  rstr      `CeedElemRestriction`
+  @param[in]  offsets   Offsets array of `rstr`
+  @param[out] elem_perm Array of length `num_elem` to store the original index of each element in the new order
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedElemRestrictionOrderElementsRCM(CeedElemRestriction rstr, const CeedInt *offsets, CeedInt *elem_perm) {
+  const CeedInt  num_elem = rstr->num_elem, elem_size = rstr->elem_size;
+  const CeedSize l_size   = rstr->l_size;
+  CeedInt        num_ordered = 0, next_root = 0, stamp = 0;
+  CeedInt       *node_elems, *elem_adj, *last_seen, *mark, *queue;
+  CeedSize      *node_start, *elem_start;
+
+  // Elements touching each node, stored in compressed rows
+  CeedCall(CeedCalloc(l_size + 1, &node_start));
+  CeedCall(CeedMalloc(CeedIntMax(num_elem * elem_size, 1), &node_elems));
+  for (CeedInt i = 0; i < num_elem * elem_size; i++) node_start[offsets[i] + 1]++;
+  for (CeedSize i = 0; i < l_size; i++) node_start[i + 1] += node_start[i];
+  for (CeedInt i = 0; i < num_elem * elem_size; i++) node_elems[node_start[offsets[i]]++] = i / elem_size;
+  for (CeedSize i = l_size; i > 0; i--) node_start[i] = node_start[i - 1];
+  node_start[0] = 0;
+
+  // Neighboring elements of each element, without duplicates
+  CeedCall(CeedCalloc(num_elem + 1, &elem_start));
+  CeedCall(CeedMalloc(CeedIntMax(num_elem, 1), &last_seen));
+  for (CeedInt pass = 0; pass < 2; pass++) {
+    for (CeedInt e = 0; e < num_elem; e++) last_seen[e] = -1;
+    for (CeedInt e = 0; e < num_elem; e++) {
+      last_seen[e] = e;
+      for (CeedInt n = 0; n < elem_size; n++) {
+        const CeedInt node = offsets[e * elem_size + n];
+
+        for (CeedSize j = node_start[node]; j < node_start[node + 1]; j++) {
+          const CeedInt neighbor = node_elems[j];
+
+          if (last_seen[neighbor] == e) continue;
+          last_seen[neighbor] = e;
+          if (pass == 0) elem_start[e + 1]++;
+          else elem_adj[elem_start[e]++] = neighbor;
+        }
+      }
+    }
+    if (pass == 0) {
+      for (CeedInt e = 0; e < num_elem; e++) elem_start[e + 1] += elem_start[e];
+      CeedCall(CeedMalloc(CeedIntMax(elem_start[num_elem], 1), &elem_adj));
+    } else {
+      for (CeedInt e = num_elem; e > 0; e--) elem_start[e] = elem_start[e - 1];
+      elem_start[0] = 0;
+    }
+  }
+  CeedCall(CeedFree(&last_seen));
+  CeedCall(CeedFree(&node_start));
+  CeedCall(CeedFree(&node_elems));
+
+  // One connected component at a time
+  CeedCall(CeedCalloc(CeedIntMax(num_elem, 1), &mark));
+  CeedCall(CeedMalloc(CeedIntMax(num_elem, 1), &queue));
+  while (num_ordered < num_elem) {
+    CeedInt root, depth = -1;
+
+    while (mark[next_root] < 0) next_root++;
+    root = next_root;
+
+    // Pseudo-peripheral root, the smallest degree element of the last level of a breadth first search, while the depth increases
+    while (true) {
+      CeedInt num_queued = 1, level_start = 0, level_end = 1, level_depth = 0, candidate;
+
+      stamp++;
+      queue[0]   = root;
+      mark[root] = stamp;
+      while (true) {
+        for (CeedInt q = level_start; q < level_end; q++) {
+          for (CeedSize j = elem_start[queue[q]]; j < elem_start[queue[q] + 1]; j++) {
+            if (mark[elem_adj[j]] != stamp) {
+              mark[elem_adj[j]]    = stamp;
+              queue[num_queued++] = elem_adj[j];
+            }
+          }
+        }
+        if (num_queued == level_end) break;
+        level_start = level_end;
+        level_end   = num_queued;
+        level_depth++;
+      }
+      if (level_depth <= depth) break;
+      depth     = level_depth;
+      candidate = queue[level_start];
+      for (CeedInt q = level_start; q < level_end; q++) {
+        if (elem_start[queue[q] + 1] - elem_start[queue[q]] < elem_start[candidate + 1] - elem_start[candidate]) candidate = queue[q];
+      }
+      if (candidate == root) break;
+      root = candidate;
+    }
+
+    // Cuthill-McKee, visiting unordered neighbors by increasing degree
+    elem_perm[num_ordered++] = root;
+    mark[root]               = -1;
+    for (CeedInt q = num_ordered - 1; q < num_ordered; q++) {
+      const CeedInt first_new = num_ordered;
+
+      for (CeedSize j = elem_start[elem_perm[q]]; j < elem_start[elem_perm[q] + 1]; j++) {
+        const CeedInt neighbor = elem_adj[j];
+
+        if (mark[neighbor] < 0) continue;
+        mark[neighbor] = -1;
+        // Insertion sort by degree
+        CeedInt k = num_ordered++;
+
+        while (k > first_new &&
+               elem_start[elem_perm[k - 1] + 1] - elem_start[elem_perm[k - 1]] > elem_start[neighbor + 1] - elem_start[neighbor]) {
+          elem_perm[k] = elem_perm[k - 1];
+          k--;
+        }
+        elem_perm[k] = neighbor;
+      }
+    }
+  }
+  CeedCall(CeedFree(&mark));
+  CeedCall(CeedFree(&queue));
+  CeedCall(CeedFree(&elem_start));
+  CeedCall(CeedFree(&elem_adj));
+
+  // Reverse
+  for (CeedInt e = 0; e < num_elem / 2; e++) {
+    const CeedInt elem = elem_perm[e];
+
+    elem_perm[e]                = elem_perm[num_elem - 1 - e];
+    elem_perm[num_elem - 1 - e] = elem;
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+/// Morton code and original index of an element
+typedef struct {
+  uint64_t code;
+  CeedInt  elem;
+} CeedElemMortonCode;
+
+/**
+  @brief Compare two `CeedElemMortonCode` values for `qsort()`, breaking ties by element index
+
+  @param[in] a Pointer to first value
+  @param[in] b Pointer to second value
+
+  @return Negative, zero, or positive as `a` is ordered before, equal to, or after `b`
+
+  @ref Developer
+**/
+static int CeedElemMortonCodeCompare(const void *a, const void *b) {
+  const CeedElemMortonCode *lhs = (const CeedElemMortonCode *)a, *rhs = (const CeedElemMortonCode *)b;
+
+  if (lhs->code != rhs->code) return (lhs->code > rhs->code) - (lhs->code < rhs->code);
+  return (lhs->elem > rhs->elem) - (lhs->elem < rhs->elem);
+}
+
+/**
+  @brief Order the elements of a `CeedElemRestriction` along a Morton (Z-order) curve through their centroids
+
+  @param[in]  rstr        `CeedElemRestriction`
+  @param[in]  dim         Dimension of the element centroids, at most 3
+  @param[in]  elem_coords Element centroids, with coordinate `d` of element `e` at index `e * dim + d`
+  @param[out] elem_perm   Array of length `num_elem` to store the original index of each element in the new order
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedElemRestrictionOrderElementsMorton(CeedElemRestriction rstr, CeedInt dim, const CeedScalar *elem_coords, CeedInt *elem_perm) {
+  // 21 bits per dimension fit three dimensions in a 64 bit code
+  const CeedInt       num_elem = rstr->num_elem, num_bits = 21;
+  CeedScalar          lower[3] = {0., 0., 0.}, upper[3] = {0., 0., 0.};
+  CeedElemMortonCode *codes;
+
+  // Bounding box
+  for (CeedInt d = 0; d < dim && num_elem > 0; d++) {
+    lower[d] = upper[d] = elem_coords[d];
+    for (CeedInt e = 1; e < num_elem; e++) {
+      const CeedScalar coord = elem_coords[e * dim + d];
+
+      lower[d] = coord < lower[d] ? coord : lower[d];
+      upper[d] = coord > upper[d] ? coord : upper[d];
+    }
+  }
+
+  // Interleave the bits of the quantized coordinates, most significant first
+  CeedCall(CeedMalloc(CeedIntMax(num_elem, 1), &codes));
+  for (CeedInt e = 0; e < num_elem; e++) {
+    uint64_t quantized[3] = {0, 0, 0};
+
+    for (CeedInt d = 0; d < dim; d++) {
+      const CeedScalar scaled = upper[d] > lower[d] ? (elem_coords[e * dim + d] - lower[d]) / (upper[d] - lower[d]) : 0.;
+
+      quantized[d] = (uint64_t)(scaled * ((1 << num_bits) - 1));
+    }
+    codes[e].code = 0;
+    codes[e].elem = e;
+    for (CeedInt bit = num_bits - 1; bit >= 0; bit--) {
+      for (CeedInt d = 0; d < dim; d++) codes[e].code = (codes[e].code << 1) | ((quantized[d] >> bit) & 1);
+    }
+  }
+  qsort(codes, num_elem, sizeof(CeedElemMortonCode), CeedElemMortonCodeCompare);
+  for (CeedInt e = 0; e < num_elem; e++) elem_perm[e] = codes[e].elem;
+  CeedCall(CeedFree(&codes));
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Compute the offsets of a structured Cartesian `CeedElemRestriction`.
+
+  Elements and nodes are numbered lexicographically with `x` varying fastest, as in @ref CeedElemRestrictionCreateStructured().
+
+  @param[in]  dim         Topological dimension of the mesh
+  @param[in]  num_elem_1d Number of elements in each dimension
+  @param[in]  P_1d        Number of nodes in each dimension of an element
+  @param[out] offsets     Address of the array of shape `[num_elem, P_1d^dim]` to allocate and fill
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedElemRestrictionCreateStructuredOffsets(CeedInt dim, const CeedInt *num_elem_1d, CeedInt P_1d, CeedInt **offsets) {
+  CeedInt num_elem = 1, elem_size = 1, num_elem_3d[3] = {1, 1, 1}, num_nodes_3d[3] = {1, 1, 1};
+
+  for (CeedInt d = 0; d < dim; d++) {
+    num_elem_3d[d]  = num_elem_1d[d];
+    num_nodes_3d[d] = num_elem_1d[d] * (P_1d - 1) + 1;
+    num_elem *= num_elem_1d[d];
+    elem_size *= P_1d;
+  }
+  CeedCall(CeedMalloc(CeedIntMax(num_elem * elem_size, 1), offsets));
+  for (CeedInt e = 0; e < num_elem; e++) {
+    const CeedInt e_x = e % num_elem_3d[0], e_y = (e / num_elem_3d[0]) % num_elem_3d[1], e_z = e / (num_elem_3d[0] * num_elem_3d[1]);
+
+    for (CeedInt n = 0; n < elem_size; n++) {
+      const CeedInt n_x = e_x * (P_1d - 1) + n % P_1d, n_y = e_y * (P_1d - 1) + (n / P_1d) % P_1d, n_z = e_z * (P_1d - 1) + n / (P_1d * P_1d);
+
+      (*offsets)[e * elem_size + n] = n_x + num_nodes_3d[0] * (n_y + num_nodes_3d[1] * n_z);
+    }
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Get the number of bytes of offsets and orientations read to apply a `CeedElemRestriction`
+
+  Strided and structured `CeedElemRestriction` compute their offsets and read no indices.
+
+  @param[in]  rstr  `CeedElemRestriction`
+  @param[out] bytes Variable to store the number of bytes
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+int CeedElemRestrictionGetIndexBytes(CeedElemRestriction rstr, CeedSize *bytes) {
+  CeedSize            num_offsets;
+  CeedRestrictionType rstr_type;
+
+  CeedCall(CeedElemRestrictionGetType(rstr, &rstr_type));
+  *bytes      = 0;
+  num_offsets = rstr->e_size / rstr->num_comp;
+  if (rstr->structured_dim > 0) return CEED_ERROR_SUCCESS;
+  switch (rstr_type) {
+    case CEED_RESTRICTION_STRIDED:
+      break;
+    case CEED_RESTRICTION_STANDARD:
+      *bytes = num_offsets * sizeof(CeedInt);
+      break;
+    case CEED_RESTRICTION_ORIENTED:
+      *bytes = num_offsets * (sizeof(CeedInt) + sizeof(bool));
+      break;
+    case CEED_RESTRICTION_CURL_ORIENTED:
+      *bytes = num_offsets * (sizeof(CeedInt) + 3 * sizeof(CeedInt8));
+      break;
+    case CEED_RESTRICTION_POINTS:
+      *bytes = (num_offsets + rstr->num_elem + 1) * sizeof(CeedInt);
+      break;
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
 /// @}
 
 /// ----------------------------------------------------------------------------
@@ -225,6 +665,43 @@ int CeedElemRestrictionHasBackendStrides(CeedElemRestriction rstr, bool *has_bac
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Get the structured status of a `CeedElemRestriction`
+
+  @param[in]  rstr          `CeedElemRestriction`
+  @param[out] is_structured Variable to store structured status
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedElemRestrictionIsStructured(CeedElemRestriction rstr, bool *is_structured) {
+  *is_structured = rstr->structured_dim > 0;
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Get the Cartesian structure of a structured `CeedElemRestriction`
+
+  @param[in]  rstr        `CeedElemRestriction`
+  @param[out] dim         Variable to store topological dimension of the mesh
+  @param[out] num_elem_1d Variable to store number of elements in each dimension, padded with 1 for unused dimensions
+  @param[out] P_1d        Variable to store number of nodes in each dimension of an element
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedElemRestrictionGetStructure(CeedElemRestriction rstr, CeedInt *dim, CeedInt num_elem_1d[3], CeedInt *P_1d) {
+  CeedCheck(rstr->structured_dim > 0, CeedElemRestrictionReturnCeed(rstr), CEED_ERROR_MINOR, "CeedElemRestriction has no structure data");
+  if (dim) *dim = rstr->structured_dim;
+  if (num_elem_1d) {
+    for (CeedInt d = 0; d < 3; d++) num_elem_1d[d] = rstr->structured_num_elem[d];
+  }
+  if (P_1d) *P_1d = rstr->structured_P_1d;
+  return CEED_ERROR_SUCCESS;
+}
+
 /**
   @brief Get read-only access to a `CeedElemRestriction` offsets array by @ref CeedMemType
 
@@ -585,6 +1062,27 @@ int CeedElemRestrictionGetFlopsEstimate(CeedElemRestriction rstr, CeedTransposeM
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Estimate number of bytes of memory traffic required to apply `CeedElemRestriction` in `t_mode`
+
+  The estimate counts compulsory traffic: the L-vector is read, or read and written when summing into it in transpose mode, the E-vector is written or read, and the offsets and orientations are read once.
+
+  @param[in]  rstr   `CeedElemRestriction` to estimate bytes for
+  @param[in]  t_mode Apply restriction or transpose
+  @param[out] bytes  Address of variable to hold bytes estimate
+
+  @ref Backend
+**/
+int CeedElemRestrictionGetBytesEstimate(CeedElemRestriction rstr, CeedTransposeMode t_mode, CeedSize *bytes) {
+  CeedSize e_size, l_size, index_bytes;
+
+  CeedCall(CeedElemRestrictionGetEVectorSize(rstr, &e_size));
+  CeedCall(CeedElemRestrictionGetLVectorSize(rstr, &l_size));
+  CeedCall(CeedElemRestrictionGetIndexBytes(rstr, &index_bytes));
+  *bytes = (e_size + (t_mode == CEED_TRANSPOSE ? 2 : 1) * l_size) * sizeof(CeedScalar) + index_bytes;
+  return CEED_ERROR_SUCCESS;
+}
+
 /// @}
 
 /// @cond DOXYGEN_SKIP
@@ -831,6 +1329,83 @@ int CeedElemRestrictionCreateStrided(Ceed ceed, CeedInt num_elem, CeedInt elem_s
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Create a structured `CeedElemRestriction` for a Cartesian tensor product mesh.
+
+  Elements and L-vector nodes are numbered lexicographically with `x` varying fastest.
+  There are `num_elem_1d[d]*(P_1d - 1) + 1` nodes in dimension `d`, and neighboring elements share their interface nodes.
+  This is the restriction produced by explicit offsets for such a mesh, but backends may apply it without storing an offsets array.
+
+  @param[in]  ceed        `Ceed` context used to create the `CeedElemRestriction`
+  @param[in]  dim         Topological dimension of the mesh, 1, 2, or 3
+  @param[in]  num_elem_1d Array of length `dim` with the number of elements in each dimension
+  @param[in]  P_1d        Number of nodes in each dimension of an element
+  @param[in]  num_comp    Number of field components per interpolation node (1 for scalar fields)
+  @param[in]  comp_stride Stride between components for the same L-vector "node"
+  @param[in]  l_size      The size of the L-vector.
+                            This vector may be larger than the elements and fields given by this restriction.
+  @param[out] rstr        Address of the variable where the newly created `CeedElemRestriction` will be stored
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedElemRestrictionCreateStructured(Ceed ceed, CeedInt dim, const CeedInt *num_elem_1d, CeedInt P_1d, CeedInt num_comp, CeedInt comp_stride,
+                                        CeedSize l_size, CeedElemRestriction *rstr) {
+  CeedInt  num_elem = 1, elem_size = 1;
+  CeedSize num_nodes = 1;
+
+  if (!ceed->ElemRestrictionCreateStructured && !ceed->ElemRestrictionCreate) {
+    Ceed delegate;
+
+    CeedCall(CeedGetObjectDelegate(ceed, &delegate, "ElemRestriction"));
+    CeedCheck(delegate, ceed, CEED_ERROR_UNSUPPORTED, "Backend does not implement CeedElemRestrictionCreateStructured");
+    CeedCall(CeedElemRestrictionCreateStructured(delegate, dim, num_elem_1d, P_1d, num_comp, comp_stride, l_size, rstr));
+    CeedCall(CeedDestroy(&delegate));
+    return CEED_ERROR_SUCCESS;
+  }
+
+  CeedCheck(dim >= 1 && dim <= 3, ceed, CEED_ERROR_DIMENSION, "Structured CeedElemRestriction must have dimension 1, 2, or 3");
+  CeedCheck(P_1d >= 2, ceed, CEED_ERROR_DIMENSION, "Structured CeedElemRestriction must have at least 2 nodes in each dimension");
+  for (CeedInt d = 0; d < dim; d++) {
+    CeedCheck(num_elem_1d[d] >= 0, ceed, CEED_ERROR_DIMENSION, "Number of elements must be non-negative");
+    num_elem *= num_elem_1d[d];
+    elem_size *= P_1d;
+    num_nodes *= (CeedSize)num_elem_1d[d] * (P_1d - 1) + 1;
+  }
+  CeedCheck(num_comp > 0, ceed, CEED_ERROR_DIMENSION, "CeedElemRestriction must have at least 1 component");
+  CeedCheck(num_comp == 1 || comp_stride > 0, ceed, CEED_ERROR_DIMENSION, "CeedElemRestriction component stride must be at least 1");
+  CeedCheck(l_size >= (CeedSize)(num_comp - 1) * (CeedSize)comp_stride + num_nodes, ceed, CEED_ERROR_DIMENSION,
+            "L-vector size must be at least (num_comp - 1) * comp_stride + num_nodes. Expected: > %" CeedSize_FMT " Found: %" CeedSize_FMT,
+            (CeedSize)(num_comp - 1) * (CeedSize)comp_stride + num_nodes, l_size);
+
+  if (ceed->ElemRestrictionCreateStructured) {
+    CeedCall(CeedCalloc(1, rstr));
+    CeedCall(CeedReferenceCopy(ceed, &(*rstr)->ceed));
+    (*rstr)->ref_count   = 1;
+    (*rstr)->num_elem    = num_elem;
+    (*rstr)->elem_size   = elem_size;
+    (*rstr)->num_comp    = num_comp;
+    (*rstr)->comp_stride = comp_stride;
+    (*rstr)->l_size      = l_size;
+    (*rstr)->e_size      = (CeedSize)num_elem * (CeedSize)elem_size * (CeedSize)num_comp;
+    (*rstr)->num_block   = num_elem;
+    (*rstr)->block_size  = 1;
+    (*rstr)->rstr_type   = CEED_RESTRICTION_STANDARD;
+  } else {
+    CeedInt *offsets;
+
+    // Backend only supports explicit offsets
+    CeedCall(CeedElemRestrictionCreateStructuredOffsets(dim, num_elem_1d, P_1d, &offsets));
+    CeedCall(CeedElemRestrictionCreate(ceed, num_elem, elem_size, num_comp, comp_stride, l_size, CEED_MEM_HOST, CEED_OWN_POINTER, offsets, rstr));
+  }
+  (*rstr)->structured_dim  = dim;
+  (*rstr)->structured_P_1d = P_1d;
+  for (CeedInt d = 0; d < 3; d++) (*rstr)->structured_num_elem[d] = d < dim ? num_elem_1d[d] : 1;
+  if (ceed->ElemRestrictionCreateStructured) CeedCall(ceed->ElemRestrictionCreateStructured(*rstr));
+  return CEED_ERROR_SUCCESS;
+}
+
 /**
   @brief Create a points `CeedElemRestriction`, for restricting for restricting from a all local points to the current element in which they are located.
 
@@ -1169,6 +1744,83 @@ int CeedElemRestrictionCreateBlockedStrided(Ceed ceed, CeedInt num_elem, CeedInt
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Create a blocked structured `CeedElemRestriction`, typically only used by backends
+
+  @param[in]  ceed        `Ceed` context used to create the `CeedElemRestriction`
+  @param[in]  dim         Topological dimension of the mesh, 1, 2, or 3
+  @param[in]  num_elem_1d Array of length `dim` with the number of elements in each dimension
+  @param[in]  P_1d        Number of nodes in each dimension of an element
+  @param[in]  block_size  Number of elements in a block
+  @param[in]  num_comp    Number of field components per interpolation node (1 for scalar fields)
+  @param[in]  comp_stride Stride between components for the same L-vector "node"
+  @param[in]  l_size      The size of the L-vector.
+                            This vector may be larger than the elements and fields given by this restriction.
+  @param[out] rstr        Address of the variable where the newly created `CeedElemRestriction` will be stored
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedElemRestrictionCreateBlockedStructured(Ceed ceed, CeedInt dim, const CeedInt *num_elem_1d, CeedInt P_1d, CeedInt block_size,
+                                               CeedInt num_comp, CeedInt comp_stride, CeedSize l_size, CeedElemRestriction *rstr) {
+  CeedInt  num_elem = 1, elem_size = 1, num_block;
+  CeedSize num_nodes = 1;
+
+  if (!ceed->ElemRestrictionCreateStructured && !ceed->ElemRestrictionCreateBlocked) {
+    Ceed delegate;
+
+    CeedCall(CeedGetObjectDelegate(ceed, &delegate, "ElemRestriction"));
+    CeedCheck(delegate, ceed, CEED_ERROR_UNSUPPORTED, "Backend does not implement CeedElemRestrictionCreateBlockedStructured");
+    CeedCall(CeedElemRestrictionCreateBlockedStructured(delegate, dim, num_elem_1d, P_1d, block_size, num_comp, comp_stride, l_size, rstr));
+    CeedCall(CeedDestroy(&delegate));
+    return CEED_ERROR_SUCCESS;
+  }
+
+  CeedCheck(dim >= 1 && dim <= 3, ceed, CEED_ERROR_DIMENSION, "Structured CeedElemRestriction must have dimension 1, 2, or 3");
+  CeedCheck(P_1d >= 2, ceed, CEED_ERROR_DIMENSION, "Structured CeedElemRestriction must have at least 2 nodes in each dimension");
+  for (CeedInt d = 0; d < dim; d++) {
+    CeedCheck(num_elem_1d[d] >= 0, ceed, CEED_ERROR_DIMENSION, "Number of elements must be non-negative");
+    num_elem *= num_elem_1d[d];
+    elem_size *= P_1d;
+    num_nodes *= (CeedSize)num_elem_1d[d] * (P_1d - 1) + 1;
+  }
+  CeedCheck(block_size > 0, ceed, CEED_ERROR_DIMENSION, "Block size must be at least 1");
+  CeedCheck(num_comp > 0, ceed, CEED_ERROR_DIMENSION, "CeedElemRestriction must have at least 1 component");
+  CeedCheck(num_comp == 1 || comp_stride > 0, ceed, CEED_ERROR_DIMENSION, "CeedElemRestriction component stride must be at least 1");
+  CeedCheck(l_size >= (CeedSize)(num_comp - 1) * (CeedSize)comp_stride + num_nodes, ceed, CEED_ERROR_DIMENSION,
+            "L-vector size must be at least (num_comp - 1) * comp_stride + num_nodes. Expected: > %" CeedSize_FMT " Found: %" CeedSize_FMT,
+            (CeedSize)(num_comp - 1) * (CeedSize)comp_stride + num_nodes, l_size);
+  num_block = (num_elem / block_size) + !!(num_elem % block_size);
+
+  if (ceed->ElemRestrictionCreateStructured) {
+    CeedCall(CeedCalloc(1, rstr));
+    CeedCall(CeedReferenceCopy(ceed, &(*rstr)->ceed));
+    (*rstr)->ref_count   = 1;
+    (*rstr)->num_elem    = num_elem;
+    (*rstr)->elem_size   = elem_size;
+    (*rstr)->num_comp    = num_comp;
+    (*rstr)->comp_stride = comp_stride;
+    (*rstr)->l_size      = l_size;
+    (*rstr)->e_size      = (CeedSize)num_block * (CeedSize)block_size * (CeedSize)elem_size * (CeedSize)num_comp;
+    (*rstr)->num_block   = num_block;
+    (*rstr)->block_size  = block_size;
+    (*rstr)->rstr_type   = CEED_RESTRICTION_STANDARD;
+  } else {
+    CeedInt *offsets;
+
+    // Backend only supports explicit offsets
+    CeedCall(CeedElemRestrictionCreateStructuredOffsets(dim, num_elem_1d, P_1d, &offsets));
+    CeedCall(CeedElemRestrictionCreateBlocked(ceed, num_elem, elem_size, block_size, num_comp, comp_stride, l_size, CEED_MEM_HOST, CEED_OWN_POINTER,
+                                              offsets, rstr));
+  }
+  (*rstr)->structured_dim  = dim;
+  (*rstr)->structured_P_1d = P_1d;
+  for (CeedInt d = 0; d < 3; d++) (*rstr)->structured_num_elem[d] = d < dim ? num_elem_1d[d] : 1;
+  if (ceed->ElemRestrictionCreateStructured) CeedCall(ceed->ElemRestrictionCreateStructured(*rstr));
+  return CEED_ERROR_SUCCESS;
+}
+
 /**
   @brief Copy the pointer to a `CeedElemRestriction` and set @ref CeedElemRestrictionApply() implementation to use the unsigned version.
 
@@ -1194,6 +1846,9 @@ int CeedElemRestrictionCreateUnsignedCopy(CeedElemRestriction rstr, CeedElemRest
     CeedCall(CeedMalloc(3, &(*rstr_unsigned)->strides));
     for (CeedInt i = 0; i < 3; i++) (*rstr_unsigned)->strides[i] = rstr->strides[i];
   }
+  (*rstr_unsigned)->coloring_block_size = 0;
+  (*rstr_unsigned)->color_offsets       = NULL;
+  (*rstr_unsigned)->color_blocks        = NULL;
   CeedCall(CeedElemRestrictionReferenceCopy(rstr, &(*rstr_unsigned)->rstr_base));
 
   // Override Apply
@@ -1226,6 +1881,9 @@ int CeedElemRestrictionCreateUnorientedCopy(CeedElemRestriction rstr, CeedElemRe
     CeedCall(CeedMalloc(3, &(*rstr_unoriented)->strides));
     for (CeedInt i = 0; i < 3; i++) (*rstr_unoriented)->strides[i] = rstr->strides[i];
   }
+  (*rstr_unoriented)->coloring_block_size = 0;
+  (*rstr_unoriented)->color_offsets       = NULL;
+  (*rstr_unoriented)->color_blocks        = NULL;
   CeedCall(CeedElemRestrictionReferenceCopy(rstr, &(*rstr_unoriented)->rstr_base));
 
   // Override Apply
@@ -1294,8 +1952,9 @@ int CeedElemRestrictionCreateVector(CeedElemRestriction rstr, CeedVector *l_vec,
   @ref User
 **/
 int CeedElemRestrictionApply(CeedElemRestriction rstr, CeedTransposeMode t_mode, CeedVector u, CeedVector ru, CeedRequest *request) {
-  CeedSize min_u_len, min_ru_len, len;
-  CeedInt  num_elem;
+  CeedSize     min_u_len, min_ru_len, len, start_ns;
+  CeedInt      num_elem;
+  CeedOperator op_stats;
 
   if (t_mode == CEED_NOTRANSPOSE) {
     CeedCall(CeedElemRestrictionGetEVectorSize(rstr, &min_ru_len));
@@ -1313,7 +1972,10 @@ int CeedElemRestrictionApply(CeedElemRestriction rstr, CeedTransposeMode t_mode,
             "Output vector size %" CeedInt_FMT " not compatible with element restriction (%" CeedInt_FMT ", %" CeedInt_FMT ")", len, min_u_len,
             min_ru_len);
   CeedCall(CeedElemRestrictionGetNumElements(rstr, &num_elem));
-  if (num_elem > 0) CeedCall(rstr->Apply(rstr, t_mode, u, ru, request));
+  if (num_elem == 0) return CEED_ERROR_SUCCESS;
+  CeedCall(CeedOperatorStatsGetCurrent(&op_stats, &start_ns));
+  CeedCall(rstr->Apply(rstr, t_mode, u, ru, request));
+  if (op_stats) CeedCall(CeedOperatorStatsRecordElemRestriction(op_stats, rstr, t_mode, rstr->num_block, start_ns));
   return CEED_ERROR_SUCCESS;
 }
 
@@ -1389,8 +2051,9 @@ int CeedElemRestrictionApplyAtPointsInElement(CeedElemRestriction rstr, CeedInt
 **/
 int CeedElemRestrictionApplyBlock(CeedElemRestriction rstr, CeedInt block, CeedTransposeMode t_mode, CeedVector u, CeedVector ru,
                                   CeedRequest *request) {
-  CeedSize min_u_len, min_ru_len, len;
-  CeedInt  block_size, num_elem;
+  CeedSize     min_u_len, min_ru_len, len, start_ns;
+  CeedInt      block_size, num_elem;
+  CeedOperator op_stats;
 
   CeedCheck(rstr->ApplyBlock, CeedElemRestrictionReturnCeed(rstr), CEED_ERROR_UNSUPPORTED,
             "Backend does not implement CeedElemRestrictionApplyBlock");
@@ -1423,7 +2086,9 @@ int CeedElemRestrictionApplyBlock(CeedElemRestriction rstr, CeedInt block, CeedT
   CeedCheck(block_size * block <= num_elem, CeedElemRestrictionReturnCeed(rstr), CEED_ERROR_DIMENSION,
             "Cannot retrieve block %" CeedInt_FMT ", element %" CeedInt_FMT " > total elements %" CeedInt_FMT "", block, block_size * block,
             num_elem);
+  CeedCall(CeedOperatorStatsGetCurrent(&op_stats, &start_ns));
   CeedCall(rstr->ApplyBlock(rstr, block, t_mode, u, ru, request));
+  if (op_stats) CeedCall(CeedOperatorStatsRecordElemRestriction(op_stats, rstr, t_mode, 1, start_ns));
   return CEED_ERROR_SUCCESS;
 }
 
@@ -1721,6 +2386,131 @@ int CeedElemRestrictionGetMultiplicity(CeedElemRestriction rstr, CeedVector mult
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Get a coloring of the element blocks of a `CeedElemRestriction` such that no two element blocks of the same color share an L-vector entry
+
+  Element block `b` holds elements `b * block_size` through `min((b + 1) * block_size, num_elem) - 1`.
+  The element blocks of color `c` are `color_blocks[color_offsets[c]]` through `color_blocks[color_offsets[c + 1] - 1]`, in increasing order, so the transpose restriction of the element blocks of one color may run concurrently without atomics or locks.
+
+  The coloring is computed on first use and cached.
+  The arrays are owned by the `CeedElemRestriction` and remain valid until it is destroyed or a coloring with a different type or block size is requested.
+
+  @param[in]  rstr          `CeedElemRestriction`
+  @param[in]  coloring_type Coloring strategy, see @ref CeedColoringType
+  @param[in]  block_size    Number of consecutive elements colored together
+  @param[out] num_colors    Variable to store the number of colors
+  @param[out] color_offsets Variable to store the start of each color in `color_blocks`, of length `num_colors + 1`
+  @param[out] color_blocks  Variable to store the element blocks sorted by color
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedElemRestrictionGetColoring(CeedElemRestriction rstr, CeedColoringType coloring_type, CeedInt block_size, CeedInt *num_colors,
+                                   const CeedInt **color_offsets, const CeedInt **color_blocks) {
+  CeedCheck(rstr->rstr_type != CEED_RESTRICTION_POINTS, rstr->ceed, CEED_ERROR_UNSUPPORTED,
+            "Element coloring not supported for CeedElemRestriction at points");
+  CeedCheck(rstr->block_size == 1, rstr->ceed, CEED_ERROR_UNSUPPORTED, "Element coloring not supported for blocked CeedElemRestriction");
+  CeedCheck(block_size > 0, rstr->ceed, CEED_ERROR_DIMENSION, "Coloring block size must be positive");
+
+  if (rstr->coloring_block_size != block_size || rstr->coloring_type != coloring_type) {
+    CeedCall(CeedElemRestrictionComputeColoring(rstr, coloring_type, block_size));
+  }
+  *num_colors    = rstr->num_colors;
+  *color_offsets = rstr->color_offsets;
+  *color_blocks  = rstr->color_blocks;
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Compute a reordering of the elements and L-vector nodes of a `CeedElemRestriction` to improve the memory locality of the restriction
+
+  The element order is given by `elem_perm`, with new element `e` being original element `elem_perm[e]`.
+  The L-vector nodes are then numbered in the order the reordered elements first reference them, reusing the set of offsets of `rstr`.
+  Original offset `o` becomes `node_perm[o]`, so component `k` of that node moves from index `o + k * comp_stride` to `node_perm[o] + k * comp_stride` of the L-vector.
+  Entries of `node_perm` that are not offsets of `rstr` map to themselves.
+  Applications adopt the reordering by creating a new `CeedElemRestriction` with offsets `node_perm[offsets[elem_perm[e] * elem_size + i]]` for node `i` of new element `e`, and permuting their mesh data accordingly.
+
+  The locality of the restriction is reported as the average distance between consecutive L-vector offsets read by the restriction, in L-vector entries, before and after reordering.
+
+  @param[in]  rstr                 `CeedElemRestriction`
+  @param[in]  reorder_type         Reordering strategy, see @ref CeedReorderType
+  @param[in]  dim                  Dimension of the element centroids for @ref CEED_REORDER_MORTON, at most 3
+  @param[in]  elem_coords          Element centroids for @ref CEED_REORDER_MORTON, with coordinate `d` of element `e` at index `e * dim + d`, or `NULL`
+  @param[out] elem_perm            Array of length `num_elem` to store the original index of each element in the new order
+  @param[out] node_perm            Array of length `l_size` to store the new offset of each original offset
+  @param[out] gather_stride_before Variable to store the average distance between consecutive offsets before reordering, or `NULL`
+  @param[out] gather_stride_after  Variable to store the average distance between consecutive offsets after reordering, or `NULL`
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedElemRestrictionComputeReordering(CeedElemRestriction rstr, CeedReorderType reorder_type, CeedInt dim, const CeedScalar *elem_coords,
+                                         CeedInt *elem_perm, CeedInt *node_perm, CeedScalar *gather_stride_before, CeedScalar *gather_stride_after) {
+  const CeedInt  num_elem = rstr->num_elem, elem_size = rstr->elem_size, num_offsets = num_elem * elem_size;
+  const CeedSize l_size   = rstr->l_size;
+  CeedInt        num_nodes = 0, *nodes;
+  CeedScalar     stride_before = 0., stride_after = 0.;
+  bool          *is_node;
+  const CeedInt *offsets;
+
+  CeedCheck(rstr->rstr_type != CEED_RESTRICTION_STRIDED && rstr->rstr_type != CEED_RESTRICTION_POINTS, rstr->ceed, CEED_ERROR_UNSUPPORTED,
+            "Reordering only supported for CeedElemRestriction with offsets");
+  CeedCheck(rstr->block_size == 1, rstr->ceed, CEED_ERROR_UNSUPPORTED, "Reordering not supported for blocked CeedElemRestriction");
+  CeedCheck(reorder_type != CEED_REORDER_MORTON || (dim >= 1 && dim <= 3 && elem_coords), rstr->ceed, CEED_ERROR_INCOMPATIBLE,
+            "Morton reordering requires element centroids of dimension 1 to 3");
+
+  CeedCall(CeedElemRestrictionGetOffsets(rstr, CEED_MEM_HOST, &offsets));
+
+  // Element order
+  switch (reorder_type) {
+    case CEED_REORDER_RCM:
+      CeedCall(CeedElemRestrictionOrderElementsRCM(rstr, offsets, elem_perm));
+      break;
+    case CEED_REORDER_MORTON:
+      CeedCall(CeedElemRestrictionOrderElementsMorton(rstr, dim, elem_coords, elem_perm));
+      break;
+  }
+
+  // Offsets in increasing order, assigned to nodes by first reference in the new element order
+  CeedCall(CeedCalloc(l_size, &is_node));
+  CeedCall(CeedMalloc(CeedIntMax(num_offsets, 1), &nodes));
+  for (CeedInt i = 0; i < num_offsets; i++) is_node[offsets[i]] = true;
+  for (CeedSize i = 0; i < l_size; i++) {
+    node_perm[i] = i;
+    if (is_node[i]) nodes[num_nodes++] = i;
+  }
+  num_nodes = 0;
+  for (CeedInt e = 0; e < num_elem; e++) {
+    for (CeedInt i = 0; i < elem_size; i++) {
+      const CeedInt node = offsets[elem_perm[e] * elem_size + i];
+
+      if (!is_node[node]) continue;
+      is_node[node]   = false;
+      node_perm[node] = nodes[num_nodes++];
+    }
+  }
+  CeedCall(CeedFree(&is_node));
+  CeedCall(CeedFree(&nodes));
+
+  // Average distance between consecutive offsets read
+  for (CeedInt i = 1; i < num_offsets; i++) {
+    const CeedInt node_before = offsets[i - 1], node_after = offsets[elem_perm[(i - 1) / elem_size] * elem_size + (i - 1) % elem_size];
+
+    stride_before += abs(offsets[i] - node_before);
+    stride_after += abs(node_perm[offsets[elem_perm[i / elem_size] * elem_size + i % elem_size]] - node_perm[node_after]);
+  }
+  if (num_offsets > 1) {
+    stride_before /= num_offsets - 1;
+    stride_after /= num_offsets - 1;
+  }
+  if (gather_stride_before) *gather_stride_before = stride_before;
+  if (gather_stride_after) *gather_stride_after = stride_after;
+  CeedCall(CeedElemRestrictionRestoreOffsets(rstr, &offsets));
+  return CEED_ERROR_SUCCESS;
+}
+
 /**
   @brief View a `CeedElemRestriction`
 
@@ -1782,6 +2572,8 @@ int CeedElemRestrictionDestroy(CeedElemRestriction *rstr) {
   else if ((*rstr)->Destroy) CeedCall((*rstr)->Destroy(*rstr));
 
   CeedCall(CeedFree(&(*rstr)->strides));
+  CeedCall(CeedFree(&(*rstr)->color_offsets));
+  CeedCall(CeedFree(&(*rstr)->color_blocks));
   CeedCall(CeedDestroy(&(*rstr)->ceed));
   CeedCall(CeedFree(rstr));
   return CEED_ERROR_SUCCESS;
@@ -454,8 +454,7 @@ CEED_EXTERN void fCeedElemRestrictionView(int *elemr, int *err) { *err = CeedEle
 
 #define fCeedRequestWait FORTRAN_NAME(ceedrequestwait, CEEDREQUESTWAIT)
 CEED_EXTERN void fCeedRequestWait(int *rqst, int *err) {
-  // TODO Uncomment this once CeedRequestWait is implemented
-  //*err = CeedRequestWait(&CeedRequest_dict[*rqst]);
+  *err = CeedRequestWait(&CeedRequest_dict[*rqst]);
 
   if (*err == 0) {
     CeedRequest_n--;
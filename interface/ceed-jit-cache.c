@@ -0,0 +1,534 @@
+// Copyright (c) 2017-2025, Lawrence Livermore National Security, LLC and other CEED contributors.
+// All Rights Reserved. See the top-level LICENSE and NOTICE files for details.
+//
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// This file is part of CEED:  http://github.com/ceed
+
+#define _POSIX_C_SOURCE 200809L
+#include <ceed-impl.h>
+#include <ceed.h>
+#include <ceed/backend.h>
+#include <ceed/jit-tools.h>
+#include <dirent.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+/// @file
+/// Implementation of persistent on-disk cache for JiT compiled kernels
+
+/// @cond DOXYGEN_SKIP
+#define CEED_JIT_CACHE_PREFIX "ceed-jit-"
+#define CEED_JIT_CACHE_TEMP_INFIX ".tmp."
+// Default maximum cache size, in MiB
+#define CEED_JIT_CACHE_MAX_SIZE_DEFAULT 1024
+// Age after which abandoned temporary files are removed, in seconds
+#define CEED_JIT_CACHE_TEMP_FILE_AGE 3600
+
+// Running total of the size of the JiT cache directory last scanned by this process, so storing an entry does not rescan the directory
+static struct {
+  pthread_mutex_t lock;
+  char            dir[CEED_MAX_RESOURCE_LEN * 4];
+  long long       size;
+} ceed_jit_cache_size = {PTHREAD_MUTEX_INITIALIZER, "", 0};
+/// @endcond
+
+/// ----------------------------------------------------------------------------
+/// JiT Cache Library Internal Functions
+/// ----------------------------------------------------------------------------
+/// @addtogroup CeedDeveloper
+/// @{
+
+/**
+  @brief Fold string, including its terminating null character, into two 64 bit hash lanes
+
+  The first lane is FNV-1a; the second lane uses a multiply-xorshift mix so the lanes are independent.
+  This is not a cryptographic hash; it identifies cache entries only.
+
+  @param[in]     str  String to hash
+  @param[in,out] hash Hash lanes to update
+
+  @ref Developer
+**/
+static void CeedJitCacheHashString(const char *str, uint64_t hash[2]) {
+  const unsigned char *c = (const unsigned char *)(str ? str : "");
+
+  do {
+    hash[0] = (hash[0] ^ *c) * 0x100000001b3ULL;
+    hash[1] = (hash[1] ^ *c) * 0x9e3779b97f4a7c15ULL;
+    hash[1] ^= hash[1] >> 29;
+  } while (*c++);
+}
+
+/**
+  @brief Get JiT cache directory, creating it if needed
+
+  The cache is disabled unless it is enabled with `CEED_JIT_CACHE=1` or by setting `CEED_JIT_CACHE_DIR`; `CEED_JIT_CACHE=0` disables it in either case.
+  The directory is `CEED_JIT_CACHE_DIR`, `$XDG_CACHE_HOME/ceed`, `$HOME/.cache/ceed`, or a directory in `/tmp`, in order of preference.
+  Cached shared objects are loaded into the process, so the cache is also disabled unless the directory is owned by the current user, is not
+  writable by group or others, and is not a symbolic link.
+
+  @param[in]  ceed      `Ceed` context for error handling
+  @param[out] cache_dir Allocated path to cache directory, or `NULL` if the cache is disabled or the directory cannot be created
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedJitCacheGetDir(Ceed ceed, char **cache_dir) {
+  const char *is_enabled = getenv("CEED_JIT_CACHE"), *env_dir = getenv("CEED_JIT_CACHE_DIR"), *xdg_dir = getenv("XDG_CACHE_HOME"),
+             *home_dir = getenv("HOME");
+  char        dir[CEED_MAX_RESOURCE_LEN * 4];
+  int         dir_len;
+
+  *cache_dir = NULL;
+  if (is_enabled ? !strcmp(is_enabled, "0") || !strcmp(is_enabled, "off") : !env_dir || !env_dir[0]) return CEED_ERROR_SUCCESS;
+  if (env_dir && env_dir[0]) dir_len = snprintf(dir, sizeof(dir), "%s", env_dir);
+  else if (xdg_dir && xdg_dir[0]) dir_len = snprintf(dir, sizeof(dir), "%s/ceed", xdg_dir);
+  else if (home_dir && home_dir[0]) dir_len = snprintf(dir, sizeof(dir), "%s/.cache/ceed", home_dir);
+  else dir_len = snprintf(dir, sizeof(dir), "/tmp/ceed-cache-%ld", (long)getuid());
+  if (dir_len <= 0 || dir_len >= (int)sizeof(dir)) {
+    // LCOV_EXCL_START
+    CeedDebug(ceed, "JiT cache directory path too long, caching disabled\n");
+    return CEED_ERROR_SUCCESS;
+    // LCOV_EXCL_STOP
+  }
+  while (dir_len > 1 && dir[dir_len - 1] == '/') dir[--dir_len] = '\0';
+
+  // Create each directory in path, private to this user; concurrent processes may race here, so only the final result is checked
+  for (char *c = &dir[1];; c++) {
+    if (*c == '/' || *c == '\0') {
+      const char end = *c;
+
+      *c = '\0';
+      mkdir(dir, 0700);
+      *c = end;
+      if (end == '\0') break;
+    }
+  }
+  {
+    struct stat dir_stat;
+
+    // Another user may have created the directory first, such as in /tmp, so reject any directory this user does not exclusively control
+    if (lstat(dir, &dir_stat) || !S_ISDIR(dir_stat.st_mode) || dir_stat.st_uid != getuid() || (dir_stat.st_mode & (S_IWGRP | S_IWOTH)) ||
+        access(dir, W_OK)) {
+      CeedDebug(ceed, "JiT cache directory %s is not a private writable directory, caching disabled\n", dir);
+      return CEED_ERROR_SUCCESS;
+    }
+  }
+  CeedCall(CeedStringAllocCopy(dir, cache_dir));
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Scan JiT cache directory and evict least recently used entries until the cache is below its maximum size
+
+  Temporary files abandoned by processes that did not finish writing an entry are removed once they are old enough.
+  Entries removed by another process while scanning are skipped.
+
+  @param[in] ceed      `Ceed` context for debugging
+  @param[in] cache_dir Path to cache directory
+  @param[in] max_size  Maximum size of cache, in bytes
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedJitCacheEvict(Ceed ceed, const char *cache_dir, long long max_size) {
+  typedef struct {
+    char           *path;
+    off_t           size;
+    struct timespec mtime;
+  } CeedJitCacheEntry;
+
+  const time_t       now        = time(NULL);
+  long long          total_size = 0;
+  size_t             num_entries = 0, max_entries = 0;
+  CeedJitCacheEntry *entries = NULL;
+  DIR               *dir;
+
+  dir = opendir(cache_dir);
+  if (!dir) return CEED_ERROR_SUCCESS;  // LCOV_EXCL_LINE
+
+  // Collect entries
+  for (struct dirent *dir_entry = readdir(dir); dir_entry; dir_entry = readdir(dir)) {
+    const bool   is_temp  = strstr(dir_entry->d_name, CEED_JIT_CACHE_TEMP_INFIX);
+    const size_t path_len = strlen(cache_dir) + strlen(dir_entry->d_name) + 2;
+    char        *path;
+    struct stat  entry_stat;
+
+    if (strncmp(dir_entry->d_name, CEED_JIT_CACHE_PREFIX, strlen(CEED_JIT_CACHE_PREFIX))) continue;
+    CeedCall(CeedCalloc(path_len, &path));
+    snprintf(path, path_len, "%s/%s", cache_dir, dir_entry->d_name);
+    if (stat(path, &entry_stat) || !S_ISREG(entry_stat.st_mode)) {
+      CeedCall(CeedFree(&path));
+      continue;
+    }
+    if (is_temp) {
+      if (now - entry_stat.st_mtime > CEED_JIT_CACHE_TEMP_FILE_AGE) remove(path);
+      CeedCall(CeedFree(&path));
+      continue;
+    }
+    if (num_entries == max_entries) {
+      max_entries = max_entries ? 2 * max_entries : 64;
+      CeedCall(CeedRealloc(max_entries, &entries));
+    }
+    entries[num_entries].path  = path;
+    entries[num_entries].size  = entry_stat.st_size;
+    entries[num_entries].mtime = entry_stat.st_mtim;
+    total_size += entry_stat.st_size;
+    num_entries++;
+  }
+  closedir(dir);
+
+  // Remove least recently used entries
+  while (total_size > max_size && num_entries > 1) {
+    size_t oldest = 0;
+
+    for (size_t i = 1; i < num_entries; i++) {
+      const struct timespec *t_i = &entries[i].mtime, *t_oldest = &entries[oldest].mtime;
+
+      if (t_i->tv_sec < t_oldest->tv_sec || (t_i->tv_sec == t_oldest->tv_sec && t_i->tv_nsec < t_oldest->tv_nsec)) oldest = i;
+    }
+    CeedDebug(ceed, "Evicting JiT cache entry %s\n", entries[oldest].path);
+    remove(entries[oldest].path);
+    total_size -= entries[oldest].size;
+    CeedCall(CeedFree(&entries[oldest].path));
+    entries[oldest] = entries[--num_entries];
+  }
+  for (size_t i = 0; i < num_entries; i++) CeedCall(CeedFree(&entries[i].path));
+  CeedCall(CeedFree(&entries));
+
+  // Restart running total from the scanned size
+  pthread_mutex_lock(&ceed_jit_cache_size.lock);
+  snprintf(ceed_jit_cache_size.dir, sizeof(ceed_jit_cache_size.dir), "%s", cache_dir);
+  ceed_jit_cache_size.size = total_size;
+  pthread_mutex_unlock(&ceed_jit_cache_size.lock);
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Add stored entry to the running total of the JiT cache size, and evict old entries if the cache is over its maximum size
+
+  The maximum size is set in MiB with `CEED_JIT_CACHE_MAX_SIZE`; a value of `0` disables eviction.
+  The cache directory is only scanned for the first entry stored by this process and when the running total exceeds the maximum size.
+  Entries stored by other processes are therefore counted at the next scan.
+
+  @param[in] ceed       `Ceed` context for debugging
+  @param[in] cache_dir  Path to cache directory
+  @param[in] entry_size Size of stored entry, in bytes
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedJitCacheAddSize(Ceed ceed, const char *cache_dir, off_t entry_size) {
+  const char     *max_size_env = getenv("CEED_JIT_CACHE_MAX_SIZE");
+  const long long max_size     = (max_size_env ? atoll(max_size_env) : CEED_JIT_CACHE_MAX_SIZE_DEFAULT) * 1024 * 1024;
+  bool            is_scan_needed;
+
+  if (max_size <= 0) return CEED_ERROR_SUCCESS;
+  pthread_mutex_lock(&ceed_jit_cache_size.lock);
+  is_scan_needed = strcmp(ceed_jit_cache_size.dir, cache_dir) || (ceed_jit_cache_size.size += entry_size) > max_size;
+  pthread_mutex_unlock(&ceed_jit_cache_size.lock);
+  if (is_scan_needed) CeedCall(CeedJitCacheEvict(ceed, cache_dir, max_size));
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Record JiT cache lookup in statistics of the root `Ceed` context
+
+  @param[in] ceed   `Ceed` context
+  @param[in] is_hit Boolean flag indicating cache hit
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedJitCacheRecordLookup(Ceed ceed, bool is_hit) {
+  Ceed ceed_parent;
+
+  CeedCall(CeedGetParent(ceed, &ceed_parent));
+  if (is_hit) ceed_parent->jit_cache_num_hits++;
+  else ceed_parent->jit_cache_num_misses++;
+  CeedCall(CeedDestroy(&ceed_parent));
+  return CEED_ERROR_SUCCESS;
+}
+
+/// @}
+
+/// ----------------------------------------------------------------------------
+/// JiT Cache Backend API
+/// ----------------------------------------------------------------------------
+/// @addtogroup CeedBackend
+/// @{
+
+/**
+  @brief Compute content address of a JiT compiled kernel.
+
+  The key covers the fully expanded kernel source, the compiler and target architecture description provided by the backend, the JiT defines and
+  source roots of the `Ceed` context, and the libCEED version.
+
+  @param[in]  ceed          `Ceed` context
+  @param[in]  source        Kernel source, after expansion with @ref CeedLoadSourceToBuffer() or similar
+  @param[in]  compiler_info Backend description of compiler, compiler version, options, and target architecture
+  @param[out] key           Allocated key string of 32 hexadecimal characters
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedJitCacheGetKey(Ceed ceed, const char *source, const char *compiler_info, char **key) {
+  uint64_t    hash[2] = {0xcbf29ce484222325ULL, 0x6a09e667f3bcc909ULL};
+  const char *git_version;
+  char        version[64];
+
+  // Library version
+  CeedCall(CeedGetGitVersion(&git_version));
+  snprintf(version, sizeof(version), "libCEED %d.%d.%d", CEED_VERSION_MAJOR, CEED_VERSION_MINOR, CEED_VERSION_PATCH);
+  CeedJitCacheHashString(version, hash);
+  CeedJitCacheHashString(git_version, hash);
+
+  // Source and compiler
+  CeedJitCacheHashString(source, hash);
+  CeedJitCacheHashString(compiler_info, hash);
+
+  // JiT source roots and defines
+  {
+    CeedInt      num_jit_source_roots;
+    const char **jit_source_roots;
+
+    CeedCall(CeedGetJitSourceRoots(ceed, &num_jit_source_roots, &jit_source_roots));
+    for (CeedInt i = 0; i < num_jit_source_roots; i++) CeedJitCacheHashString(jit_source_roots[i], hash);
+    CeedCall(CeedRestoreJitSourceRoots(ceed, &jit_source_roots));
+  }
+  CeedJitCacheHashString("", hash);
+  {
+    CeedInt      num_jit_defines;
+    const char **jit_defines;
+
+    CeedCall(CeedGetJitDefines(ceed, &num_jit_defines, &jit_defines));
+    for (CeedInt i = 0; i < num_jit_defines; i++) CeedJitCacheHashString(jit_defines[i], hash);
+    CeedCall(CeedRestoreJitDefines(ceed, &jit_defines));
+  }
+
+  CeedCall(CeedCalloc(33, key));
+  snprintf(*key, 33, "%016llx%016llx", (unsigned long long)hash[0], (unsigned long long)hash[1]);
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Look up JiT cache entry.
+
+  A cache hit marks the entry as recently used.
+  Each lookup is counted in the statistics reported by @ref CeedGetJitCacheStats().
+
+  Note: The caller is responsible for freeing `entry_path` with @ref CeedFree().
+
+  @param[in]  ceed       `Ceed` context
+  @param[in]  key        Key from @ref CeedJitCacheGetKey()
+  @param[in]  suffix     File suffix for the entry, such as `.so`
+  @param[out] entry_path Allocated path of the cache entry, or `NULL` if the cache is disabled
+  @param[out] is_hit     Boolean flag indicating that the entry exists
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedJitCacheLookup(Ceed ceed, const char *key, const char *suffix, char **entry_path, bool *is_hit) {
+  char  *cache_dir;
+  size_t path_len;
+
+  *entry_path = NULL;
+  *is_hit     = false;
+  CeedCall(CeedJitCacheGetDir(ceed, &cache_dir));
+  if (!cache_dir) return CEED_ERROR_SUCCESS;
+
+  path_len = strlen(cache_dir) + strlen(CEED_JIT_CACHE_PREFIX) + strlen(key) + strlen(suffix) + 2;
+  CeedCall(CeedCalloc(path_len, entry_path));
+  snprintf(*entry_path, path_len, "%s/" CEED_JIT_CACHE_PREFIX "%s%s", cache_dir, key, suffix);
+  CeedCall(CeedFree(&cache_dir));
+
+  *is_hit = !access(*entry_path, R_OK);
+  if (*is_hit) utimensat(AT_FDCWD, *entry_path, NULL, 0);
+  CeedCall(CeedJitCacheRecordLookup(ceed, *is_hit));
+  CeedDebug(ceed, "JiT cache %s: %s\n", *is_hit ? "hit" : "miss", *entry_path);
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Get unique temporary file path in the JiT cache directory for writing a new entry.
+
+  Writing the entry to this file and then calling @ref CeedJitCacheStoreFile() ensures that concurrent processes never observe a partial entry.
+  Failure to create the file is not an error; `fd` is `-1` and `temp_path` is `NULL`, and the caller should continue without caching the entry.
+
+  Note: The caller is responsible for freeing `temp_path` with @ref CeedFree().
+
+  @param[in]  ceed       `Ceed` context
+  @param[in]  entry_path Path from @ref CeedJitCacheLookup()
+  @param[out] fd         Open file descriptor for temporary file, or `-1`; the caller is responsible for closing it
+  @param[out] temp_path  Allocated path of the temporary file, or `NULL`
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedJitCacheCreateTempFile(Ceed ceed, const char *entry_path, int *fd, char **temp_path) {
+  const size_t path_len = strlen(entry_path) + strlen(CEED_JIT_CACHE_TEMP_INFIX) + 7;
+
+  CeedCall(CeedCalloc(path_len, temp_path));
+  snprintf(*temp_path, path_len, "%s" CEED_JIT_CACHE_TEMP_INFIX "XXXXXX", entry_path);
+  *fd = mkstemp(*temp_path);
+  if (*fd < 0) {
+    // LCOV_EXCL_START
+    CeedDebug(ceed, "Could not create JiT cache file %s: %s\n", *temp_path, strerror(errno));
+    CeedCall(CeedFree(temp_path));
+    // LCOV_EXCL_STOP
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Move completed temporary file into the JiT cache and evict old entries, if needed.
+
+  The move is atomic, so if several processes store the same entry concurrently, the last one to finish wins and all see a complete file.
+  Failure to move the file is not an error; the temporary file is left in place for the caller to use or remove.
+
+  @param[in]  ceed       `Ceed` context
+  @param[in]  temp_path  Path from @ref CeedJitCacheCreateTempFile()
+  @param[in]  entry_path Path from @ref CeedJitCacheLookup()
+  @param[out] is_stored  Boolean flag indicating that the entry was stored
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedJitCacheStoreFile(Ceed ceed, const char *temp_path, const char *entry_path, bool *is_stored) {
+  *is_stored = !rename(temp_path, entry_path);
+  if (!*is_stored) {
+    // LCOV_EXCL_START
+    CeedDebug(ceed, "Could not store JiT cache entry %s: %s\n", entry_path, strerror(errno));
+    return CEED_ERROR_SUCCESS;
+    // LCOV_EXCL_STOP
+  }
+  {
+    char       *cache_dir;
+    struct stat entry_stat;
+
+    CeedCall(CeedStringAllocCopy(entry_path, &cache_dir));
+    *strrchr(cache_dir, '/') = '\0';
+    CeedCall(CeedJitCacheAddSize(ceed, cache_dir, stat(entry_path, &entry_stat) ? 0 : entry_stat.st_size));
+    CeedCall(CeedFree(&cache_dir));
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Read JiT cache entry into memory.
+
+  An entry that is removed by another process before it can be read is reported as a miss.
+
+  Note: The caller is responsible for freeing `data` with @ref CeedFree().
+
+  @param[in]  ceed   `Ceed` context
+  @param[in]  key    Key from @ref CeedJitCacheGetKey()
+  @param[in]  suffix File suffix for the entry, such as `.cubin`
+  @param[out] is_hit Boolean flag indicating that the entry was read
+  @param[out] size   Size of entry in bytes
+  @param[out] data   Allocated entry contents, or `NULL` on a miss
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedJitCacheRead(Ceed ceed, const char *key, const char *suffix, bool *is_hit, size_t *size, char **data) {
+  char *entry_path;
+  FILE *file = NULL;
+
+  *size = 0;
+  *data = NULL;
+  CeedCall(CeedJitCacheLookup(ceed, key, suffix, &entry_path, is_hit));
+  if (*is_hit) file = fopen(entry_path, "rb");
+  if (file) {
+    long file_size;
+
+    fseek(file, 0, SEEK_END);
+    file_size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    if (file_size > 0) {
+      CeedCall(CeedMalloc(file_size, data));
+      if (fread(*data, 1, file_size, file) == (size_t)file_size) *size = file_size;
+      else CeedCall(CeedFree(data));
+    }
+    fclose(file);
+  }
+  if (*is_hit && !*data) {
+    // LCOV_EXCL_START
+    Ceed ceed_parent;
+
+    CeedCall(CeedGetParent(ceed, &ceed_parent));
+    ceed_parent->jit_cache_num_hits--;
+    ceed_parent->jit_cache_num_misses++;
+    CeedCall(CeedDestroy(&ceed_parent));
+    *is_hit = false;
+    // LCOV_EXCL_STOP
+  }
+  CeedCall(CeedFree(&entry_path));
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Write JiT cache entry from memory.
+
+  Nothing is written if the cache is disabled.
+  Failure to write the entry is not an error, since the caller already has the compiled kernel.
+
+  @param[in] ceed   `Ceed` context
+  @param[in] key    Key from @ref CeedJitCacheGetKey()
+  @param[in] suffix File suffix for the entry, such as `.cubin`
+  @param[in] size   Size of entry in bytes
+  @param[in] data   Entry contents
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedJitCacheWrite(Ceed ceed, const char *key, const char *suffix, size_t size, const char *data) {
+  bool  is_stored = false;
+  int   fd;
+  char *cache_dir, *entry_path, *temp_path;
+
+  CeedCall(CeedJitCacheGetDir(ceed, &cache_dir));
+  if (!cache_dir) return CEED_ERROR_SUCCESS;
+  {
+    const size_t path_len = strlen(cache_dir) + strlen(CEED_JIT_CACHE_PREFIX) + strlen(key) + strlen(suffix) + 2;
+
+    CeedCall(CeedCalloc(path_len, &entry_path));
+    snprintf(entry_path, path_len, "%s/" CEED_JIT_CACHE_PREFIX "%s%s", cache_dir, key, suffix);
+  }
+  CeedCall(CeedFree(&cache_dir));
+
+  CeedCall(CeedJitCacheCreateTempFile(ceed, entry_path, &fd, &temp_path));
+  if (temp_path) {
+    const ssize_t write_size = write(fd, data, size);
+
+    close(fd);
+    if (write_size == (ssize_t)size) CeedCall(CeedJitCacheStoreFile(ceed, temp_path, entry_path, &is_stored));
+    else CeedDebug(ceed, "Could not write JiT cache file %s\n", temp_path);  // LCOV_EXCL_LINE
+    if (!is_stored) remove(temp_path);
+  }
+  CeedCall(CeedFree(&temp_path));
+  CeedCall(CeedFree(&entry_path));
+  return CEED_ERROR_SUCCESS;
+}
+
+/// @}
@@ -5,16 +5,33 @@
 //
 // This file is part of CEED:  http://github.com/ceed
 
+#define _POSIX_C_SOURCE 200809L
 #include <ceed-impl.h>
 #include <ceed.h>
 #include <ceed/backend.h>
 #include <stdbool.h>
 #include <stdio.h>
 #include <string.h>
+#include <time.h>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 /// @file
 /// Implementation of CeedOperator interfaces
 
+/// @cond DOXYGEN_SKIP
+// Statistics entries for the stage totals, indexed by CeedStageType, before the entries for each field
+#define CEED_OPERATOR_STATS_NUM_TOTALS 4
+
+// CeedOperator receiving statistics for stages applied on this thread, and the OpenMP nesting level of its application
+static _Thread_local struct {
+  CeedOperator op;
+  int          level;
+} ceed_operator_stats_thread;
+/// @endcond
+
 /// ----------------------------------------------------------------------------
 /// CeedOperator Library Internal Functions
 /// ----------------------------------------------------------------------------
@@ -118,6 +135,7 @@ static int CeedOperatorFieldView(CeedOperatorField op_field, CeedQFunctionField
   if (basis == CEED_BASIS_NONE) fprintf(stream, "%s      No basis\n", pre);
   if (vec == CEED_VECTOR_ACTIVE) fprintf(stream, "%s      Active vector\n", pre);
   else if (vec == CEED_VECTOR_NONE) fprintf(stream, "%s      No vector\n", pre);
+  if (op_field->storage != CEED_STORAGE_SCALAR) fprintf(stream, "%s      Storage: %s\n", pre, CeedStorageTypes[op_field->storage]);
 
   CeedCall(CeedVectorDestroy(&vec));
   CeedCall(CeedBasisDestroy(&basis));
@@ -534,6 +552,753 @@ static int CeedOperatorContextRestoreGenericRead(CeedOperator op, CeedContextFie
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Task for deferred @ref CeedOperatorApply() on the host task queue
+
+  @param[in]  op  `CeedOperator` to apply
+  @param[in]  in  `CeedVector` containing input state or @ref CEED_VECTOR_NONE
+  @param[out] out `CeedVector` to store result or @ref CEED_VECTOR_NONE
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedOperatorApplyTask(CeedOperator op, CeedVector in, CeedVector out) {
+  return CeedOperatorApply(op, in, out, CEED_REQUEST_IMMEDIATE);
+}
+
+/**
+  @brief Task for deferred @ref CeedOperatorApplyAdd() on the host task queue
+
+  @param[in]  op  `CeedOperator` to apply
+  @param[in]  in  `CeedVector` containing input state or @ref CEED_VECTOR_NONE
+  @param[out] out `CeedVector` to sum in result or @ref CEED_VECTOR_NONE
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedOperatorApplyAddTask(CeedOperator op, CeedVector in, CeedVector out) {
+  return CeedOperatorApplyAdd(op, in, out, CEED_REQUEST_IMMEDIATE);
+}
+
+/**
+  @brief Get the current monotonic time, in nanoseconds
+
+  @return Time in nanoseconds since an arbitrary fixed point
+
+  @ref Developer
+**/
+static CeedSize CeedOperatorStatsGetTime(void) {
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (CeedSize)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+/**
+  @brief Get the OpenMP nesting level of the calling thread
+
+  @return Number of enclosing OpenMP parallel regions, or 0 without OpenMP
+
+  @ref Developer
+**/
+static int CeedOperatorStatsGetLevel(void) {
+#ifdef _OPENMP
+  return omp_get_level();
+#else
+  return 0;
+#endif
+}
+
+/**
+  @brief Start collecting statistics for an application of a `CeedOperator` on the calling thread
+
+  Stages dispatched through the interface on the calling thread are attributed to `op` until @ref CeedOperatorStatsEnd().
+  Stages applied in parallel regions that the backend opens during the application are not attributed, as only some of the threads would record them.
+  Backends instead add `CeedQFunction` applications from such regions with @ref CeedOperatorAddQFunctionStats() once the region completes.
+  `op` may be a sub-operator applied by a composite `CeedOperator`, so the previous attribution is returned to be restored.
+
+  @param[in]  op         `CeedOperator` being applied
+  @param[out] op_prev    Variable to store `CeedOperator` previously receiving statistics on the calling thread
+  @param[out] level_prev Variable to store OpenMP nesting level of the application of `op_prev`
+  @param[out] start_ns   Variable to store start time of application
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedOperatorStatsBegin(CeedOperator op, CeedOperator *op_prev, int *level_prev, CeedSize *start_ns) {
+  *op_prev    = ceed_operator_stats_thread.op;
+  *level_prev = ceed_operator_stats_thread.level;
+  *start_ns   = 0;
+  if (op->collect_stats && !op->stats) {
+    CeedInt num_input_fields = 0, num_output_fields = 0;
+
+    if (!op->is_composite) CeedCall(CeedQFunctionGetFields(op->qf, &num_input_fields, NULL, &num_output_fields, NULL));
+    op->num_stats = CEED_OPERATOR_STATS_NUM_TOTALS + 2 * (num_input_fields + num_output_fields);
+    CeedCall(CeedCalloc(op->num_stats, &op->stats));
+  }
+  ceed_operator_stats_thread.op    = op->collect_stats ? op : NULL;
+  ceed_operator_stats_thread.level = CeedOperatorStatsGetLevel();
+  if (op->collect_stats) *start_ns = CeedOperatorStatsGetTime();
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Stop collecting statistics for an application of a `CeedOperator` on the calling thread
+
+  @param[in] op         `CeedOperator` being applied
+  @param[in] op_prev    `CeedOperator` previously receiving statistics on the calling thread, from @ref CeedOperatorStatsBegin()
+  @param[in] level_prev OpenMP nesting level of the application of `op_prev`, from @ref CeedOperatorStatsBegin()
+  @param[in] start_ns   Start time of application, from @ref CeedOperatorStatsBegin()
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedOperatorStatsEnd(CeedOperator op, CeedOperator op_prev, int level_prev, CeedSize start_ns) {
+  if (op->collect_stats) {
+    op->stats[CEED_STAGE_OPERATOR].num_calls += 1;
+    op->stats[CEED_STAGE_OPERATOR].time_ns += CeedOperatorStatsGetTime() - start_ns;
+  }
+  ceed_operator_stats_thread.op    = op_prev;
+  ceed_operator_stats_thread.level = level_prev;
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Add a stage application to the statistics of a `CeedOperator`
+
+  @param[in] op        `CeedOperator` collecting statistics
+  @param[in] stage     Stage applied
+  @param[in] field     Index of field in the input fields followed by the output fields, or -1 if the application does not match a field
+  @param[in] num_calls Number of applications
+  @param[in] bytes     Estimated bytes read and written
+  @param[in] flops     Estimated floating point operations
+  @param[in] time_ns   Wall time of applications, in nanoseconds
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedOperatorStatsRecord(CeedOperator op, CeedStageType stage, CeedInt field, CeedSize num_calls, CeedSize bytes, CeedSize flops,
+                                   CeedSize time_ns) {
+  CeedOperatorStageStats *stats[2] = {&op->stats[stage], NULL};
+
+  if (field >= 0) stats[1] = &op->stats[CEED_OPERATOR_STATS_NUM_TOTALS + 2 * field + (stage == CEED_STAGE_BASIS)];
+  for (CeedInt i = 0; i < 2 && stats[i]; i++) {
+    stats[i]->num_calls += num_calls;
+    stats[i]->time_ns += time_ns;
+    stats[i]->bytes += bytes;
+    stats[i]->flops += flops;
+  }
+  // Stages applied by the operator also count towards its estimates
+  op->stats[CEED_STAGE_OPERATOR].bytes += bytes;
+  op->stats[CEED_STAGE_OPERATOR].flops += flops;
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Get the `CeedOperator` receiving statistics for stages applied on the calling thread
+
+  @param[out] op       Variable to store `CeedOperator`, or `NULL` if no `CeedOperator` is collecting statistics
+  @param[out] start_ns Variable to store start time of the stage application
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+int CeedOperatorStatsGetCurrent(CeedOperator *op, CeedSize *start_ns) {
+  *op = ceed_operator_stats_thread.op;
+  if (*op && ceed_operator_stats_thread.level != CeedOperatorStatsGetLevel()) *op = NULL;
+  *start_ns = *op ? CeedOperatorStatsGetTime() : 0;
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Record a `CeedElemRestriction` application in the statistics of a `CeedOperator`
+
+  The application is attributed to the first field using `rstr` in the direction given by `t_mode`.
+  Backends may apply copies of the field `CeedElemRestriction`, such as blocked copies, so a field with the same shape is matched otherwise.
+
+  @param[in] op        `CeedOperator` collecting statistics, from @ref CeedOperatorStatsGetCurrent()
+  @param[in] rstr      `CeedElemRestriction` applied
+  @param[in] t_mode    Apply restriction or transpose
+  @param[in] num_block Number of element blocks applied
+  @param[in] start_ns  Start time of application, from @ref CeedOperatorStatsGetCurrent()
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+int CeedOperatorStatsRecordElemRestriction(CeedOperator op, CeedElemRestriction rstr, CeedTransposeMode t_mode, CeedInt num_block,
+                                           CeedSize start_ns) {
+  const bool         is_input   = t_mode == CEED_NOTRANSPOSE;
+  const CeedInt      num_fields = op->is_composite ? 0 : (is_input ? op->qf->num_input_fields : op->qf->num_output_fields);
+  CeedInt            field      = -1;
+  CeedSize           bytes, flops;
+  CeedOperatorField *op_fields = is_input ? op->input_fields : op->output_fields;
+
+  // Match field
+  for (CeedInt i = 0; i < num_fields && field < 0; i++) {
+    if (op_fields[i]->elem_rstr == rstr) field = i;
+  }
+  for (CeedInt i = 0; i < num_fields && field < 0; i++) {
+    CeedElemRestriction rstr_field = op_fields[i]->elem_rstr;
+
+    if (rstr_field != CEED_ELEMRESTRICTION_NONE && rstr_field->num_elem == rstr->num_elem && rstr_field->elem_size == rstr->elem_size &&
+        rstr_field->num_comp == rstr->num_comp && rstr_field->comp_stride == rstr->comp_stride && rstr_field->l_size == rstr->l_size) {
+      field = i;
+    }
+  }
+  if (field >= 0 && !is_input) field += op->qf->num_input_fields;
+
+  // Estimates, for the fraction of the element blocks applied
+  CeedCall(CeedElemRestrictionGetFlopsEstimate(rstr, t_mode, &flops));
+  CeedCall(CeedElemRestrictionGetBytesEstimate(rstr, t_mode, &bytes));
+  if (rstr->num_block > 0) {
+    flops = flops * num_block / rstr->num_block;
+    bytes = bytes * num_block / rstr->num_block;
+  }
+  CeedCall(CeedOperatorStatsRecord(op, CEED_STAGE_RESTRICTION, field, 1, bytes, flops, CeedOperatorStatsGetTime() - start_ns));
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Record a `CeedBasis` application in the statistics of a `CeedOperator`
+
+  The application is attributed to the first field using `basis` with `eval_mode` in the direction given by `t_mode`, or else the first field using `basis`.
+
+  @param[in] op        `CeedOperator` collecting statistics, from @ref CeedOperatorStatsGetCurrent()
+  @param[in] basis     `CeedBasis` applied
+  @param[in] num_elem  Number of elements applied
+  @param[in] t_mode    Apply basis or transpose
+  @param[in] eval_mode @ref CeedEvalMode applied
+  @param[in] is_add    Whether the output was summed into
+  @param[in] start_ns  Start time of application, from @ref CeedOperatorStatsGetCurrent()
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+int CeedOperatorStatsRecordBasis(CeedOperator op, CeedBasis basis, CeedInt num_elem, CeedTransposeMode t_mode, CeedEvalMode eval_mode, bool is_add,
+                                 CeedSize start_ns) {
+  const bool          is_input   = t_mode == CEED_NOTRANSPOSE;
+  const CeedInt       num_fields = op->is_composite ? 0 : (is_input ? op->qf->num_input_fields : op->qf->num_output_fields);
+  CeedInt             field      = -1, q_comp;
+  CeedSize            bytes, flops;
+  CeedOperatorField  *op_fields = is_input ? op->input_fields : op->output_fields;
+  CeedQFunctionField *qf_fields = op->is_composite ? NULL : (is_input ? op->qf->input_fields : op->qf->output_fields);
+
+  // Match field
+  for (CeedInt i = 0; i < num_fields && field < 0; i++) {
+    if (op_fields[i]->basis == basis && qf_fields[i]->eval_mode == eval_mode) field = i;
+  }
+  for (CeedInt i = 0; i < num_fields && field < 0; i++) {
+    if (op_fields[i]->basis == basis) field = i;
+  }
+  if (field >= 0 && !is_input) field += op->qf->num_input_fields;
+
+  // Estimates, also reading the output values when summing into them
+  CeedCall(CeedBasisGetFlopsEstimate(basis, t_mode, eval_mode, false, 0, &flops));
+  CeedCall(CeedBasisGetBytesEstimate(basis, t_mode, eval_mode, false, 0, &bytes));
+  CeedCall(CeedBasisGetNumQuadratureComponents(basis, eval_mode, &q_comp));
+  if (is_add && eval_mode != CEED_EVAL_NONE) {
+    bytes += (is_input ? basis->Q * basis->num_comp * q_comp : basis->P * basis->num_comp) * sizeof(CeedScalar);
+  }
+  flops *= num_elem;
+  bytes *= num_elem;
+  CeedCall(CeedOperatorStatsRecord(op, CEED_STAGE_BASIS, field, 1, bytes, flops, CeedOperatorStatsGetTime() - start_ns));
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Record a `CeedQFunction` application in the statistics of a `CeedOperator`
+
+  @param[in] op       `CeedOperator` collecting statistics, from @ref CeedOperatorStatsGetCurrent()
+  @param[in] qf       `CeedQFunction` applied
+  @param[in] Q        Number of quadrature points applied
+  @param[in] start_ns Start time of application, from @ref CeedOperatorStatsGetCurrent()
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+int CeedOperatorStatsRecordQFunction(CeedOperator op, CeedQFunction qf, CeedInt Q, CeedSize start_ns) {
+  CeedSize bytes, flops;
+
+  CeedCall(CeedQFunctionGetFlopsEstimate(qf, &flops));
+  CeedCall(CeedQFunctionGetBytesEstimate(qf, &bytes));
+  CeedCall(CeedOperatorStatsRecord(op, CEED_STAGE_QFUNCTION, -1, 1, bytes * Q, flops * Q, CeedOperatorStatsGetTime() - start_ns));
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Sum the statistics of a `CeedOperator` for a stage
+
+  @param[in]     op         `CeedOperator`
+  @param[in]     stage      Stage to sum statistics for
+  @param[in]     field_name Name of field to sum statistics for, or `NULL` for all applications of the stage
+  @param[in]     is_sub     Whether `op` is a sub-operator of a composite `CeedOperator` being summed
+  @param[in,out] values     Number of calls, time in nanoseconds, bytes, and floating point operations to sum into
+  @param[in,out] has_field  Variable to set if `op` has a field named `field_name`
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedOperatorSumStats(CeedOperator op, CeedStageType stage, const char *field_name, bool is_sub, CeedSize values[4], bool *has_field) {
+  if (op->stats && !field_name) {
+    // Sub-operator applications are already included in the calls and time of the composite operator application
+    if (!is_sub || stage != CEED_STAGE_OPERATOR) {
+      values[0] += op->stats[stage].num_calls;
+      values[1] += op->stats[stage].time_ns;
+    }
+    values[2] += op->stats[stage].bytes;
+    values[3] += op->stats[stage].flops;
+  }
+  if (op->is_composite) {
+    for (CeedInt i = 0; i < op->num_suboperators; i++) {
+      CeedCall(CeedOperatorSumStats(op->sub_operators[i], stage, field_name, true, values, has_field));
+    }
+  } else if (field_name) {
+    const CeedInt num_input_fields = op->qf->num_input_fields;
+
+    for (CeedInt i = 0; i < num_input_fields + op->qf->num_output_fields; i++) {
+      CeedOperatorField op_field = i < num_input_fields ? op->input_fields[i] : op->output_fields[i - num_input_fields];
+
+      if (!op_field || strcmp(op_field->field_name, field_name)) continue;
+      *has_field = true;
+      if (op->stats) {
+        CeedOperatorStageStats *stats = &op->stats[CEED_OPERATOR_STATS_NUM_TOTALS + 2 * i + (stage == CEED_STAGE_BASIS)];
+
+        values[0] += stats->num_calls;
+        values[1] += stats->time_ns;
+        values[2] += stats->bytes;
+        values[3] += stats->flops;
+      }
+    }
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief View the statistics collected for a `CeedOperator`
+
+  @param[in] op     `CeedOperator` to view statistics for
+  @param[in] sub    Boolean flag for sub-operator
+  @param[in] stream Stream to write; typically `stdout` or a file
+
+  @return Error code: 0 - success, otherwise - failure
+
+  @ref Utility
+**/
+static int CeedOperatorStatsView(CeedOperator op, bool sub, FILE *stream) {
+  const bool    has_fields       = !op->is_composite && op->stats;
+  const char   *pre              = sub ? "  " : "";
+  const CeedInt num_input_fields = has_fields ? op->qf->num_input_fields : 0, num_fields = has_fields ? op->num_fields : 0;
+
+  fprintf(stream, "%s  Statistics:\n", pre);
+  for (CeedInt s = CEED_STAGE_OPERATOR; s <= CEED_STAGE_QFUNCTION; s++) {
+    CeedSize num_calls, bytes, flops;
+    double   time;
+
+    CeedCall(CeedOperatorGetStats(op, (CeedStageType)s, NULL, &num_calls, &time, &bytes, &flops));
+    fprintf(stream, "%s    %s: %" CeedSize_FMT " calls, %.6e s, %" CeedSize_FMT " bytes, %" CeedSize_FMT " flops\n", pre, CeedStageTypes[s],
+            num_calls, time, bytes, flops);
+    if (s != CEED_STAGE_RESTRICTION && s != CEED_STAGE_BASIS) continue;
+
+    // Fields applied, listing fields that are both inputs and outputs once
+    for (CeedInt i = 0; i < num_fields; i++) {
+      bool        is_listed  = false;
+      const char *field_name = i < num_input_fields ? op->input_fields[i]->field_name : op->output_fields[i - num_input_fields]->field_name;
+
+      for (CeedInt j = 0; j < num_input_fields && i >= num_input_fields; j++) is_listed |= !strcmp(op->input_fields[j]->field_name, field_name);
+      if (is_listed) continue;
+      CeedCall(CeedOperatorGetStats(op, (CeedStageType)s, field_name, &num_calls, &time, &bytes, &flops));
+      if (num_calls == 0) continue;
+      fprintf(stream, "%s      Field \"%s\": %" CeedSize_FMT " calls, %.6e s, %" CeedSize_FMT " bytes, %" CeedSize_FMT " flops\n", pre, field_name,
+              num_calls, time, bytes, flops);
+    }
+  }
+
+  // Achieved bandwidth for the compulsory traffic of each application
+  {
+    double   bandwidth;
+    CeedSize bytes;
+
+    CeedCall(CeedOperatorGetBytesEstimate(op, &bytes));
+    CeedCall(CeedOperatorGetRoofline(op, 0.0, NULL, &bandwidth, NULL));
+    fprintf(stream, "%s    roofline: %" CeedSize_FMT " compulsory bytes per application, %.6e bytes/s\n", pre, bytes, bandwidth);
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Check if two `CeedOperator` share state that a backend may modify while applying them
+
+  `CeedOperator` conflict if they share a `CeedQFunction`, a `CeedQFunctionContext`, or a passive `CeedVector`.
+
+  @param[in]  op_a         First `CeedOperator`
+  @param[in]  op_b         Second `CeedOperator`
+  @param[out] shares_state Variable to store conflict status
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedOperatorSharesState(CeedOperator op_a, CeedOperator op_b, bool *shares_state) {
+  CeedInt            num_input_fields_a, num_output_fields_a, num_input_fields_b, num_output_fields_b;
+  CeedOperatorField *input_fields_a, *output_fields_a, *input_fields_b, *output_fields_b;
+
+  *shares_state = op_a->qf == op_b->qf || (op_a->qf->ctx && op_a->qf->ctx == op_b->qf->ctx);
+  CeedCall(CeedOperatorGetFields(op_a, &num_input_fields_a, &input_fields_a, &num_output_fields_a, &output_fields_a));
+  CeedCall(CeedOperatorGetFields(op_b, &num_input_fields_b, &input_fields_b, &num_output_fields_b, &output_fields_b));
+  for (CeedInt i = 0; i < num_input_fields_a + num_output_fields_a && !*shares_state; i++) {
+    CeedVector vec_a = i < num_input_fields_a ? input_fields_a[i]->vec : output_fields_a[i - num_input_fields_a]->vec;
+
+    if (vec_a == CEED_VECTOR_ACTIVE || vec_a == CEED_VECTOR_NONE) continue;
+    for (CeedInt j = 0; j < num_input_fields_b + num_output_fields_b; j++) {
+      CeedVector vec_b = j < num_input_fields_b ? input_fields_b[j]->vec : output_fields_b[j - num_input_fields_b]->vec;
+
+      if (vec_a == vec_b) *shares_state = true;
+    }
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Visit the active output L-vector entries of a `CeedOperator`, collecting and marking the groups that sum into them
+
+  Entries of strided and points restrictions are not tracked individually, so every entry is visited.
+
+  @param[in]     op          `CeedOperator` to visit
+  @param[in]     l_size      Length of the active output L-vector
+  @param[in]     mark        Bits to set in `used_groups` for each visited entry
+  @param[in,out] used_groups Bitmask of groups summing into each entry of the active output L-vector
+  @param[in,out] forbidden   Bitmask to accumulate the groups already summing into the visited entries
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedOperatorMarkActiveOutputEntries(CeedOperator op, CeedSize l_size, uint64_t mark, uint64_t *used_groups, uint64_t *forbidden) {
+  CeedInt            num_output_fields;
+  CeedOperatorField *output_fields;
+
+  CeedCall(CeedOperatorGetFields(op, NULL, NULL, &num_output_fields, &output_fields));
+  for (CeedInt i = 0; i < num_output_fields; i++) {
+    CeedRestrictionType rstr_type;
+    CeedElemRestriction rstr = output_fields[i]->elem_rstr;
+
+    if (output_fields[i]->vec != CEED_VECTOR_ACTIVE) continue;
+    CeedCall(CeedElemRestrictionGetType(rstr, &rstr_type));
+    if (rstr_type == CEED_RESTRICTION_STRIDED || rstr_type == CEED_RESTRICTION_POINTS) {
+      for (CeedSize j = 0; j < l_size; j++) {
+        *forbidden |= used_groups[j];
+        used_groups[j] |= mark;
+      }
+    } else {
+      CeedInt        num_elem, elem_size, num_comp, comp_stride;
+      const CeedInt *offsets;
+
+      CeedCall(CeedElemRestrictionGetNumElements(rstr, &num_elem));
+      CeedCall(CeedElemRestrictionGetElementSize(rstr, &elem_size));
+      CeedCall(CeedElemRestrictionGetNumComponents(rstr, &num_comp));
+      CeedCall(CeedElemRestrictionGetCompStride(rstr, &comp_stride));
+      CeedCall(CeedElemRestrictionGetOffsets(rstr, CEED_MEM_HOST, &offsets));
+      for (CeedSize j = 0; j < (CeedSize)num_elem * elem_size; j++) {
+        for (CeedInt c = 0; c < num_comp; c++) {
+          const CeedSize index = offsets[j] + (CeedSize)c * comp_stride;
+
+          *forbidden |= used_groups[index];
+          used_groups[index] |= mark;
+        }
+      }
+      CeedCall(CeedElemRestrictionRestoreOffsets(rstr, &offsets));
+    }
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Group the sub-operators of a composite `CeedOperator` into sets that may be applied concurrently
+
+  Groups are assigned greedily in sub-operator order, so a sub-operator never shares a group with an earlier sub-operator it conflicts with.
+  If the composite `CeedOperator` is deterministic, sub-operators whose active outputs sum into the same entries also conflict.
+  If more than 64 groups would be needed, every sub-operator is placed in its own group.
+
+  @param[in,out] op Composite `CeedOperator`
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedCompositeOperatorSetupGroups(CeedOperator op) {
+  bool          is_exhausted = false;
+  CeedInt       num_sub      = op->num_suboperators, num_groups = 0, *groups;
+  CeedOperator *sub_ops      = op->sub_operators;
+  uint64_t     *used_groups  = NULL;
+
+  CeedCall(CeedCalloc(num_sub, &groups));
+  if (op->is_deterministic && op->output_size > 0) CeedCall(CeedCalloc(op->output_size, &used_groups));
+  for (CeedInt k = 0; k < num_sub; k++) {
+    uint64_t forbidden = 0;
+
+    for (CeedInt j = 0; j < k; j++) {
+      bool shares_state;
+
+      CeedCall(CeedOperatorSharesState(sub_ops[j], sub_ops[k], &shares_state));
+      if (shares_state) forbidden |= (uint64_t)1 << groups[j];
+    }
+    if (used_groups) CeedCall(CeedOperatorMarkActiveOutputEntries(sub_ops[k], op->output_size, 0, used_groups, &forbidden));
+    is_exhausted = forbidden == UINT64_MAX;
+    if (is_exhausted) break;
+    while (forbidden & ((uint64_t)1 << groups[k])) groups[k]++;
+    if (used_groups) CeedCall(CeedOperatorMarkActiveOutputEntries(sub_ops[k], op->output_size, (uint64_t)1 << groups[k], used_groups, &forbidden));
+    num_groups = CeedIntMax(num_groups, groups[k] + 1);
+  }
+  if (is_exhausted) {
+    for (CeedInt k = 0; k < num_sub; k++) groups[k] = k;
+    num_groups = num_sub;
+  }
+
+  // Sub-operator indices ordered by group
+  op->num_sub_groups = num_groups;
+  CeedCall(CeedCalloc(num_groups + 1, &op->sub_group_offsets));
+  CeedCall(CeedCalloc(num_sub, &op->sub_group_indices));
+  for (CeedInt k = 0; k < num_sub; k++) op->sub_group_offsets[groups[k] + 1]++;
+  for (CeedInt g = 0; g < num_groups; g++) op->sub_group_offsets[g + 1] += op->sub_group_offsets[g];
+  {
+    CeedInt *next;
+
+    CeedCall(CeedCalloc(num_groups, &next));
+    for (CeedInt k = 0; k < num_sub; k++) op->sub_group_indices[op->sub_group_offsets[groups[k]] + next[groups[k]]++] = k;
+    CeedCall(CeedFree(&next));
+  }
+  CeedCall(CeedFree(&used_groups));
+  CeedCall(CeedFree(&groups));
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Destroy the per-thread input views and output buffers for concurrent application of a composite `CeedOperator`
+
+  @param[in,out] op Composite `CeedOperator`
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedCompositeOperatorDestroyConcurrentBuffers(CeedOperator op) {
+  for (int t = 0; t < op->num_concurrent_threads; t++) {
+    if (op->concurrent_in_views) CeedCall(CeedVectorDestroy(&op->concurrent_in_views[t]));
+    if (op->concurrent_out_buffers) CeedCall(CeedVectorDestroy(&op->concurrent_out_buffers[t]));
+  }
+  CeedCall(CeedFree(&op->concurrent_in_views));
+  CeedCall(CeedFree(&op->concurrent_out_buffers));
+  op->num_concurrent_threads = 0;
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Set up the per-thread input views and output buffers for concurrent application of a composite `CeedOperator`
+
+  Views and buffers are kept on the composite `CeedOperator` between applications.
+  Output buffers are zeroed once when created; @ref CeedCompositeOperatorSumConcurrentBuffers() zeroes the entries it adds to the output, so the buffers are zero between applications.
+  The active output L-vector entries of each sub-operator are collected on first use, so only those entries are summed.
+
+  @param[in,out] op          Composite `CeedOperator`
+  @param[in]     num_threads Number of threads
+  @param[in]     in_length   Length of the input `CeedVector`, or 0 for @ref CEED_VECTOR_NONE
+  @param[in]     out_length  Length of the output `CeedVector`, or 0 for @ref CEED_VECTOR_NONE
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedCompositeOperatorSetupConcurrentBuffers(CeedOperator op, int num_threads, CeedSize in_length, CeedSize out_length) {
+  Ceed ceed = CeedOperatorReturnCeed(op);
+
+  if (num_threads != op->num_concurrent_threads) {
+    CeedCall(CeedCompositeOperatorDestroyConcurrentBuffers(op));
+    CeedCall(CeedCalloc(num_threads, &op->concurrent_in_views));
+    CeedCall(CeedCalloc(num_threads, &op->concurrent_out_buffers));
+    op->num_concurrent_threads = num_threads;
+  }
+  if (!op->sub_threads) CeedCall(CeedCalloc(op->num_suboperators, &op->sub_threads));
+  for (int t = 0; t < num_threads; t++) {
+    CeedSize length;
+
+    if (in_length > 0 && op->concurrent_in_views[t]) {
+      CeedCall(CeedVectorGetLength(op->concurrent_in_views[t], &length));
+      if (length != in_length) CeedCall(CeedVectorDestroy(&op->concurrent_in_views[t]));
+    }
+    if (in_length > 0 && !op->concurrent_in_views[t]) CeedCall(CeedVectorCreate(ceed, in_length, &op->concurrent_in_views[t]));
+    if (out_length > 0 && op->concurrent_out_buffers[t]) {
+      CeedCall(CeedVectorGetLength(op->concurrent_out_buffers[t], &length));
+      if (length != out_length) CeedCall(CeedVectorDestroy(&op->concurrent_out_buffers[t]));
+    }
+    if (out_length > 0 && !op->concurrent_out_buffers[t]) {
+      CeedCall(CeedVectorCreate(ceed, out_length, &op->concurrent_out_buffers[t]));
+      CeedCall(CeedVectorSetValue(op->concurrent_out_buffers[t], 0.0));
+    }
+  }
+
+  // Active output entries of each sub-operator
+  if (out_length > 0 && !op->sub_output_offsets) {
+    CeedSize  num_indices = 0, max_indices = out_length;
+    uint64_t *marks, unused = 0;
+
+    CeedCall(CeedCalloc(out_length, &marks));
+    CeedCall(CeedCalloc(op->num_suboperators + 1, &op->sub_output_offsets));
+    CeedCall(CeedMalloc(max_indices, &op->sub_output_indices));
+    for (CeedInt k = 0; k < op->num_suboperators; k++) {
+      if (op->sub_operators[k]->num_elem > 0) CeedCall(CeedOperatorMarkActiveOutputEntries(op->sub_operators[k], out_length, 1, marks, &unused));
+      for (CeedSize j = 0; j < out_length; j++) {
+        if (!marks[j]) continue;
+        if (num_indices == max_indices) {
+          max_indices *= 2;
+          CeedCall(CeedRealloc(max_indices, &op->sub_output_indices));
+        }
+        op->sub_output_indices[num_indices++] = j;
+        marks[j]                              = 0;
+      }
+      op->sub_output_offsets[k + 1] = num_indices;
+    }
+    CeedCall(CeedFree(&marks));
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Add the output buffers of a range of concurrently applied sub-operators into the output `CeedVector`
+
+  Only the active output entries of each sub-operator are added, and each added buffer entry is zeroed.
+  A sub-operator sharing a buffer entry with an earlier sub-operator of the same thread adds zero, so every contribution is added once.
+
+  @param[in,out] op    Composite `CeedOperator`
+  @param[in]     start First entry of `sub_group_indices` to add
+  @param[in]     end   One past the last entry of `sub_group_indices` to add
+  @param[out]    out   `CeedVector` to sum into
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedCompositeOperatorSumConcurrentBuffers(CeedOperator op, CeedInt start, CeedInt end, CeedVector out) {
+  CeedScalar *out_array;
+
+  CeedCall(CeedVectorGetArray(out, CEED_MEM_HOST, &out_array));
+  for (CeedInt i = start; i < end; i++) {
+    const CeedInt   k           = op->sub_group_indices[i];
+    const CeedSize *indices     = &op->sub_output_indices[op->sub_output_offsets[k]];
+    const CeedSize  num_indices = op->sub_output_offsets[k + 1] - op->sub_output_offsets[k];
+    CeedScalar     *buffer_array;
+
+    if (num_indices == 0) continue;
+    CeedCall(CeedVectorGetArray(op->concurrent_out_buffers[op->sub_threads[i]], CEED_MEM_HOST, &buffer_array));
+    for (CeedSize j = 0; j < num_indices; j++) {
+      out_array[indices[j]] += buffer_array[indices[j]];
+      buffer_array[indices[j]] = 0.0;
+    }
+    CeedCall(CeedVectorRestoreArray(op->concurrent_out_buffers[op->sub_threads[i]], &buffer_array));
+  }
+  CeedCall(CeedVectorRestoreArray(out, &out_array));
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Apply the sub-operators of a composite `CeedOperator` concurrently and add the result to the output `CeedVector`
+
+  Each group of sub-operators from @ref CeedCompositeOperatorSetupGroups() is applied with an OpenMP parallel loop over its sub-operators.
+  Every thread reads the input through its own `CeedVector` view and sums into its own accumulation buffer, so backends never share a `CeedVector` between threads.
+  The active output entries of each sub-operator are added to the output after the last group, or after each group if the composite `CeedOperator` is deterministic.
+  In the deterministic case each output entry receives a contribution from at most one sub-operator per group, so the result does not depend on scheduling.
+
+  @param[in]  op  Composite `CeedOperator` to apply
+  @param[in]  in  `CeedVector` containing input state or @ref CEED_VECTOR_NONE
+  @param[out] out `CeedVector` to sum in result or @ref CEED_VECTOR_NONE
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedCompositeOperatorApplyAddConcurrent(CeedOperator op, CeedVector in, CeedVector out) {
+  int               ierr = CEED_ERROR_SUCCESS, num_threads = 1;
+  CeedInt           sum_start = 0;
+  CeedSize          in_length = 0, out_length = 0;
+  const CeedScalar *in_array  = NULL;
+
+#ifdef _OPENMP
+  num_threads = omp_get_max_threads();
+#endif
+  if (!op->sub_group_offsets) CeedCall(CeedCompositeOperatorSetupGroups(op));
+
+  // Per-thread input views and output buffers
+  if (in != CEED_VECTOR_NONE) CeedCall(CeedVectorGetLength(in, &in_length));
+  if (out != CEED_VECTOR_NONE) CeedCall(CeedVectorGetLength(out, &out_length));
+  CeedCall(CeedCompositeOperatorSetupConcurrentBuffers(op, num_threads, in_length, out_length));
+  if (in != CEED_VECTOR_NONE) {
+    // The views are only read, so they may borrow the read-only array of the input
+    CeedCall(CeedVectorGetArrayRead(in, CEED_MEM_HOST, &in_array));
+    for (int t = 0; t < num_threads; t++) {
+      CeedCall(CeedVectorSetArray(op->concurrent_in_views[t], CEED_MEM_HOST, CEED_USE_POINTER, (CeedScalar *)in_array));
+    }
+  }
+
+  // Apply groups in order
+  for (CeedInt g = 0; g < op->num_sub_groups && ierr == CEED_ERROR_SUCCESS; g++) {
+    const CeedInt group_start = op->sub_group_offsets[g], group_end = op->sub_group_offsets[g + 1];
+
+    CeedPragmaOMP(parallel for schedule(dynamic))
+    for (CeedInt k = group_start; k < group_end; k++) {
+      CeedOperator sub_op = op->sub_operators[op->sub_group_indices[k]];
+      int          thread = 0;
+
+#ifdef _OPENMP
+      thread = omp_get_thread_num();
+#endif
+      op->sub_threads[k] = thread;
+      if (sub_op->num_elem > 0) {
+        int          level_prev;
+        CeedSize     start_ns;
+        CeedOperator op_prev;
+        CeedVector   in_view    = in == CEED_VECTOR_NONE ? CEED_VECTOR_NONE : op->concurrent_in_views[thread];
+        CeedVector   out_buffer = out == CEED_VECTOR_NONE ? CEED_VECTOR_NONE : op->concurrent_out_buffers[thread];
+        int          ierr_k     = CeedOperatorStatsBegin(sub_op, &op_prev, &level_prev, &start_ns);
+
+        if (ierr_k == CEED_ERROR_SUCCESS) {
+          ierr_k = sub_op->ApplyAdd(sub_op, in_view, out_buffer, CEED_REQUEST_IMMEDIATE);
+          CeedOperatorStatsEnd(sub_op, op_prev, level_prev, start_ns);
+        }
+        if (ierr_k != CEED_ERROR_SUCCESS) {
+          CeedPragmaCritical(CeedCompositeOperatorApplyAddConcurrent)
+          ierr = ierr_k;
+        }
+      }
+    }
+
+    // Sum buffers into output
+    if (ierr == CEED_ERROR_SUCCESS && out != CEED_VECTOR_NONE && (op->is_deterministic || g == op->num_sub_groups - 1)) {
+      ierr      = CeedCompositeOperatorSumConcurrentBuffers(op, sum_start, group_end, out);
+      sum_start = group_end;
+    }
+  }
+
+  // Release input
+  if (in != CEED_VECTOR_NONE) {
+    for (int t = 0; t < num_threads; t++) CeedCall(CeedVectorTakeArray(op->concurrent_in_views[t], CEED_MEM_HOST, NULL));
+    CeedCall(CeedVectorRestoreArrayRead(in, &in_array));
+  }
+
+  // Buffers are no longer zero after a failed application
+  if (ierr != CEED_ERROR_SUCCESS) CeedCall(CeedCompositeOperatorDestroyConcurrentBuffers(op));
+  CeedCall(ierr);
+  return CEED_ERROR_SUCCESS;
+}
+
 /// @}
 
 /// ----------------------------------------------------------------------------
@@ -727,6 +1492,46 @@ int CeedOperatorSetSetupDone(CeedOperator op) {
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Get whether a `CeedOperator` collects statistics for each stage of its application
+
+  @param[in]  op            `CeedOperator`
+  @param[out] collect_stats Variable to store collection status
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedOperatorGetCollectStats(CeedOperator op, bool *collect_stats) {
+  *collect_stats = op->collect_stats;
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Add `CeedQFunction` applications made directly by the backend to the statistics of a `CeedOperator`
+
+  Backends calling the user function of the `CeedQFunction` outside of @ref CeedQFunctionApply(), such as on worker threads, accumulate the applications and add them from the thread applying `op`.
+  Only valid during the application of `op` while it collects statistics, see @ref CeedOperatorGetCollectStats().
+
+  @param[in,out] op         `CeedOperator` being applied
+  @param[in]     num_calls  Number of `CeedQFunction` applications
+  @param[in]     num_points Total number of quadrature points applied
+  @param[in]     time_ns    Wall time of applications, in nanoseconds, summed over threads
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedOperatorAddQFunctionStats(CeedOperator op, CeedSize num_calls, CeedSize num_points, CeedSize time_ns) {
+  CeedSize bytes, flops;
+
+  if (!op->collect_stats || !op->stats || num_calls == 0) return CEED_ERROR_SUCCESS;
+  CeedCall(CeedQFunctionGetFlopsEstimate(op->qf, &flops));
+  CeedCall(CeedQFunctionGetBytesEstimate(op->qf, &bytes));
+  CeedCall(CeedOperatorStatsRecord(op, CEED_STAGE_QFUNCTION, -1, num_calls, bytes * num_points, flops * num_points, time_ns));
+  return CEED_ERROR_SUCCESS;
+}
+
 /// @}
 
 /// ----------------------------------------------------------------------------
@@ -1006,6 +1811,38 @@ found:
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Set the storage format for a passive input field of a `CeedOperator`.
+
+  Backends may store the passive input data, such as quadrature point data, in a compressed format and decompress it as each element block is read.
+  Computation remains in @ref CeedScalar, so compression reduces the memory traffic for the field at the cost of accuracy in the stored data.
+  Backends without support for compressed storage use @ref CeedScalar.
+
+  @param[in,out] op         `CeedOperator`
+  @param[in]     field_name Name of the passive input field, set with @ref CeedOperatorSetField()
+  @param[in]     storage    Storage format for the field data
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedOperatorSetFieldStorage(CeedOperator op, const char *field_name, CeedStorageType storage) {
+  bool              is_immutable;
+  CeedOperatorField op_field = NULL;
+
+  CeedCall(CeedOperatorIsImmutable(op, &is_immutable));
+  CeedCheck(!op->is_composite, CeedOperatorReturnCeed(op), CEED_ERROR_INCOMPATIBLE, "Cannot set field storage for composite operator");
+  CeedCheck(!is_immutable, CeedOperatorReturnCeed(op), CEED_ERROR_MAJOR, "Operator cannot be changed after set as immutable");
+  for (CeedInt i = 0; i < CEED_FIELD_MAX && !op_field; i++) {
+    if (op->input_fields[i] && !strcmp(op->input_fields[i]->field_name, field_name)) op_field = op->input_fields[i];
+  }
+  CeedCheck(op_field, CeedOperatorReturnCeed(op), CEED_ERROR_INCOMPLETE, "No input field '%s' has been set", field_name);
+  CeedCheck(op_field->vec != CEED_VECTOR_ACTIVE && op_field->vec != CEED_VECTOR_NONE, CeedOperatorReturnCeed(op), CEED_ERROR_INCOMPATIBLE,
+            "Only passive input fields can set storage format");
+  op_field->storage = storage;
+  return CEED_ERROR_SUCCESS;
+}
+
 /**
   @brief Get the `CeedOperator` Field of a `CeedOperator`.
 
@@ -1216,15 +2053,30 @@ int CeedOperatorFieldGetBasis(CeedOperatorField op_field, CeedBasis *basis) {
   Note: Caller is responsible for destroying the `vec` with @ref CeedVectorDestroy().
 
   @param[in]  op_field `CeedOperator` Field
-  @param[out] vec      Variable to store `CeedVector`
+  @param[out] vec      Variable to store `CeedVector`
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Advanced
+**/
+int CeedOperatorFieldGetVector(CeedOperatorField op_field, CeedVector *vec) {
+  *vec = NULL;
+  CeedCall(CeedVectorReferenceCopy(op_field->vec, vec));
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Get the storage format of a `CeedOperator` Field
+
+  @param[in]  op_field `CeedOperator` Field
+  @param[out] storage  Variable to store the storage format
 
   @return An error code: 0 - success, otherwise - failure
 
   @ref Advanced
 **/
-int CeedOperatorFieldGetVector(CeedOperatorField op_field, CeedVector *vec) {
-  *vec = NULL;
-  CeedCall(CeedVectorReferenceCopy(op_field->vec, vec));
+int CeedOperatorFieldGetStorage(CeedOperatorField op_field, CeedStorageType *storage) {
+  *storage = op_field->storage;
   return CEED_ERROR_SUCCESS;
 }
 
@@ -1365,6 +2217,60 @@ int CeedCompositeOperatorGetSubByName(CeedOperator op, const char *op_name, Ceed
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Set whether the sub-operators of a composite `CeedOperator` are applied concurrently.
+
+  When the composite `CeedOperator` has no backend composite implementation, sub-operators that do not share a `CeedQFunction`, `CeedQFunctionContext`, or passive `CeedVector` are applied concurrently with OpenMP on host backends.
+  Each thread sums into its own accumulation buffer, kept on the composite `CeedOperator` between applications, and only the active output entries of each sub-operator are added to the output, so rounding may differ between runs.
+  With `is_deterministic`, sub-operators whose active outputs overlap are also applied one after another and the buffers are added after each group, so the result does not depend on the number of threads or on scheduling.
+
+  The first application after setup is always sequential, as backends complete their setup of each sub-operator at that time.
+
+  @param[in,out] op               Composite `CeedOperator`
+  @param[in]     is_concurrent    Boolean flag to apply sub-operators concurrently
+  @param[in]     is_deterministic Boolean flag to order sub-operators with overlapping active outputs for a deterministic result
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Advanced
+**/
+int CeedCompositeOperatorSetConcurrent(CeedOperator op, bool is_concurrent, bool is_deterministic) {
+  bool is_composite;
+
+  CeedCall(CeedOperatorIsComposite(op, &is_composite));
+  CeedCheck(is_composite, CeedOperatorReturnCeed(op), CEED_ERROR_MINOR, "Only defined for a composite operator");
+  if (is_deterministic != op->is_deterministic) {
+    // Groups depend on whether active outputs are considered
+    CeedCall(CeedFree(&op->sub_group_offsets));
+    CeedCall(CeedFree(&op->sub_group_indices));
+    op->num_sub_groups = 0;
+  }
+  op->is_concurrent    = is_concurrent;
+  op->is_deterministic = is_deterministic;
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Get whether the sub-operators of a composite `CeedOperator` are applied concurrently.
+
+  @param[in]  op               Composite `CeedOperator`
+  @param[out] is_concurrent    Variable to store concurrent application status
+  @param[out] is_deterministic Variable to store deterministic ordering status
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Advanced
+**/
+int CeedCompositeOperatorGetConcurrent(CeedOperator op, bool *is_concurrent, bool *is_deterministic) {
+  bool is_composite;
+
+  CeedCall(CeedOperatorIsComposite(op, &is_composite));
+  CeedCheck(is_composite, CeedOperatorReturnCeed(op), CEED_ERROR_MINOR, "Only defined for a composite operator");
+  if (is_concurrent) *is_concurrent = op->is_concurrent;
+  if (is_deterministic) *is_deterministic = op->is_deterministic;
+  return CEED_ERROR_SUCCESS;
+}
+
 /**
   @brief Check if a `CeedOperator` is ready to be used.
 
@@ -1576,6 +2482,123 @@ int CeedOperatorGetName(CeedOperator op, const char **name) {
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Set whether a `CeedOperator` collects statistics for each stage of its application.
+
+  When enabled, each application of the `CeedOperator` records the number of calls, wall time, and estimated bytes read and written and floating point operations.
+  These are recorded for the whole application and for each `CeedElemRestriction`, `CeedBasis`, and `CeedQFunction` application dispatched through the libCEED interface, both in total and for each field.
+  Stages fused into backend kernels, such as every stage with `/gpu/cuda/gen` or the restrictions in the fused element block kernel of `/cpu/self/opt`, are only included in the whole application.
+  `CeedElemRestriction` and `CeedBasis` applications on backend worker threads are not recorded either, so use a single threaded backend such as `/cpu/self/ref/blocked` for a full breakdown by stage.
+  `CeedQFunction` applications are still recorded by the threaded and fused element block loops of `/cpu/self/opt`, with their time summed over the worker threads.
+  Times are measured on the host, so for device backends they only include kernel launches unless the backend synchronizes.
+
+  Setting this for a composite `CeedOperator` also sets it for the current sub-operators.
+
+  @param[in,out] op            `CeedOperator`
+  @param[in]     collect_stats Boolean flag to collect statistics
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedOperatorSetCollectStats(CeedOperator op, bool collect_stats) {
+  op->collect_stats = collect_stats;
+  for (CeedInt i = 0; i < op->num_suboperators; i++) CeedCall(CeedOperatorSetCollectStats(op->sub_operators[i], collect_stats));
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Get the statistics collected for a stage of the application of a `CeedOperator`.
+
+  Statistics are collected once enabled with @ref CeedOperatorSetCollectStats().
+  Bytes and floating point operations are estimates for the stages recorded, and for @ref CEED_STAGE_OPERATOR they are the sums over the recorded stages.
+  For a composite `CeedOperator`, statistics are summed over the sub-operators.
+
+  @param[in]  op         `CeedOperator`
+  @param[in]  stage      Stage to get statistics for
+  @param[in]  field_name Name of field to get statistics for, or `NULL` for all applications of the stage.
+                           Only @ref CEED_STAGE_RESTRICTION and @ref CEED_STAGE_BASIS have statistics for each field.
+  @param[out] num_calls  Variable to store number of applications, or `NULL`
+  @param[out] time       Variable to store total wall time of applications in seconds, or `NULL`
+  @param[out] bytes      Variable to store estimated bytes read and written, or `NULL`
+  @param[out] flops      Variable to store estimated floating point operations, or `NULL`
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedOperatorGetStats(CeedOperator op, CeedStageType stage, const char *field_name, CeedSize *num_calls, double *time, CeedSize *bytes,
+                         CeedSize *flops) {
+  bool     has_field = false;
+  CeedSize values[4] = {0, 0, 0, 0};
+
+  CeedCheck(stage >= CEED_STAGE_OPERATOR && stage <= CEED_STAGE_QFUNCTION, CeedOperatorReturnCeed(op), CEED_ERROR_UNSUPPORTED,
+            "Unknown CeedOperator stage %d", stage);
+  CeedCheck(!field_name || stage == CEED_STAGE_RESTRICTION || stage == CEED_STAGE_BASIS, CeedOperatorReturnCeed(op), CEED_ERROR_INCOMPATIBLE,
+            "CeedOperator statistics for %s stage are not available by field", CeedStageTypes[stage]);
+  CeedCall(CeedOperatorSumStats(op, stage, field_name, false, values, &has_field));
+  CeedCheck(!field_name || has_field, CeedOperatorReturnCeed(op), CEED_ERROR_INCOMPLETE, "CeedOperator has no field '%s'", field_name);
+  if (num_calls) *num_calls = values[0];
+  if (time) *time = values[1] * 1e-9;
+  if (bytes) *bytes = values[2];
+  if (flops) *flops = values[3];
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Reset the statistics collected for a `CeedOperator` and its sub-operators
+
+  @param[in,out] op `CeedOperator`
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedOperatorResetStats(CeedOperator op) {
+  for (CeedInt i = 0; i < op->num_stats; i++) {
+    op->stats[i].num_calls = 0;
+    op->stats[i].time_ns   = 0;
+    op->stats[i].bytes     = 0;
+    op->stats[i].flops     = 0;
+  }
+  for (CeedInt i = 0; i < op->num_suboperators; i++) CeedCall(CeedOperatorResetStats(op->sub_operators[i]));
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Get the roofline summary of the applications of a `CeedOperator` with collected statistics
+
+  The arithmetic intensity and the achieved bandwidth use @ref CeedOperatorGetFlopsEstimate() and @ref CeedOperatorGetBytesEstimate() for each application, with the wall time measured by @ref CeedOperatorGetStats() for @ref CEED_STAGE_OPERATOR.
+  The achieved bandwidth is 0 if no applications have been measured.
+
+  @param[in]  op               `CeedOperator`
+  @param[in]  stream_bandwidth Measured STREAM bandwidth of the device in bytes per second, or 0 if unknown
+  @param[out] intensity        Variable to store estimated floating point operations per byte, or `NULL`
+  @param[out] bandwidth        Variable to store achieved bandwidth in bytes per second, or `NULL`
+  @param[out] fraction         Variable to store achieved fraction of `stream_bandwidth`, or `NULL`; 0 if `stream_bandwidth` is not positive
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedOperatorGetRoofline(CeedOperator op, double stream_bandwidth, double *intensity, double *bandwidth, double *fraction) {
+  double   time, achieved = 0.0;
+  CeedSize num_calls, bytes;
+
+  CeedCall(CeedOperatorGetBytesEstimate(op, &bytes));
+  if (intensity) {
+    CeedSize flops;
+
+    CeedCall(CeedOperatorGetFlopsEstimate(op, &flops));
+    *intensity = bytes > 0 ? (double)flops / bytes : 0.0;
+  }
+  CeedCall(CeedOperatorGetStats(op, CEED_STAGE_OPERATOR, NULL, &num_calls, &time, NULL, NULL));
+  if (num_calls > 0 && time > 0.0) achieved = (double)bytes * num_calls / time;
+  if (bandwidth) *bandwidth = achieved;
+  if (fraction) *fraction = stream_bandwidth > 0.0 ? achieved / stream_bandwidth : 0.0;
+  return CEED_ERROR_SUCCESS;
+}
+
 /**
   @brief Core logic for viewing a `CeedOperator`
 
@@ -1608,11 +2631,13 @@ static int CeedOperatorView_Core(CeedOperator op, FILE *stream, bool is_full) {
       fprintf(stream, "  SubOperator%s %" CeedInt_FMT "%s%s%s\n", is_at_points ? " AtPoints" : "", i, has_name ? " - " : "",
               has_name ? sub_operators[i]->name : "", is_full ? ":" : "");
       if (is_full) CeedCall(CeedOperatorSingleView(sub_operators[i], 1, stream));
+      if (is_full && sub_operators[i]->collect_stats) CeedCall(CeedOperatorStatsView(sub_operators[i], 1, stream));
     }
   } else {
     fprintf(stream, "CeedOperator%s%s%s\n", is_at_points ? " AtPoints" : "", has_name ? " - " : "", has_name ? name : "");
     if (is_full) CeedCall(CeedOperatorSingleView(op, 0, stream));
   }
+  if (is_full && op->collect_stats) CeedCall(CeedOperatorStatsView(op, 0, stream));
   return CEED_ERROR_SUCCESS;
 }
 
@@ -1842,6 +2867,89 @@ int CeedOperatorGetFlopsEstimate(CeedOperator op, CeedSize *flops) {
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Estimate number of bytes of compulsory memory traffic required to apply `CeedOperator` on the active `CeedVector`
+
+  The estimate assumes a fused application where E-vectors and quadrature point values remain in cache.
+  The active input L-vector and each passive input `CeedVector` are read once, at their storage precision, and the output L-vectors are read and written once.
+  The offsets and orientations of each `CeedElemRestriction` are read once, and basis matrices are assumed to remain in cache.
+
+  @param[in]  op    `CeedOperator` to estimate bytes for
+  @param[out] bytes Address of variable to hold bytes estimate
+
+  @ref Backend
+**/
+int CeedOperatorGetBytesEstimate(CeedOperator op, CeedSize *bytes) {
+  bool is_composite;
+
+  CeedCall(CeedOperatorCheckReady(op));
+
+  *bytes = 0;
+  CeedCall(CeedOperatorIsComposite(op, &is_composite));
+  if (is_composite) {
+    CeedInt       num_suboperators;
+    CeedOperator *sub_operators;
+
+    CeedCall(CeedCompositeOperatorGetNumSub(op, &num_suboperators));
+    CeedCall(CeedCompositeOperatorGetSubList(op, &sub_operators));
+    for (CeedInt i = 0; i < num_suboperators; i++) {
+      CeedSize suboperator_bytes;
+
+      CeedCall(CeedOperatorGetBytesEstimate(sub_operators[i], &suboperator_bytes));
+      *bytes += suboperator_bytes;
+    }
+  } else {
+    bool               is_at_points;
+    CeedInt            num_elem, num_input_fields, num_output_fields;
+    CeedOperatorField *op_input_fields, *op_output_fields;
+
+    CeedCall(CeedOperatorGetNumElements(op, &num_elem));
+    if (num_elem == 0) return CEED_ERROR_SUCCESS;
+    CeedCall(CeedOperatorGetFields(op, &num_input_fields, &op_input_fields, &num_output_fields, &op_output_fields));
+
+    // Points coordinates
+    CeedCall(CeedOperatorIsAtPoints(op, &is_at_points));
+    if (is_at_points) {
+      CeedSize            l_size, index_bytes;
+      CeedElemRestriction rstr_points = NULL;
+
+      CeedCall(CeedOperatorAtPointsGetPoints(op, &rstr_points, NULL));
+      CeedCall(CeedElemRestrictionGetLVectorSize(rstr_points, &l_size));
+      CeedCall(CeedElemRestrictionGetIndexBytes(rstr_points, &index_bytes));
+      CeedCall(CeedElemRestrictionDestroy(&rstr_points));
+      *bytes += l_size * sizeof(CeedScalar) + index_bytes;
+    }
+
+    // Input and output fields, counting each CeedVector once in each direction and each CeedElemRestriction once
+    for (CeedInt i = 0; i < num_input_fields + num_output_fields; i++) {
+      const bool        is_input       = i < num_input_fields;
+      bool              is_vec_counted = false, is_rstr_counted = false;
+      CeedSize          scalar_bytes   = sizeof(CeedScalar), l_size, index_bytes;
+      CeedOperatorField op_field       = is_input ? op_input_fields[i] : op_output_fields[i - num_input_fields];
+
+      if (op_field->vec == CEED_VECTOR_NONE || op_field->elem_rstr == CEED_ELEMRESTRICTION_NONE) continue;
+      for (CeedInt j = 0; j < i; j++) {
+        CeedOperatorField op_field_prev = j < num_input_fields ? op_input_fields[j] : op_output_fields[j - num_input_fields];
+
+        is_rstr_counted |= op_field_prev->elem_rstr == op_field->elem_rstr;
+        is_vec_counted |= op_field_prev->vec == op_field->vec && (j < num_input_fields) == is_input;
+      }
+      if (!is_rstr_counted) {
+        CeedCall(CeedElemRestrictionGetIndexBytes(op_field->elem_rstr, &index_bytes));
+        *bytes += index_bytes;
+      }
+      if (is_vec_counted) continue;
+      if (is_input && op_field->vec != CEED_VECTOR_ACTIVE) {
+        if (op_field->storage == CEED_STORAGE_FP32) scalar_bytes = sizeof(float);
+        else if (op_field->storage == CEED_STORAGE_BF16) scalar_bytes = sizeof(uint16_t);
+      }
+      CeedCall(CeedElemRestrictionGetLVectorSize(op_field->elem_rstr, &l_size));
+      *bytes += (is_input ? 1 : 2) * l_size * scalar_bytes;
+    }
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
 /**
   @brief Get `CeedQFunction` global context for a `CeedOperator`.
 
@@ -2137,27 +3245,69 @@ int CeedOperatorRestoreContextBooleanRead(CeedOperator op, CeedContextFieldLabel
 }
 
 /**
-  @brief Apply `CeedOperator` to a `CeedVector`.
+  @brief Apply `CeedOperator` to a `CeedVector` and add result to output `CeedVector`, once any task queue submission is handled
 
-  This computes the action of the operator on the specified (active) input, yielding its (active) output.
-  All inputs and outputs must be specified using @ref CeedOperatorSetField().
+  @param[in]  op      `CeedOperator` to apply
+  @param[in]  in      `CeedVector` containing input state or @ref CEED_VECTOR_NONE if there are no active inputs
+  @param[out] out     `CeedVector` to sum in result of applying operator or @ref CEED_VECTOR_NONE if there are no active outputs
+  @param[in]  request Address of @ref CeedRequest for non-blocking completion, else @ref CEED_REQUEST_IMMEDIATE
 
-  Note: Calling this function asserts that setup is complete and sets the `CeedOperator` as immutable.
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedOperatorApplyAdd_Core(CeedOperator op, CeedVector in, CeedVector out, CeedRequest *request) {
+  bool is_composite;
+
+  CeedCall(CeedOperatorIsComposite(op, &is_composite));
+  if (is_composite) {
+    // Composite Operator
+    if (op->ApplyAddComposite) {
+      CeedCall(op->ApplyAddComposite(op, in, out, request));
+    } else {
+      CeedInt       num_suboperators;
+      CeedOperator *sub_operators;
+
+      CeedCall(CeedCompositeOperatorGetNumSub(op, &num_suboperators));
+      CeedCall(CeedCompositeOperatorGetSubList(op, &sub_operators));
+      if (op->is_concurrent && num_suboperators > 1) {
+        bool        is_setup_done = true;
+        CeedMemType mem_type;
+
+        // Only host backends, and only once every sub-operator has completed its backend setup
+        CeedCall(CeedGetPreferredMemType(CeedOperatorReturnCeed(op), &mem_type));
+        for (CeedInt i = 0; i < num_suboperators; i++) is_setup_done &= sub_operators[i]->num_elem == 0 || sub_operators[i]->is_backend_setup;
+        if (mem_type == CEED_MEM_HOST && is_setup_done) {
+          CeedCall(CeedCompositeOperatorApplyAddConcurrent(op, in, out));
+          return CEED_ERROR_SUCCESS;
+        }
+      }
+      for (CeedInt i = 0; i < num_suboperators; i++) {
+        CeedCall(CeedOperatorApplyAdd(sub_operators[i], in, out, request));
+      }
+    }
+  } else if (op->num_elem > 0) {
+    // Standard Operator
+    CeedCall(op->ApplyAdd(op, in, out, request));
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Apply `CeedOperator` to a `CeedVector`, once any task queue submission is handled
 
   @param[in]  op      `CeedOperator` to apply
   @param[in]  in      `CeedVector` containing input state or @ref CEED_VECTOR_NONE if there are no active inputs
-  @param[out] out     `CeedVector` to store result of applying operator (must be distinct from `in`) or @ref CEED_VECTOR_NONE if there are no active outputs
+  @param[out] out     `CeedVector` to store result of applying operator or @ref CEED_VECTOR_NONE if there are no active outputs
   @param[in]  request Address of @ref CeedRequest for non-blocking completion, else @ref CEED_REQUEST_IMMEDIATE
 
   @return An error code: 0 - success, otherwise - failure
 
-  @ref User
+  @ref Developer
 **/
-int CeedOperatorApply(CeedOperator op, CeedVector in, CeedVector out, CeedRequest *request) {
+static int CeedOperatorApply_Core(CeedOperator op, CeedVector in, CeedVector out, CeedRequest *request) {
   bool is_composite;
 
-  CeedCall(CeedOperatorCheckReady(op));
-
   CeedCall(CeedOperatorIsComposite(op, &is_composite));
   if (is_composite) {
     // Composite Operator
@@ -2188,7 +3338,7 @@ int CeedOperatorApply(CeedOperator op, CeedVector in, CeedVector out, CeedReques
         }
       }
       // ApplyAdd
-      CeedCall(CeedOperatorApplyAdd(op, in, out, request));
+      CeedCall(CeedOperatorApplyAdd_Core(op, in, out, request));
     }
   } else {
     // Standard Operator
@@ -2217,6 +3367,43 @@ int CeedOperatorApply(CeedOperator op, CeedVector in, CeedVector out, CeedReques
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Apply `CeedOperator` to a `CeedVector`.
+
+  This computes the action of the operator on the specified (active) input, yielding its (active) output.
+  All inputs and outputs must be specified using @ref CeedOperatorSetField().
+
+  Note: Calling this function asserts that setup is complete and sets the `CeedOperator` as immutable.
+
+  @param[in]  op      `CeedOperator` to apply
+  @param[in]  in      `CeedVector` containing input state or @ref CEED_VECTOR_NONE if there are no active inputs
+  @param[out] out     `CeedVector` to store result of applying operator (must be distinct from `in`) or @ref CEED_VECTOR_NONE if there are no active outputs
+  @param[in]  request Address of @ref CeedRequest for non-blocking completion, @ref CEED_REQUEST_ORDERED for ordered completion,
+                      else @ref CEED_REQUEST_IMMEDIATE
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedOperatorApply(CeedOperator op, CeedVector in, CeedVector out, CeedRequest *request) {
+  int          ierr, level_prev;
+  bool         is_submitted;
+  CeedSize     start_ns;
+  CeedOperator op_prev;
+
+  CeedCall(CeedOperatorCheckReady(op));
+
+  // Submit to host task queue
+  CeedCall(CeedRequestSubmit(CeedOperatorReturnCeed(op), CeedOperatorApplyTask, op, in, out, request, &is_submitted));
+  if (is_submitted) return CEED_ERROR_SUCCESS;
+
+  // Apply, attributing stages to this operator
+  CeedCall(CeedOperatorStatsBegin(op, &op_prev, &level_prev, &start_ns));
+  ierr = CeedOperatorApply_Core(op, in, out, request);
+  CeedCall(CeedOperatorStatsEnd(op, op_prev, level_prev, start_ns));
+  return ierr;
+}
+
 /**
   @brief Apply `CeedOperator` to a `CeedVector` and add result to output `CeedVector`.
 
@@ -2226,37 +3413,126 @@ int CeedOperatorApply(CeedOperator op, CeedVector in, CeedVector out, CeedReques
   @param[in]  op      `CeedOperator` to apply
   @param[in]  in      `CeedVector` containing input state or @ref CEED_VECTOR_NONE if there are no active inputs
   @param[out] out     `CeedVector` to sum in result of applying operator (must be distinct from `in`) or @ref CEED_VECTOR_NONE if there are no active outputs
-  @param[in]  request Address of @ref CeedRequest for non-blocking completion, else @ref CEED_REQUEST_IMMEDIATE
+  @param[in]  request Address of @ref CeedRequest for non-blocking completion, @ref CEED_REQUEST_ORDERED for ordered completion,
+                      else @ref CEED_REQUEST_IMMEDIATE
 
   @return An error code: 0 - success, otherwise - failure
 
   @ref User
 **/
 int CeedOperatorApplyAdd(CeedOperator op, CeedVector in, CeedVector out, CeedRequest *request) {
-  bool is_composite;
+  int          ierr, level_prev;
+  bool         is_submitted;
+  CeedSize     start_ns;
+  CeedOperator op_prev;
+
+  CeedCall(CeedOperatorCheckReady(op));
+
+  // Submit to host task queue
+  CeedCall(CeedRequestSubmit(CeedOperatorReturnCeed(op), CeedOperatorApplyAddTask, op, in, out, request, &is_submitted));
+  if (is_submitted) return CEED_ERROR_SUCCESS;
+
+  // Apply, attributing stages to this operator
+  CeedCall(CeedOperatorStatsBegin(op, &op_prev, &level_prev, &start_ns));
+  ierr = CeedOperatorApplyAdd_Core(op, in, out, request);
+  CeedCall(CeedOperatorStatsEnd(op, op_prev, level_prev, start_ns));
+  return ierr;
+}
+
+/**
+  @brief Apply `CeedOperator` to several `CeedVector`.
+
+  This computes the action of the operator on each of the specified (active) inputs, yielding the corresponding (active) outputs.
+  Backends may process all of the vectors in a single pass over the elements, so passive inputs, such as quadrature point data, and restriction offsets are read once for all of the vectors.
+  All inputs and outputs must be specified using @ref CeedOperatorSetField(), and the `CeedOperator` may not have passive outputs.
+
+  Note: Calling this function asserts that setup is complete and sets the `CeedOperator` as immutable.
+
+  @param[in]  op       `CeedOperator` to apply
+  @param[in]  num_vecs Number of input and output vectors
+  @param[in]  in       Array of `num_vecs` `CeedVector` containing input states
+  @param[out] out      Array of `num_vecs` `CeedVector` to store results of applying operator (must be distinct from `in`)
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedOperatorApplyMulti(CeedOperator op, CeedInt num_vecs, CeedVector *in, CeedVector *out) {
+  CeedCall(CeedOperatorCheckReady(op));
+  CeedCall(CeedRequestSynchronize(CeedOperatorReturnCeed(op)));
+
+  // Zero all output vectors
+  for (CeedInt r = 0; r < num_vecs; r++) {
+    if (out[r] != CEED_VECTOR_NONE) CeedCall(CeedVectorSetValue(out[r], 0.0));
+  }
+  CeedCall(CeedOperatorApplyAddMulti(op, num_vecs, in, out));
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Apply `CeedOperator` to several `CeedVector` and add results to output `CeedVector`.
+
+  This computes the action of the operator on each of the specified (active) inputs, yielding the corresponding (active) outputs.
+  All inputs and outputs must be specified using @ref CeedOperatorSetField(), and the `CeedOperator` may not have passive outputs.
+
+  @param[in]  op       `CeedOperator` to apply
+  @param[in]  num_vecs Number of input and output vectors
+  @param[in]  in       Array of `num_vecs` `CeedVector` containing input states
+  @param[out] out      Array of `num_vecs` `CeedVector` to sum in results of applying operator (must be distinct from `in`)
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedOperatorApplyAddMulti(CeedOperator op, CeedInt num_vecs, CeedVector *in, CeedVector *out) {
+  int          ierr = CEED_ERROR_SUCCESS, level_prev;
+  bool         is_composite;
+  CeedSize     start_ns;
+  CeedOperator op_prev;
 
   CeedCall(CeedOperatorCheckReady(op));
+  CeedCall(CeedRequestSynchronize(CeedOperatorReturnCeed(op)));
+  CeedCheck(num_vecs >= 0, CeedOperatorReturnCeed(op), CEED_ERROR_DIMENSION, "Number of vectors must be non-negative");
 
   CeedCall(CeedOperatorIsComposite(op, &is_composite));
   if (is_composite) {
     // Composite Operator
-    if (op->ApplyAddComposite) {
-      CeedCall(op->ApplyAddComposite(op, in, out, request));
-    } else {
-      CeedInt       num_suboperators;
-      CeedOperator *sub_operators;
+    CeedInt       num_suboperators;
+    CeedOperator *sub_operators;
 
-      CeedCall(CeedCompositeOperatorGetNumSub(op, &num_suboperators));
-      CeedCall(CeedCompositeOperatorGetSubList(op, &sub_operators));
-      for (CeedInt i = 0; i < num_suboperators; i++) {
-        CeedCall(CeedOperatorApplyAdd(sub_operators[i], in, out, request));
-      }
-    }
-  } else if (op->num_elem > 0) {
+    CeedCall(CeedCompositeOperatorGetNumSub(op, &num_suboperators));
+    CeedCall(CeedCompositeOperatorGetSubList(op, &sub_operators));
+    CeedCall(CeedOperatorStatsBegin(op, &op_prev, &level_prev, &start_ns));
+    for (CeedInt i = 0; i < num_suboperators && !ierr; i++) ierr = CeedOperatorApplyAddMulti(sub_operators[i], num_vecs, in, out);
+    CeedCall(CeedOperatorStatsEnd(op, op_prev, level_prev, start_ns));
+  } else {
     // Standard Operator
-    CeedCall(op->ApplyAdd(op, in, out, request));
+    CeedInt            num_output_fields;
+    CeedOperatorField *output_fields;
+
+    // Passive outputs would be summed into once per vector
+    CeedCall(CeedOperatorGetFields(op, NULL, NULL, &num_output_fields, &output_fields));
+    for (CeedInt i = 0; i < num_output_fields; i++) {
+      bool       is_active;
+      CeedVector vec;
+
+      CeedCall(CeedOperatorFieldGetVector(output_fields[i], &vec));
+      is_active = vec == CEED_VECTOR_ACTIVE;
+      CeedCall(CeedVectorDestroy(&vec));
+      CeedCheck(is_active, CeedOperatorReturnCeed(op), CEED_ERROR_INCOMPATIBLE, "Cannot apply CeedOperator with passive outputs to several vectors");
+    }
+    if (op->num_elem == 0 || num_vecs == 0) return CEED_ERROR_SUCCESS;
+
+    // Apply, attributing stages to this operator
+    CeedCall(CeedOperatorStatsBegin(op, &op_prev, &level_prev, &start_ns));
+    if (op->ApplyAddMulti) {
+      ierr = op->ApplyAddMulti(op, num_vecs, in, out);
+    } else {
+      for (CeedInt r = 0; r < num_vecs && !ierr; r++) ierr = op->ApplyAdd(op, in[r], out[r], CEED_REQUEST_IMMEDIATE);
+    }
+    CeedCall(CeedOperatorStatsEnd(op, op_prev, level_prev, start_ns));
   }
-  return CEED_ERROR_SUCCESS;
+  return ierr;
 }
 
 /**
@@ -2302,6 +3578,8 @@ int CeedOperatorDestroy(CeedOperator *op) {
     *op = NULL;
     return CEED_ERROR_SUCCESS;
   }
+  // Complete queued work that may use this operator
+  CeedCall(CeedRequestSynchronize((*op)->ceed));
   // Backend destroy
   if ((*op)->Destroy) {
     CeedCall((*op)->Destroy(*op));
@@ -2343,6 +3621,15 @@ int CeedOperatorDestroy(CeedOperator *op) {
   CeedCall(CeedElemRestrictionDestroy(&(*op)->first_points_rstr));
   // Destroy assembly data (must happen before destroying sub_operators)
   CeedCall(CeedOperatorAssemblyDataStrip(*op));
+  CeedCall(CeedFree(&(*op)->csr_row_offsets));
+  CeedCall(CeedFree(&(*op)->csr_cols));
+  CeedCall(CeedFree(&(*op)->sub_group_offsets));
+  CeedCall(CeedFree(&(*op)->sub_group_indices));
+  CeedCall(CeedFree(&(*op)->sub_threads));
+  CeedCall(CeedFree(&(*op)->sub_output_offsets));
+  CeedCall(CeedFree(&(*op)->sub_output_indices));
+  CeedCall(CeedCompositeOperatorDestroyConcurrentBuffers(*op));
+  CeedCall(CeedFree(&(*op)->stats));
   // Destroy sub_operators
   for (CeedInt i = 0; i < (*op)->num_suboperators; i++) {
     if ((*op)->sub_operators[i]) {
@@ -12,6 +12,7 @@
 #include <math.h>
 #include <stdbool.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 
 /// @file
@@ -203,9 +204,112 @@ static int CeedOperatorCreateFallback(CeedOperator op) {
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Accumulate element diagonals or point block diagonals of `B^T D B` for a range of elements
+
+  The assembled `CeedQFunction` data for element `e` starts at `assembled_qf[(e - elem_start) * layout_qf[2]]`.
+
+  @param[in]     data           `CeedOperatorAssemblyData` for the `CeedOperator`
+  @param[in]     b_in           Index of the active input basis
+  @param[in]     b_out          Index of the matching active output basis
+  @param[in]     is_point_block Boolean flag to assemble diagonal or point block diagonal
+  @param[in]     identity       Identity matrix for @ref CEED_EVAL_NONE, or `NULL` if not needed
+  @param[in]     elem_start     First element to accumulate
+  @param[in]     elem_end       One past the last element to accumulate
+  @param[in]     assembled_qf   Assembled `CeedQFunction` data for the element range
+  @param[in]     layout_qf      E-vector layout of `assembled_qf`
+  @param[in,out] elem_diag      Element diagonal array to accumulate into
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedSingleOperatorLinearAssembleAddDiagonalElements(CeedOperatorAssemblyData data, CeedInt b_in, CeedInt b_out, const bool is_point_block,
+                                                               const CeedScalar *identity, CeedSize elem_start, CeedSize elem_end,
+                                                               const CeedScalar *assembled_qf, const CeedInt layout_qf[3], CeedScalar *elem_diag) {
+  const CeedEvalMode **eval_modes_in, **eval_modes_out;
+  CeedInt              num_nodes, num_qpts, num_comp, *num_eval_modes_in, *num_eval_modes_out;
+  CeedSize           **eval_mode_offsets_in, **eval_mode_offsets_out, num_output_components;
+  CeedBasis           *active_bases_in, *active_bases_out;
+
+  CeedCall(CeedOperatorAssemblyDataGetEvalModes(data, NULL, &num_eval_modes_in, &eval_modes_in, &eval_mode_offsets_in, NULL, &num_eval_modes_out,
+                                                &eval_modes_out, &eval_mode_offsets_out, &num_output_components));
+  CeedCall(CeedOperatorAssemblyDataGetBases(data, NULL, &active_bases_in, NULL, NULL, &active_bases_out, NULL));
+  CeedCall(CeedBasisGetNumNodes(active_bases_in[b_in], &num_nodes));
+  CeedCall(CeedBasisGetNumComponents(active_bases_in[b_in], &num_comp));
+  if (active_bases_in[b_in] == CEED_BASIS_NONE) num_qpts = num_nodes;
+  else CeedCall(CeedBasisGetNumQuadraturePoints(active_bases_in[b_in], &num_qpts));
+
+  // Each element
+  for (CeedSize e = elem_start; e < elem_end; e++) {
+    // Each basis eval mode pair
+    CeedInt           d_out              = 0, q_comp_out;
+    CeedEvalMode      eval_mode_out_prev = CEED_EVAL_NONE;
+    const CeedScalar *qf_elem            = &assembled_qf[(e - elem_start) * layout_qf[2]];
+
+    for (CeedInt e_out = 0; e_out < num_eval_modes_out[b_out]; e_out++) {
+      CeedInt           d_in              = 0, q_comp_in;
+      const CeedScalar *B_t               = NULL;
+      CeedEvalMode      eval_mode_in_prev = CEED_EVAL_NONE;
+
+      CeedCall(CeedOperatorGetBasisPointer(active_bases_out[b_out], eval_modes_out[b_out][e_out], identity, &B_t));
+      CeedCall(CeedBasisGetNumQuadratureComponents(active_bases_out[b_out], eval_modes_out[b_out][e_out], &q_comp_out));
+      if (q_comp_out > 1) {
+        if (e_out == 0 || eval_modes_out[b_out][e_out] != eval_mode_out_prev) d_out = 0;
+        else B_t = &B_t[(++d_out) * num_qpts * num_nodes];
+      }
+      eval_mode_out_prev = eval_modes_out[b_out][e_out];
+
+      for (CeedInt e_in = 0; e_in < num_eval_modes_in[b_in]; e_in++) {
+        const CeedScalar *B = NULL;
+
+        CeedCall(CeedOperatorGetBasisPointer(active_bases_in[b_in], eval_modes_in[b_in][e_in], identity, &B));
+        CeedCall(CeedBasisGetNumQuadratureComponents(active_bases_in[b_in], eval_modes_in[b_in][e_in], &q_comp_in));
+        if (q_comp_in > 1) {
+          if (e_in == 0 || eval_modes_in[b_in][e_in] != eval_mode_in_prev) d_in = 0;
+          else B = &B[(++d_in) * num_qpts * num_nodes];
+        }
+        eval_mode_in_prev = eval_modes_in[b_in][e_in];
+
+        // Each component
+        for (CeedInt c_out = 0; c_out < num_comp; c_out++) {
+          // Each qpt/node pair
+          for (CeedInt q = 0; q < num_qpts; q++) {
+            if (is_point_block) {
+              // Point Block Diagonal
+              for (CeedInt c_in = 0; c_in < num_comp; c_in++) {
+                const CeedSize c_offset =
+                    (eval_mode_offsets_in[b_in][e_in] + c_in) * num_output_components + eval_mode_offsets_out[b_out][e_out] + c_out;
+                const CeedScalar qf_value = qf_elem[q * layout_qf[0] + c_offset * layout_qf[1]];
+
+                for (CeedInt n = 0; n < num_nodes; n++) {
+                  elem_diag[((e * num_comp + c_out) * num_comp + c_in) * num_nodes + n] += B_t[q * num_nodes + n] * qf_value * B[q * num_nodes + n];
+                }
+              }
+            } else {
+              // Diagonal Only
+              const CeedInt c_offset =
+                  (eval_mode_offsets_in[b_in][e_in] + c_out) * num_output_components + eval_mode_offsets_out[b_out][e_out] + c_out;
+              const CeedScalar qf_value = qf_elem[q * layout_qf[0] + c_offset * layout_qf[1]];
+
+              for (CeedInt n = 0; n < num_nodes; n++) {
+                elem_diag[(e * num_comp + c_out) * num_nodes + n] += B_t[q * num_nodes + n] * qf_value * B[q * num_nodes + n];
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
 /**
   @brief Core logic for assembling operator diagonal or point block diagonal
 
+  If the backend can linearize the `CeedQFunction` for a range of elements and the assembled `CeedQFunction` is not being reused, the linearization is
+    computed and contracted with the bases one chunk of elements at a time, so the full assembled `CeedQFunction` is never stored.
+
   @param[in]  op             `CeedOperator` to assemble diagonal or point block diagonal
   @param[in]  request        Address of @ref CeedRequest for non-blocking completion, else @ref CEED_REQUEST_IMMEDIATE
   @param[in]  is_point_block Boolean flag to assemble diagonal or point block diagonal
@@ -217,28 +321,23 @@ static int CeedOperatorCreateFallback(CeedOperator op) {
 **/
 static inline int CeedSingleOperatorLinearAssembleAddDiagonal_Mesh(CeedOperator op, CeedRequest *request, const bool is_point_block,
                                                                    CeedVector assembled) {
-  bool is_composite;
+  bool                      is_composite, is_streaming;
+  CeedQFunctionAssemblyData qf_data;
 
   CeedCall(CeedOperatorIsComposite(op, &is_composite));
   CeedCheck(!is_composite, CeedOperatorReturnCeed(op), CEED_ERROR_UNSUPPORTED, "Composite operator not supported");
-
-  // Assemble QFunction
-  CeedInt             layout_qf[3];
-  const CeedScalar   *assembled_qf_array;
-  CeedVector          assembled_qf        = NULL;
-  CeedElemRestriction assembled_elem_rstr = NULL;
-
-  CeedCall(CeedOperatorLinearAssembleQFunctionBuildOrUpdate(op, &assembled_qf, &assembled_elem_rstr, request));
-  CeedCall(CeedElemRestrictionGetELayout(assembled_elem_rstr, layout_qf));
-  CeedCall(CeedElemRestrictionDestroy(&assembled_elem_rstr));
-  CeedCall(CeedVectorGetArrayRead(assembled_qf, CEED_MEM_HOST, &assembled_qf_array));
+  CeedCall(CeedOperatorGetQFunctionAssemblyData(op, &qf_data));
+  is_streaming = op->LinearAssembleQFunctionElements && !qf_data->reuse_data;
 
   // Get assembly data
   const CeedEvalMode     **eval_modes_in, **eval_modes_out;
-  CeedInt                  num_active_bases_in, *num_eval_modes_in, num_active_bases_out, *num_eval_modes_out;
+  CeedInt                  num_active_bases_in, *num_eval_modes_in, num_active_bases_out, *num_eval_modes_out, num_pairs = 0;
+  CeedInt                 *pair_b_in, *pair_b_out;
   CeedSize               **eval_mode_offsets_in, **eval_mode_offsets_out, num_output_components;
+  CeedScalar             **elem_diag_arrays, **identities;
+  CeedVector              *elem_diags;
   CeedBasis               *active_bases_in, *active_bases_out;
-  CeedElemRestriction     *active_elem_rstrs_in, *active_elem_rstrs_out;
+  CeedElemRestriction     *active_elem_rstrs_in, *active_elem_rstrs_out, *diag_elem_rstrs;
   CeedOperatorAssemblyData data;
 
   CeedCall(CeedOperatorGetOperatorAssemblyData(op, &data));
@@ -247,14 +346,21 @@ static inline int CeedSingleOperatorLinearAssembleAddDiagonal_Mesh(CeedOperator
                                                 &num_output_components));
   CeedCall(CeedOperatorAssemblyDataGetBases(data, NULL, &active_bases_in, NULL, NULL, &active_bases_out, NULL));
   CeedCall(CeedOperatorAssemblyDataGetElemRestrictions(data, NULL, &active_elem_rstrs_in, NULL, &active_elem_rstrs_out));
+  {
+    const CeedInt max_pairs = CeedIntMin(num_active_bases_in, num_active_bases_out);
+
+    CeedCall(CeedCalloc(max_pairs, &pair_b_in));
+    CeedCall(CeedCalloc(max_pairs, &pair_b_out));
+    CeedCall(CeedCalloc(max_pairs, &elem_diag_arrays));
+    CeedCall(CeedCalloc(max_pairs, &identities));
+    CeedCall(CeedCalloc(max_pairs, &elem_diags));
+    CeedCall(CeedCalloc(max_pairs, &diag_elem_rstrs));
+  }
 
   // Loop over all active bases (find matching input/output pairs)
   for (CeedInt b = 0; b < CeedIntMin(num_active_bases_in, num_active_bases_out); b++) {
-    CeedInt             b_in, b_out, num_elem, num_nodes, num_qpts, num_comp;
-    bool                has_eval_none = false;
-    CeedScalar         *elem_diag_array, *identity = NULL;
-    CeedVector          elem_diag;
-    CeedElemRestriction diag_elem_rstr;
+    CeedInt b_in, b_out, num_nodes, num_qpts;
+    bool    has_eval_none = false;
 
     if (num_active_bases_in <= num_active_bases_out) {
       b_in = b;
@@ -279,27 +385,25 @@ static inline int CeedSingleOperatorLinearAssembleAddDiagonal_Mesh(CeedOperator
     }
     CeedCheck(active_elem_rstrs_in[b_in] == active_elem_rstrs_out[b_out], CeedOperatorReturnCeed(op), CEED_ERROR_UNSUPPORTED,
               "Cannot assemble operator diagonal with different input and output active element restrictions");
+    pair_b_in[num_pairs]  = b_in;
+    pair_b_out[num_pairs] = b_out;
 
     // Assemble point block diagonal restriction, if needed
     if (is_point_block) {
-      CeedCall(CeedOperatorCreateActivePointBlockRestriction(active_elem_rstrs_in[b_in], &diag_elem_rstr));
+      CeedCall(CeedOperatorCreateActivePointBlockRestriction(active_elem_rstrs_in[b_in], &diag_elem_rstrs[num_pairs]));
     } else {
-      CeedCall(CeedElemRestrictionCreateUnsignedCopy(active_elem_rstrs_in[b_in], &diag_elem_rstr));
+      CeedCall(CeedElemRestrictionCreateUnsignedCopy(active_elem_rstrs_in[b_in], &diag_elem_rstrs[num_pairs]));
     }
 
     // Create diagonal vector
-    CeedCall(CeedElemRestrictionCreateVector(diag_elem_rstr, NULL, &elem_diag));
+    CeedCall(CeedElemRestrictionCreateVector(diag_elem_rstrs[num_pairs], NULL, &elem_diags[num_pairs]));
+    CeedCall(CeedVectorSetValue(elem_diags[num_pairs], 0.0));
+    CeedCall(CeedVectorGetArray(elem_diags[num_pairs], CEED_MEM_HOST, &elem_diag_arrays[num_pairs]));
 
-    // Assemble element operator diagonals
-    CeedCall(CeedVectorSetValue(elem_diag, 0.0));
-    CeedCall(CeedVectorGetArray(elem_diag, CEED_MEM_HOST, &elem_diag_array));
-    CeedCall(CeedElemRestrictionGetNumElements(diag_elem_rstr, &num_elem));
+    // Construct identity matrix for basis if required
     CeedCall(CeedBasisGetNumNodes(active_bases_in[b_in], &num_nodes));
-    CeedCall(CeedBasisGetNumComponents(active_bases_in[b_in], &num_comp));
     if (active_bases_in[b_in] == CEED_BASIS_NONE) num_qpts = num_nodes;
     else CeedCall(CeedBasisGetNumQuadraturePoints(active_bases_in[b_in], &num_qpts));
-
-    // Construct identity matrix for basis if required
     for (CeedInt i = 0; i < num_eval_modes_in[b_in]; i++) {
       has_eval_none = has_eval_none || (eval_modes_in[b_in][i] == CEED_EVAL_NONE);
     }
@@ -307,84 +411,81 @@ static inline int CeedSingleOperatorLinearAssembleAddDiagonal_Mesh(CeedOperator
       has_eval_none = has_eval_none || (eval_modes_out[b_out][i] == CEED_EVAL_NONE);
     }
     if (has_eval_none) {
-      CeedCall(CeedCalloc(num_qpts * num_nodes, &identity));
-      for (CeedInt i = 0; i < (num_nodes < num_qpts ? num_nodes : num_qpts); i++) identity[i * num_nodes + i] = 1.0;
+      CeedCall(CeedCalloc(num_qpts * num_nodes, &identities[num_pairs]));
+      for (CeedInt i = 0; i < (num_nodes < num_qpts ? num_nodes : num_qpts); i++) identities[num_pairs][i * num_nodes + i] = 1.0;
     }
+    num_pairs++;
+  }
 
-    // Compute the diagonal of B^T D B
-    // Each element
-    for (CeedSize e = 0; e < num_elem; e++) {
-      // Each basis eval mode pair
-      CeedInt      d_out              = 0, q_comp_out;
-      CeedEvalMode eval_mode_out_prev = CEED_EVAL_NONE;
-
-      for (CeedInt e_out = 0; e_out < num_eval_modes_out[b_out]; e_out++) {
-        CeedInt           d_in              = 0, q_comp_in;
-        const CeedScalar *B_t               = NULL;
-        CeedEvalMode      eval_mode_in_prev = CEED_EVAL_NONE;
-
-        CeedCall(CeedOperatorGetBasisPointer(active_bases_out[b_out], eval_modes_out[b_out][e_out], identity, &B_t));
-        CeedCall(CeedBasisGetNumQuadratureComponents(active_bases_out[b_out], eval_modes_out[b_out][e_out], &q_comp_out));
-        if (q_comp_out > 1) {
-          if (e_out == 0 || eval_modes_out[b_out][e_out] != eval_mode_out_prev) d_out = 0;
-          else B_t = &B_t[(++d_out) * num_qpts * num_nodes];
-        }
-        eval_mode_out_prev = eval_modes_out[b_out][e_out];
-
-        for (CeedInt e_in = 0; e_in < num_eval_modes_in[b_in]; e_in++) {
-          const CeedScalar *B = NULL;
+  // Compute the diagonal of B^T D B
+  if (is_streaming) {
+    // Linearize the QFunction one chunk of elements at a time, the chunk size is a multiple of the common CPU backend block sizes
+    const CeedInt     chunk_size = 64;
+    CeedInt           num_elem, num_qpts, num_input_components = 0, layout_qf[3];
+    const CeedScalar *chunk_qf_array;
+    CeedVector        chunk_qf;
 
-          CeedCall(CeedOperatorGetBasisPointer(active_bases_in[b_in], eval_modes_in[b_in][e_in], identity, &B));
-          CeedCall(CeedBasisGetNumQuadratureComponents(active_bases_in[b_in], eval_modes_in[b_in][e_in], &q_comp_in));
-          if (q_comp_in > 1) {
-            if (e_in == 0 || eval_modes_in[b_in][e_in] != eval_mode_in_prev) d_in = 0;
-            else B = &B[(++d_in) * num_qpts * num_nodes];
-          }
-          eval_mode_in_prev = eval_modes_in[b_in][e_in];
-
-          // Each component
-          for (CeedInt c_out = 0; c_out < num_comp; c_out++) {
-            // Each qpt/node pair
-            for (CeedInt q = 0; q < num_qpts; q++) {
-              if (is_point_block) {
-                // Point Block Diagonal
-                for (CeedInt c_in = 0; c_in < num_comp; c_in++) {
-                  const CeedSize c_offset =
-                      (eval_mode_offsets_in[b_in][e_in] + c_in) * num_output_components + eval_mode_offsets_out[b_out][e_out] + c_out;
-                  const CeedScalar qf_value = assembled_qf_array[q * layout_qf[0] + c_offset * layout_qf[1] + e * layout_qf[2]];
-
-                  for (CeedInt n = 0; n < num_nodes; n++) {
-                    elem_diag_array[((e * num_comp + c_out) * num_comp + c_in) * num_nodes + n] +=
-                        B_t[q * num_nodes + n] * qf_value * B[q * num_nodes + n];
-                  }
-                }
-              } else {
-                // Diagonal Only
-                const CeedInt c_offset =
-                    (eval_mode_offsets_in[b_in][e_in] + c_out) * num_output_components + eval_mode_offsets_out[b_out][e_out] + c_out;
-                const CeedScalar qf_value = assembled_qf_array[q * layout_qf[0] + c_offset * layout_qf[1] + e * layout_qf[2]];
+    for (CeedInt b = 0; b < num_active_bases_in; b++) {
+      CeedInt num_comp;
 
-                for (CeedInt n = 0; n < num_nodes; n++) {
-                  elem_diag_array[(e * num_comp + c_out) * num_nodes + n] += B_t[q * num_nodes + n] * qf_value * B[q * num_nodes + n];
-                }
-              }
-            }
-          }
-        }
+      if (num_eval_modes_in[b] == 0) continue;
+      CeedCall(CeedBasisGetNumComponents(active_bases_in[b], &num_comp));
+      num_input_components = CeedIntMax(num_input_components, (CeedInt)eval_mode_offsets_in[b][num_eval_modes_in[b] - 1] + num_comp);
+    }
+    CeedCall(CeedOperatorGetNumElements(op, &num_elem));
+    CeedCall(CeedOperatorGetNumQuadraturePoints(op, &num_qpts));
+    layout_qf[0] = 1;
+    layout_qf[1] = num_qpts;
+    layout_qf[2] = num_input_components * num_output_components * num_qpts;
+    CeedCall(CeedVectorCreate(CeedOperatorReturnCeed(op), (CeedSize)CeedIntMin(chunk_size, num_elem) * layout_qf[2], &chunk_qf));
+    for (CeedInt elem_start = 0; elem_start < num_elem; elem_start += chunk_size) {
+      const CeedInt elem_end = CeedIntMin(elem_start + chunk_size, num_elem);
+
+      CeedCall(op->LinearAssembleQFunctionElements(op, elem_start, elem_end, chunk_qf, request));
+      CeedCall(CeedVectorGetArrayRead(chunk_qf, CEED_MEM_HOST, &chunk_qf_array));
+      for (CeedInt p = 0; p < num_pairs; p++) {
+        CeedCall(CeedSingleOperatorLinearAssembleAddDiagonalElements(data, pair_b_in[p], pair_b_out[p], is_point_block, identities[p], elem_start,
+                                                                     elem_end, chunk_qf_array, layout_qf, elem_diag_arrays[p]));
       }
+      CeedCall(CeedVectorRestoreArrayRead(chunk_qf, &chunk_qf_array));
+    }
+    CeedCall(CeedVectorDestroy(&chunk_qf));
+  } else {
+    // Assemble QFunction
+    CeedInt             num_elem, layout_qf[3];
+    const CeedScalar   *assembled_qf_array;
+    CeedVector          assembled_qf        = NULL;
+    CeedElemRestriction assembled_elem_rstr = NULL;
+
+    CeedCall(CeedOperatorLinearAssembleQFunctionBuildOrUpdate(op, &assembled_qf, &assembled_elem_rstr, request));
+    CeedCall(CeedElemRestrictionGetELayout(assembled_elem_rstr, layout_qf));
+    CeedCall(CeedElemRestrictionDestroy(&assembled_elem_rstr));
+    CeedCall(CeedVectorGetArrayRead(assembled_qf, CEED_MEM_HOST, &assembled_qf_array));
+    for (CeedInt p = 0; p < num_pairs; p++) {
+      CeedCall(CeedElemRestrictionGetNumElements(diag_elem_rstrs[p], &num_elem));
+      CeedCall(CeedSingleOperatorLinearAssembleAddDiagonalElements(data, pair_b_in[p], pair_b_out[p], is_point_block, identities[p], 0, num_elem,
+                                                                   assembled_qf_array, layout_qf, elem_diag_arrays[p]));
     }
-    CeedCall(CeedVectorRestoreArray(elem_diag, &elem_diag_array));
+    CeedCall(CeedVectorRestoreArrayRead(assembled_qf, &assembled_qf_array));
+    CeedCall(CeedVectorDestroy(&assembled_qf));
+  }
 
-    // Assemble local operator diagonal
-    CeedCall(CeedElemRestrictionApply(diag_elem_rstr, CEED_TRANSPOSE, elem_diag, assembled, request));
+  // Assemble local operator diagonal
+  for (CeedInt p = 0; p < num_pairs; p++) {
+    CeedCall(CeedVectorRestoreArray(elem_diags[p], &elem_diag_arrays[p]));
+    CeedCall(CeedElemRestrictionApply(diag_elem_rstrs[p], CEED_TRANSPOSE, elem_diags[p], assembled, request));
 
     // Cleanup
-    CeedCall(CeedElemRestrictionDestroy(&diag_elem_rstr));
-    CeedCall(CeedVectorDestroy(&elem_diag));
-    CeedCall(CeedFree(&identity));
-  }
-  CeedCall(CeedVectorRestoreArrayRead(assembled_qf, &assembled_qf_array));
-  CeedCall(CeedVectorDestroy(&assembled_qf));
+    CeedCall(CeedElemRestrictionDestroy(&diag_elem_rstrs[p]));
+    CeedCall(CeedVectorDestroy(&elem_diags[p]));
+    CeedCall(CeedFree(&identities[p]));
+  }
+  CeedCall(CeedFree(&pair_b_in));
+  CeedCall(CeedFree(&pair_b_out));
+  CeedCall(CeedFree(&elem_diag_arrays));
+  CeedCall(CeedFree(&identities));
+  CeedCall(CeedFree(&elem_diags));
+  CeedCall(CeedFree(&diag_elem_rstrs));
   return CEED_ERROR_SUCCESS;
 }
 
@@ -439,6 +540,40 @@ static inline int CeedCompositeOperatorLinearAssembleAddDiagonal(CeedOperator op
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Get the L-vector index of each E-vector entry of an active `CeedElemRestriction`.
+
+  @param[in]  rstr      `CeedElemRestriction` to map
+  @param[in]  num_nodes Length of the L-vector for `rstr`
+  @param[out] elem_dof  `CeedVector` holding the L-vector index of each E-vector entry
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedElemRestrictionGetElemDofs(CeedElemRestriction rstr, CeedSize num_nodes, CeedVector *elem_dof) {
+  Ceed                ceed;
+  CeedSize            e_size;
+  CeedScalar         *array;
+  CeedVector          index_vec;
+  CeedElemRestriction index_elem_rstr;
+
+  CeedCall(CeedElemRestrictionGetCeed(rstr, &ceed));
+  CeedCall(CeedElemRestrictionGetEVectorSize(rstr, &e_size));
+  CeedCall(CeedVectorCreate(ceed, num_nodes, &index_vec));
+  CeedCall(CeedVectorGetArrayWrite(index_vec, CEED_MEM_HOST, &array));
+  for (CeedSize i = 0; i < num_nodes; i++) array[i] = i;
+  CeedCall(CeedVectorRestoreArray(index_vec, &array));
+  CeedCall(CeedVectorCreate(ceed, e_size, elem_dof));
+  CeedCall(CeedVectorSetValue(*elem_dof, 0.0));
+  CeedCall(CeedElemRestrictionCreateUnorientedCopy(rstr, &index_elem_rstr));
+  CeedCall(CeedElemRestrictionApply(index_elem_rstr, CEED_NOTRANSPOSE, index_vec, *elem_dof, CEED_REQUEST_IMMEDIATE));
+  CeedCall(CeedVectorDestroy(&index_vec));
+  CeedCall(CeedElemRestrictionDestroy(&index_elem_rstr));
+  CeedCall(CeedDestroy(&ceed));
+  return CEED_ERROR_SUCCESS;
+}
+
 /**
   @brief Build nonzero pattern for non-composite CeedOperator`.
 
@@ -459,10 +594,9 @@ static int CeedSingleOperatorAssembleSymbolic(CeedOperator op, CeedInt offset, C
   CeedSize            num_nodes_in, num_nodes_out, local_num_entries, count = 0;
   CeedInt             num_elem_in, elem_size_in, num_comp_in, layout_er_in[3];
   CeedInt             num_elem_out, elem_size_out, num_comp_out, layout_er_out[3];
-  CeedScalar         *array;
   const CeedScalar   *elem_dof_a_in, *elem_dof_a_out;
-  CeedVector          index_vec_in, index_vec_out, elem_dof_in, elem_dof_out;
-  CeedElemRestriction elem_rstr_in, elem_rstr_out, index_elem_rstr_in, index_elem_rstr_out;
+  CeedVector          elem_dof_in, elem_dof_out;
+  CeedElemRestriction elem_rstr_in, elem_rstr_out;
 
   CeedCall(CeedOperatorIsComposite(op, &is_composite));
   CeedCall(CeedOperatorGetCeed(op, &ceed));
@@ -476,17 +610,8 @@ static int CeedSingleOperatorAssembleSymbolic(CeedOperator op, CeedInt offset, C
   CeedCall(CeedElemRestrictionGetELayout(elem_rstr_in, layout_er_in));
 
   // Determine elem_dof relation for input
-  CeedCall(CeedVectorCreate(ceed, num_nodes_in, &index_vec_in));
-  CeedCall(CeedVectorGetArrayWrite(index_vec_in, CEED_MEM_HOST, &array));
-  for (CeedSize i = 0; i < num_nodes_in; i++) array[i] = i;
-  CeedCall(CeedVectorRestoreArray(index_vec_in, &array));
-  CeedCall(CeedVectorCreate(ceed, num_elem_in * elem_size_in * num_comp_in, &elem_dof_in));
-  CeedCall(CeedVectorSetValue(elem_dof_in, 0.0));
-  CeedCall(CeedElemRestrictionCreateUnorientedCopy(elem_rstr_in, &index_elem_rstr_in));
-  CeedCall(CeedElemRestrictionApply(index_elem_rstr_in, CEED_NOTRANSPOSE, index_vec_in, elem_dof_in, CEED_REQUEST_IMMEDIATE));
+  CeedCall(CeedElemRestrictionGetElemDofs(elem_rstr_in, num_nodes_in, &elem_dof_in));
   CeedCall(CeedVectorGetArrayRead(elem_dof_in, CEED_MEM_HOST, &elem_dof_a_in));
-  CeedCall(CeedVectorDestroy(&index_vec_in));
-  CeedCall(CeedElemRestrictionDestroy(&index_elem_rstr_in));
 
   if (elem_rstr_in != elem_rstr_out) {
     CeedCall(CeedElemRestrictionGetNumElements(elem_rstr_out, &num_elem_out));
@@ -499,17 +624,8 @@ static int CeedSingleOperatorAssembleSymbolic(CeedOperator op, CeedInt offset, C
     CeedCall(CeedElemRestrictionGetELayout(elem_rstr_out, layout_er_out));
 
     // Determine elem_dof relation for output
-    CeedCall(CeedVectorCreate(ceed, num_nodes_out, &index_vec_out));
-    CeedCall(CeedVectorGetArrayWrite(index_vec_out, CEED_MEM_HOST, &array));
-    for (CeedSize i = 0; i < num_nodes_out; i++) array[i] = i;
-    CeedCall(CeedVectorRestoreArray(index_vec_out, &array));
-    CeedCall(CeedVectorCreate(ceed, num_elem_out * elem_size_out * num_comp_out, &elem_dof_out));
-    CeedCall(CeedVectorSetValue(elem_dof_out, 0.0));
-    CeedCall(CeedElemRestrictionCreateUnorientedCopy(elem_rstr_out, &index_elem_rstr_out));
-    CeedCall(CeedElemRestrictionApply(index_elem_rstr_out, CEED_NOTRANSPOSE, index_vec_out, elem_dof_out, CEED_REQUEST_IMMEDIATE));
+    CeedCall(CeedElemRestrictionGetElemDofs(elem_rstr_out, num_nodes_out, &elem_dof_out));
     CeedCall(CeedVectorGetArrayRead(elem_dof_out, CEED_MEM_HOST, &elem_dof_a_out));
-    CeedCall(CeedVectorDestroy(&index_vec_out));
-    CeedCall(CeedElemRestrictionDestroy(&index_elem_rstr_out));
   } else {
     num_elem_out     = num_elem_in;
     elem_size_out    = elem_size_in;
@@ -553,51 +669,281 @@ static int CeedSingleOperatorAssembleSymbolic(CeedOperator op, CeedInt offset, C
   return CEED_ERROR_SUCCESS;
 }
 
+// Number of elements in each batch of element matrices formed by one tensor contraction
+#define CEED_ASSEMBLE_BLOCK_SIZE 8
+
+// Sizes and arrays shared by all element batches in @ref CeedSingleOperatorAssemble()
+typedef struct {
+  CeedInt             num_qpts, num_eval_modes_in, num_eval_modes_out, elem_size_in, elem_size_out, num_comp_in, num_comp_out, layout_qf[3];
+  const CeedScalar   *assembled_qf, *B_mat_in, *B_mat_out;
+  const bool         *orients_in, *orients_out;
+  const CeedInt8     *curl_orients_in, *curl_orients_out;
+  CeedTensorContract  contract;
+} CeedElemMatAssemblyData;
+
+// Deduplicated block compressed sparse row pattern and values for @ref CeedOperatorLinearAssembleCSR()
+typedef struct {
+  CeedInt         block_size;
+  const CeedSize *row_offsets;
+  const CeedInt  *cols;
+  CeedScalar     *values;
+} CeedCSRAssemblyData;
+
+// E-vector to L-vector maps of the active element restrictions for adding element matrices into block values
+typedef struct {
+  CeedInt           layout_in[3], layout_out[3];
+  const CeedScalar *elem_dof_in, *elem_dof_out;
+} CeedElemDofAssemblyData;
+
 /**
-  @brief Assemble nonzero entries for non-composite `CeedOperator`.
+  @brief Get the index in the block values of a matrix entry in the deduplicated block compressed sparse row pattern
 
-  Users should generally use @ref CeedOperatorLinearAssemble().
+  @param[in] csr Block compressed sparse row pattern
+  @param[in] row Row of the matrix entry
+  @param[in] col Column of the matrix entry
 
-  @param[in]  op     `CeedOperator` to assemble
-  @param[in]  offset Offset for number of entries
-  @param[out] values Values to assemble into matrix
+  @return Index of the entry in `csr->values`
+
+  @ref Developer
+**/
+static inline CeedSize CeedCSRAssemblyGetValueIndex(const CeedCSRAssemblyData *csr, CeedInt row, CeedInt col) {
+  const CeedInt block_size = csr->block_size, block_col = col / block_size;
+  CeedSize      lo = csr->row_offsets[row / block_size], hi = csr->row_offsets[row / block_size + 1] - 1;
+
+  // Block columns are sorted in each block row
+  while (lo < hi) {
+    const CeedSize mid = lo + (hi - lo) / 2;
+
+    if (csr->cols[mid] < block_col) lo = mid + 1;
+    else hi = mid;
+  }
+  return (lo * block_size + row % block_size) * block_size + col % block_size;
+}
+
+/**
+  @brief Assemble element matrices for a batch of elements of a non-composite `CeedOperator`.
+
+  The product of the transposed output basis and the assembled `CeedQFunction` is formed for the whole batch, with one column per element,
+  component pair, and output node, so a single tensor contraction with the input basis forms every element matrix of the batch.
+
+  @param[in]  ceed       `Ceed` context for scratch memory
+  @param[in]  data       Sizes and arrays for element matrix assembly
+  @param[in]  elem_start First element of the batch
+  @param[in]  elem_end   One past the last element of the batch
+  @param[out] vals       Element matrix entries for the batch, in COO order starting at the first entry for element `elem_start`
 
   @return An error code: 0 - success, otherwise - failure
 
   @ref Developer
 **/
-int CeedSingleOperatorAssemble(CeedOperator op, CeedInt offset, CeedVector values) {
-  bool is_composite, is_at_points;
+static int CeedSingleOperatorAssembleElements(Ceed ceed, const CeedElemMatAssemblyData *data, CeedInt elem_start, CeedInt elem_end,
+                                              CeedScalar *vals) {
+  const CeedInt     num_qpts = data->num_qpts, num_eval_modes_in = data->num_eval_modes_in, num_eval_modes_out = data->num_eval_modes_out;
+  const CeedInt     elem_size_in = data->elem_size_in, elem_size_out = data->elem_size_out;
+  const CeedInt     num_comp_in = data->num_comp_in, num_comp_out = data->num_comp_out, num_comp_pairs = num_comp_in * num_comp_out;
+  const CeedInt     num_rows_btd = num_qpts * num_eval_modes_in, num_elem = elem_end - elem_start;
+  const CeedInt     num_cols = num_elem * num_comp_pairs * elem_size_out;
+  const CeedInt    *layout_qf = data->layout_qf;
+  const CeedScalar *B_mat_in = data->B_mat_in, *B_mat_out = data->B_mat_out;
+  int               ierr     = CEED_ERROR_SUCCESS;
+  CeedScalar       *BTD_mat, *elem_mats, *elem_mat_b = NULL;
+
+  CeedCall(CeedGetScratch(ceed, (size_t)num_rows_btd * num_cols, &BTD_mat));
+  ierr = CeedGetScratch(ceed, (size_t)elem_size_in * num_cols, &elem_mats);
+  if (ierr) {
+    // LCOV_EXCL_START
+    CeedCall(CeedRestoreScratch(ceed, &BTD_mat));
+    return ierr;
+    // LCOV_EXCL_STOP
+  }
+  if (data->curl_orients_in || data->curl_orients_out) ierr = CeedGetScratch(ceed, (size_t)elem_size_out * elem_size_in, &elem_mat_b);
+  if (ierr) {
+    // LCOV_EXCL_START
+    CeedCall(CeedRestoreScratch(ceed, &elem_mats));
+    CeedCall(CeedRestoreScratch(ceed, &BTD_mat));
+    return ierr;
+    // LCOV_EXCL_STOP
+  }
+
+  // Compute B^T*D, with row q * num_eval_modes_in + e_in and column ((k * num_comp_in + comp_in) * num_comp_out + comp_out) * elem_size_out + n
+  for (CeedInt q = 0; q < num_qpts; q++) {
+    for (CeedInt e_in = 0; e_in < num_eval_modes_in; e_in++) {
+      CeedScalar *BTD_row = &BTD_mat[(CeedSize)(q * num_eval_modes_in + e_in) * num_cols];
+
+      for (CeedInt k = 0; k < num_elem; k++) {
+        const CeedSize qf_elem_offset = q * layout_qf[0] + (CeedSize)(elem_start + k) * layout_qf[2];
+
+        for (CeedInt comp_in = 0; comp_in < num_comp_in; comp_in++) {
+          for (CeedInt comp_out = 0; comp_out < num_comp_out; comp_out++) {
+            CeedScalar *BTD = &BTD_row[((k * num_comp_in + comp_in) * num_comp_out + comp_out) * elem_size_out];
+
+            for (CeedInt n = 0; n < elem_size_out; n++) BTD[n] = 0.0;
+            for (CeedInt e_out = 0; e_out < num_eval_modes_out; e_out++) {
+              const CeedInt     eval_mode_index = ((e_in * num_comp_in + comp_in) * num_eval_modes_out + e_out) * num_comp_out + comp_out;
+              const CeedScalar  d               = data->assembled_qf[qf_elem_offset + eval_mode_index * layout_qf[1]];
+              const CeedScalar *B_out           = &B_mat_out[(q * num_eval_modes_out + e_out) * elem_size_out];
+
+              CeedPragmaSIMD for (CeedInt n = 0; n < elem_size_out; n++) BTD[n] += B_out[n] * d;
+            }
+          }
+        }
+      }
+    }
+  }
 
-  CeedCall(CeedOperatorIsComposite(op, &is_composite));
-  CeedCheck(!is_composite, CeedOperatorReturnCeed(op), CEED_ERROR_UNSUPPORTED, "Composite operator not supported");
+  // Form element matrices, transposed, with row j and the same columns as B^T*D
+  if (data->contract) {
+    ierr = CeedTensorContractApply(data->contract, 1, num_rows_btd, num_cols, elem_size_in, B_mat_in, CEED_TRANSPOSE, false, BTD_mat, elem_mats);
+  } else {
+    for (CeedSize i = 0; i < (CeedSize)elem_size_in * num_cols; i++) elem_mats[i] = 0.0;
+    for (CeedInt b = 0; b < num_rows_btd; b++) {
+      for (CeedInt j = 0; j < elem_size_in; j++) {
+        const CeedScalar  B_in    = B_mat_in[b * elem_size_in + j];
+        const CeedScalar *BTD_row = &BTD_mat[(CeedSize)b * num_cols];
+        CeedScalar       *mat_row = &elem_mats[(CeedSize)j * num_cols];
+
+        CeedPragmaSIMD for (CeedInt c = 0; c < num_cols; c++) mat_row[c] += B_in * BTD_row[c];
+      }
+    }
+  }
 
-  // Early exit for empty operator
-  {
-    CeedInt num_elem = 0;
+  // Put element matrices in coordinate data structure, transforming if required
+  for (CeedInt k = 0; k < num_elem && !ierr; k++) {
+    const CeedSize e = elem_start + k;
 
-    CeedCall(CeedOperatorGetNumElements(op, &num_elem));
-    if (num_elem == 0) return CEED_ERROR_SUCCESS;
+    for (CeedInt comp_pair = 0; comp_pair < num_comp_pairs; comp_pair++) {
+      const CeedInt col      = (k * num_comp_pairs + comp_pair) * elem_size_out;
+      CeedScalar   *elem_mat = &vals[((CeedSize)k * num_comp_pairs + comp_pair) * elem_size_out * elem_size_in];
+
+      for (CeedInt i = 0; i < elem_size_out; i++) {
+        for (CeedInt j = 0; j < elem_size_in; j++) elem_mat[i * elem_size_in + j] = elem_mats[(CeedSize)j * num_cols + col + i];
+      }
+      if (data->orients_out) {
+        const bool *elem_orients = &data->orients_out[e * elem_size_out];
+
+        for (CeedInt i = 0; i < elem_size_out; i++) {
+          const double orient = elem_orients[i] ? -1.0 : 1.0;
+
+          for (CeedInt j = 0; j < elem_size_in; j++) {
+            elem_mat[i * elem_size_in + j] *= orient;
+          }
+        }
+      } else if (data->curl_orients_out) {
+        const CeedInt8 *elem_curl_orients = &data->curl_orients_out[e * 3 * elem_size_out];
+
+        // T^T*(B^T*D*B)
+        memcpy(elem_mat_b, elem_mat, elem_size_out * elem_size_in * sizeof(CeedScalar));
+        for (CeedInt i = 0; i < elem_size_out; i++) {
+          for (CeedInt j = 0; j < elem_size_in; j++) {
+            elem_mat[i * elem_size_in + j] = elem_mat_b[i * elem_size_in + j] * elem_curl_orients[3 * i + 1] +
+                                             (i > 0 ? elem_mat_b[(i - 1) * elem_size_in + j] * elem_curl_orients[3 * i - 1] : 0.0) +
+                                             (i < elem_size_out - 1 ? elem_mat_b[(i + 1) * elem_size_in + j] * elem_curl_orients[3 * i + 3] : 0.0);
+          }
+        }
+      }
+      if (data->orients_in) {
+        const bool *elem_orients = &data->orients_in[e * elem_size_in];
+
+        for (CeedInt i = 0; i < elem_size_out; i++) {
+          for (CeedInt j = 0; j < elem_size_in; j++) {
+            elem_mat[i * elem_size_in + j] *= elem_orients[j] ? -1.0 : 1.0;
+          }
+        }
+      } else if (data->curl_orients_in) {
+        const CeedInt8 *elem_curl_orients = &data->curl_orients_in[e * 3 * elem_size_in];
+
+        // (B^T*D*B)*T
+        memcpy(elem_mat_b, elem_mat, elem_size_out * elem_size_in * sizeof(CeedScalar));
+        for (CeedInt i = 0; i < elem_size_out; i++) {
+          for (CeedInt j = 0; j < elem_size_in; j++) {
+            elem_mat[i * elem_size_in + j] = elem_mat_b[i * elem_size_in + j] * elem_curl_orients[3 * j + 1] +
+                                             (j > 0 ? elem_mat_b[i * elem_size_in + j - 1] * elem_curl_orients[3 * j - 1] : 0.0) +
+                                             (j < elem_size_in - 1 ? elem_mat_b[i * elem_size_in + j + 1] * elem_curl_orients[3 * j + 3] : 0.0);
+          }
+        }
+      }
+    }
   }
 
-  if (op->LinearAssembleSingle) {
-    // Backend version
-    CeedCall(op->LinearAssembleSingle(op, offset, values));
-    return CEED_ERROR_SUCCESS;
-  } else {
-    // Operator fallback
-    CeedOperator op_fallback;
+  // Restore scratch before returning any error
+  if (elem_mat_b) CeedCall(CeedRestoreScratch(ceed, &elem_mat_b));
+  CeedCall(CeedRestoreScratch(ceed, &elem_mats));
+  CeedCall(CeedRestoreScratch(ceed, &BTD_mat));
+  return ierr;
+}
 
-    CeedCall(CeedOperatorGetFallback(op, &op_fallback));
-    if (op_fallback) {
-      CeedCall(CeedSingleOperatorAssemble(op_fallback, offset, values));
-      return CEED_ERROR_SUCCESS;
+/**
+  @brief Add element matrices for a batch of elements of a non-composite `CeedOperator` into deduplicated block compressed sparse row values.
+
+  @param[in]  ceed       `Ceed` context for scratch memory
+  @param[in]  data       Sizes and arrays for element matrix assembly
+  @param[in]  elem_dofs  L-vector indices of the active E-vector entries
+  @param[in]  csr        Block compressed sparse row pattern and values to add into
+  @param[in]  elem_start First element of the batch
+  @param[in]  elem_end   One past the last element of the batch
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedSingleOperatorAssembleElementsCSR(Ceed ceed, const CeedElemMatAssemblyData *data, const CeedElemDofAssemblyData *elem_dofs,
+                                                 const CeedCSRAssemblyData *csr, CeedInt elem_start, CeedInt elem_end) {
+  const CeedInt  elem_size_in = data->elem_size_in, elem_size_out = data->elem_size_out;
+  const CeedInt  num_comp_in = data->num_comp_in, num_comp_out = data->num_comp_out;
+  const CeedInt *layout_in = elem_dofs->layout_in, *layout_out = elem_dofs->layout_out;
+  int            ierr;
+  CeedScalar    *elem_vals;
+
+  CeedCall(CeedGetScratch(ceed, (size_t)(elem_end - elem_start) * num_comp_in * num_comp_out * elem_size_in * elem_size_out, &elem_vals));
+  ierr = CeedSingleOperatorAssembleElements(ceed, data, elem_start, elem_end, elem_vals);
+  if (ierr) {
+    // Restore scratch before returning the error
+    CeedCall(CeedRestoreScratch(ceed, &elem_vals));
+    return ierr;
+  }
+
+  // Element matrices of different batches may share block values, so only the additions are atomic
+  {
+    CeedSize count = 0;
+
+    for (CeedInt e = elem_start; e < elem_end; e++) {
+      for (CeedInt comp_in = 0; comp_in < num_comp_in; comp_in++) {
+        for (CeedInt comp_out = 0; comp_out < num_comp_out; comp_out++) {
+          for (CeedInt i = 0; i < elem_size_out; i++) {
+            const CeedInt row = elem_dofs->elem_dof_out[i * layout_out[0] + comp_out * layout_out[1] + (CeedSize)e * layout_out[2]];
+
+            for (CeedInt j = 0; j < elem_size_in; j++) {
+              const CeedInt    col   = elem_dofs->elem_dof_in[j * layout_in[0] + comp_in * layout_in[1] + (CeedSize)e * layout_in[2]];
+              const CeedSize   index = CeedCSRAssemblyGetValueIndex(csr, row, col);
+              const CeedScalar value = elem_vals[count++];
+
+              CeedPragmaAtomic csr->values[index] += value;
+            }
+          }
+        }
+      }
     }
   }
+  CeedCall(CeedRestoreScratch(ceed, &elem_vals));
+  return CEED_ERROR_SUCCESS;
+}
 
-  CeedCall(CeedOperatorIsAtPoints(op, &is_at_points));
-  CeedCheck(!is_at_points, CeedOperatorReturnCeed(op), CEED_ERROR_UNSUPPORTED,
-            "Backend does not implement CeedOperatorLinearAssemble for AtPoints operator");
+/**
+  @brief Assemble element matrices of a non-composite `CeedOperator` with the interface implementation.
+
+  Entries are stored in COO order in `vals` or, if `csr` is not `NULL`, added into the block values of the deduplicated block compressed sparse
+  row pattern one batch of elements at a time.
+
+  @param[in]  op   `CeedOperator` to assemble
+  @param[out] vals COO values for the entries of `op`, or `NULL` if `csr` is provided
+  @param[in]  csr  Block compressed sparse row pattern and values to add into, or `NULL`
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedSingleOperatorAssembleDefault(CeedOperator op, CeedScalar *vals, const CeedCSRAssemblyData *csr) {
+  int ierr = CEED_ERROR_SUCCESS;
 
   // Assemble QFunction
   CeedInt             layout_qf[3];
@@ -613,7 +959,6 @@ int CeedSingleOperatorAssemble(CeedOperator op, CeedInt offset, CeedVector value
   // Get assembly data
   CeedInt                  num_elem_in, elem_size_in, num_comp_in, num_qpts_in;
   CeedInt                  num_elem_out, elem_size_out, num_comp_out, num_qpts_out;
-  CeedSize                 local_num_entries, count = 0;
   const CeedEvalMode     **eval_modes_in, **eval_modes_out;
   CeedInt                  num_active_bases_in, *num_eval_modes_in, num_active_bases_out, *num_eval_modes_out;
   CeedBasis               *active_bases_in, *active_bases_out, basis_in, basis_out;
@@ -683,116 +1028,74 @@ int CeedSingleOperatorAssemble(CeedOperator op, CeedInt offset, CeedVector value
     elem_rstr_orients_out      = elem_rstr_orients_in;
     elem_rstr_curl_orients_out = elem_rstr_curl_orients_in;
   }
-  local_num_entries = (CeedSize)elem_size_out * num_comp_out * elem_size_in * num_comp_in * num_elem_in;
 
-  // Loop over elements and put in data structure
+  // Assemble element matrices in batches, in parallel when threading is available
   // We store B_mat_in, B_mat_out, BTD, elem_mat in row-major order
-  CeedTensorContract contract;
-  CeedScalar        *vals, *BTD_mat = NULL, *elem_mat = NULL, *elem_mat_b = NULL;
-
-  CeedCall(CeedBasisGetTensorContract(basis_in, &contract));
-  CeedCall(CeedCalloc(elem_size_out * num_qpts_in * num_eval_modes_in[0], &BTD_mat));
-  CeedCall(CeedCalloc(elem_size_out * elem_size_in, &elem_mat));
-  if (elem_rstr_curl_orients_in || elem_rstr_curl_orients_out) CeedCall(CeedCalloc(elem_size_out * elem_size_in, &elem_mat_b));
-
-  CeedCall(CeedVectorGetArray(values, CEED_MEM_HOST, &vals));
-  for (CeedSize e = 0; e < num_elem_in; e++) {
-    for (CeedInt comp_in = 0; comp_in < num_comp_in; comp_in++) {
-      for (CeedInt comp_out = 0; comp_out < num_comp_out; comp_out++) {
-        // Compute B^T*D
-        for (CeedSize n = 0; n < elem_size_out; n++) {
-          for (CeedSize q = 0; q < num_qpts_in; q++) {
-            for (CeedInt e_in = 0; e_in < num_eval_modes_in[0]; e_in++) {
-              const CeedSize btd_index = n * (num_qpts_in * num_eval_modes_in[0]) + q * num_eval_modes_in[0] + e_in;
-              CeedScalar     sum       = 0.0;
-
-              for (CeedInt e_out = 0; e_out < num_eval_modes_out[0]; e_out++) {
-                const CeedSize b_out_index     = (q * num_eval_modes_out[0] + e_out) * elem_size_out + n;
-                const CeedSize eval_mode_index = ((e_in * num_comp_in + comp_in) * num_eval_modes_out[0] + e_out) * num_comp_out + comp_out;
-                const CeedSize qf_index        = q * layout_qf[0] + eval_mode_index * layout_qf[1] + e * layout_qf[2];
-
-                sum += B_mat_out[b_out_index] * assembled_qf_array[qf_index];
-              }
-              BTD_mat[btd_index] = sum;
-            }
-          }
-        }
-
-        // Form element matrix itself (for each block component)
-        if (contract) {
-          CeedCall(CeedTensorContractApply(contract, 1, num_qpts_in * num_eval_modes_in[0], elem_size_in, elem_size_out, BTD_mat, CEED_NOTRANSPOSE,
-                                           false, B_mat_in, elem_mat));
-        } else {
-          Ceed ceed;
-
-          CeedCall(CeedOperatorGetCeed(op, &ceed));
-          CeedCall(CeedMatrixMatrixMultiply(ceed, BTD_mat, B_mat_in, elem_mat, elem_size_out, elem_size_in, num_qpts_in * num_eval_modes_in[0]));
-          CeedCall(CeedDestroy(&ceed));
-        }
-
-        // Transform the element matrix if required
-        if (elem_rstr_orients_out) {
-          const bool *elem_orients = &elem_rstr_orients_out[e * elem_size_out];
-
-          for (CeedInt i = 0; i < elem_size_out; i++) {
-            const double orient = elem_orients[i] ? -1.0 : 1.0;
-
-            for (CeedInt j = 0; j < elem_size_in; j++) {
-              elem_mat[i * elem_size_in + j] *= orient;
-            }
-          }
-        } else if (elem_rstr_curl_orients_out) {
-          const CeedInt8 *elem_curl_orients = &elem_rstr_curl_orients_out[e * 3 * elem_size_out];
-
-          // T^T*(B^T*D*B)
-          memcpy(elem_mat_b, elem_mat, elem_size_out * elem_size_in * sizeof(CeedScalar));
-          for (CeedInt i = 0; i < elem_size_out; i++) {
-            for (CeedInt j = 0; j < elem_size_in; j++) {
-              elem_mat[i * elem_size_in + j] = elem_mat_b[i * elem_size_in + j] * elem_curl_orients[3 * i + 1] +
-                                               (i > 0 ? elem_mat_b[(i - 1) * elem_size_in + j] * elem_curl_orients[3 * i - 1] : 0.0) +
-                                               (i < elem_size_out - 1 ? elem_mat_b[(i + 1) * elem_size_in + j] * elem_curl_orients[3 * i + 3] : 0.0);
-            }
-          }
-        }
-        if (elem_rstr_orients_in) {
-          const bool *elem_orients = &elem_rstr_orients_in[e * elem_size_in];
-
-          for (CeedInt i = 0; i < elem_size_out; i++) {
-            for (CeedInt j = 0; j < elem_size_in; j++) {
-              elem_mat[i * elem_size_in + j] *= elem_orients[j] ? -1.0 : 1.0;
-            }
-          }
-        } else if (elem_rstr_curl_orients_in) {
-          const CeedInt8 *elem_curl_orients = &elem_rstr_curl_orients_in[e * 3 * elem_size_in];
-
-          // (B^T*D*B)*T
-          memcpy(elem_mat_b, elem_mat, elem_size_out * elem_size_in * sizeof(CeedScalar));
-          for (CeedInt i = 0; i < elem_size_out; i++) {
-            for (CeedInt j = 0; j < elem_size_in; j++) {
-              elem_mat[i * elem_size_in + j] = elem_mat_b[i * elem_size_in + j] * elem_curl_orients[3 * j + 1] +
-                                               (j > 0 ? elem_mat_b[i * elem_size_in + j - 1] * elem_curl_orients[3 * j - 1] : 0.0) +
-                                               (j < elem_size_in - 1 ? elem_mat_b[i * elem_size_in + j + 1] * elem_curl_orients[3 * j + 3] : 0.0);
-            }
-          }
-        }
-
-        // Put element matrix in coordinate data structure
-        for (CeedInt i = 0; i < elem_size_out; i++) {
-          for (CeedInt j = 0; j < elem_size_in; j++) {
-            vals[offset + count] = elem_mat[i * elem_size_in + j];
-            count++;
-          }
-        }
+  {
+    const CeedInt           num_blocks = num_elem_in / CEED_ASSEMBLE_BLOCK_SIZE + !!(num_elem_in % CEED_ASSEMBLE_BLOCK_SIZE);
+    CeedElemMatAssemblyData assembly_data = {
+        .num_qpts           = num_qpts_in,
+        .num_eval_modes_in  = num_eval_modes_in[0],
+        .num_eval_modes_out = num_eval_modes_out[0],
+        .elem_size_in       = elem_size_in,
+        .elem_size_out      = elem_size_out,
+        .num_comp_in        = num_comp_in,
+        .num_comp_out       = num_comp_out,
+        .layout_qf          = {layout_qf[0], layout_qf[1], layout_qf[2]},
+        .assembled_qf       = assembled_qf_array,
+        .B_mat_in           = B_mat_in,
+        .B_mat_out          = B_mat_out,
+        .orients_in         = elem_rstr_orients_in,
+        .orients_out        = elem_rstr_orients_out,
+        .curl_orients_in    = elem_rstr_curl_orients_in,
+        .curl_orients_out   = elem_rstr_curl_orients_out,
+    };
+
+    const CeedSize          num_elem_entries = (CeedSize)num_comp_in * num_comp_out * elem_size_in * elem_size_out;
+    CeedVector              elem_dof_in = NULL, elem_dof_out = NULL;
+    CeedElemDofAssemblyData elem_dof_data = {0};
+
+    if (basis_in != CEED_BASIS_NONE) CeedCall(CeedBasisGetTensorContract(basis_in, &assembly_data.contract));
+    if (csr) {
+      CeedSize num_nodes_in, num_nodes_out;
+
+      CeedCall(CeedOperatorGetActiveVectorLengths(op, &num_nodes_in, &num_nodes_out));
+      CeedCall(CeedElemRestrictionGetELayout(elem_rstr_in, elem_dof_data.layout_in));
+      CeedCall(CeedElemRestrictionGetELayout(elem_rstr_out, elem_dof_data.layout_out));
+      CeedCall(CeedElemRestrictionGetElemDofs(elem_rstr_in, num_nodes_in, &elem_dof_in));
+      CeedCall(CeedVectorGetArrayRead(elem_dof_in, CEED_MEM_HOST, &elem_dof_data.elem_dof_in));
+      if (elem_rstr_in != elem_rstr_out) {
+        CeedCall(CeedElemRestrictionGetElemDofs(elem_rstr_out, num_nodes_out, &elem_dof_out));
+        CeedCall(CeedVectorGetArrayRead(elem_dof_out, CEED_MEM_HOST, &elem_dof_data.elem_dof_out));
+      } else {
+        elem_dof_data.elem_dof_out = elem_dof_data.elem_dof_in;
       }
     }
+    CeedPragmaOMP(parallel for schedule(static))
+    for (CeedInt b = 0; b < num_blocks; b++) {
+      const CeedInt elem_start = b * CEED_ASSEMBLE_BLOCK_SIZE, elem_end = CeedIntMin(elem_start + CEED_ASSEMBLE_BLOCK_SIZE, num_elem_in);
+      const int     ierr_b =
+          csr ? CeedSingleOperatorAssembleElementsCSR(CeedOperatorReturnCeed(op), &assembly_data, &elem_dof_data, csr, elem_start, elem_end)
+              : CeedSingleOperatorAssembleElements(CeedOperatorReturnCeed(op), &assembly_data, elem_start, elem_end,
+                                                   &vals[elem_start * num_elem_entries]);
+
+      if (ierr_b != CEED_ERROR_SUCCESS) {
+        CeedPragmaCritical(CeedSingleOperatorAssemble)
+        ierr = ierr_b;
+      }
+    }
+    // Any error from the batches is returned after the borrowed arrays are restored
+    if (elem_dof_in) {
+      CeedCall(CeedVectorRestoreArrayRead(elem_dof_in, &elem_dof_data.elem_dof_in));
+      CeedCall(CeedVectorDestroy(&elem_dof_in));
+    }
+    if (elem_dof_out) {
+      CeedCall(CeedVectorRestoreArrayRead(elem_dof_out, &elem_dof_data.elem_dof_out));
+      CeedCall(CeedVectorDestroy(&elem_dof_out));
+    }
   }
-  CeedCheck(count == local_num_entries, CeedOperatorReturnCeed(op), CEED_ERROR_MAJOR, "Error computing entries");
-  CeedCall(CeedVectorRestoreArray(values, &vals));
 
   // Cleanup
-  CeedCall(CeedFree(&BTD_mat));
-  CeedCall(CeedFree(&elem_mat));
-  CeedCall(CeedFree(&elem_mat_b));
   if (elem_rstr_type_in == CEED_RESTRICTION_ORIENTED) {
     CeedCall(CeedElemRestrictionRestoreOrientations(elem_rstr_in, &elem_rstr_orients_in));
   } else if (elem_rstr_type_in == CEED_RESTRICTION_CURL_ORIENTED) {
@@ -809,7 +1112,82 @@ int CeedSingleOperatorAssemble(CeedOperator op, CeedInt offset, CeedVector value
   CeedCall(CeedVectorDestroy(&assembled_qf));
   CeedCall(CeedElemRestrictionDestroy(&elem_rstr_in));
   CeedCall(CeedElemRestrictionDestroy(&elem_rstr_out));
-  return CEED_ERROR_SUCCESS;
+  return ierr;
+}
+
+/**
+  @brief Assemble nonzero entries for non-composite `CeedOperator`.
+
+  Users should generally use @ref CeedOperatorLinearAssemble().
+
+  @param[in]  op     `CeedOperator` to assemble
+  @param[in]  offset Offset for number of entries
+  @param[out] values Values to assemble into matrix
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+int CeedSingleOperatorAssemble(CeedOperator op, CeedInt offset, CeedVector values) {
+  bool is_composite, is_at_points;
+
+  CeedCall(CeedOperatorIsComposite(op, &is_composite));
+  CeedCheck(!is_composite, CeedOperatorReturnCeed(op), CEED_ERROR_UNSUPPORTED, "Composite operator not supported");
+
+  // Early exit for empty operator
+  {
+    CeedInt num_elem = 0;
+
+    CeedCall(CeedOperatorGetNumElements(op, &num_elem));
+    if (num_elem == 0) return CEED_ERROR_SUCCESS;
+  }
+
+  if (op->LinearAssembleSingle) {
+    // Backend version
+    CeedCall(op->LinearAssembleSingle(op, offset, values));
+    return CEED_ERROR_SUCCESS;
+  } else {
+    // Operator fallback
+    CeedOperator op_fallback;
+
+    CeedCall(CeedOperatorGetFallback(op, &op_fallback));
+    if (op_fallback) {
+      CeedCall(CeedSingleOperatorAssemble(op_fallback, offset, values));
+      return CEED_ERROR_SUCCESS;
+    }
+  }
+
+  CeedCall(CeedOperatorIsAtPoints(op, &is_at_points));
+  CeedCheck(!is_at_points, CeedOperatorReturnCeed(op), CEED_ERROR_UNSUPPORTED,
+            "Backend does not implement CeedOperatorLinearAssemble for AtPoints operator");
+
+  // Assemble element matrices
+  {
+    int         ierr;
+    CeedScalar *vals;
+
+    CeedCall(CeedVectorGetArray(values, CEED_MEM_HOST, &vals));
+    ierr = CeedSingleOperatorAssembleDefault(op, &vals[offset], NULL);
+    // Restore values before returning any error
+    CeedCall(CeedVectorRestoreArray(values, &vals));
+    return ierr;
+  }
+}
+
+/**
+  @brief Compare two `CeedInt` values for `qsort()`
+
+  @param[in] a Pointer to first value
+  @param[in] b Pointer to second value
+
+  @return Negative, zero, or positive as `a` is less than, equal to, or greater than `b`
+
+  @ref Developer
+**/
+static int CeedIntCompare(const void *a, const void *b) {
+  const CeedInt lhs = *(const CeedInt *)a, rhs = *(const CeedInt *)b;
+
+  return (lhs > rhs) - (lhs < rhs);
 }
 
 /**
@@ -1115,6 +1493,36 @@ static int CeedBuildMassLaplace(const CeedScalar *interp_1d, const CeedScalar *g
 }
 CeedPragmaOptimizeOn
 
+/**
+  @brief Task for deferred @ref CeedOperatorLinearAssembleDiagonal() on the host task queue
+
+  @param[in]  op        `CeedOperator` to assemble
+  @param[in]  in        Unused, must be `NULL`
+  @param[out] assembled `CeedVector` to store assembled `CeedOperator` diagonal
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedOperatorLinearAssembleDiagonalTask(CeedOperator op, CeedVector in, CeedVector assembled) {
+  return CeedOperatorLinearAssembleDiagonal(op, assembled, CEED_REQUEST_IMMEDIATE);
+}
+
+/**
+  @brief Task for deferred @ref CeedOperatorLinearAssembleAddDiagonal() on the host task queue
+
+  @param[in]  op        `CeedOperator` to assemble
+  @param[in]  in        Unused, must be `NULL`
+  @param[out] assembled `CeedVector` to sum in assembled `CeedOperator` diagonal
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedOperatorLinearAssembleAddDiagonalTask(CeedOperator op, CeedVector in, CeedVector assembled) {
+  return CeedOperatorLinearAssembleAddDiagonal(op, assembled, CEED_REQUEST_IMMEDIATE);
+}
+
 /// @}
 
 /// ----------------------------------------------------------------------------
@@ -2027,10 +2435,15 @@ int CeedOperatorLinearAssembleQFunctionBuildOrUpdate(CeedOperator op, CeedVector
   @ref User
 **/
 int CeedOperatorLinearAssembleDiagonal(CeedOperator op, CeedVector assembled, CeedRequest *request) {
-  bool     is_composite;
+  bool     is_composite, is_submitted;
   CeedSize input_size = 0, output_size = 0;
 
   CeedCall(CeedOperatorCheckReady(op));
+
+  // Submit to host task queue
+  CeedCall(CeedRequestSubmit(CeedOperatorReturnCeed(op), CeedOperatorLinearAssembleDiagonalTask, op, NULL, assembled, request, &is_submitted));
+  if (is_submitted) return CEED_ERROR_SUCCESS;
+
   CeedCall(CeedOperatorIsComposite(op, &is_composite));
 
   CeedCall(CeedOperatorGetActiveVectorLengths(op, &input_size, &output_size));
@@ -2092,10 +2505,15 @@ int CeedOperatorLinearAssembleDiagonal(CeedOperator op, CeedVector assembled, Ce
   @ref User
 **/
 int CeedOperatorLinearAssembleAddDiagonal(CeedOperator op, CeedVector assembled, CeedRequest *request) {
-  bool     is_composite;
+  bool     is_composite, is_submitted;
   CeedSize input_size = 0, output_size = 0;
 
   CeedCall(CeedOperatorCheckReady(op));
+
+  // Submit to host task queue
+  CeedCall(CeedRequestSubmit(CeedOperatorReturnCeed(op), CeedOperatorLinearAssembleAddDiagonalTask, op, NULL, assembled, request, &is_submitted));
+  if (is_submitted) return CEED_ERROR_SUCCESS;
+
   CeedCall(CeedOperatorIsComposite(op, &is_composite));
 
   CeedCall(CeedOperatorGetActiveVectorLengths(op, &input_size, &output_size));
@@ -2506,6 +2924,216 @@ int CeedOperatorLinearAssemble(CeedOperator op, CeedVector values) {
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+   @brief Assemble the deduplicated block compressed sparse row nonzero pattern of a linear `CeedOperator`.
+
+   Expected to be used in conjunction with @ref CeedOperatorLinearAssembleCSR().
+
+   Unlike @ref CeedOperatorLinearAssembleSymbolic(), each nonzero block appears once.
+   The matrix is partitioned into dense `block_size` by `block_size` blocks; block row `i` holds the blocks with block column indices `cols[row_offsets[i]]` through `cols[row_offsets[i + 1] - 1]`, in increasing order.
+   With `block_size = 1` this is the usual compressed sparse row format.
+   A copy of the pattern is stored on the `CeedOperator`, so @ref CeedOperatorLinearAssembleCSR() can add element matrix entries directly into their block values.
+
+   Note: Calling this function asserts that setup is complete and sets the `CeedOperator` as immutable.
+
+   @param[in]  op             `CeedOperator` to assemble
+   @param[in]  block_size     Number of rows and columns in each block; must divide the active input and output vector lengths
+   @param[out] num_block_rows Number of block rows
+   @param[out] row_offsets    Offsets into `cols` for each block row, of length `num_block_rows + 1`
+   @param[out] cols           Block column index for each nonzero block
+
+   @return An error code: 0 - success, otherwise - failure
+
+   @ref User
+**/
+int CeedOperatorLinearAssembleSymbolicCSR(CeedOperator op, CeedInt block_size, CeedSize *num_block_rows, CeedSize **row_offsets,
+                                          CeedInt **cols) {
+  Ceed      ceed = CeedOperatorReturnCeed(op);
+  CeedInt  *entry_rows, *entry_cols;
+  CeedSize  input_size, output_size, num_entries, num_block_cols, num_blocks = 0, max_blocks;
+  CeedSize *row_ends, *perm, *col_slots;
+
+  CeedCheck(block_size > 0, ceed, CEED_ERROR_DIMENSION, "Block size must be positive");
+  CeedCall(CeedOperatorGetActiveVectorLengths(op, &input_size, &output_size));
+  CeedCheck(input_size % block_size == 0 && output_size % block_size == 0, ceed, CEED_ERROR_DIMENSION,
+            "Active vector lengths %" CeedSize_FMT " and %" CeedSize_FMT " not divisible by block size %" CeedInt_FMT, input_size, output_size,
+            block_size);
+  *num_block_rows = output_size / block_size;
+  num_block_cols  = input_size / block_size;
+
+  // Coordinate pattern
+  CeedCall(CeedOperatorLinearAssembleSymbolic(op, &num_entries, &entry_rows, &entry_cols));
+
+  // Bucket entries by block row
+  CeedCall(CeedCalloc(*num_block_rows + 1, &row_ends));
+  CeedCall(CeedMalloc(num_entries, &perm));
+  for (CeedSize e = 0; e < num_entries; e++) row_ends[entry_rows[e] / block_size + 1]++;
+  for (CeedSize i = 0; i < *num_block_rows; i++) row_ends[i + 1] += row_ends[i];
+  for (CeedSize e = 0; e < num_entries; e++) perm[row_ends[entry_rows[e] / block_size]++] = e;
+
+  // Deduplicate block columns in each block row and map entries to block values
+  max_blocks = *num_block_rows > 0 ? *num_block_rows : 1;
+  CeedCall(CeedCalloc(*num_block_rows + 1, row_offsets));
+  CeedCall(CeedMalloc(max_blocks, cols));
+  CeedCall(CeedMalloc(num_block_cols, &col_slots));
+  for (CeedSize j = 0; j < num_block_cols; j++) col_slots[j] = -1;
+  for (CeedSize i = 0; i < *num_block_rows; i++) {
+    const CeedSize row_start = i ? row_ends[i - 1] : 0, row_end = row_ends[i], first_block = num_blocks;
+
+    for (CeedSize k = row_start; k < row_end; k++) {
+      const CeedInt col = entry_cols[perm[k]] / block_size;
+
+      if (col_slots[col] >= 0) continue;
+      if (num_blocks == max_blocks) {
+        max_blocks *= 2;
+        CeedCall(CeedRealloc(max_blocks, cols));
+      }
+      col_slots[col]        = num_blocks;
+      (*cols)[num_blocks++] = col;
+    }
+    qsort(&(*cols)[first_block], num_blocks - first_block, sizeof(CeedInt), CeedIntCompare);
+    for (CeedSize b = first_block; b < num_blocks; b++) col_slots[(*cols)[b]] = -1;
+    (*row_offsets)[i + 1] = num_blocks;
+  }
+  if (num_blocks) CeedCall(CeedRealloc(num_blocks, cols));
+
+  // Store pattern for numeric assembly
+  CeedCall(CeedFree(&op->csr_row_offsets));
+  CeedCall(CeedFree(&op->csr_cols));
+  CeedCall(CeedMalloc(*num_block_rows + 1, &op->csr_row_offsets));
+  CeedCall(CeedMalloc(max_blocks, &op->csr_cols));
+  memcpy(op->csr_row_offsets, *row_offsets, (*num_block_rows + 1) * sizeof(CeedSize));
+  memcpy(op->csr_cols, *cols, num_blocks * sizeof(CeedInt));
+  op->csr_block_size = block_size;
+  op->csr_num_values = num_blocks * block_size * block_size;
+
+  // Cleanup
+  CeedCall(CeedFree(&col_slots));
+  CeedCall(CeedFree(&perm));
+  CeedCall(CeedFree(&row_ends));
+  CeedCall(CeedFree(&entry_cols));
+  CeedCall(CeedFree(&entry_rows));
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Add the assembled entries of a non-composite `CeedOperator` into deduplicated block compressed sparse row values.
+
+  Element matrices formed by the interface implementation are added one batch of elements at a time.
+  Operators assembled by a backend are assembled in COO format into temporary storage that is freed before returning.
+
+  @param[in] op  `CeedOperator` to assemble
+  @param[in] csr Block compressed sparse row pattern and values to add into
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedSingleOperatorAssembleCSR(CeedOperator op, const CeedCSRAssemblyData *csr) {
+  bool    is_at_points;
+  CeedInt num_elem = 0;
+
+  // Early exit for empty operator
+  CeedCall(CeedOperatorGetNumElements(op, &num_elem));
+  if (num_elem == 0) return CEED_ERROR_SUCCESS;
+
+  if (!op->LinearAssembleSingle) {
+    // Operator fallback
+    CeedOperator op_fallback;
+
+    CeedCall(CeedOperatorGetFallback(op, &op_fallback));
+    if (op_fallback) {
+      CeedCall(CeedSingleOperatorAssembleCSR(op_fallback, csr));
+      return CEED_ERROR_SUCCESS;
+    }
+
+    // Interface version
+    CeedCall(CeedOperatorIsAtPoints(op, &is_at_points));
+    if (!is_at_points) {
+      CeedCall(CeedSingleOperatorAssembleDefault(op, NULL, csr));
+      return CEED_ERROR_SUCCESS;
+    }
+  }
+
+  // Backend version, through temporary COO entries
+  {
+    CeedInt          *rows, *cols;
+    CeedSize          num_entries;
+    const CeedScalar *entry_values_array;
+    CeedVector        entry_values;
+
+    CeedCall(CeedSingleOperatorAssemblyCountEntries(op, &num_entries));
+    CeedCall(CeedCalloc(num_entries, &rows));
+    CeedCall(CeedCalloc(num_entries, &cols));
+    CeedCall(CeedSingleOperatorAssembleSymbolic(op, 0, rows, cols));
+    CeedCall(CeedVectorCreate(CeedOperatorReturnCeed(op), num_entries, &entry_values));
+    CeedCall(CeedVectorSetValue(entry_values, 0.0));
+    CeedCall(CeedSingleOperatorAssemble(op, 0, entry_values));
+    CeedCall(CeedVectorGetArrayRead(entry_values, CEED_MEM_HOST, &entry_values_array));
+    for (CeedSize e = 0; e < num_entries; e++) csr->values[CeedCSRAssemblyGetValueIndex(csr, rows[e], cols[e])] += entry_values_array[e];
+    CeedCall(CeedVectorRestoreArrayRead(entry_values, &entry_values_array));
+    CeedCall(CeedVectorDestroy(&entry_values));
+    CeedCall(CeedFree(&cols));
+    CeedCall(CeedFree(&rows));
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+   @brief Fully assemble the nonzero blocks of a linear `CeedOperator` in block compressed sparse row format.
+
+   Expected to be used in conjunction with @ref CeedOperatorLinearAssembleSymbolicCSR(), which must be called first.
+
+   The values are stored block by block in the order of the `cols` array from @ref CeedOperatorLinearAssembleSymbolicCSR(), with each block in row-major order.
+   Repeated coordinate entries are summed into their block value, so `values` holds the assembled matrix rather than element contributions.
+   With the interface implementation, element matrices are added into `values` one batch of elements at a time, without forming the COO values of
+   @ref CeedOperatorLinearAssemble().
+   Sub-operators assembled by a backend still form their COO values in temporary storage.
+
+   Note: Calling this function asserts that setup is complete and sets the `CeedOperator` as immutable.
+
+   @param[in]  op     `CeedOperator` to assemble
+   @param[out] values Values of the nonzero blocks, of length `block_size * block_size` times the number of nonzero blocks
+
+   @return An error code: 0 - success, otherwise - failure
+
+   @ref User
+**/
+int CeedOperatorLinearAssembleCSR(CeedOperator op, CeedVector values) {
+  bool                is_composite;
+  Ceed                ceed = CeedOperatorReturnCeed(op);
+  CeedSize            length;
+  CeedCSRAssemblyData csr;
+
+  CeedCheck(op->csr_row_offsets, ceed, CEED_ERROR_INCOMPLETE, "Must call CeedOperatorLinearAssembleSymbolicCSR before CeedOperatorLinearAssembleCSR");
+  CeedCall(CeedVectorGetLength(values, &length));
+  CeedCheck(length == op->csr_num_values, ceed, CEED_ERROR_DIMENSION,
+            "Values vector length %" CeedSize_FMT " does not match number of block values %" CeedSize_FMT, length, op->csr_num_values);
+  CeedCall(CeedOperatorCheckReady(op));
+  CeedCall(CeedOperatorIsComposite(op, &is_composite));
+
+  CeedCall(CeedVectorSetValue(values, 0.0));
+  if (op->csr_num_values == 0) return CEED_ERROR_SUCCESS;
+
+  // Add entries of each operator into block values
+  csr.block_size  = op->csr_block_size;
+  csr.row_offsets = op->csr_row_offsets;
+  csr.cols        = op->csr_cols;
+  CeedCall(CeedVectorGetArray(values, CEED_MEM_HOST, &csr.values));
+  if (is_composite) {
+    CeedInt       num_suboperators;
+    CeedOperator *sub_operators;
+
+    CeedCall(CeedCompositeOperatorGetNumSub(op, &num_suboperators));
+    CeedCall(CeedCompositeOperatorGetSubList(op, &sub_operators));
+    for (CeedInt k = 0; k < num_suboperators; k++) CeedCall(CeedSingleOperatorAssembleCSR(sub_operators[k], &csr));
+  } else {
+    CeedCall(CeedSingleOperatorAssembleCSR(op, &csr));
+  }
+  CeedCall(CeedVectorRestoreArray(values, &csr.values));
+  return CEED_ERROR_SUCCESS;
+}
+
 /**
   @brief Get the multiplicity of nodes across sub-operators in a composite `CeedOperator`.
 
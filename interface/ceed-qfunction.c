@@ -513,6 +513,21 @@ int CeedQFunctionIsIdentity(CeedQFunction qf, bool *is_identity) {
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Determine if `CeedQFunction` uses the Fortran interface
+
+  @param[in]  qf         `CeedQFunction`
+  @param[out] is_fortran Variable to store Fortran status
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedQFunctionIsFortran(CeedQFunction qf, bool *is_fortran) {
+  *is_fortran = qf->is_fortran;
+  return CEED_ERROR_SUCCESS;
+}
+
 /**
   @brief Determine if `CeedQFunctionContext` is writable
 
@@ -614,6 +629,25 @@ int CeedQFunctionGetFlopsEstimate(CeedQFunction qf, CeedSize *flops) {
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Estimate number of bytes of memory traffic per quadrature point required to apply `CeedQFunction`
+
+  The estimate counts each input field read and each output field written.
+
+  @param[in]  qf    `CeedQFunction` to estimate bytes for
+  @param[out] bytes Address of variable to hold bytes estimate
+
+  @ref Backend
+**/
+int CeedQFunctionGetBytesEstimate(CeedQFunction qf, CeedSize *bytes) {
+  CeedInt size = 0;
+
+  for (CeedInt i = 0; i < qf->num_input_fields; i++) size += qf->input_fields[i]->size;
+  for (CeedInt i = 0; i < qf->num_output_fields; i++) size += qf->output_fields[i]->size;
+  *bytes = (CeedSize)size * sizeof(CeedScalar);
+  return CEED_ERROR_SUCCESS;
+}
+
 /// @}
 
 /// ----------------------------------------------------------------------------
@@ -1080,14 +1114,18 @@ Ceed CeedQFunctionReturnCeed(CeedQFunction qf) { return qf->ceed; }
   @ref User
 **/
 int CeedQFunctionApply(CeedQFunction qf, CeedInt Q, CeedVector *u, CeedVector *v) {
-  CeedInt vec_length;
+  CeedInt      vec_length;
+  CeedSize     start_ns;
+  CeedOperator op_stats;
 
   CeedCheck(qf->Apply, CeedQFunctionReturnCeed(qf), CEED_ERROR_UNSUPPORTED, "Backend does not support CeedQFunctionApply");
   CeedCall(CeedQFunctionGetVectorLength(qf, &vec_length));
   CeedCheck(Q % vec_length == 0, CeedQFunctionReturnCeed(qf), CEED_ERROR_DIMENSION,
             "Number of quadrature points %" CeedInt_FMT " must be a multiple of %" CeedInt_FMT, Q, qf->vec_length);
   CeedCall(CeedQFunctionSetImmutable(qf));
+  CeedCall(CeedOperatorStatsGetCurrent(&op_stats, &start_ns));
   CeedCall(qf->Apply(qf, Q, u, v));
+  if (op_stats) CeedCall(CeedOperatorStatsRecordQFunction(op_stats, qf, Q, start_ns));
   return CEED_ERROR_SUCCESS;
 }
 
@@ -8,6 +8,7 @@
 #include <ceed-impl.h>
 #include <ceed.h>
 #include <ceed/backend.h>
+#include <stdbool.h>
 #include <stddef.h>
 
 /// @file
@@ -75,6 +76,57 @@ int CeedTensorContractApply(CeedTensorContract contract, CeedInt A, CeedInt B, C
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Apply tensor contraction with the even-odd decomposition of a centro-symmetric or centro-antisymmetric `t`
+
+  Computes the same contraction as @ref CeedTensorContractApply() from the even and odd halves of `t` given by @ref CeedMatrixFoldEvenOdd().
+  The middle index of `u` is folded into sums and differences of mirrored entries, which are contracted with the even and odd halves of `t` and
+    unfolded into mirrored pairs of entries of `v`, so the contraction takes about half of the multiply-adds.
+  See @ref CeedTensorContractHasEvenOdd() to check if the backend implements this contraction.
+
+  @param[in]  contract `CeedTensorContract` to use
+  @param[in]  A        First index of `u`, `v`
+  @param[in]  B        Middle index of `u`, one index of `t`
+  @param[in]  C        Last index of `u`, `v`
+  @param[in]  J        Middle index of `v`, one index of `t`
+  @param[in]  t_even   Even half of tensor array to contract against
+  @param[in]  t_odd    Odd half of tensor array to contract against
+  @param[in]  parity   1 if `t` is centro-symmetric, -1 if `t` is centro-antisymmetric
+  @param[in]  t_mode   Transpose mode for `t`, @ref CEED_NOTRANSPOSE for `t_jb` @ref CEED_TRANSPOSE for `t_bj`
+  @param[in]  add      Add mode
+  @param[in]  u        Input array
+  @param[out] v        Output array
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedTensorContractApplyEvenOdd(CeedTensorContract contract, CeedInt A, CeedInt B, CeedInt C, CeedInt J, const CeedScalar *restrict t_even,
+                                   const CeedScalar *restrict t_odd, CeedInt parity, CeedTransposeMode t_mode, const CeedInt add,
+                                   const CeedScalar *restrict u, CeedScalar *restrict v) {
+  CeedCheck(contract->ApplyEvenOdd, CeedTensorContractReturnCeed(contract), CEED_ERROR_UNSUPPORTED,
+            "Backend does not implement CeedTensorContractApplyEvenOdd");
+  CeedCall(contract->ApplyEvenOdd(contract, A, B, C, J, t_even, t_odd, parity, t_mode, add, u, v));
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Check if a `CeedTensorContract` implements @ref CeedTensorContractApplyEvenOdd()
+
+  Backends with register tiled contractions may not implement the even-odd decomposition, as the full contraction can be faster for them.
+
+  @param[in]  contract     `CeedTensorContract`
+  @param[out] has_even_odd Variable to store whether the even-odd decomposition is implemented
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedTensorContractHasEvenOdd(CeedTensorContract contract, bool *has_even_odd) {
+  *has_even_odd = contract->ApplyEvenOdd != NULL;
+  return CEED_ERROR_SUCCESS;
+}
+
 /**
   @brief Apply tensor contraction
 
@@ -113,6 +165,46 @@ int CeedTensorContractStridedApply(CeedTensorContract contract, CeedInt A, CeedI
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Get the number of register tile shapes a `CeedTensorContract` can apply with
+
+  Backends without tile shapes to choose from report a single tile shape.
+
+  @param[in]  contract  `CeedTensorContract`
+  @param[out] num_tiles Variable to store number of tile shapes
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedTensorContractGetNumTiles(CeedTensorContract contract, CeedInt *num_tiles) {
+  *num_tiles = 1;
+  if (contract->GetNumTiles) CeedCall(contract->GetNumTiles(contract, num_tiles));
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Set the register tile shape for subsequent applications of a `CeedTensorContract`
+
+  Tile shapes only change the order in which the contraction is computed, not the result.
+
+  @param[in,out] contract `CeedTensorContract`
+  @param[in]     tile     Index of tile shape, less than the number from @ref CeedTensorContractGetNumTiles()
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedTensorContractSetTile(CeedTensorContract contract, CeedInt tile) {
+  CeedInt num_tiles;
+
+  CeedCall(CeedTensorContractGetNumTiles(contract, &num_tiles));
+  CeedCheck(tile >= 0 && tile < num_tiles, CeedTensorContractReturnCeed(contract), CEED_ERROR_DIMENSION,
+            "Tile shape %" CeedInt_FMT " out of range for CeedTensorContract with %" CeedInt_FMT " tile shapes", tile, num_tiles);
+  if (contract->SetTile) CeedCall(contract->SetTile(contract, tile));
+  return CEED_ERROR_SUCCESS;
+}
+
 /**
   @brief Get the `Ceed` associated with a `CeedTensorContract`
 
@@ -59,6 +59,29 @@ const char *const CeedContextFieldTypes[] = {
     [CEED_CONTEXT_FIELD_BOOL]   = "bool",
 };
 
+const char *const CeedStorageTypes[] = {
+    [CEED_STORAGE_SCALAR] = "CeedScalar",
+    [CEED_STORAGE_FP32]   = "fp32",
+    [CEED_STORAGE_BF16]   = "bf16",
+};
+
+const char *const CeedColoringTypes[] = {
+    [CEED_COLORING_GREEDY]   = "greedy",
+    [CEED_COLORING_BALANCED] = "balanced",
+};
+
+const char *const CeedReorderTypes[] = {
+    [CEED_REORDER_RCM]    = "rcm",
+    [CEED_REORDER_MORTON] = "morton",
+};
+
+const char *const CeedStageTypes[] = {
+    [CEED_STAGE_OPERATOR]    = "operator",
+    [CEED_STAGE_RESTRICTION] = "restriction",
+    [CEED_STAGE_BASIS]       = "basis",
+    [CEED_STAGE_QFUNCTION]   = "qfunction",
+};
+
 const char *const CeedFESpaces[] = {
     [CEED_FE_SPACE_H1]    = "H^1 space",
     [CEED_FE_SPACE_HDIV]  = "H(div) space",
@@ -33,6 +33,155 @@ const CeedVector CEED_VECTOR_NONE = &ceed_vector_none;
 
 /// @}
 
+/// ----------------------------------------------------------------------------
+/// CeedVector Library Internal Functions
+/// ----------------------------------------------------------------------------
+/// @addtogroup CeedVectorDeveloper
+/// @{
+
+/// Number of independent partial sums used by the default reduction kernels, so the compiler can vectorize them without reassociating
+#define CEED_VECTOR_NUM_LANES 8
+/// Number of entries each thread processes at a time in the default fused kernels, sized to keep the chunks of all operands in cache
+#define CEED_VECTOR_CHUNK_SIZE 1024
+/// Minimum vector length for which the default fused kernels are threaded
+#define CEED_VECTOR_OMP_MIN_LENGTH 32768
+
+/**
+  @brief Check that `x` may be combined with `y` in a fused vector kernel
+
+  @param[in] y       Target `CeedVector`
+  @param[in] x       `CeedVector` to combine with `y`
+  @param[in] op_name Name of the calling function, for error messages
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedVectorCheckCompatible(CeedVector y, CeedVector x, const char *op_name) {
+  bool     has_valid_array_x = true, has_valid_array_y = true;
+  CeedSize length_x, length_y;
+
+  CeedCall(CeedVectorGetLength(y, &length_y));
+  CeedCall(CeedVectorGetLength(x, &length_x));
+  CeedCheck(length_x == length_y, CeedVectorReturnCeed(y), CEED_ERROR_UNSUPPORTED,
+            "Cannot combine vectors of different lengths in %s."
+            " x length: %" CeedSize_FMT " y length: %" CeedSize_FMT,
+            op_name, length_x, length_y);
+
+  CeedCall(CeedVectorHasValidArray(x, &has_valid_array_x));
+  CeedCheck(has_valid_array_x, CeedVectorReturnCeed(y), CEED_ERROR_BACKEND,
+            "CeedVector x has no valid data, must set data with CeedVectorSetValue or CeedVectorSetArray");
+  CeedCall(CeedVectorHasValidArray(y, &has_valid_array_y));
+  CeedCheck(has_valid_array_y, CeedVectorReturnCeed(y), CEED_ERROR_BACKEND,
+            "CeedVector y has no valid data, must set data with CeedVectorSetValue or CeedVectorSetArray");
+
+  {
+    Ceed ceed_x, ceed_y, ceed_parent_x, ceed_parent_y;
+
+    CeedCall(CeedVectorGetCeed(y, &ceed_y));
+    CeedCall(CeedVectorGetCeed(x, &ceed_x));
+    CeedCall(CeedGetParent(ceed_x, &ceed_parent_x));
+    CeedCall(CeedGetParent(ceed_y, &ceed_parent_y));
+    CeedCall(CeedDestroy(&ceed_x));
+    CeedCall(CeedDestroy(&ceed_y));
+    CeedCheck(ceed_parent_x == ceed_parent_y, CeedVectorReturnCeed(y), CEED_ERROR_INCOMPATIBLE,
+              "Vectors x and y must be created by the same Ceed context");
+    CeedCall(CeedDestroy(&ceed_parent_x));
+    CeedCall(CeedDestroy(&ceed_parent_y));
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Compute the dot product of two host arrays.
+
+  Partial sums are kept in @ref CEED_VECTOR_NUM_LANES independent lanes so the loop vectorizes.
+
+  @param[in] n Number of entries
+  @param[in] x First array
+  @param[in] y Second array
+
+  @return Dot product of `x` and `y`
+
+  @ref Developer
+**/
+static inline CeedScalar CeedVectorDotKernel(CeedSize n, const CeedScalar *x, const CeedScalar *y) {
+  CeedSize   i;
+  CeedScalar lanes[CEED_VECTOR_NUM_LANES] = {0.}, sum = 0.;
+
+  for (i = 0; i + CEED_VECTOR_NUM_LANES <= n; i += CEED_VECTOR_NUM_LANES) {
+    CeedPragmaSIMD for (CeedInt j = 0; j < CEED_VECTOR_NUM_LANES; j++) lanes[j] += x[i + j] * y[i + j];
+  }
+  for (; i < n; i++) sum += x[i] * y[i];
+  for (CeedInt j = 0; j < CEED_VECTOR_NUM_LANES; j++) sum += lanes[j];
+  return sum;
+}
+
+/**
+  @brief Compute `y = alpha x + y` on host arrays and return the norm contribution of the updated `y`.
+
+  For @ref CEED_NORM_1 and @ref CEED_NORM_2 the contribution is a sum of absolute values or squares, for @ref CEED_NORM_MAX it is the largest absolute value.
+
+  @param[in]     n         Number of entries
+  @param[in]     alpha     Scaling factor
+  @param[in]     x         Array to add
+  @param[in,out] y         Array to update
+  @param[in]     norm_type Norm type @ref CEED_NORM_1, @ref CEED_NORM_2, or @ref CEED_NORM_MAX
+
+  @return Norm contribution of the updated entries of `y`
+
+  @ref Developer
+**/
+static inline CeedScalar CeedVectorAXPYNormKernel(CeedSize n, CeedScalar alpha, const CeedScalar *x, CeedScalar *y, CeedNormType norm_type) {
+  CeedSize   i;
+  CeedScalar lanes[CEED_VECTOR_NUM_LANES] = {0.}, norm = 0.;
+
+  switch (norm_type) {
+    case CEED_NORM_1:
+      for (i = 0; i + CEED_VECTOR_NUM_LANES <= n; i += CEED_VECTOR_NUM_LANES) {
+        CeedPragmaSIMD for (CeedInt j = 0; j < CEED_VECTOR_NUM_LANES; j++) {
+          y[i + j] += alpha * x[i + j];
+          lanes[j] += fabs(y[i + j]);
+        }
+      }
+      for (; i < n; i++) {
+        y[i] += alpha * x[i];
+        norm += fabs(y[i]);
+      }
+      for (CeedInt j = 0; j < CEED_VECTOR_NUM_LANES; j++) norm += lanes[j];
+      break;
+    case CEED_NORM_2:
+      for (i = 0; i + CEED_VECTOR_NUM_LANES <= n; i += CEED_VECTOR_NUM_LANES) {
+        CeedPragmaSIMD for (CeedInt j = 0; j < CEED_VECTOR_NUM_LANES; j++) {
+          y[i + j] += alpha * x[i + j];
+          lanes[j] += y[i + j] * y[i + j];
+        }
+      }
+      for (; i < n; i++) {
+        y[i] += alpha * x[i];
+        norm += y[i] * y[i];
+      }
+      for (CeedInt j = 0; j < CEED_VECTOR_NUM_LANES; j++) norm += lanes[j];
+      break;
+    case CEED_NORM_MAX:
+      for (i = 0; i + CEED_VECTOR_NUM_LANES <= n; i += CEED_VECTOR_NUM_LANES) {
+        CeedPragmaSIMD for (CeedInt j = 0; j < CEED_VECTOR_NUM_LANES; j++) {
+          y[i + j] += alpha * x[i + j];
+          lanes[j] = lanes[j] > fabs(y[i + j]) ? lanes[j] : fabs(y[i + j]);
+        }
+      }
+      for (; i < n; i++) {
+        y[i] += alpha * x[i];
+        norm = norm > fabs(y[i]) ? norm : fabs(y[i]);
+      }
+      for (CeedInt j = 0; j < CEED_VECTOR_NUM_LANES; j++) norm = norm > lanes[j] ? norm : lanes[j];
+      break;
+  }
+  return norm;
+}
+
+/// @}
+
 /// ----------------------------------------------------------------------------
 /// CeedVector Backend API
 /// ----------------------------------------------------------------------------
@@ -214,6 +363,8 @@ int CeedVectorCopy(CeedVector vec, CeedVector vec_copy) {
   CeedMemType mem_type, mem_type_copy;
   CeedScalar *array;
 
+  CeedCall(CeedRequestSynchronizeVector(vec));
+  CeedCall(CeedRequestSynchronizeVector(vec_copy));
   // Get the preferred memory types
   {
     Ceed ceed;
@@ -265,6 +416,8 @@ int CeedVectorCopyStrided(CeedVector vec, CeedSize start, CeedSize stop, CeedSiz
   const CeedScalar *array      = NULL;
   CeedScalar       *array_copy = NULL;
 
+  CeedCall(CeedRequestSynchronizeVector(vec));
+  CeedCall(CeedRequestSynchronizeVector(vec_copy));
   // Check length
   {
     CeedSize length_vec, length_copy;
@@ -316,6 +469,7 @@ int CeedVectorCopyStrided(CeedVector vec, CeedSize start, CeedSize stop, CeedSiz
 int CeedVectorSetArray(CeedVector vec, CeedMemType mem_type, CeedCopyMode copy_mode, CeedScalar *array) {
   CeedSize length;
 
+  CeedCall(CeedRequestSynchronizeVector(vec));
   CeedCheck(vec->SetArray, CeedVectorReturnCeed(vec), CEED_ERROR_UNSUPPORTED, "Backend does not support VectorSetArray");
   CeedCheck(vec->state % 2 == 0, CeedVectorReturnCeed(vec), CEED_ERROR_ACCESS,
             "Cannot grant CeedVector array access, the access lock is already in use");
@@ -338,6 +492,7 @@ int CeedVectorSetArray(CeedVector vec, CeedMemType mem_type, CeedCopyMode copy_m
   @ref User
 **/
 int CeedVectorSetValue(CeedVector vec, CeedScalar value) {
+  CeedCall(CeedRequestSynchronizeVector(vec));
   CeedCheck(vec->state % 2 == 0, CeedVectorReturnCeed(vec), CEED_ERROR_ACCESS,
             "Cannot grant CeedVector array access, the access lock is already in use");
   CeedCheck(vec->num_readers == 0, CeedVectorReturnCeed(vec), CEED_ERROR_ACCESS, "Cannot grant CeedVector array access, a process has read access");
@@ -375,6 +530,7 @@ int CeedVectorSetValue(CeedVector vec, CeedScalar value) {
 int CeedVectorSetValueStrided(CeedVector vec, CeedSize start, CeedSize stop, CeedSize step, CeedScalar value) {
   CeedSize length;
 
+  CeedCall(CeedRequestSynchronizeVector(vec));
   CeedCheck(vec->state % 2 == 0, CeedVectorReturnCeed(vec), CEED_ERROR_ACCESS,
             "Cannot grant CeedVector array access, the access lock is already in use");
   CeedCheck(vec->num_readers == 0, CeedVectorReturnCeed(vec), CEED_ERROR_ACCESS, "Cannot grant CeedVector array access, a process has read access");
@@ -413,6 +569,7 @@ int CeedVectorSetValueStrided(CeedVector vec, CeedSize start, CeedSize stop, Cee
 int CeedVectorSyncArray(CeedVector vec, CeedMemType mem_type) {
   CeedSize length;
 
+  CeedCall(CeedRequestSynchronizeVector(vec));
   CeedCheck(vec->state % 2 == 0, CeedVectorReturnCeed(vec), CEED_ERROR_ACCESS, "Cannot sync CeedVector, the access lock is already in use");
 
   // Don't sync empty array
@@ -449,6 +606,7 @@ int CeedVectorTakeArray(CeedVector vec, CeedMemType mem_type, CeedScalar **array
   CeedSize    length;
   CeedScalar *temp_array = NULL;
 
+  CeedCall(CeedRequestSynchronizeVector(vec));
   CeedCheck(vec->state % 2 == 0, CeedVectorReturnCeed(vec), CEED_ERROR_ACCESS, "Cannot take CeedVector array, the access lock is already in use");
   CeedCheck(vec->num_readers == 0, CeedVectorReturnCeed(vec), CEED_ERROR_ACCESS, "Cannot take CeedVector array, a process has read access");
 
@@ -490,6 +648,7 @@ int CeedVectorTakeArray(CeedVector vec, CeedMemType mem_type, CeedScalar **array
 int CeedVectorGetArray(CeedVector vec, CeedMemType mem_type, CeedScalar **array) {
   CeedSize length;
 
+  CeedCall(CeedRequestSynchronizeVector(vec));
   CeedCheck(vec->GetArray, CeedVectorReturnCeed(vec), CEED_ERROR_UNSUPPORTED, "Backend does not support GetArray");
   CeedCheck(vec->state % 2 == 0, CeedVectorReturnCeed(vec), CEED_ERROR_ACCESS,
             "Cannot grant CeedVector array access, the access lock is already in use");
@@ -528,6 +687,7 @@ int CeedVectorGetArray(CeedVector vec, CeedMemType mem_type, CeedScalar **array)
 int CeedVectorGetArrayRead(CeedVector vec, CeedMemType mem_type, const CeedScalar **array) {
   CeedSize length;
 
+  CeedCall(CeedRequestSynchronizeVector(vec));
   CeedCheck(vec->GetArrayRead, CeedVectorReturnCeed(vec), CEED_ERROR_UNSUPPORTED, "Backend does not support GetArrayRead");
   CeedCheck(vec->state % 2 == 0, CeedVectorReturnCeed(vec), CEED_ERROR_ACCESS,
             "Cannot grant CeedVector read-only array access, the access lock is already in use");
@@ -565,6 +725,7 @@ int CeedVectorGetArrayRead(CeedVector vec, CeedMemType mem_type, const CeedScala
 int CeedVectorGetArrayWrite(CeedVector vec, CeedMemType mem_type, CeedScalar **array) {
   CeedSize length;
 
+  CeedCall(CeedRequestSynchronizeVector(vec));
   CeedCheck(vec->GetArrayWrite, CeedVectorReturnCeed(vec), CEED_ERROR_UNSUPPORTED, "Backend does not support CeedVectorGetArrayWrite");
   CeedCheck(vec->state % 2 == 0, CeedVectorReturnCeed(vec), CEED_ERROR_ACCESS,
             "Cannot grant CeedVector array access, the access lock is already in use");
@@ -641,6 +802,7 @@ int CeedVectorNorm(CeedVector vec, CeedNormType norm_type, CeedScalar *norm) {
   bool     has_valid_array = true;
   CeedSize length;
 
+  CeedCall(CeedRequestSynchronizeVector(vec));
   CeedCall(CeedVectorHasValidArray(vec, &has_valid_array));
   CeedCheck(has_valid_array, CeedVectorReturnCeed(vec), CEED_ERROR_BACKEND,
             "CeedVector has no valid data to compute norm, must set data with CeedVectorSetValue or CeedVectorSetArray");
@@ -685,6 +847,132 @@ int CeedVectorNorm(CeedVector vec, CeedNormType norm_type, CeedScalar *norm) {
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Compute the dot product `x . y` of two `CeedVector`.
+
+  Note: This operation is local to the `CeedVector`, as with @ref CeedVectorNorm().
+
+  @param[in]  x      First `CeedVector`
+  @param[in]  y      Second `CeedVector`, may be the same as `x`
+  @param[out] result Variable to store the dot product
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedVectorDot(CeedVector x, CeedVector y, CeedScalar *result) {
+  CeedSize          length;
+  const CeedScalar *x_array = NULL, *y_array = NULL;
+
+  CeedCall(CeedRequestSynchronizeVector(x));
+  CeedCall(CeedRequestSynchronizeVector(y));
+  CeedCall(CeedVectorCheckCompatible(y, x, "CeedVectorDot"));
+
+  // Return early for empty vectors
+  CeedCall(CeedVectorGetLength(x, &length));
+  if (length == 0) {
+    *result = 0.;
+    return CEED_ERROR_SUCCESS;
+  }
+
+  // Backend implementation
+  if (x->Dot) {
+    CeedCall(x->Dot(x, y, result));
+    return CEED_ERROR_SUCCESS;
+  }
+
+  // Default implementation
+  CeedCall(CeedVectorGetArrayRead(x, CEED_MEM_HOST, &x_array));
+  CeedCall(CeedVectorGetArrayRead(y, CEED_MEM_HOST, &y_array));
+
+  assert(x_array);
+  assert(y_array);
+
+  {
+    const CeedSize num_chunks = (length + CEED_VECTOR_CHUNK_SIZE - 1) / CEED_VECTOR_CHUNK_SIZE;
+    CeedScalar     sum        = 0.;
+
+    CeedPragmaOMP(parallel for reduction(+ : sum) schedule(static) if (length >= CEED_VECTOR_OMP_MIN_LENGTH))
+    for (CeedSize c = 0; c < num_chunks; c++) {
+      const CeedSize start = c * CEED_VECTOR_CHUNK_SIZE, n = length - start < CEED_VECTOR_CHUNK_SIZE ? length - start : CEED_VECTOR_CHUNK_SIZE;
+
+      sum += CeedVectorDotKernel(n, &x_array[start], &y_array[start]);
+    }
+    *result = sum;
+  }
+
+  CeedCall(CeedVectorRestoreArrayRead(x, &x_array));
+  CeedCall(CeedVectorRestoreArrayRead(y, &y_array));
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Compute the dot products `x . y[k]` of one `CeedVector` with several others.
+
+  The default implementation reads `x` once for all `num_vecs` products, so Krylov methods with several inner products per iteration do not stream `x` repeatedly.
+
+  Note: This operation is local to the `CeedVector`, as with @ref CeedVectorNorm().
+
+  @param[in]  x        First `CeedVector`
+  @param[in]  num_vecs Number of `CeedVector` in `y`
+  @param[in]  y        Array of `num_vecs` `CeedVector`, any of which may be the same as `x`
+  @param[out] results  Array of size `num_vecs` to store the dot products
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedVectorMDot(CeedVector x, CeedInt num_vecs, CeedVector *y, CeedScalar *results) {
+  CeedSize           length;
+  const CeedScalar  *x_array  = NULL;
+  const CeedScalar **y_arrays = NULL;
+
+  CeedCall(CeedRequestSynchronizeVector(x));
+  for (CeedInt k = 0; k < num_vecs; k++) CeedCall(CeedRequestSynchronizeVector(y[k]));
+  for (CeedInt k = 0; k < num_vecs; k++) CeedCall(CeedVectorCheckCompatible(y[k], x, "CeedVectorMDot"));
+
+  // Return early for empty vectors
+  CeedCall(CeedVectorGetLength(x, &length));
+  if (num_vecs == 0) return CEED_ERROR_SUCCESS;
+  if (length == 0) {
+    for (CeedInt k = 0; k < num_vecs; k++) results[k] = 0.;
+    return CEED_ERROR_SUCCESS;
+  }
+
+  // Backend implementation
+  if (x->MDot) {
+    CeedCall(x->MDot(x, num_vecs, y, results));
+    return CEED_ERROR_SUCCESS;
+  }
+
+  // Default implementation
+  CeedCall(CeedCalloc(num_vecs, &y_arrays));
+  CeedCall(CeedVectorGetArrayRead(x, CEED_MEM_HOST, &x_array));
+  assert(x_array);
+  for (CeedInt k = 0; k < num_vecs; k++) {
+    CeedCall(CeedVectorGetArrayRead(y[k], CEED_MEM_HOST, &y_arrays[k]));
+    assert(y_arrays[k]);
+    results[k] = 0.;
+  }
+
+  {
+    const CeedSize num_chunks = (length + CEED_VECTOR_CHUNK_SIZE - 1) / CEED_VECTOR_CHUNK_SIZE;
+
+    // Each chunk of x stays in cache while it is multiplied against every y
+    CeedPragmaOMP(parallel for reduction(+ : results[:num_vecs]) schedule(static) if (length >= CEED_VECTOR_OMP_MIN_LENGTH))
+    for (CeedSize c = 0; c < num_chunks; c++) {
+      const CeedSize start = c * CEED_VECTOR_CHUNK_SIZE, n = length - start < CEED_VECTOR_CHUNK_SIZE ? length - start : CEED_VECTOR_CHUNK_SIZE;
+
+      for (CeedInt k = 0; k < num_vecs; k++) results[k] += CeedVectorDotKernel(n, &x_array[start], &y_arrays[k][start]);
+    }
+  }
+
+  for (CeedInt k = 0; k < num_vecs; k++) CeedCall(CeedVectorRestoreArrayRead(y[k], &y_arrays[k]));
+  CeedCall(CeedVectorRestoreArrayRead(x, &x_array));
+  CeedCall(CeedFree(&y_arrays));
+  return CEED_ERROR_SUCCESS;
+}
+
 /**
   @brief Compute `x = alpha x`
 
@@ -700,6 +988,7 @@ int CeedVectorScale(CeedVector x, CeedScalar alpha) {
   CeedSize    length;
   CeedScalar *x_array = NULL;
 
+  CeedCall(CeedRequestSynchronizeVector(x));
   CeedCall(CeedVectorHasValidArray(x, &has_valid_array));
   CeedCheck(has_valid_array, CeedVectorReturnCeed(x), CEED_ERROR_BACKEND,
             "CeedVector has no valid data to scale, must set data with CeedVectorSetValue or CeedVectorSetArray");
@@ -722,6 +1011,8 @@ int CeedVectorScale(CeedVector x, CeedScalar alpha) {
 /**
   @brief Compute `y = alpha x + y`
 
+  Note: Work submitted to the `Ceed` context of `y` with a @ref CeedRequest is completed first.
+
   @param[in,out] y     target `CeedVector` for sum
   @param[in]     alpha scaling factor
   @param[in]     x     second `CeedVector`, must be different than ``y`
@@ -736,6 +1027,8 @@ int CeedVectorAXPY(CeedVector y, CeedScalar alpha, CeedVector x) {
   CeedScalar       *y_array = NULL;
   CeedScalar const *x_array = NULL;
 
+  CeedCall(CeedRequestSynchronizeVector(y));
+  CeedCall(CeedRequestSynchronizeVector(x));
   CeedCall(CeedVectorGetLength(y, &length_y));
   CeedCall(CeedVectorGetLength(x, &length_x));
   CeedCheck(length_x == length_y, CeedVectorReturnCeed(y), CEED_ERROR_UNSUPPORTED,
@@ -807,6 +1100,8 @@ int CeedVectorAXPBY(CeedVector y, CeedScalar alpha, CeedScalar beta, CeedVector
   CeedScalar       *y_array = NULL;
   CeedScalar const *x_array = NULL;
 
+  CeedCall(CeedRequestSynchronizeVector(y));
+  CeedCall(CeedRequestSynchronizeVector(x));
   CeedCall(CeedVectorGetLength(y, &length_y));
   CeedCall(CeedVectorGetLength(x, &length_x));
   CeedCheck(length_x == length_y, CeedVectorReturnCeed(y), CEED_ERROR_UNSUPPORTED,
@@ -860,6 +1155,153 @@ int CeedVectorAXPBY(CeedVector y, CeedScalar alpha, CeedScalar beta, CeedVector
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Compute `y = y + sum_k alpha[k] x[k]`
+
+  The default implementation reads and writes `y` once for all `num_vecs` updates.
+
+  Note: Work submitted to the `Ceed` context of `y` with a @ref CeedRequest is completed first.
+
+  @param[in,out] y        target `CeedVector` for sum
+  @param[in]     num_vecs Number of `CeedVector` in `x`
+  @param[in]     alpha    Array of `num_vecs` scaling factors
+  @param[in]     x        Array of `num_vecs` `CeedVector`, each must be different than `y`
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedVectorMAXPY(CeedVector y, CeedInt num_vecs, const CeedScalar *alpha, CeedVector *x) {
+  CeedSize           length;
+  CeedScalar        *y_array  = NULL;
+  const CeedScalar **x_arrays = NULL;
+
+  CeedCall(CeedRequestSynchronizeVector(y));
+  for (CeedInt k = 0; k < num_vecs; k++) CeedCall(CeedRequestSynchronizeVector(x[k]));
+  for (CeedInt k = 0; k < num_vecs; k++) {
+    CeedCheck(x[k] != y, CeedVectorReturnCeed(y), CEED_ERROR_UNSUPPORTED, "Cannot use same vector for x and y in CeedVectorMAXPY");
+    CeedCall(CeedVectorCheckCompatible(y, x[k], "CeedVectorMAXPY"));
+  }
+
+  // Return early for empty vectors
+  CeedCall(CeedVectorGetLength(y, &length));
+  if (length == 0 || num_vecs == 0) return CEED_ERROR_SUCCESS;
+
+  // Backend implementation
+  if (y->MAXPY) {
+    CeedCall(y->MAXPY(y, num_vecs, alpha, x));
+    return CEED_ERROR_SUCCESS;
+  }
+
+  // Default implementation
+  CeedCall(CeedCalloc(num_vecs, &x_arrays));
+  CeedCall(CeedVectorGetArray(y, CEED_MEM_HOST, &y_array));
+  assert(y_array);
+  for (CeedInt k = 0; k < num_vecs; k++) {
+    CeedCall(CeedVectorGetArrayRead(x[k], CEED_MEM_HOST, &x_arrays[k]));
+    assert(x_arrays[k]);
+  }
+
+  {
+    const CeedSize num_chunks = (length + CEED_VECTOR_CHUNK_SIZE - 1) / CEED_VECTOR_CHUNK_SIZE;
+
+    // Each chunk of y stays in cache while every x is added to it
+    CeedPragmaOMP(parallel for schedule(static) if (length >= CEED_VECTOR_OMP_MIN_LENGTH))
+    for (CeedSize c = 0; c < num_chunks; c++) {
+      const CeedSize start   = c * CEED_VECTOR_CHUNK_SIZE;
+      const CeedSize n       = length - start < CEED_VECTOR_CHUNK_SIZE ? length - start : CEED_VECTOR_CHUNK_SIZE;
+      CeedScalar    *y_chunk = &y_array[start];
+
+      for (CeedInt k = 0; k < num_vecs; k++) {
+        const CeedScalar  alpha_k = alpha[k];
+        const CeedScalar *x_chunk = &x_arrays[k][start];
+
+        CeedPragmaSIMD for (CeedSize i = 0; i < n; i++) y_chunk[i] += alpha_k * x_chunk[i];
+      }
+    }
+  }
+
+  for (CeedInt k = 0; k < num_vecs; k++) CeedCall(CeedVectorRestoreArrayRead(x[k], &x_arrays[k]));
+  CeedCall(CeedVectorRestoreArray(y, &y_array));
+  CeedCall(CeedFree(&x_arrays));
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Compute `y = alpha x + y` and the norm of the updated `y` in a single pass
+
+  Note: Work submitted to the `Ceed` context of `y` with a @ref CeedRequest is completed first.
+        This operation is local to the `CeedVector`, as with @ref CeedVectorNorm().
+
+  @param[in,out] y         target `CeedVector` for sum
+  @param[in]     alpha     scaling factor
+  @param[in]     x         second `CeedVector`, must be different than `y`
+  @param[in]     norm_type Norm type @ref CEED_NORM_1, @ref CEED_NORM_2, or @ref CEED_NORM_MAX
+  @param[out]    norm      Variable to store norm value of the updated `y`
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedVectorAXPYNorm(CeedVector y, CeedScalar alpha, CeedVector x, CeedNormType norm_type, CeedScalar *norm) {
+  CeedSize          length;
+  CeedScalar       *y_array = NULL;
+  CeedScalar const *x_array = NULL;
+
+  CeedCall(CeedRequestSynchronizeVector(y));
+  CeedCall(CeedRequestSynchronizeVector(x));
+  CeedCheck(x != y, CeedVectorReturnCeed(y), CEED_ERROR_UNSUPPORTED, "Cannot use same vector for x and y in CeedVectorAXPYNorm");
+  CeedCall(CeedVectorCheckCompatible(y, x, "CeedVectorAXPYNorm"));
+
+  // Return early for empty vectors
+  CeedCall(CeedVectorGetLength(y, &length));
+  if (length == 0) {
+    *norm = 0.;
+    return CEED_ERROR_SUCCESS;
+  }
+
+  // Backend implementation
+  if (y->AXPYNorm) {
+    CeedCall(y->AXPYNorm(y, alpha, x, norm_type, norm));
+    return CEED_ERROR_SUCCESS;
+  }
+
+  // Default implementation
+  CeedCall(CeedVectorGetArray(y, CEED_MEM_HOST, &y_array));
+  CeedCall(CeedVectorGetArrayRead(x, CEED_MEM_HOST, &x_array));
+
+  assert(x_array);
+  assert(y_array);
+
+  {
+    const CeedSize num_chunks = (length + CEED_VECTOR_CHUNK_SIZE - 1) / CEED_VECTOR_CHUNK_SIZE;
+    CeedScalar     result     = 0.;
+
+    if (norm_type == CEED_NORM_MAX) {
+      CeedPragmaOMP(parallel for reduction(max : result) schedule(static) if (length >= CEED_VECTOR_OMP_MIN_LENGTH))
+      for (CeedSize c = 0; c < num_chunks; c++) {
+        const CeedSize   start      = c * CEED_VECTOR_CHUNK_SIZE;
+        const CeedSize   n          = length - start < CEED_VECTOR_CHUNK_SIZE ? length - start : CEED_VECTOR_CHUNK_SIZE;
+        const CeedScalar chunk_norm = CeedVectorAXPYNormKernel(n, alpha, &x_array[start], &y_array[start], norm_type);
+
+        result = result > chunk_norm ? result : chunk_norm;
+      }
+    } else {
+      CeedPragmaOMP(parallel for reduction(+ : result) schedule(static) if (length >= CEED_VECTOR_OMP_MIN_LENGTH))
+      for (CeedSize c = 0; c < num_chunks; c++) {
+        const CeedSize start = c * CEED_VECTOR_CHUNK_SIZE, n = length - start < CEED_VECTOR_CHUNK_SIZE ? length - start : CEED_VECTOR_CHUNK_SIZE;
+
+        result += CeedVectorAXPYNormKernel(n, alpha, &x_array[start], &y_array[start], norm_type);
+      }
+    }
+    *norm = norm_type == CEED_NORM_2 ? sqrt(result) : result;
+  }
+
+  CeedCall(CeedVectorRestoreArray(y, &y_array));
+  CeedCall(CeedVectorRestoreArrayRead(x, &x_array));
+  return CEED_ERROR_SUCCESS;
+}
+
 /**
   @brief Compute the pointwise multiplication \f$w = x .* y\f$.
 
@@ -879,6 +1321,9 @@ int CeedVectorPointwiseMult(CeedVector w, CeedVector x, CeedVector y) {
   CeedScalar const *x_array = NULL, *y_array = NULL;
   CeedSize          length_w, length_x, length_y;
 
+  CeedCall(CeedRequestSynchronizeVector(w));
+  CeedCall(CeedRequestSynchronizeVector(x));
+  CeedCall(CeedRequestSynchronizeVector(y));
   CeedCall(CeedVectorGetLength(w, &length_w));
   CeedCall(CeedVectorGetLength(x, &length_x));
   CeedCall(CeedVectorGetLength(y, &length_y));
@@ -967,6 +1412,7 @@ int CeedVectorReciprocal(CeedVector vec) {
   CeedSize    length;
   CeedScalar *array;
 
+  CeedCall(CeedRequestSynchronizeVector(vec));
   CeedCall(CeedVectorHasValidArray(vec, &has_valid_array));
   CeedCheck(has_valid_array, CeedVectorReturnCeed(vec), CEED_ERROR_BACKEND,
             "CeedVector has no valid data to compute reciprocal, must set data with CeedVectorSetValue or CeedVectorSetArray");
@@ -1108,6 +1554,7 @@ int CeedVectorDestroy(CeedVector *vec) {
     *vec = NULL;
     return CEED_ERROR_SUCCESS;
   }
+  CeedCall(CeedRequestSynchronizeVector(*vec));
   CeedCheck((*vec)->state % 2 == 0, (*vec)->ceed, CEED_ERROR_ACCESS, "Cannot destroy CeedVector, the writable access lock is in use");
   CeedCheck((*vec)->num_readers == 0, (*vec)->ceed, CEED_ERROR_ACCESS, "Cannot destroy CeedVector, a process has read access");
 
@@ -10,12 +10,16 @@
 #include <ceed.h>
 #include <ceed/backend.h>
 #include <limits.h>
+#include <pthread.h>
 #include <stdarg.h>
 #include <stdbool.h>
 #include <stddef.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 /// @cond DOXYGEN_SKIP
 static CeedRequest ceed_request_immediate;
@@ -25,10 +29,70 @@ static struct {
   char prefix[CEED_MAX_RESOURCE_LEN];
   int (*init)(const char *resource, Ceed f);
   unsigned int priority;
-} backends[32];
+} backends[64];
 static size_t num_backends;
 
 #define CEED_FTABLE_ENTRY(class, method) {#class #method, offsetof(struct class##_private, method)}
+
+// Host task queue, served in submission order by one worker thread
+struct CeedTaskQueue_private {
+  pthread_mutex_t lock;
+  pthread_cond_t  has_task, has_completed;
+  pthread_t       worker;
+  CeedRequest     head, tail;
+  CeedRequest     waitable;    /* Requests returned to the caller that have not been passed to CeedRequestWait */
+  CeedInt         num_pending; /* Number of submitted tasks not yet completed */
+  int             error_code;  /* First error from a task submitted with CEED_REQUEST_ORDERED */
+  bool            is_running, is_shutdown;
+};
+
+struct CeedRequest_private {
+  CeedTaskQueue queue; /* NULL once the queue has been destroyed */
+  CeedRequest   next, next_waitable;
+  int (*Run)(CeedOperator, CeedVector, CeedVector);
+  CeedOperator op;
+  CeedVector   in, out;
+  CeedInt      num_vecs;
+  CeedVector  *vecs; /* Vectors read or written by the task, including passive operator fields */
+  bool         is_ordered, is_done;
+  int          error_code;
+};
+
+// Set on host task queue worker threads
+static _Thread_local bool ceed_is_task_worker;
+
+#define CEED_SCRATCH_MIN_BLOCK_SIZE (64 * 1024)
+
+// Scratch arena for one thread, a stack of borrowed regions in a list of aligned blocks
+typedef struct CeedScratchArena_private *CeedScratchArena;
+struct CeedScratchArena_private {
+  pthread_t        thread;
+  CeedScratchArena next;
+  char           **blocks;
+  size_t          *block_sizes;
+  size_t           offset; /* Offset of the next region in the current block */
+  CeedInt          num_blocks, current, num_borrowed;
+};
+
+// Header stored before each borrowed region, recording the arena top to restore
+typedef struct {
+  size_t  offset;
+  CeedInt current;
+} CeedScratchMark;
+
+// Scratch arenas for all threads using a root Ceed context
+struct CeedScratch_private {
+  pthread_mutex_t  lock;
+  CeedSize         id; /* Unique over the life of the process, for the thread local arena lookup */
+  CeedScratchArena arenas;
+  CeedCounter      num_allocs;
+};
+
+static CeedCounter ceed_scratch_num_ids;
+static _Thread_local struct {
+  CeedSize         id;
+  CeedScratchArena arena;
+} ceed_scratch_thread;
 /// @endcond
 
 /// @file
@@ -75,7 +139,11 @@ CeedRequest *const CEED_REQUEST_IMMEDIATE = &ceed_request_immediate;
 
   which allows the sequence to complete asynchronously but does not start `op2` until `op1` has completed.
 
-  @todo The current implementation is overly strict, offering equivalent semantics to @ref CEED_REQUEST_IMMEDIATE.
+  On host backends, work submitted with a @ref CeedRequest is executed by a worker thread owned by the `Ceed` context, in the order it was submitted.
+  Errors from work submitted with @ref CEED_REQUEST_ORDERED are returned by the next @ref CeedRequestWait() on the same `Ceed` context.
+  Objects used by pending work must not be modified or destroyed until the work completes.
+  `CeedVector` functions that access vector data, such as @ref CeedVectorGetArray(), @ref CeedVectorSetValue(), or @ref CeedVectorDot(), first wait
+  for all pending work on the `Ceed` context of the vector.
 
   @sa CEED_REQUEST_IMMEDIATE
  */
@@ -85,6 +153,7 @@ CeedRequest *const CEED_REQUEST_ORDERED = &ceed_request_ordered;
   @brief Wait for a @ref CeedRequest to complete.
 
   Calling @ref CeedRequestWait() on a `NULL` request is a no-op.
+  Work submitted earlier to the same `Ceed` context, including with @ref CEED_REQUEST_ORDERED, has also completed when this function returns.
 
   @param[in,out] req Address of @ref CeedRequest to wait for; zeroed on completion.
 
@@ -93,8 +162,28 @@ CeedRequest *const CEED_REQUEST_ORDERED = &ceed_request_ordered;
   @ref User
 **/
 int CeedRequestWait(CeedRequest *req) {
+  int           error_code;
+  CeedTaskQueue queue;
+
   if (!*req) return CEED_ERROR_SUCCESS;
-  return CeedError(NULL, CEED_ERROR_UNSUPPORTED, "CeedRequestWait not implemented");
+  queue = (*req)->queue;
+  if (queue) {
+    CeedRequest *waitable;
+
+    pthread_mutex_lock(&queue->lock);
+    while (!(*req)->is_done) pthread_cond_wait(&queue->has_completed, &queue->lock);
+    // Errors from earlier ordered work are reported first
+    error_code        = queue->error_code ? queue->error_code : (*req)->error_code;
+    queue->error_code = CEED_ERROR_SUCCESS;
+    for (waitable = &queue->waitable; *waitable != *req; waitable = &(*waitable)->next_waitable) continue;
+    *waitable = (*req)->next_waitable;
+    pthread_mutex_unlock(&queue->lock);
+  } else {
+    // The queue was drained and destroyed with its `Ceed` context
+    error_code = (*req)->error_code;
+  }
+  CeedCall(CeedFree(req));
+  return error_code;
 }
 
 /// @}
@@ -141,6 +230,8 @@ int CeedRegisterImpl(const char *prefix, int (*init)(const char *, Ceed), unsign
 /**
   @brief Create a work vector space for a `ceed`
 
+  The budget for memory held by work vectors is read from `CEED_WORK_VECTORS_MAX_SIZE`, in MiB.
+
   @param[in,out] ceed `Ceed` to create work vector space for
 
   @return An error code: 0 - success, otherwise - failure
@@ -148,7 +239,88 @@ int CeedRegisterImpl(const char *prefix, int (*init)(const char *, Ceed), unsign
   @ref Developer
 **/
 static int CeedWorkVectorsCreate(Ceed ceed) {
+  const char *max_size = getenv("CEED_WORK_VECTORS_MAX_SIZE");
+
   CeedCall(CeedCalloc(1, &ceed->work_vectors));
+  if (max_size) ceed->work_vectors->max_bytes = (CeedSize)(strtod(max_size, NULL) * 1024 * 1024);
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Get the size class of a work vector length
+
+  @param[in] len Length of work vector
+
+  @return Size class, `floor(log2(len))`
+
+  @ref Developer
+**/
+static CeedInt CeedWorkVectorSizeClass(CeedSize len) {
+  CeedInt size_class = 0;
+
+  while (len > 1 && size_class < CEED_WORK_VECTOR_NUM_CLASSES - 1) {
+    len >>= 1;
+    size_class++;
+  }
+  return size_class;
+}
+
+/**
+  @brief Remove an unused work vector from a `ceed`
+
+  @param[in,out] ceed   `Ceed` holding the work vector
+  @param[in,out] bucket Size class bucket holding the work vector
+  @param[in]     i      Index of work vector in `bucket`
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedWorkVectorsRemove(Ceed ceed, CeedWorkVectorBucket *bucket, CeedInt i) {
+  const CeedInt last = bucket->num_vecs - 1;
+
+  CeedCheck(!bucket->is_in_use[i], ceed, CEED_ERROR_ACCESS, "Work vector checked out but not returned");
+  ceed->work_vectors->num_bytes -= bucket->lengths[i] * (CeedSize)sizeof(CeedScalar);
+  ceed->ref_count += 2;  // Note: increase ref_count to prevent Ceed destructor from triggering
+  CeedCall(CeedVectorDestroy(&bucket->vecs[i]));
+  ceed->ref_count -= 1;  // Note: restore ref_count
+  bucket->vecs[i]      = bucket->vecs[last];
+  bucket->is_in_use[i] = bucket->is_in_use[last];
+  bucket->lengths[i]   = bucket->lengths[last];
+  bucket->last_used[i] = bucket->last_used[last];
+  bucket->vecs[last]   = NULL;
+  bucket->num_vecs--;
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Remove least recently used unused work vectors until the memory held by work vectors of a `ceed` is within budget
+
+  @param[in,out] ceed `Ceed` to trim work vectors for
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedWorkVectorsTrim(Ceed ceed) {
+  CeedWorkVectors work_vectors = ceed->work_vectors;
+
+  while (work_vectors->max_bytes > 0 && work_vectors->num_bytes > work_vectors->max_bytes) {
+    CeedInt               lru_index  = -1;
+    CeedWorkVectorBucket *lru_bucket = NULL;
+
+    for (CeedInt c = 0; c < CEED_WORK_VECTOR_NUM_CLASSES; c++) {
+      CeedWorkVectorBucket *bucket = &work_vectors->buckets[c];
+
+      for (CeedInt i = 0; i < bucket->num_vecs; i++) {
+        if (bucket->is_in_use[i] || (lru_bucket && bucket->last_used[i] >= lru_bucket->last_used[lru_index])) continue;
+        lru_bucket = bucket;
+        lru_index  = i;
+      }
+    }
+    if (!lru_bucket) break;
+    CeedCall(CeedWorkVectorsRemove(ceed, lru_bucket, lru_index));
+  }
   return CEED_ERROR_SUCCESS;
 }
 
@@ -163,18 +335,297 @@ static int CeedWorkVectorsCreate(Ceed ceed) {
 **/
 static int CeedWorkVectorsDestroy(Ceed ceed) {
   if (!ceed->work_vectors) return CEED_ERROR_SUCCESS;
-  for (CeedSize i = 0; i < ceed->work_vectors->num_vecs; i++) {
-    CeedCheck(!ceed->work_vectors->is_in_use[i], ceed, CEED_ERROR_ACCESS, "Work vector %" CeedSize_FMT " checked out but not returned");
-    ceed->ref_count += 2;  // Note: increase ref_count to prevent Ceed destructor from triggering again
-    CeedCall(CeedVectorDestroy(&ceed->work_vectors->vecs[i]));
-    ceed->ref_count -= 1;  // Note: restore ref_count
+  for (CeedInt c = 0; c < CEED_WORK_VECTOR_NUM_CLASSES; c++) {
+    CeedWorkVectorBucket *bucket = &ceed->work_vectors->buckets[c];
+
+    while (bucket->num_vecs > 0) CeedCall(CeedWorkVectorsRemove(ceed, bucket, bucket->num_vecs - 1));
+    CeedCall(CeedFree(&bucket->is_in_use));
+    CeedCall(CeedFree(&bucket->vecs));
+    CeedCall(CeedFree(&bucket->lengths));
+    CeedCall(CeedFree(&bucket->last_used));
   }
-  CeedCall(CeedFree(&ceed->work_vectors->is_in_use));
-  CeedCall(CeedFree(&ceed->work_vectors->vecs));
   CeedCall(CeedFree(&ceed->work_vectors));
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Get the root `Ceed` context that owns the host task queue for a `Ceed` context
+
+  @param[in] ceed `Ceed` context
+
+  @return Root `Ceed` context, without taking a reference
+
+  @ref Developer
+**/
+static Ceed CeedGetTaskQueueRoot(Ceed ceed) {
+  while (ceed->parent || ceed->op_fallback_parent) ceed = ceed->parent ? ceed->parent : ceed->op_fallback_parent;
+  return ceed;
+}
+
+/**
+  @brief Run tasks from a host task queue until the queue is shut down
+
+  @param[in,out] data `CeedTaskQueue` to serve
+
+  @return `NULL`
+
+  @ref Developer
+**/
+static void *CeedTaskQueueWorker(void *data) {
+  CeedTaskQueue queue = data;
+
+  ceed_is_task_worker = true;
+  pthread_mutex_lock(&queue->lock);
+  while (true) {
+    int         error_code;
+    CeedRequest req;
+
+    while (!queue->head && !queue->is_shutdown) pthread_cond_wait(&queue->has_task, &queue->lock);
+    if (!queue->head) break;
+    req         = queue->head;
+    queue->head = req->next;
+    if (!queue->head) queue->tail = NULL;
+    queue->is_running = true;
+    pthread_mutex_unlock(&queue->lock);
+
+    error_code = req->Run(req->op, req->in, req->out);
+
+    pthread_mutex_lock(&queue->lock);
+    queue->is_running = false;
+    queue->num_pending--;
+    for (CeedInt i = 0; i < req->num_vecs; i++) req->vecs[i]->num_pending_tasks--;
+    CeedFree(&req->vecs);
+    if (req->is_ordered) {
+      if (error_code && !queue->error_code) queue->error_code = error_code;
+      CeedFree(&req);
+    } else {
+      req->error_code = error_code;
+      req->is_done    = true;
+    }
+    pthread_cond_broadcast(&queue->has_completed);
+  }
+  pthread_mutex_unlock(&queue->lock);
+  return NULL;
+}
+
+/**
+  @brief Check if the calling thread is running a task from a host task queue.
+
+  OpenMP threads started by a running task do not share the thread local flag of the worker thread, so any thread in an active parallel region is treated as part of the running task.
+
+  @param[in] queue `CeedTaskQueue` to check
+
+  @return Boolean flag indicating if the caller must not wait on `queue`
+
+  @ref Developer
+**/
+static bool CeedTaskQueueIsInTask(CeedTaskQueue queue) {
+  bool is_in_task = ceed_is_task_worker;
+
+#ifdef _OPENMP
+  if (!is_in_task && omp_in_parallel()) {
+    pthread_mutex_lock(&queue->lock);
+    is_in_task = queue->is_running;
+    pthread_mutex_unlock(&queue->lock);
+  }
+#endif
+  return is_in_task;
+}
+
+/**
+  @brief Create the host task queue for a `ceed` and start its worker thread
+
+  @param[in,out] ceed `Ceed` to create host task queue for
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedTaskQueueCreate(Ceed ceed) {
+  CeedTaskQueue queue;
+
+  CeedCall(CeedCalloc(1, &queue));
+  pthread_mutex_init(&queue->lock, NULL);
+  pthread_cond_init(&queue->has_task, NULL);
+  pthread_cond_init(&queue->has_completed, NULL);
+  if (pthread_create(&queue->worker, NULL, CeedTaskQueueWorker, queue)) {
+    // LCOV_EXCL_START
+    pthread_cond_destroy(&queue->has_completed);
+    pthread_cond_destroy(&queue->has_task);
+    pthread_mutex_destroy(&queue->lock);
+    CeedCall(CeedFree(&queue));
+    return CeedError(ceed, CEED_ERROR_MAJOR, "Unable to start host task queue worker thread");
+    // LCOV_EXCL_STOP
+  }
+  ceed->task_queue = queue;
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Destroy the host task queue for a `ceed` after completing all submitted work.
+
+  Requests that have not been passed to @ref CeedRequestWait() are detached from the queue and keep their own error code.
+  An error from work submitted with @ref CEED_REQUEST_ORDERED that has not been reported yet is passed on to these requests.
+
+  @param[in,out] ceed `Ceed` to destroy host task queue for
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedTaskQueueDestroy(Ceed ceed) {
+  CeedTaskQueue queue = ceed->task_queue;
+
+  if (!queue) return CEED_ERROR_SUCCESS;
+  // The worker completes all queued tasks before it exits
+  pthread_mutex_lock(&queue->lock);
+  queue->is_shutdown = true;
+  pthread_cond_signal(&queue->has_task);
+  pthread_mutex_unlock(&queue->lock);
+  pthread_join(queue->worker, NULL);
+  for (CeedRequest req = queue->waitable; req; req = req->next_waitable) {
+    if (!req->error_code) req->error_code = queue->error_code;
+    req->queue = NULL;
+  }
+  pthread_cond_destroy(&queue->has_completed);
+  pthread_cond_destroy(&queue->has_task);
+  pthread_mutex_destroy(&queue->lock);
+  CeedCall(CeedFree(&ceed->task_queue));
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Create the scratch arena registry for a `ceed`
+
+  @param[in,out] ceed `Ceed` to create scratch arena registry for
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedScratchCreate(Ceed ceed) {
+  CeedCall(CeedCalloc(1, &ceed->scratch));
+  pthread_mutex_init(&ceed->scratch->lock, NULL);
+  ceed->scratch->id = ++ceed_scratch_num_ids;
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Destroy the scratch arenas for all threads of a `ceed`
+
+  @param[in,out] ceed `Ceed` to destroy scratch arenas for
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedScratchDestroy(Ceed ceed) {
+  CeedScratch scratch = ceed->scratch;
+
+  if (!scratch) return CEED_ERROR_SUCCESS;
+  while (scratch->arenas) {
+    CeedScratchArena arena = scratch->arenas;
+
+    CeedCheck(!arena->num_borrowed, ceed, CEED_ERROR_ACCESS, "Scratch memory checked out but not returned");
+    for (CeedInt i = 0; i < arena->num_blocks; i++) CeedCall(CeedFree(&arena->blocks[i]));
+    CeedCall(CeedFree(&arena->blocks));
+    CeedCall(CeedFree(&arena->block_sizes));
+    scratch->arenas = arena->next;
+    CeedCall(CeedFree(&arena));
+  }
+  pthread_mutex_destroy(&scratch->lock);
+  CeedCall(CeedFree(&ceed->scratch));
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Get the scratch arena for the calling thread, shared by all `Ceed` contexts with the same root
+
+  @param[in]  ceed  `Ceed` context
+  @param[out] arena Address of the variable where the scratch arena will be stored
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedScratchGetArena(Ceed ceed, CeedScratchArena *arena) {
+  CeedScratch scratch = CeedGetTaskQueueRoot(ceed)->scratch;
+
+  // Common case, same context as the last call from this thread
+  if (ceed_scratch_thread.id == scratch->id) {
+    *arena = ceed_scratch_thread.arena;
+    return CEED_ERROR_SUCCESS;
+  }
+
+  // Find or create arena for this thread
+  pthread_mutex_lock(&scratch->lock);
+  for (*arena = scratch->arenas; *arena && !pthread_equal((*arena)->thread, pthread_self()); *arena = (*arena)->next) continue;
+  if (!*arena) {
+    int ierr = CeedCalloc(1, arena);
+
+    if (ierr) {
+      // LCOV_EXCL_START
+      pthread_mutex_unlock(&scratch->lock);
+      return ierr;
+      // LCOV_EXCL_STOP
+    }
+    (*arena)->thread = pthread_self();
+    (*arena)->next   = scratch->arenas;
+    scratch->arenas  = *arena;
+  }
+  pthread_mutex_unlock(&scratch->lock);
+  ceed_scratch_thread.id    = scratch->id;
+  ceed_scratch_thread.arena = *arena;
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Add a block of at least `size` bytes to a scratch arena, reusing the next block when it is large enough
+
+  @param[in]     ceed  `Ceed` context
+  @param[in,out] arena Scratch arena to grow
+  @param[in]     size  Minimum size of block in bytes
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedScratchArenaNextBlock(Ceed ceed, CeedScratchArena arena, size_t size) {
+  const CeedInt next    = arena->num_blocks ? arena->current + 1 : 0;
+  int           ierr    = CEED_ERROR_SUCCESS;
+  CeedScratch   scratch = CeedGetTaskQueueRoot(ceed)->scratch;
+
+  if (next < arena->num_blocks && arena->block_sizes[next] >= size) {
+    arena->current = next;
+    arena->offset  = 0;
+    return CEED_ERROR_SUCCESS;
+  }
+  if (size < CEED_SCRATCH_MIN_BLOCK_SIZE) size = CEED_SCRATCH_MIN_BLOCK_SIZE;
+  if (next > 0 && size < 2 * arena->block_sizes[next - 1]) size = 2 * arena->block_sizes[next - 1];
+
+  // Blocks past the current block hold no borrowed regions, replace them with one larger block
+  // The block list is read by CeedGetScratchStats() and CeedClearScratch() from other threads
+  pthread_mutex_lock(&scratch->lock);
+  for (CeedInt i = next; i < arena->num_blocks && !ierr; i++) ierr = CeedFree(&arena->blocks[i]);
+  if (!ierr) {
+    arena->num_blocks = next;
+    ierr              = CeedRealloc(next + 1, &arena->blocks);
+  }
+  if (!ierr) ierr = CeedRealloc(next + 1, &arena->block_sizes);
+  if (!ierr) ierr = CeedMallocArray(size, 1, &arena->blocks[next]);
+  if (!ierr) {
+    arena->block_sizes[next] = size;
+    arena->num_blocks        = next + 1;
+    arena->current           = next;
+    arena->offset            = 0;
+    scratch->num_allocs++;
+  }
+  pthread_mutex_unlock(&scratch->lock);
+  CeedCall(ierr);
+  CeedDebug(ceed, "Scratch arena allocated block of %zu bytes\n", size);
+  return CEED_ERROR_SUCCESS;
+}
+
 /// @}
 
 /// ----------------------------------------------------------------------------
@@ -817,9 +1268,182 @@ int CeedReference(Ceed ceed) {
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Add a `CeedVector` to the vectors used by a @ref CeedRequest
+
+  @param[in,out] req @ref CeedRequest to update
+  @param[in]     vec `CeedVector` read or written by the work; @ref CEED_VECTOR_ACTIVE and @ref CEED_VECTOR_NONE are skipped
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedRequestAddVector(CeedRequest req, CeedVector vec) {
+  if (!vec || vec == CEED_VECTOR_ACTIVE || vec == CEED_VECTOR_NONE) return CEED_ERROR_SUCCESS;
+  CeedCall(CeedRealloc(req->num_vecs + 1, &req->vecs));
+  req->vecs[req->num_vecs++] = vec;
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Add the passive field `CeedVector` of a `CeedOperator` and its sub-operators to the vectors used by a @ref CeedRequest
+
+  @param[in,out] req @ref CeedRequest to update
+  @param[in]     op  `CeedOperator` for the work
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedRequestAddOperatorVectors(CeedRequest req, CeedOperator op) {
+  bool is_composite;
+
+  CeedCall(CeedOperatorIsComposite(op, &is_composite));
+  if (is_composite) {
+    CeedInt       num_suboperators;
+    CeedOperator *sub_operators;
+
+    CeedCall(CeedCompositeOperatorGetNumSub(op, &num_suboperators));
+    CeedCall(CeedCompositeOperatorGetSubList(op, &sub_operators));
+    for (CeedInt i = 0; i < num_suboperators; i++) CeedCall(CeedRequestAddOperatorVectors(req, sub_operators[i]));
+  } else {
+    CeedInt            num_input_fields, num_output_fields;
+    CeedOperatorField *input_fields, *output_fields;
+
+    CeedCall(CeedOperatorGetFields(op, &num_input_fields, &input_fields, &num_output_fields, &output_fields));
+    for (CeedInt i = 0; i < num_input_fields + num_output_fields; i++) {
+      CeedVector vec;
+
+      CeedCall(CeedOperatorFieldGetVector(i < num_input_fields ? input_fields[i] : output_fields[i - num_input_fields], &vec));
+      CeedCall(CeedRequestAddVector(req, vec));
+      CeedCall(CeedVectorDestroy(&vec));
+    }
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Submit work to the host task queue of a `Ceed` context.
+
+  Work is submitted when `request` is neither `NULL` nor @ref CEED_REQUEST_IMMEDIATE and the `Ceed` context prefers host memory.
+  Submitted work runs on the worker thread of the root `Ceed` context in submission order.
+  For @ref CEED_REQUEST_IMMEDIATE, previously submitted work is completed first so that the caller can run the work synchronously.
+  Device backends and calls from within a running task are not submitted.
+  `in`, `out`, and the passive field vectors of `op` are marked as in use until the work completes, see @ref CeedRequestSynchronizeVector().
+
+  @param[in]  ceed         `Ceed` context
+  @param[in]  Run          Function to run on the worker thread, called with `op`, `in`, and `out`
+  @param[in]  op           `CeedOperator` for the work
+  @param[in]  in           Input `CeedVector` for the work
+  @param[in]  out          Output `CeedVector` for the work
+  @param[out] request      Address of @ref CeedRequest for the work, or @ref CEED_REQUEST_ORDERED
+  @param[out] is_submitted Boolean flag indicating if the work was submitted; the caller must run the work itself otherwise
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedRequestSubmit(Ceed ceed, int (*Run)(CeedOperator, CeedVector, CeedVector), CeedOperator op, CeedVector in, CeedVector out,
+                      CeedRequest *request, bool *is_submitted) {
+  Ceed          ceed_root = CeedGetTaskQueueRoot(ceed);
+  CeedMemType   mem_type;
+  CeedRequest   req;
+  CeedTaskQueue queue;
+
+  *is_submitted = false;
+  if (!request || request == CEED_REQUEST_IMMEDIATE) return CeedRequestSynchronize(ceed);
+  if (ceed_root->task_queue && CeedTaskQueueIsInTask(ceed_root->task_queue)) return CEED_ERROR_SUCCESS;
+  CeedCall(CeedGetPreferredMemType(ceed_root, &mem_type));
+  if (mem_type != CEED_MEM_HOST) return CEED_ERROR_SUCCESS;
+
+  // Enqueue
+  if (!ceed_root->task_queue) CeedCall(CeedTaskQueueCreate(ceed_root));
+  queue = ceed_root->task_queue;
+  CeedCall(CeedCalloc(1, &req));
+  req->queue      = queue;
+  req->Run        = Run;
+  req->op         = op;
+  req->in         = in;
+  req->out        = out;
+  req->is_ordered = request == CEED_REQUEST_ORDERED;
+  CeedCall(CeedRequestAddVector(req, in));
+  CeedCall(CeedRequestAddVector(req, out));
+  CeedCall(CeedRequestAddOperatorVectors(req, op));
+  if (!req->is_ordered) *request = req;
+  pthread_mutex_lock(&queue->lock);
+  if (queue->tail) queue->tail->next = req;
+  else queue->head = req;
+  queue->tail = req;
+  if (!req->is_ordered) {
+    req->next_waitable = queue->waitable;
+    queue->waitable    = req;
+  }
+  for (CeedInt i = 0; i < req->num_vecs; i++) {
+    req->vecs[i]->num_pending_tasks++;
+    req->vecs[i]->task_queue = queue;
+  }
+  queue->num_pending++;
+  pthread_cond_signal(&queue->has_task);
+  pthread_mutex_unlock(&queue->lock);
+  *is_submitted = true;
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Wait for all work submitted to the host task queue of a `Ceed` context.
+
+  Calling this function from within a running task, including from OpenMP threads started by the task, is a no-op.
+
+  @param[in] ceed `Ceed` context
+
+  @return An error code: 0 - success, otherwise - failure; errors from work submitted with @ref CEED_REQUEST_ORDERED are returned
+
+  @ref Backend
+**/
+int CeedRequestSynchronize(Ceed ceed) {
+  int           error_code;
+  CeedTaskQueue queue = CeedGetTaskQueueRoot(ceed)->task_queue;
+
+  if (!queue || CeedTaskQueueIsInTask(queue)) return CEED_ERROR_SUCCESS;
+  pthread_mutex_lock(&queue->lock);
+  while (queue->num_pending > 0) pthread_cond_wait(&queue->has_completed, &queue->lock);
+  error_code        = queue->error_code;
+  queue->error_code = CEED_ERROR_SUCCESS;
+  pthread_mutex_unlock(&queue->lock);
+  return error_code;
+}
+
+/**
+  @brief Wait for the work submitted to a host task queue that uses a `CeedVector`.
+
+  Unrelated work in the queue keeps running, and errors from work submitted with @ref CEED_REQUEST_ORDERED are left for the next @ref CeedRequestWait().
+  Calling this function from within a running task, including from OpenMP threads started by the task, is a no-op.
+
+  @param[in] vec `CeedVector` to wait for
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedRequestSynchronizeVector(CeedVector vec) {
+  CeedTaskQueue queue;
+
+  if (!vec || vec == CEED_VECTOR_ACTIVE || vec == CEED_VECTOR_NONE || vec->num_pending_tasks == 0) return CEED_ERROR_SUCCESS;
+  queue = vec->task_queue;
+  if (CeedTaskQueueIsInTask(queue)) return CEED_ERROR_SUCCESS;
+  pthread_mutex_lock(&queue->lock);
+  while (vec->num_pending_tasks > 0) pthread_cond_wait(&queue->has_completed, &queue->lock);
+  pthread_mutex_unlock(&queue->lock);
+  return CEED_ERROR_SUCCESS;
+}
+
 /**
   @brief Computes the current memory usage of the work vectors in a `Ceed` context and prints to debug.abort
 
+  The number of work vectors, hits, and misses are printed to debug with the usage.
+  Use @ref CeedGetWorkVectorStats() to retrieve the hit, miss, and byte counters; they are not added here so the signature of this function is
+  unchanged.
+
   @param[in]  ceed     `Ceed` context
   @param[out] usage_mb Address of the variable where the MB of work vector usage will be stored
 
@@ -839,15 +1463,46 @@ int CeedGetWorkVectorMemoryUsage(Ceed ceed, CeedScalar *usage_mb) {
   }
   *usage_mb = 0.0;
   if (ceed->work_vectors) {
-    for (CeedInt i = 0; i < ceed->work_vectors->num_vecs; i++) {
-      CeedSize vec_len;
-      CeedCall(CeedVectorGetLength(ceed->work_vectors->vecs[i], &vec_len));
-      *usage_mb += vec_len;
-    }
-    *usage_mb *= sizeof(CeedScalar) * 1e-6;
-    CeedDebug(ceed, "Resource {%s}: Work vectors memory usage: %" CeedInt_FMT " vectors, %g MB\n", ceed->resource, ceed->work_vectors->num_vecs,
-              *usage_mb);
+    CeedInt  num_vecs = 0;
+    CeedSize num_hits, num_misses, num_bytes;
+
+    for (CeedInt c = 0; c < CEED_WORK_VECTOR_NUM_CLASSES; c++) num_vecs += ceed->work_vectors->buckets[c].num_vecs;
+    CeedCall(CeedGetWorkVectorStats(ceed, &num_hits, &num_misses, &num_bytes));
+    *usage_mb = num_bytes * 1e-6;
+    CeedDebug(ceed,
+              "Resource {%s}: Work vectors memory usage: %" CeedInt_FMT " vectors, %g MB, %" CeedSize_FMT " hits, %" CeedSize_FMT " misses\n",
+              ceed->resource, num_vecs, *usage_mb, num_hits, num_misses);
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Get usage statistics for the work vectors in a `Ceed` context.
+
+  These are the counters printed to debug by @ref CeedGetWorkVectorMemoryUsage(), which keeps its single output argument.
+
+  @param[in]  ceed       `Ceed` context
+  @param[out] num_hits   Number of requests served by an existing work vector, or `NULL`
+  @param[out] num_misses Number of requests that created a new work vector, or `NULL`
+  @param[out] num_bytes  Number of bytes currently held by work vectors, or `NULL`
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedGetWorkVectorStats(Ceed ceed, CeedSize *num_hits, CeedSize *num_misses, CeedSize *num_bytes) {
+  if (!ceed->VectorCreate) {
+    Ceed delegate;
+
+    CeedCall(CeedGetObjectDelegate(ceed, &delegate, "Vector"));
+    CeedCheck(delegate, ceed, CEED_ERROR_UNSUPPORTED, "Backend does not implement VectorCreate");
+    CeedCall(CeedGetWorkVectorStats(delegate, num_hits, num_misses, num_bytes));
+    CeedCall(CeedDestroy(&delegate));
+    return CEED_ERROR_SUCCESS;
   }
+  if (num_hits) *num_hits = ceed->work_vectors ? ceed->work_vectors->num_hits : 0;
+  if (num_misses) *num_misses = ceed->work_vectors ? ceed->work_vectors->num_misses : 0;
+  if (num_bytes) *num_bytes = ceed->work_vectors ? ceed->work_vectors->num_bytes : 0;
   return CEED_ERROR_SUCCESS;
 }
 
@@ -872,21 +1527,11 @@ int CeedClearWorkVectors(Ceed ceed, CeedSize min_len) {
     return CEED_ERROR_SUCCESS;
   }
   if (!ceed->work_vectors) return CEED_ERROR_SUCCESS;
-  for (CeedInt i = 0; i < ceed->work_vectors->num_vecs; i++) {
-    if (ceed->work_vectors->is_in_use[i]) continue;
-    CeedSize vec_len;
-    CeedCall(CeedVectorGetLength(ceed->work_vectors->vecs[i], &vec_len));
-    if (vec_len < min_len) {
-      ceed->ref_count += 2;  // Note: increase ref_count to prevent Ceed destructor from triggering
-      CeedCall(CeedVectorDestroy(&ceed->work_vectors->vecs[i]));
-      ceed->ref_count -= 1;  // Note: restore ref_count
-      ceed->work_vectors->num_vecs--;
-      if (ceed->work_vectors->num_vecs > 0) {
-        ceed->work_vectors->vecs[i]                                 = ceed->work_vectors->vecs[ceed->work_vectors->num_vecs];
-        ceed->work_vectors->is_in_use[i]                            = ceed->work_vectors->is_in_use[ceed->work_vectors->num_vecs];
-        ceed->work_vectors->is_in_use[ceed->work_vectors->num_vecs] = false;
-        i--;
-      }
+  for (CeedInt c = 0; c <= CeedWorkVectorSizeClass(min_len); c++) {
+    CeedWorkVectorBucket *bucket = &ceed->work_vectors->buckets[c];
+
+    for (CeedInt i = bucket->num_vecs - 1; i >= 0; i--) {
+      if (!bucket->is_in_use[i] && bucket->lengths[i] < min_len) CeedCall(CeedWorkVectorsRemove(ceed, bucket, i));
     }
   }
   return CEED_ERROR_SUCCESS;
@@ -895,6 +1540,10 @@ int CeedClearWorkVectors(Ceed ceed, CeedSize min_len) {
 /**
   @brief Get a `CeedVector` for scratch work from a `Ceed` context.
 
+  The smallest unused work vector of at least length `len` is returned, searching the size classes `floor(log2(length))` from the size class of
+  `len` upwards.
+  A new work vector of length `len` is created if none is found.
+
   Note: This vector must be restored with @ref CeedRestoreWorkVector().
 
   @param[in]  ceed `Ceed` context
@@ -906,8 +1555,8 @@ int CeedClearWorkVectors(Ceed ceed, CeedSize min_len) {
   @ref Backend
 **/
 int CeedGetWorkVector(Ceed ceed, CeedSize len, CeedVector *vec) {
-  CeedInt    i = 0;
-  CeedScalar usage_mb;
+  CeedInt               i      = -1;
+  CeedWorkVectorBucket *bucket = NULL;
 
   if (!ceed->VectorCreate) {
     Ceed delegate;
@@ -921,42 +1570,55 @@ int CeedGetWorkVector(Ceed ceed, CeedSize len, CeedVector *vec) {
 
   if (!ceed->work_vectors) CeedCall(CeedWorkVectorsCreate(ceed));
 
-  // Search for big enough work vector
-  for (i = 0; i < ceed->work_vectors->num_vecs; i++) {
-    if (!ceed->work_vectors->is_in_use[i]) {
-      CeedSize work_len;
-
-      CeedCall(CeedVectorGetLength(ceed->work_vectors->vecs[i], &work_len));
-      if (work_len >= len) break;
+  // Search for best fitting work vector, all vectors in larger size classes are longer than those in smaller size classes
+  for (CeedInt c = CeedWorkVectorSizeClass(len); c < CEED_WORK_VECTOR_NUM_CLASSES && i < 0; c++) {
+    bucket = &ceed->work_vectors->buckets[c];
+    for (CeedInt j = 0; j < bucket->num_vecs; j++) {
+      if (bucket->is_in_use[j] || bucket->lengths[j] < len || (i >= 0 && bucket->lengths[j] >= bucket->lengths[i])) continue;
+      i = j;
     }
   }
-  // Long enough vector was not found
-  if (i == ceed->work_vectors->num_vecs) {
-    if (ceed->work_vectors->max_vecs == 0) {
-      ceed->work_vectors->max_vecs = 1;
-      CeedCall(CeedCalloc(ceed->work_vectors->max_vecs, &ceed->work_vectors->vecs));
-      CeedCall(CeedCalloc(ceed->work_vectors->max_vecs, &ceed->work_vectors->is_in_use));
-    } else if (ceed->work_vectors->max_vecs == i) {
-      ceed->work_vectors->max_vecs *= 2;
-      CeedCall(CeedRealloc(ceed->work_vectors->max_vecs, &ceed->work_vectors->vecs));
-      CeedCall(CeedRealloc(ceed->work_vectors->max_vecs, &ceed->work_vectors->is_in_use));
+  if (i >= 0) {
+    ceed->work_vectors->num_hits++;
+  } else {
+    // Long enough vector was not found
+    bucket = &ceed->work_vectors->buckets[CeedWorkVectorSizeClass(len)];
+    if (bucket->max_vecs == bucket->num_vecs) {
+      bucket->max_vecs = bucket->max_vecs ? 2 * bucket->max_vecs : 1;
+      CeedCall(CeedRealloc(bucket->max_vecs, &bucket->vecs));
+      CeedCall(CeedRealloc(bucket->max_vecs, &bucket->is_in_use));
+      CeedCall(CeedRealloc(bucket->max_vecs, &bucket->lengths));
+      CeedCall(CeedRealloc(bucket->max_vecs, &bucket->last_used));
     }
-    ceed->work_vectors->num_vecs++;
-    CeedCallBackend(CeedVectorCreate(ceed, len, &ceed->work_vectors->vecs[i]));
+    i = bucket->num_vecs++;
+    bucket->is_in_use[i] = false;
+    bucket->lengths[i]   = len;
+    bucket->vecs[i]      = NULL;
+    CeedCallBackend(CeedVectorCreate(ceed, len, &bucket->vecs[i]));
     ceed->ref_count--;  // Note: ref_count manipulation to prevent a ref-loop
-    if (ceed->is_debug) CeedGetWorkVectorMemoryUsage(ceed, &usage_mb);
+    ceed->work_vectors->num_misses++;
+    ceed->work_vectors->num_bytes += len * (CeedSize)sizeof(CeedScalar);
+    if (ceed->is_debug) {
+      CeedScalar usage_mb;
+
+      CeedCall(CeedGetWorkVectorMemoryUsage(ceed, &usage_mb));
+    }
   }
   // Return pointer to work vector
-  ceed->work_vectors->is_in_use[i] = true;
-  *vec                             = NULL;
-  CeedCall(CeedVectorReferenceCopy(ceed->work_vectors->vecs[i], vec));
+  bucket->is_in_use[i] = true;
+  bucket->last_used[i] = ++ceed->work_vectors->clock;
+  *vec                 = NULL;
+  CeedCall(CeedVectorReferenceCopy(bucket->vecs[i], vec));
   ceed->ref_count++;  // Note: bump ref_count to account for external access
+  CeedCall(CeedWorkVectorsTrim(ceed));
   return CEED_ERROR_SUCCESS;
 }
 
 /**
   @brief Restore a `CeedVector` for scratch work from a `Ceed` context from @ref CeedGetWorkVector()
 
+  Unused work vectors are removed in least recently used order while the memory held by work vectors exceeds `CEED_WORK_VECTORS_MAX_SIZE` MiB.
+
   @param[in]  ceed `Ceed` context
   @param[out] vec  `CeedVector` to restore
 
@@ -965,6 +1627,9 @@ int CeedGetWorkVector(Ceed ceed, CeedSize len, CeedVector *vec) {
   @ref Backend
 **/
 int CeedRestoreWorkVector(Ceed ceed, CeedVector *vec) {
+  CeedSize              len;
+  CeedWorkVectorBucket *bucket;
+
   if (!ceed->VectorCreate) {
     Ceed delegate;
 
@@ -975,12 +1640,15 @@ int CeedRestoreWorkVector(Ceed ceed, CeedVector *vec) {
     return CEED_ERROR_SUCCESS;
   }
 
-  for (CeedInt i = 0; i < ceed->work_vectors->num_vecs; i++) {
-    if (*vec == ceed->work_vectors->vecs[i]) {
-      CeedCheck(ceed->work_vectors->is_in_use[i], ceed, CEED_ERROR_ACCESS, "Work vector %" CeedSize_FMT " was not checked out but is being returned");
+  CeedCall(CeedVectorGetLength(*vec, &len));
+  bucket = &ceed->work_vectors->buckets[CeedWorkVectorSizeClass(len)];
+  for (CeedInt i = 0; i < bucket->num_vecs; i++) {
+    if (*vec == bucket->vecs[i]) {
+      CeedCheck(bucket->is_in_use[i], ceed, CEED_ERROR_ACCESS, "Work vector %" CeedInt_FMT " was not checked out but is being returned", i);
       CeedCall(CeedVectorDestroy(vec));
-      ceed->work_vectors->is_in_use[i] = false;
+      bucket->is_in_use[i] = false;
       ceed->ref_count--;  // Note: reduce ref_count again to prevent a ref-loop
+      CeedCall(CeedWorkVectorsTrim(ceed));
       return CEED_ERROR_SUCCESS;
     }
   }
@@ -989,6 +1657,145 @@ int CeedRestoreWorkVector(Ceed ceed, CeedVector *vec) {
   // LCOV_EXCL_STOP
 }
 
+/**
+  @brief Get scratch memory for temporaries from the calling thread's arena in a `Ceed` context.
+
+  Scratch memory is aligned at `CEED_ALIGN` bytes and is not initialized.
+  Regions must be restored with @ref CeedRestoreScratch() in reverse order of checkout.
+  Once the arena for a thread has grown to the peak usage of a workload, repeated checkouts do not allocate.
+
+  @param[in]  ceed `Ceed` context
+  @param[in]  n    Number of units to check out
+  @param[in]  unit Size of each unit
+  @param[out] p    Address of pointer to hold the result
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+
+  @sa CeedGetScratch()
+**/
+int CeedGetScratchArray(Ceed ceed, size_t n, size_t unit, void *p) {
+  // Regions are preceded by a mark padded to CEED_ALIGN bytes so they keep the alignment of the block
+  const size_t     size = CEED_ALIGN + ((n * unit + CEED_ALIGN - 1) / CEED_ALIGN) * CEED_ALIGN;
+  CeedScratchMark  mark;
+  CeedScratchArena arena;
+
+  CeedCall(CeedScratchGetArena(ceed, &arena));
+  mark.current = arena->current;
+  mark.offset  = arena->offset;
+  if (!arena->num_blocks || arena->offset + size > arena->block_sizes[arena->current]) CeedCall(CeedScratchArenaNextBlock(ceed, arena, size));
+  memcpy(&arena->blocks[arena->current][arena->offset], &mark, sizeof(mark));
+  *(void **)p = &arena->blocks[arena->current][arena->offset + CEED_ALIGN];
+  arena->offset += size;
+  arena->num_borrowed++;
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Restore scratch memory checked out with @ref CeedGetScratch()
+
+  When the last region is restored and the arena for the thread has grown to multiple blocks, the blocks are merged into one.
+
+  @param[in]     ceed `Ceed` context
+  @param[in,out] p    Address of pointer to scratch memory, set to `NULL` on return
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedRestoreScratch(Ceed ceed, void *p) {
+  CeedScratchMark  mark;
+  CeedScratchArena arena;
+
+  CeedCall(CeedScratchGetArena(ceed, &arena));
+  CeedCheck(arena->num_borrowed > 0, ceed, CEED_ERROR_ACCESS, "Scratch memory was not checked out via CeedGetScratch()");
+  memcpy(&mark, *(char **)p - CEED_ALIGN, sizeof(mark));
+  arena->current = mark.current;
+  arena->offset  = mark.offset;
+  arena->num_borrowed--;
+  *(void **)p = NULL;
+
+  // Merge blocks so the next workload of this size fits in one block
+  if (!arena->num_borrowed && arena->num_blocks > 1) {
+    int         ierr    = CEED_ERROR_SUCCESS;
+    size_t      size    = 0;
+    CeedScratch scratch = CeedGetTaskQueueRoot(ceed)->scratch;
+
+    pthread_mutex_lock(&scratch->lock);
+    for (CeedInt i = 0; i < arena->num_blocks; i++) {
+      size += arena->block_sizes[i];
+      if (!ierr) ierr = CeedFree(&arena->blocks[i]);
+    }
+    arena->num_blocks = 0;
+    pthread_mutex_unlock(&scratch->lock);
+    CeedCall(ierr);
+    CeedCall(CeedScratchArenaNextBlock(ceed, arena, size));
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Get usage statistics for the scratch arenas of a `Ceed` context.
+
+  Arena blocks are only allocated while the arenas grow, so `num_allocs` is unchanged over repeated applications of a workload after the first.
+
+  @param[in]  ceed       `Ceed` context
+  @param[out] num_allocs Number of arena blocks allocated over the life of the context, or `NULL`
+  @param[out] num_bytes  Number of bytes currently held by the arenas of all threads, or `NULL`
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedGetScratchStats(Ceed ceed, CeedSize *num_allocs, CeedSize *num_bytes) {
+  CeedScratch scratch = CeedGetTaskQueueRoot(ceed)->scratch;
+
+  // Arenas of other threads only change block lists while holding the lock
+  pthread_mutex_lock(&scratch->lock);
+  if (num_allocs) *num_allocs = scratch->num_allocs;
+  if (num_bytes) {
+    *num_bytes = 0;
+    for (CeedScratchArena arena = scratch->arenas; arena; arena = arena->next) {
+      for (CeedInt i = 0; i < arena->num_blocks; i++) *num_bytes += arena->block_sizes[i];
+    }
+  }
+  pthread_mutex_unlock(&scratch->lock);
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Release the blocks held by the scratch arenas of a `Ceed` context.
+
+  Arenas keep their peak allocation for reuse; this returns that memory after a large workload.
+  Arenas with regions still checked out are left unchanged.
+  This must not be called while other threads check out scratch memory from the same context.
+
+  @param[in,out] ceed `Ceed` context
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedClearScratch(Ceed ceed) {
+  int         ierr    = CEED_ERROR_SUCCESS;
+  CeedScratch scratch = CeedGetTaskQueueRoot(ceed)->scratch;
+
+  pthread_mutex_lock(&scratch->lock);
+  for (CeedScratchArena arena = scratch->arenas; arena && !ierr; arena = arena->next) {
+    if (arena->num_borrowed) continue;
+    for (CeedInt i = 0; i < arena->num_blocks && !ierr; i++) ierr = CeedFree(&arena->blocks[i]);
+    if (!ierr) ierr = CeedFree(&arena->blocks);
+    if (!ierr) ierr = CeedFree(&arena->block_sizes);
+    arena->num_blocks = 0;
+    arena->current    = 0;
+    arena->offset     = 0;
+  }
+  pthread_mutex_unlock(&scratch->lock);
+  CeedCall(ierr);
+  return CEED_ERROR_SUCCESS;
+}
+
 /**
   @brief Retrieve list of additional JiT source roots from `Ceed` context.
 
@@ -1220,6 +2027,7 @@ int CeedInit(const char *resource, Ceed *ceed) {
   // Setup Ceed
   CeedCall(CeedCalloc(1, ceed));
   CeedCall(CeedCalloc(1, &(*ceed)->jit_source_roots));
+  CeedCall(CeedScratchCreate(*ceed));
   const char *ceed_error_handler = getenv("CEED_ERROR_HANDLER");
   if (!ceed_error_handler) ceed_error_handler = "abort";
   if (!strcmp(ceed_error_handler, "exit")) (*ceed)->Error = CeedErrorExit;
@@ -1239,6 +2047,7 @@ int CeedInit(const char *resource, Ceed *ceed) {
       CEED_FTABLE_ENTRY(Ceed, ElemRestrictionCreate),
       CEED_FTABLE_ENTRY(Ceed, ElemRestrictionCreateAtPoints),
       CEED_FTABLE_ENTRY(Ceed, ElemRestrictionCreateBlocked),
+      CEED_FTABLE_ENTRY(Ceed, ElemRestrictionCreateStructured),
       CEED_FTABLE_ENTRY(Ceed, BasisCreateTensorH1),
       CEED_FTABLE_ENTRY(Ceed, BasisCreateH1),
       CEED_FTABLE_ENTRY(Ceed, BasisCreateHdiv),
@@ -1263,9 +2072,13 @@ int CeedInit(const char *resource, Ceed *ceed) {
       CEED_FTABLE_ENTRY(CeedVector, RestoreArray),
       CEED_FTABLE_ENTRY(CeedVector, RestoreArrayRead),
       CEED_FTABLE_ENTRY(CeedVector, Norm),
+      CEED_FTABLE_ENTRY(CeedVector, Dot),
+      CEED_FTABLE_ENTRY(CeedVector, MDot),
       CEED_FTABLE_ENTRY(CeedVector, Scale),
       CEED_FTABLE_ENTRY(CeedVector, AXPY),
       CEED_FTABLE_ENTRY(CeedVector, AXPBY),
+      CEED_FTABLE_ENTRY(CeedVector, MAXPY),
+      CEED_FTABLE_ENTRY(CeedVector, AXPYNorm),
       CEED_FTABLE_ENTRY(CeedVector, PointwiseMult),
       CEED_FTABLE_ENTRY(CeedVector, Reciprocal),
       CEED_FTABLE_ENTRY(CeedVector, Destroy),
@@ -1285,6 +2098,9 @@ int CeedInit(const char *resource, Ceed *ceed) {
       CEED_FTABLE_ENTRY(CeedBasis, ApplyAddAtPoints),
       CEED_FTABLE_ENTRY(CeedBasis, Destroy),
       CEED_FTABLE_ENTRY(CeedTensorContract, Apply),
+      CEED_FTABLE_ENTRY(CeedTensorContract, ApplyEvenOdd),
+      CEED_FTABLE_ENTRY(CeedTensorContract, GetNumTiles),
+      CEED_FTABLE_ENTRY(CeedTensorContract, SetTile),
       CEED_FTABLE_ENTRY(CeedTensorContract, Destroy),
       CEED_FTABLE_ENTRY(CeedQFunction, Apply),
       CEED_FTABLE_ENTRY(CeedQFunction, SetCUDAUserFunction),
@@ -1302,6 +2118,7 @@ int CeedInit(const char *resource, Ceed *ceed) {
       CEED_FTABLE_ENTRY(CeedQFunctionContext, Destroy),
       CEED_FTABLE_ENTRY(CeedOperator, LinearAssembleQFunction),
       CEED_FTABLE_ENTRY(CeedOperator, LinearAssembleQFunctionUpdate),
+      CEED_FTABLE_ENTRY(CeedOperator, LinearAssembleQFunctionElements),
       CEED_FTABLE_ENTRY(CeedOperator, LinearAssembleDiagonal),
       CEED_FTABLE_ENTRY(CeedOperator, LinearAssembleAddDiagonal),
       CEED_FTABLE_ENTRY(CeedOperator, LinearAssemblePointBlockDiagonal),
@@ -1314,6 +2131,7 @@ int CeedInit(const char *resource, Ceed *ceed) {
       CEED_FTABLE_ENTRY(CeedOperator, ApplyComposite),
       CEED_FTABLE_ENTRY(CeedOperator, ApplyAdd),
       CEED_FTABLE_ENTRY(CeedOperator, ApplyAddComposite),
+      CEED_FTABLE_ENTRY(CeedOperator, ApplyAddMulti),
       CEED_FTABLE_ENTRY(CeedOperator, ApplyJacobian),
       CEED_FTABLE_ENTRY(CeedOperator, Destroy),
       {NULL, 0}  // End of lookup table - used in SetBackendFunction loop
@@ -1507,6 +2325,31 @@ int CeedAddJitDefine(Ceed ceed, const char *jit_define) {
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Get statistics for the on-disk cache of JiT compiled kernels used by `Ceed` context.
+
+  Backends that JiT compile kernels look up each kernel in the cache, keyed by its expanded source, compiler, and JiT defines, before compiling.
+  The cache is enabled with `CEED_JIT_CACHE=1` or by setting the cache directory with `CEED_JIT_CACHE_DIR`, and the maximum size in MiB is set with
+  `CEED_JIT_CACHE_MAX_SIZE`.
+
+  @param[in]  ceed       `Ceed` context
+  @param[out] num_hits   Number of kernels loaded from the cache, or `NULL`
+  @param[out] num_misses Number of kernels not found in the cache, or `NULL`
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedGetJitCacheStats(Ceed ceed, CeedSize *num_hits, CeedSize *num_misses) {
+  Ceed ceed_parent;
+
+  CeedCall(CeedGetParent(ceed, &ceed_parent));
+  if (num_hits) *num_hits = ceed_parent->jit_cache_num_hits;
+  if (num_misses) *num_misses = ceed_parent->jit_cache_num_misses;
+  CeedCall(CeedDestroy(&ceed_parent));
+  return CEED_ERROR_SUCCESS;
+}
+
 /**
   @brief View a `Ceed`
 
@@ -1548,6 +2391,7 @@ int CeedDestroy(Ceed *ceed) {
   CeedCheck(!(*ceed)->num_jit_source_roots_readers, *ceed, CEED_ERROR_ACCESS,
             "Cannot destroy ceed context, read access for JiT source roots has been granted");
   CeedCheck(!(*ceed)->num_jit_defines_readers, *ceed, CEED_ERROR_ACCESS, "Cannot add JiT source root, read access for JiT defines has been granted");
+  CeedCall(CeedTaskQueueDestroy(*ceed));
 
   if ((*ceed)->delegate) CeedCall(CeedDestroy(&(*ceed)->delegate));
 
@@ -1576,6 +2420,7 @@ int CeedDestroy(Ceed *ceed) {
   CeedCall(CeedDestroy(&(*ceed)->op_fallback_ceed));
   CeedCall(CeedFree(&(*ceed)->op_fallback_resource));
   CeedCall(CeedWorkVectorsDestroy(*ceed));
+  CeedCall(CeedScratchDestroy(*ceed));
   CeedCall(CeedFree(ceed));
   return CEED_ERROR_SUCCESS;
 }
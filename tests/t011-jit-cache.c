@@ -0,0 +1,144 @@
+/// @file
+/// Test JiT cache store, lookup, eviction, and statistics
+/// \test Test JiT cache store, lookup, eviction, and statistics
+#define _POSIX_C_SOURCE 200809L
+#include <ceed.h>
+#include <ceed/backend.h>
+#include <ceed/jit-tools.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+int main(int argc, char **argv) {
+  Ceed        ceed;
+  char        cache_dir[] = "/tmp/ceed-t011-XXXXXX", *keys[3], *entry_paths[3];
+  const char *sources[3]  = {"kernel a", "kernel b", "kernel c"};
+  const int   entry_size  = 400 * 1024;
+  char       *entry;
+  CeedSize    num_hits, num_misses;
+
+  CeedInit(argv[1], &ceed);
+
+  // Cache is off unless requested
+  unsetenv("CEED_JIT_CACHE");
+  unsetenv("CEED_JIT_CACHE_DIR");
+  {
+    bool  is_hit;
+    char *key, *entry_path;
+
+    CeedJitCacheGetKey(ceed, sources[0], "compiler", &key);
+    CeedJitCacheLookup(ceed, key, ".bin", &entry_path, &is_hit);
+    if (entry_path) printf("JiT cache used without being enabled\n");
+    CeedFree(&entry_path);
+    CeedFree(&key);
+  }
+
+  // Use private cache with room for two entries
+  if (!mkdtemp(cache_dir)) return 1;
+  setenv("CEED_JIT_CACHE_DIR", cache_dir, 1);
+  setenv("CEED_JIT_CACHE_MAX_SIZE", "1", 1);
+
+  // Keys
+  for (CeedInt i = 0; i < 3; i++) CeedJitCacheGetKey(ceed, sources[i], "compiler", &keys[i]);
+  {
+    char *key;
+
+    if (strlen(keys[0]) != 32) printf("Incorrect key length %d\n", (int)strlen(keys[0]));
+    CeedJitCacheGetKey(ceed, sources[0], "compiler", &key);
+    if (strcmp(key, keys[0])) printf("Key for identical source differs\n");
+    CeedFree(&key);
+    CeedJitCacheGetKey(ceed, sources[0], "other compiler", &key);
+    if (!strcmp(key, keys[0])) printf("Key does not depend on compiler\n");
+    CeedFree(&key);
+    CeedAddJitDefine(ceed, "FOO=1");
+    CeedJitCacheGetKey(ceed, sources[0], "compiler", &key);
+    if (!strcmp(key, keys[0])) printf("Key does not depend on JiT defines\n");
+    CeedFree(&key);
+  }
+
+  // Miss, store, and hit
+  entry = calloc(entry_size, 1);
+  {
+    bool   is_hit;
+    size_t size;
+    char  *data;
+
+    CeedJitCacheRead(ceed, keys[0], ".bin", &is_hit, &size, &data);
+    if (is_hit) printf("Unexpected hit for new entry\n");
+    entry[0] = 'a';
+    CeedJitCacheWrite(ceed, keys[0], ".bin", entry_size, entry);
+    CeedJitCacheRead(ceed, keys[0], ".bin", &is_hit, &size, &data);
+    if (!is_hit || size != (size_t)entry_size || data[0] != 'a') printf("Incorrect entry read from cache\n");
+    CeedFree(&data);
+  }
+
+  // Least recently used entry evicted
+  {
+    bool                  is_hit;
+    size_t                size;
+    char                 *data;
+    const struct timespec delay = {0, 50 * 1000 * 1000};
+
+    // File modification times are only as fine as the filesystem clock, so space out the accesses
+    entry[0] = 'b';
+    CeedJitCacheWrite(ceed, keys[1], ".bin", entry_size, entry);
+    nanosleep(&delay, NULL);
+    CeedJitCacheRead(ceed, keys[0], ".bin", &is_hit, &size, &data);
+    CeedFree(&data);
+    nanosleep(&delay, NULL);
+    entry[0] = 'c';
+    CeedJitCacheWrite(ceed, keys[2], ".bin", entry_size, entry);
+    CeedJitCacheRead(ceed, keys[1], ".bin", &is_hit, &size, &data);
+    if (is_hit) printf("Least recently used entry not evicted\n");
+    CeedJitCacheRead(ceed, keys[0], ".bin", &is_hit, &size, &data);
+    if (!is_hit || data[0] != 'a') printf("Recently used entry evicted\n");
+    CeedFree(&data);
+  }
+  free(entry);
+
+  // Statistics
+  CeedGetJitCacheStats(ceed, &num_hits, &num_misses);
+  if (num_hits != 3 || num_misses != 2) printf("Incorrect JiT cache stats: %td hits, %td misses\n", num_hits, num_misses);
+
+  // Cleanup
+  for (CeedInt i = 0; i < 3; i++) {
+    bool is_hit;
+
+    CeedJitCacheLookup(ceed, keys[i], ".bin", &entry_paths[i], &is_hit);
+    remove(entry_paths[i]);
+    CeedFree(&entry_paths[i]);
+    CeedFree(&keys[i]);
+  }
+  rmdir(cache_dir);
+
+  // Directories writable by others and symbolic links are not used
+  {
+    bool  is_hit;
+    char  shared_dir[] = "/tmp/ceed-t011-XXXXXX", link_path[sizeof(shared_dir) + 4], *entry_path;
+    char *key;
+
+    CeedJitCacheGetKey(ceed, sources[0], "compiler", &key);
+    if (!mkdtemp(shared_dir)) return 1;
+    setenv("CEED_JIT_CACHE_DIR", shared_dir, 1);
+    chmod(shared_dir, 0777);
+    CeedJitCacheLookup(ceed, key, ".bin", &entry_path, &is_hit);
+    if (entry_path) printf("JiT cache used directory writable by others\n");
+    CeedFree(&entry_path);
+    chmod(shared_dir, 0700);
+    snprintf(link_path, sizeof(link_path), "%s.lnk", shared_dir);
+    if (!symlink(shared_dir, link_path)) {
+      setenv("CEED_JIT_CACHE_DIR", link_path, 1);
+      CeedJitCacheLookup(ceed, key, ".bin", &entry_path, &is_hit);
+      if (entry_path) printf("JiT cache used symbolic link to directory\n");
+      CeedFree(&entry_path);
+      remove(link_path);
+    }
+    CeedFree(&key);
+    rmdir(shared_dir);
+  }
+  CeedDestroy(&ceed);
+  return 0;
+}
@@ -0,0 +1,74 @@
+/// @file
+/// Test scratch arena reuse
+/// \test Test scratch arena reuse
+
+//TESTARGS(only="cpu") {ceed_resource}
+#include <ceed.h>
+#include <ceed/backend.h>
+#include <stdio.h>
+
+int main(int argc, char **argv) {
+  Ceed       ceed;
+  CeedInt    dim = 3, p = 6, q = 8, num_elem = 64;
+  CeedSize   num_allocs_warm, num_allocs, num_bytes;
+  CeedVector u, v;
+  CeedBasis  basis;
+
+  CeedInit(argv[1], &ceed);
+
+  // Nested checkouts, growing the arena
+  for (CeedInt i = 0; i < 2; i++) {
+    CeedScalar *small, *large;
+    CeedInt    *ints;
+
+    CeedGetScratch(ceed, 100, &small);
+    CeedGetScratch(ceed, 100000, &large);
+    CeedGetScratch(ceed, 7, &ints);
+    if ((size_t)small % CEED_ALIGN || (size_t)large % CEED_ALIGN || (size_t)ints % CEED_ALIGN) printf("Scratch memory not aligned\n");
+    for (CeedInt j = 0; j < 100000; j++) large[j] = j;
+    for (CeedInt j = 0; j < 100; j++) small[j] = -j;
+    for (CeedInt j = 0; j < 7; j++) ints[j] = j;
+    if (large[99999] != 99999 || small[99] != -99) printf("Scratch regions overlap\n");
+    CeedRestoreScratch(ceed, &ints);
+    CeedRestoreScratch(ceed, &large);
+    CeedRestoreScratch(ceed, &small);
+    if (small || large || ints) printf("Restored scratch pointers not cleared\n");
+    if (i == 0) CeedGetScratchStats(ceed, &num_allocs_warm, NULL);
+  }
+  CeedGetScratchStats(ceed, &num_allocs, &num_bytes);
+  if (num_allocs != num_allocs_warm) {
+    // LCOV_EXCL_START
+    printf("Scratch arena allocated after warm up: %td != %td\n", num_allocs, num_allocs_warm);
+    // LCOV_EXCL_STOP
+  }
+  if (num_bytes < (CeedSize)(100000 * sizeof(CeedScalar))) printf("Scratch arena smaller than peak usage: %td bytes\n", num_bytes);
+
+  // Repeated basis applications
+  CeedVectorCreate(ceed, num_elem * CeedIntPow(p, dim), &u);
+  CeedVectorCreate(ceed, num_elem * CeedIntPow(q, dim) * dim, &v);
+  CeedVectorSetValue(u, 1.0);
+  CeedBasisCreateTensorH1Lagrange(ceed, dim, 1, p, q, CEED_GAUSS, &basis);
+  for (CeedInt i = 0; i < 3; i++) {
+    CeedBasisApply(basis, num_elem, CEED_NOTRANSPOSE, CEED_EVAL_INTERP, u, v);
+    CeedBasisApply(basis, num_elem, CEED_NOTRANSPOSE, CEED_EVAL_GRAD, u, v);
+    CeedBasisApply(basis, num_elem, CEED_TRANSPOSE, CEED_EVAL_GRAD, v, u);
+    if (i == 0) CeedGetScratchStats(ceed, &num_allocs_warm, NULL);
+  }
+  CeedGetScratchStats(ceed, &num_allocs, NULL);
+  if (num_allocs != num_allocs_warm) {
+    // LCOV_EXCL_START
+    printf("Scratch arena allocated after warm up of basis: %td != %td\n", num_allocs, num_allocs_warm);
+    // LCOV_EXCL_STOP
+  }
+
+  // Release arena blocks
+  CeedClearScratch(ceed);
+  CeedGetScratchStats(ceed, NULL, &num_bytes);
+  if (num_bytes != 0) printf("Scratch arena not released: %td bytes\n", num_bytes);
+
+  CeedVectorDestroy(&u);
+  CeedVectorDestroy(&v);
+  CeedBasisDestroy(&basis);
+  CeedDestroy(&ceed);
+  return 0;
+}
@@ -0,0 +1,61 @@
+/// @file
+/// Test work vector best fit selection and memory budget
+/// \test Test work vector best fit selection and memory budget
+#define _POSIX_C_SOURCE 200809L
+#include <ceed.h>
+#include <ceed/backend.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+int main(int argc, char **argv) {
+  Ceed       ceed;
+  CeedVector x, y, z;
+  CeedSize   num_hits, num_misses, num_bytes, len;
+
+  // Best fit selection
+  CeedInit(argv[1], &ceed);
+  CeedGetWorkVector(ceed, 100, &x);
+  CeedGetWorkVector(ceed, 1000, &y);
+  CeedGetWorkVector(ceed, 10000, &z);
+  CeedRestoreWorkVector(ceed, &x);
+  CeedRestoreWorkVector(ceed, &y);
+  CeedRestoreWorkVector(ceed, &z);
+
+  CeedGetWorkVector(ceed, 500, &y);
+  CeedVectorGetLength(y, &len);
+  if (len != 1000) printf("Work vector of length %td is not the best fit for length 500\n", len);
+  CeedGetWorkVector(ceed, 50, &x);
+  CeedVectorGetLength(x, &len);
+  if (len != 100) printf("Work vector of length %td is not the best fit for length 50\n", len);
+  CeedRestoreWorkVector(ceed, &x);
+  CeedRestoreWorkVector(ceed, &y);
+
+  CeedGetWorkVectorStats(ceed, &num_hits, &num_misses, &num_bytes);
+  if (num_hits != 2 || num_misses != 3) printf("Incorrect work vector stats: %td hits, %td misses\n", num_hits, num_misses);
+  if (num_bytes != 11100 * (CeedSize)sizeof(CeedScalar)) printf("Incorrect work vector memory: %td bytes\n", num_bytes);
+  CeedDestroy(&ceed);
+
+  // Memory budget of 0.1 MiB, about 13000 scalars in double precision
+  setenv("CEED_WORK_VECTORS_MAX_SIZE", "0.1", 1);
+  CeedInit(argv[1], &ceed);
+  CeedGetWorkVector(ceed, 5000 * 8 / (CeedInt)sizeof(CeedScalar), &x);
+  CeedRestoreWorkVector(ceed, &x);
+
+  // -- Unused vector removed when over budget
+  CeedGetWorkVector(ceed, 10000 * 8 / (CeedInt)sizeof(CeedScalar), &y);
+  CeedGetWorkVectorStats(ceed, NULL, NULL, &num_bytes);
+  if (num_bytes != 10000 * 8) printf("Unused work vector not trimmed: %td bytes\n", num_bytes);
+
+  // -- Vectors in use are kept
+  CeedGetWorkVector(ceed, 5000 * 8 / (CeedInt)sizeof(CeedScalar), &x);
+  CeedGetWorkVectorStats(ceed, NULL, NULL, &num_bytes);
+  if (num_bytes != 15000 * 8) printf("Work vector in use trimmed: %td bytes\n", num_bytes);
+
+  // -- Returned vector removed when over budget
+  CeedRestoreWorkVector(ceed, &y);
+  CeedGetWorkVectorStats(ceed, NULL, NULL, &num_bytes);
+  if (num_bytes != 5000 * 8) printf("Returned work vector not trimmed: %td bytes\n", num_bytes);
+  CeedRestoreWorkVector(ceed, &x);
+  CeedDestroy(&ceed);
+  return 0;
+}
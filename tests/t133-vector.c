@@ -0,0 +1,110 @@
+/// @file
+/// Test fused Krylov vector kernels
+/// \test Test fused Krylov vector kernels
+
+//TESTARGS(name="length 10") {ceed_resource} 10
+//TESTARGS(name="length 0") {ceed_resource} 0
+//TESTARGS(name="length 100000") {ceed_resource} 100000
+#include <ceed.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+int main(int argc, char **argv) {
+  Ceed       ceed;
+  CeedVector x, y[3];
+  CeedInt    len      = 10;
+  CeedScalar alpha[3] = {0.5, -1.0, 2.0};
+
+  CeedInit(argv[1], &ceed);
+  len = argc > 2 ? atoi(argv[2]) : len;
+
+  // x_i = 1, y[k]_i = (k + 1) (i % 7 - 3)
+  CeedVectorCreate(ceed, len, &x);
+  CeedVectorSetValue(x, 1.0);
+  for (CeedInt k = 0; k < 3; k++) {
+    CeedScalar *array;
+
+    CeedVectorCreate(ceed, len, &y[k]);
+    CeedVectorGetArrayWrite(y[k], CEED_MEM_HOST, &array);
+    for (CeedInt i = 0; i < len; i++) array[i] = (k + 1) * (CeedScalar)(i % 7 - 3);
+    CeedVectorRestoreArray(y[k], &array);
+  }
+
+  // Dot products
+  {
+    CeedScalar dot, dots[4], sum_true = 0.0, sum_squares_true = 0.0;
+    CeedVector vecs[4] = {y[0], y[1], y[2], x};
+
+    for (CeedInt i = 0; i < len; i++) {
+      sum_true += i % 7 - 3;
+      sum_squares_true += (i % 7 - 3) * (i % 7 - 3);
+    }
+
+    CeedVectorDot(x, y[0], &dot);
+    if (fabs(dot - sum_true) > 1e-10) {
+      // LCOV_EXCL_START
+      printf("Error in x . y: computed %f actual %f\n", dot, sum_true);
+      // LCOV_EXCL_STOP
+    }
+    CeedVectorDot(y[1], y[1], &dot);
+    if (fabs(dot - 4 * sum_squares_true) > 1e-10 * (1 + sum_squares_true)) {
+      // LCOV_EXCL_START
+      printf("Error in y . y: computed %f actual %f\n", dot, 4 * sum_squares_true);
+      // LCOV_EXCL_STOP
+    }
+
+    CeedVectorMDot(x, 4, vecs, dots);
+    for (CeedInt k = 0; k < 3; k++) {
+      if (fabs(dots[k] - (k + 1) * sum_true) > 1e-10) {
+        // LCOV_EXCL_START
+        printf("Error in multi-dot product %" CeedInt_FMT ": computed %f actual %f\n", k, dots[k], (k + 1) * sum_true);
+        // LCOV_EXCL_STOP
+      }
+    }
+    if (fabs(dots[3] - len) > 1e-10) {
+      // LCOV_EXCL_START
+      printf("Error in multi-dot product 3: computed %f actual %f\n", dots[3], (CeedScalar)len);
+      // LCOV_EXCL_STOP
+    }
+  }
+
+  // x = x + sum_k alpha_k y[k] = 1 + 4.5 (i % 7 - 3)
+  CeedVectorMAXPY(x, 3, alpha, y);
+  {
+    const CeedScalar *read_array;
+
+    CeedVectorGetArrayRead(x, CEED_MEM_HOST, &read_array);
+    for (CeedInt i = 0; i < len; i++) {
+      if (fabs(read_array[i] - (1.0 + 4.5 * (i % 7 - 3))) > 1e-12) {
+        // LCOV_EXCL_START
+        printf("Error in multi-AXPY at index %" CeedInt_FMT ", computed: %f actual: %f\n", i, read_array[i], 1.0 + 4.5 * (i % 7 - 3));
+        // LCOV_EXCL_STOP
+      }
+    }
+    CeedVectorRestoreArrayRead(x, &read_array);
+  }
+
+  // x = x - 4.5 y[0] = 1, once per norm type
+  {
+    CeedNormType norm_types[3] = {CEED_NORM_1, CEED_NORM_2, CEED_NORM_MAX};
+    CeedScalar   norms_true[3] = {len, sqrt(len), len > 0 ? 1.0 : 0.0};
+
+    for (CeedInt t = 0; t < 3; t++) {
+      CeedScalar norm;
+
+      CeedVectorAXPYNorm(x, -4.5, y[0], norm_types[t], &norm);
+      if (fabs(norm - norms_true[t]) > 1e-10 * (1 + norms_true[t])) {
+        // LCOV_EXCL_START
+        printf("Error in fused AXPY and norm type %" CeedInt_FMT ": computed %f actual %f\n", t, norm, norms_true[t]);
+        // LCOV_EXCL_STOP
+      }
+      CeedVectorAXPY(x, 4.5, y[0]);
+    }
+  }
+
+  CeedVectorDestroy(&x);
+  for (CeedInt k = 0; k < 3; k++) CeedVectorDestroy(&y[k]);
+  CeedDestroy(&ceed);
+  return 0;
+}
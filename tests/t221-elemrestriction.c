@@ -0,0 +1,99 @@
+/// @file
+/// Test coloring of element blocks of an element restriction
+/// \test Test coloring of element blocks of an element restriction
+#include <ceed.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+int main(int argc, char **argv) {
+  Ceed                ceed;
+  CeedInt             n_x = 7, n_y = 5, p = 3, num_comp = 2;
+  CeedInt             num_elem = n_x * n_y, num_nodes_x = n_x * (p - 1) + 1, num_nodes = num_nodes_x * (n_y * (p - 1) + 1);
+  CeedInt             ind[num_elem * p * p];
+  CeedInt             spread[2];
+  CeedElemRestriction elem_restriction, elem_restriction_strided;
+
+  CeedInit(argv[1], &ceed);
+
+  // 2D mesh of quadratic elements, with component stride between nodes of each component
+  for (CeedInt i = 0; i < n_x; i++) {
+    for (CeedInt j = 0; j < n_y; j++) {
+      CeedInt e = i * n_y + j;
+
+      for (CeedInt k = 0; k < p; k++) {
+        for (CeedInt l = 0; l < p; l++) ind[e * p * p + k * p + l] = (j * (p - 1) + k) * num_nodes_x + i * (p - 1) + l;
+      }
+    }
+  }
+  CeedElemRestrictionCreate(ceed, num_elem, p * p, num_comp, num_nodes, num_comp * num_nodes, CEED_MEM_HOST, CEED_USE_POINTER, ind,
+                            &elem_restriction);
+
+  for (CeedInt block_size = 1; block_size <= 3; block_size += 2) {
+    const CeedInt num_block = num_elem / block_size + !!(num_elem % block_size);
+
+    for (CeedInt t = 0; t < 2; t++) {
+      const CeedColoringType coloring_type = t == 0 ? CEED_COLORING_GREEDY : CEED_COLORING_BALANCED;
+      CeedInt                num_colors, min_count = num_block, max_count = 0, block_count[num_block];
+      const CeedInt         *color_offsets, *color_blocks, *color_offsets_cached;
+
+      CeedElemRestrictionGetColoring(elem_restriction, coloring_type, block_size, &num_colors, &color_offsets, &color_blocks);
+      CeedElemRestrictionGetColoring(elem_restriction, coloring_type, block_size, &num_colors, &color_offsets_cached, &color_blocks);
+      if (color_offsets_cached != color_offsets) printf("Coloring not cached\n");
+      if (block_size == 1 && t == 0 && num_colors != 4) {
+        // LCOV_EXCL_START
+        printf("Greedy coloring of quadrilateral mesh should have 4 colors, found %" CeedInt_FMT "\n", num_colors);
+        // LCOV_EXCL_STOP
+      }
+
+      // Each element block appears once, in increasing order within a color, and same colored blocks share no nodes
+      for (CeedInt b = 0; b < num_block; b++) block_count[b] = 0;
+      if (color_offsets[0] != 0 || color_offsets[num_colors] != num_block) printf("Incorrect color offsets\n");
+      for (CeedInt c = 0; c < num_colors; c++) {
+        CeedInt node_color[num_nodes];
+
+        for (CeedInt n = 0; n < num_nodes; n++) node_color[n] = -1;
+        for (CeedInt k = color_offsets[c]; k < color_offsets[c + 1]; k++) {
+          const CeedInt b = color_blocks[k];
+
+          block_count[b]++;
+          if (k > color_offsets[c] && color_blocks[k - 1] >= b) printf("Element blocks of color %" CeedInt_FMT " not in increasing order\n", c);
+          for (CeedInt i = b * block_size * p * p; i < (b + 1) * block_size * p * p && i < num_elem * p * p; i++) {
+            if (node_color[ind[i]] >= 0 && node_color[ind[i]] != b) {
+              // LCOV_EXCL_START
+              printf("Element blocks %" CeedInt_FMT " and %" CeedInt_FMT " of color %" CeedInt_FMT " share node %" CeedInt_FMT "\n",
+                     node_color[ind[i]], b, c, ind[i]);
+              // LCOV_EXCL_STOP
+            }
+            node_color[ind[i]] = b;
+          }
+        }
+        min_count = color_offsets[c + 1] - color_offsets[c] < min_count ? color_offsets[c + 1] - color_offsets[c] : min_count;
+        max_count = color_offsets[c + 1] - color_offsets[c] > max_count ? color_offsets[c + 1] - color_offsets[c] : max_count;
+      }
+      for (CeedInt b = 0; b < num_block; b++) {
+        if (block_count[b] != 1) printf("Element block %" CeedInt_FMT " appears %" CeedInt_FMT " times\n", b, block_count[b]);
+      }
+      spread[t] = max_count - min_count;
+    }
+    if (spread[1] > spread[0]) {
+      // LCOV_EXCL_START
+      printf("Balanced coloring less balanced than greedy coloring: %" CeedInt_FMT " > %" CeedInt_FMT "\n", spread[1], spread[0]);
+      // LCOV_EXCL_STOP
+    }
+  }
+
+  // Elements of a strided restriction share no nodes
+  {
+    CeedInt        num_colors, strides[3] = {1, p * p, p * p * num_comp};
+    const CeedInt *color_offsets, *color_blocks;
+
+    CeedElemRestrictionCreateStrided(ceed, num_elem, p * p, num_comp, num_elem * p * p * num_comp, strides, &elem_restriction_strided);
+    CeedElemRestrictionGetColoring(elem_restriction_strided, CEED_COLORING_GREEDY, 1, &num_colors, &color_offsets, &color_blocks);
+    if (num_colors != 1) printf("Strided restriction should have 1 color, found %" CeedInt_FMT "\n", num_colors);
+  }
+
+  CeedElemRestrictionDestroy(&elem_restriction);
+  CeedElemRestrictionDestroy(&elem_restriction_strided);
+  CeedDestroy(&ceed);
+  return 0;
+}
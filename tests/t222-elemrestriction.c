@@ -0,0 +1,104 @@
+/// @file
+/// Test transpose application of a blocked oriented element restriction with padding and unused nodes, with and without signs
+/// \test Test transpose application of a blocked oriented element restriction with padding and unused nodes, with and without signs
+#include <ceed.h>
+#include <math.h>
+#include <stdio.h>
+
+int main(int argc, char **argv) {
+  Ceed                ceed;
+  CeedVector          x, x_block, y, y_block;
+  CeedInt             num_elem = 10, elem_size = 3, block_size = 4, num_comp = 2, num_nodes = 25;
+  CeedInt             num_block = (num_elem + block_size - 1) / block_size, e_size = num_block * block_size * elem_size * num_comp;
+  CeedInt             ind[num_elem * elem_size], e_layout[3];
+  bool                orients[num_elem * elem_size];
+  CeedElemRestriction elem_restriction, elem_restriction_unsigned;
+
+  CeedInit(argv[1], &ceed);
+
+  // Offsets out of order, with repeated nodes and the last node unused
+  for (CeedInt i = 0; i < num_elem * elem_size; i++) {
+    ind[i]     = (7 * i) % (num_nodes - 1);
+    orients[i] = (i % 3) == 1;
+  }
+  CeedElemRestrictionCreateBlockedOriented(ceed, num_elem, elem_size, block_size, num_comp, num_nodes, num_comp * num_nodes, CEED_MEM_HOST,
+                                           CEED_USE_POINTER, ind, orients, &elem_restriction);
+  CeedElemRestrictionCreateUnsignedCopy(elem_restriction, &elem_restriction_unsigned);
+  CeedElemRestrictionGetELayout(elem_restriction, e_layout);
+
+  CeedVectorCreate(ceed, num_comp * num_nodes, &x);
+  CeedVectorCreate(ceed, num_comp * num_nodes, &x_block);
+  CeedVectorCreate(ceed, e_size, &y);
+  CeedVectorCreate(ceed, e_size / num_block, &y_block);
+  {
+    CeedScalar *y_array;
+
+    CeedVectorGetArrayWrite(y, CEED_MEM_HOST, &y_array);
+    for (CeedInt i = 0; i < e_size; i++) y_array[i] = 1.0 + sin(i);
+    CeedVectorRestoreArray(y, &y_array);
+  }
+
+  for (CeedInt use_signs = 0; use_signs <= 1; use_signs++) {
+    CeedElemRestriction rstr = use_signs ? elem_restriction : elem_restriction_unsigned;
+    CeedScalar          x_true[num_comp * num_nodes];
+    const CeedScalar   *x_array, *x_block_array, *y_array;
+
+    // Sum into existing values, all elements at once and, as block application always uses signs, one block at a time
+    CeedVectorSetValue(x, 1.0);
+    CeedVectorSetValue(x_block, 1.0);
+    CeedElemRestrictionApply(rstr, CEED_TRANSPOSE, y, x, CEED_REQUEST_IMMEDIATE);
+    for (CeedInt b = 0; b < num_block && use_signs; b++) {
+      CeedScalar *y_block_array;
+
+      CeedVectorGetArrayRead(y, CEED_MEM_HOST, &y_array);
+      CeedVectorGetArrayWrite(y_block, CEED_MEM_HOST, &y_block_array);
+      for (CeedInt i = 0; i < e_size / num_block; i++) y_block_array[i] = y_array[b * (e_size / num_block) + i];
+      CeedVectorRestoreArray(y_block, &y_block_array);
+      CeedVectorRestoreArrayRead(y, &y_array);
+      CeedElemRestrictionApplyBlock(rstr, b, CEED_TRANSPOSE, y_block, x_block, CEED_REQUEST_IMMEDIATE);
+    }
+
+    // Expected values, skipping padding elements
+    for (CeedInt i = 0; i < num_comp * num_nodes; i++) x_true[i] = 1.0;
+    CeedVectorGetArrayRead(y, CEED_MEM_HOST, &y_array);
+    for (CeedInt e = 0; e < num_elem; e++) {
+      const CeedInt block = e / block_size, elem = e % block_size;
+
+      for (CeedInt n = 0; n < elem_size; n++) {
+        for (CeedInt k = 0; k < num_comp; k++) {
+          const CeedInt    index = (n * block_size + elem) * e_layout[0] + k * e_layout[1] * block_size + block * e_layout[2] * block_size;
+          const CeedScalar sign  = use_signs && orients[e * elem_size + n] ? -1.0 : 1.0;
+
+          x_true[ind[e * elem_size + n] + k * num_nodes] += sign * y_array[index];
+        }
+      }
+    }
+    CeedVectorRestoreArrayRead(y, &y_array);
+
+    CeedVectorGetArrayRead(x, CEED_MEM_HOST, &x_array);
+    CeedVectorGetArrayRead(x_block, CEED_MEM_HOST, &x_block_array);
+    for (CeedInt i = 0; i < num_comp * num_nodes; i++) {
+      if (fabs(x_array[i] - x_true[i]) > 100. * CEED_EPSILON) {
+        // LCOV_EXCL_START
+        printf("Signs %" CeedInt_FMT ": Error in transpose x[%" CeedInt_FMT "] = %f != %f\n", use_signs, i, x_array[i], x_true[i]);
+        // LCOV_EXCL_STOP
+      }
+      if (use_signs && fabs(x_block_array[i] - x_true[i]) > 100. * CEED_EPSILON) {
+        // LCOV_EXCL_START
+        printf("Error in transpose by block x[%" CeedInt_FMT "] = %f != %f\n", i, x_block_array[i], x_true[i]);
+        // LCOV_EXCL_STOP
+      }
+    }
+    CeedVectorRestoreArrayRead(x, &x_array);
+    CeedVectorRestoreArrayRead(x_block, &x_block_array);
+  }
+
+  CeedVectorDestroy(&x);
+  CeedVectorDestroy(&x_block);
+  CeedVectorDestroy(&y);
+  CeedVectorDestroy(&y_block);
+  CeedElemRestrictionDestroy(&elem_restriction);
+  CeedElemRestrictionDestroy(&elem_restriction_unsigned);
+  CeedDestroy(&ceed);
+  return 0;
+}
@@ -0,0 +1,141 @@
+/// @file
+/// Test reordering of the elements and nodes of an element restriction for memory locality
+/// \test Test reordering of the elements and nodes of an element restriction for memory locality
+#include <ceed.h>
+#include <math.h>
+#include <stdio.h>
+
+int main(int argc, char **argv) {
+  Ceed                ceed;
+  CeedInt             nx = 12, ny = 9, num_elem = nx * ny, elem_size = 4, num_comp = 2, num_nodes = (nx + 1) * (ny + 1);
+  CeedInt             elem_shuffle[num_elem], node_shuffle[num_nodes], ind[num_elem * elem_size], ind_reordered[num_elem * elem_size];
+  CeedInt             elem_perm[num_elem], node_perm[num_comp * num_nodes];
+  CeedScalar          elem_coords[num_elem * 2];
+  CeedElemRestriction elem_restriction;
+
+  CeedInit(argv[1], &ceed);
+
+  // Linear quadrilaterals on a structured grid, with elements and nodes shuffled
+  for (CeedInt e = 0; e < num_elem; e++) elem_shuffle[e] = e;
+  for (CeedInt n = 0; n < num_nodes; n++) node_shuffle[n] = n;
+  for (CeedInt e = num_elem - 1; e > 0; e--) {
+    CeedInt j = (37 * e + 11) % (e + 1), tmp = elem_shuffle[e];
+
+    elem_shuffle[e] = elem_shuffle[j];
+    elem_shuffle[j] = tmp;
+  }
+  for (CeedInt n = num_nodes - 1; n > 0; n--) {
+    CeedInt j = (53 * n + 7) % (n + 1), tmp = node_shuffle[n];
+
+    node_shuffle[n] = node_shuffle[j];
+    node_shuffle[j] = tmp;
+  }
+  for (CeedInt e = 0; e < num_elem; e++) {
+    CeedInt i = elem_shuffle[e] % nx, j = elem_shuffle[e] / nx;
+
+    ind[e * elem_size + 0] = node_shuffle[i + j * (nx + 1)];
+    ind[e * elem_size + 1] = node_shuffle[i + 1 + j * (nx + 1)];
+    ind[e * elem_size + 2] = node_shuffle[i + (j + 1) * (nx + 1)];
+    ind[e * elem_size + 3] = node_shuffle[i + 1 + (j + 1) * (nx + 1)];
+    elem_coords[e * 2 + 0] = i + 0.5;
+    elem_coords[e * 2 + 1] = j + 0.5;
+  }
+  CeedElemRestrictionCreate(ceed, num_elem, elem_size, num_comp, num_nodes, num_comp * num_nodes, CEED_MEM_HOST, CEED_USE_POINTER, ind,
+                            &elem_restriction);
+
+  for (CeedInt t = 0; t < 2; t++) {
+    CeedReorderType     reorder_type = t == 0 ? CEED_REORDER_RCM : CEED_REORDER_MORTON;
+    CeedScalar          stride_before, stride_after;
+    bool                is_seen[num_comp * num_nodes];
+    CeedVector          x, x_reordered, y, y_reordered;
+    CeedElemRestriction elem_restriction_reordered;
+
+    CeedElemRestrictionComputeReordering(elem_restriction, reorder_type, 2, elem_coords, elem_perm, node_perm, &stride_before, &stride_after);
+    if (stride_after >= stride_before) {
+      // LCOV_EXCL_START
+      printf("Reordering %s did not improve locality: %f >= %f\n", CeedReorderTypes[reorder_type], stride_after, stride_before);
+      // LCOV_EXCL_STOP
+    }
+
+    // Check permutations
+    for (CeedInt i = 0; i < num_comp * num_nodes; i++) is_seen[i] = false;
+    for (CeedInt e = 0; e < num_elem; e++) {
+      if (elem_perm[e] < 0 || elem_perm[e] >= num_elem || is_seen[elem_perm[e]]) {
+        // LCOV_EXCL_START
+        printf("Reordering %s: invalid element permutation at %" CeedInt_FMT "\n", CeedReorderTypes[reorder_type], e);
+        // LCOV_EXCL_STOP
+      } else {
+        is_seen[elem_perm[e]] = true;
+      }
+    }
+    for (CeedInt i = 0; i < num_comp * num_nodes; i++) is_seen[i] = false;
+    for (CeedInt i = 0; i < num_comp * num_nodes; i++) {
+      if (node_perm[i] < 0 || node_perm[i] >= num_comp * num_nodes || is_seen[node_perm[i]] || (i >= num_nodes && node_perm[i] != i)) {
+        // LCOV_EXCL_START
+        printf("Reordering %s: invalid node permutation at %" CeedInt_FMT "\n", CeedReorderTypes[reorder_type], i);
+        // LCOV_EXCL_STOP
+      } else {
+        is_seen[node_perm[i]] = true;
+      }
+    }
+
+    // Reordered restriction of the reordered L-vector reads the same values
+    for (CeedInt e = 0; e < num_elem; e++) {
+      for (CeedInt i = 0; i < elem_size; i++) ind_reordered[e * elem_size + i] = node_perm[ind[elem_perm[e] * elem_size + i]];
+    }
+    CeedElemRestrictionCreate(ceed, num_elem, elem_size, num_comp, num_nodes, num_comp * num_nodes, CEED_MEM_HOST, CEED_USE_POINTER, ind_reordered,
+                              &elem_restriction_reordered);
+    CeedElemRestrictionCreateVector(elem_restriction, &x, &y);
+    CeedElemRestrictionCreateVector(elem_restriction_reordered, &x_reordered, &y_reordered);
+    {
+      CeedScalar *x_array, *x_reordered_array;
+
+      CeedVectorGetArrayWrite(x, CEED_MEM_HOST, &x_array);
+      CeedVectorGetArrayWrite(x_reordered, CEED_MEM_HOST, &x_reordered_array);
+      for (CeedInt n = 0; n < num_nodes; n++) {
+        for (CeedInt k = 0; k < num_comp; k++) {
+          x_array[n + k * num_nodes]                      = sin(n + 10 * k);
+          x_reordered_array[node_perm[n] + k * num_nodes] = sin(n + 10 * k);
+        }
+      }
+      CeedVectorRestoreArray(x, &x_array);
+      CeedVectorRestoreArray(x_reordered, &x_reordered_array);
+    }
+    CeedElemRestrictionApply(elem_restriction, CEED_NOTRANSPOSE, x, y, CEED_REQUEST_IMMEDIATE);
+    CeedElemRestrictionApply(elem_restriction_reordered, CEED_NOTRANSPOSE, x_reordered, y_reordered, CEED_REQUEST_IMMEDIATE);
+    {
+      CeedInt           e_layout[3];
+      const CeedScalar *y_array, *y_reordered_array;
+
+      CeedElemRestrictionGetELayout(elem_restriction, e_layout);
+      CeedVectorGetArrayRead(y, CEED_MEM_HOST, &y_array);
+      CeedVectorGetArrayRead(y_reordered, CEED_MEM_HOST, &y_reordered_array);
+      for (CeedInt e = 0; e < num_elem; e++) {
+        for (CeedInt k = 0; k < num_comp; k++) {
+          for (CeedInt i = 0; i < elem_size; i++) {
+            const CeedInt index = i * e_layout[0] + k * e_layout[1];
+
+            if (y_reordered_array[index + e * e_layout[2]] != y_array[index + elem_perm[e] * e_layout[2]]) {
+              // LCOV_EXCL_START
+              printf("Reordering %s: element %" CeedInt_FMT " component %" CeedInt_FMT " node %" CeedInt_FMT " %f != %f\n",
+                     CeedReorderTypes[reorder_type], e, k, i, y_reordered_array[index + e * e_layout[2]],
+                     y_array[index + elem_perm[e] * e_layout[2]]);
+              // LCOV_EXCL_STOP
+            }
+          }
+        }
+      }
+      CeedVectorRestoreArrayRead(y, &y_array);
+      CeedVectorRestoreArrayRead(y_reordered, &y_reordered_array);
+    }
+    CeedVectorDestroy(&x);
+    CeedVectorDestroy(&x_reordered);
+    CeedVectorDestroy(&y);
+    CeedVectorDestroy(&y_reordered);
+    CeedElemRestrictionDestroy(&elem_restriction_reordered);
+  }
+
+  CeedElemRestrictionDestroy(&elem_restriction);
+  CeedDestroy(&ceed);
+  return 0;
+}
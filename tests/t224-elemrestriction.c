@@ -0,0 +1,146 @@
+/// @file
+/// Test structured element restriction for Cartesian meshes against restriction with explicit offsets
+/// \test Test structured element restriction for Cartesian meshes against restriction with explicit offsets
+#include <ceed.h>
+#include <ceed/backend.h>
+#include <math.h>
+#include <stdio.h>
+
+int main(int argc, char **argv) {
+  Ceed    ceed;
+  CeedInt num_elem_1d[3] = {3, 2, 4}, p = 3, num_comp = 2, block_size = 8;
+
+  CeedInit(argv[1], &ceed);
+
+  for (CeedInt dim = 1; dim <= 3; dim++) {
+    CeedInt num_elem = 1, elem_size = 1, num_nodes = 1, num_nodes_1d[3] = {1, 1, 1};
+
+    for (CeedInt d = 0; d < dim; d++) {
+      num_nodes_1d[d] = num_elem_1d[d] * (p - 1) + 1;
+      num_elem *= num_elem_1d[d];
+      elem_size *= p;
+      num_nodes *= num_nodes_1d[d];
+    }
+
+    // Lexicographic offsets with x fastest
+    CeedInt ind[num_elem * elem_size];
+
+    for (CeedInt e = 0; e < num_elem; e++) {
+      CeedInt e_xyz[3] = {e % num_elem_1d[0], 0, 0};
+
+      if (dim > 1) e_xyz[1] = (e / num_elem_1d[0]) % num_elem_1d[1];
+      if (dim > 2) e_xyz[2] = e / (num_elem_1d[0] * num_elem_1d[1]);
+      for (CeedInt n = 0; n < elem_size; n++) {
+        CeedInt n_xyz[3] = {n % p, (n / p) % p, n / (p * p)}, index = 0;
+
+        for (CeedInt d = dim - 1; d >= 0; d--) index = index * num_nodes_1d[d] + e_xyz[d] * (p - 1) + n_xyz[d];
+        ind[e * elem_size + n] = index;
+      }
+    }
+
+    for (CeedInt is_blocked = 0; is_blocked <= 1; is_blocked++) {
+      bool                is_structured;
+      CeedVector          x, y, y_offsets, z, z_offsets;
+      CeedElemRestriction elem_restriction, elem_restriction_offsets;
+
+      if (is_blocked) {
+        CeedElemRestrictionCreateBlockedStructured(ceed, dim, num_elem_1d, p, block_size, num_comp, num_nodes, num_comp * num_nodes,
+                                                   &elem_restriction);
+        CeedElemRestrictionCreateBlocked(ceed, num_elem, elem_size, block_size, num_comp, num_nodes, num_comp * num_nodes, CEED_MEM_HOST,
+                                         CEED_USE_POINTER, ind, &elem_restriction_offsets);
+      } else {
+        CeedElemRestrictionCreateStructured(ceed, dim, num_elem_1d, p, num_comp, num_nodes, num_comp * num_nodes, &elem_restriction);
+        CeedElemRestrictionCreate(ceed, num_elem, elem_size, num_comp, num_nodes, num_comp * num_nodes, CEED_MEM_HOST, CEED_USE_POINTER, ind,
+                                  &elem_restriction_offsets);
+      }
+      CeedElemRestrictionIsStructured(elem_restriction, &is_structured);
+      if (!is_structured) printf("Dim %" CeedInt_FMT ", blocked %" CeedInt_FMT ": restriction not structured\n", dim, is_blocked);
+
+      CeedElemRestrictionCreateVector(elem_restriction, &x, &y);
+      CeedElemRestrictionCreateVector(elem_restriction_offsets, &z, &y_offsets);
+      CeedVectorCreate(ceed, num_comp * num_nodes, &z_offsets);
+      {
+        CeedScalar *x_array;
+
+        CeedVectorGetArrayWrite(x, CEED_MEM_HOST, &x_array);
+        for (CeedInt i = 0; i < num_comp * num_nodes; i++) x_array[i] = sin(i);
+        CeedVectorRestoreArray(x, &x_array);
+      }
+
+      // Same E-vector from L-vector
+      CeedElemRestrictionApply(elem_restriction, CEED_NOTRANSPOSE, x, y, CEED_REQUEST_IMMEDIATE);
+      CeedElemRestrictionApply(elem_restriction_offsets, CEED_NOTRANSPOSE, x, y_offsets, CEED_REQUEST_IMMEDIATE);
+      {
+        CeedSize          e_size;
+        const CeedScalar *y_array, *y_offsets_array;
+
+        CeedVectorGetLength(y, &e_size);
+        CeedVectorGetArrayRead(y, CEED_MEM_HOST, &y_array);
+        CeedVectorGetArrayRead(y_offsets, CEED_MEM_HOST, &y_offsets_array);
+        for (CeedSize i = 0; i < e_size; i++) {
+          if (y_array[i] != y_offsets_array[i]) {
+            // LCOV_EXCL_START
+            printf("Dim %" CeedInt_FMT ", blocked %" CeedInt_FMT ": Error in restricted array y[%" CeedSize_FMT "] = %f != %f\n", dim, is_blocked, i,
+                   y_array[i], y_offsets_array[i]);
+            // LCOV_EXCL_STOP
+          }
+        }
+        CeedVectorRestoreArrayRead(y, &y_array);
+        CeedVectorRestoreArrayRead(y_offsets, &y_offsets_array);
+      }
+
+      // Same L-vector from E-vector
+      CeedVectorSetValue(z, 0.0);
+      CeedVectorSetValue(z_offsets, 0.0);
+      CeedElemRestrictionApply(elem_restriction, CEED_TRANSPOSE, y, z, CEED_REQUEST_IMMEDIATE);
+      CeedElemRestrictionApply(elem_restriction_offsets, CEED_TRANSPOSE, y, z_offsets, CEED_REQUEST_IMMEDIATE);
+      {
+        const CeedScalar *z_array, *z_offsets_array;
+
+        CeedVectorGetArrayRead(z, CEED_MEM_HOST, &z_array);
+        CeedVectorGetArrayRead(z_offsets, CEED_MEM_HOST, &z_offsets_array);
+        for (CeedInt i = 0; i < num_comp * num_nodes; i++) {
+          if (fabs(z_array[i] - z_offsets_array[i]) > 100. * CEED_EPSILON) {
+            // LCOV_EXCL_START
+            printf("Dim %" CeedInt_FMT ", blocked %" CeedInt_FMT ": Error in transpose z[%" CeedInt_FMT "] = %f != %f\n", dim, is_blocked, i,
+                   z_array[i], z_offsets_array[i]);
+            // LCOV_EXCL_STOP
+          }
+        }
+        CeedVectorRestoreArrayRead(z, &z_array);
+        CeedVectorRestoreArrayRead(z_offsets, &z_offsets_array);
+      }
+
+      // Same offsets on request
+      {
+        CeedInt        num_block;
+        const CeedInt *offsets, *offsets_explicit;
+
+        CeedElemRestrictionGetNumBlocks(elem_restriction, &num_block);
+        CeedElemRestrictionGetOffsets(elem_restriction, CEED_MEM_HOST, &offsets);
+        CeedElemRestrictionGetOffsets(elem_restriction_offsets, CEED_MEM_HOST, &offsets_explicit);
+        for (CeedInt i = 0; i < num_block * (is_blocked ? block_size : 1) * elem_size; i++) {
+          if (offsets[i] != offsets_explicit[i]) {
+            // LCOV_EXCL_START
+            printf("Dim %" CeedInt_FMT ", blocked %" CeedInt_FMT ": Error in offsets[%" CeedInt_FMT "] = %" CeedInt_FMT " != %" CeedInt_FMT "\n", dim,
+                   is_blocked, i, offsets[i], offsets_explicit[i]);
+            // LCOV_EXCL_STOP
+          }
+        }
+        CeedElemRestrictionRestoreOffsets(elem_restriction, &offsets);
+        CeedElemRestrictionRestoreOffsets(elem_restriction_offsets, &offsets_explicit);
+      }
+
+      CeedVectorDestroy(&x);
+      CeedVectorDestroy(&y);
+      CeedVectorDestroy(&y_offsets);
+      CeedVectorDestroy(&z);
+      CeedVectorDestroy(&z_offsets);
+      CeedElemRestrictionDestroy(&elem_restriction);
+      CeedElemRestrictionDestroy(&elem_restriction_offsets);
+    }
+  }
+
+  CeedDestroy(&ceed);
+  return 0;
+}
@@ -0,0 +1,108 @@
+/// @file
+/// Test even-odd decomposition of symmetric 1D interpolation and gradient matrices
+/// \test Test even-odd decomposition of symmetric 1D interpolation and gradient matrices
+#include <ceed.h>
+#include <ceed/backend.h>
+#include <math.h>
+#include <stdio.h>
+
+int main(int argc, char **argv) {
+  Ceed       ceed;
+  CeedScalar tol;
+
+  CeedInit(argv[1], &ceed);
+  {
+    CeedScalarType scalar_type;
+
+    CeedGetScalarType(&scalar_type);
+    tol = scalar_type == CEED_SCALAR_FP32 ? 1e-4 : 1e-12;
+  }
+
+  // Symmetric nodes and quadrature points
+  for (CeedInt quad_mode = CEED_GAUSS; quad_mode <= CEED_GAUSS_LOBATTO; quad_mode++) {
+    for (CeedInt P = 2; P <= 6; P++) {
+      for (CeedInt Q = P; Q <= P + 1; Q++) {
+        bool               has_even_odd;
+        const CeedInt      A = 2;
+        const CeedScalar  *interp_1d, *grad_1d, *interp_1d_even, *interp_1d_odd, *grad_1d_even, *grad_1d_odd;
+        CeedBasis          basis;
+        CeedTensorContract contract;
+
+        CeedBasisCreateTensorH1Lagrange(ceed, 1, 1, P, Q, (CeedQuadMode)quad_mode, &basis);
+        CeedBasisGetInterp1D(basis, &interp_1d);
+        CeedBasisGetGrad1D(basis, &grad_1d);
+        CeedBasisGetInterp1DEvenOdd(basis, &interp_1d_even, &interp_1d_odd);
+        CeedBasisGetGrad1DEvenOdd(basis, &grad_1d_even, &grad_1d_odd);
+        if (!interp_1d_even || !interp_1d_odd || !grad_1d_even || !grad_1d_odd) {
+          // LCOV_EXCL_START
+          printf("Missing even-odd decomposition for P = %" CeedInt_FMT ", Q = %" CeedInt_FMT "\n", P, Q);
+          // LCOV_EXCL_STOP
+          CeedBasisDestroy(&basis);
+          continue;
+        }
+
+        // Compare contractions with and without the even-odd decomposition
+        CeedBasisGetTensorContract(basis, &contract);
+        CeedTensorContractHasEvenOdd(contract, &has_even_odd);
+        for (CeedInt i = 0; i < 2 * 2 * 2 * 2 && has_even_odd; i++) {
+          const bool        is_grad = i % 2, add = (i / 2) % 2;
+          CeedTransposeMode t_mode  = (i / 4) % 2 ? CEED_TRANSPOSE : CEED_NOTRANSPOSE;
+          const CeedInt     C       = i / 8 ? 3 : 1;
+          const CeedInt     B = t_mode == CEED_NOTRANSPOSE ? P : Q, J = t_mode == CEED_NOTRANSPOSE ? Q : P;
+          CeedScalar        u[A * B * C], v[A * J * C], v_even_odd[A * J * C];
+
+          for (CeedInt k = 0; k < A * B * C; k++) u[k] = sin(k + 1.0);
+          for (CeedInt k = 0; k < A * J * C; k++) v[k] = v_even_odd[k] = cos(k + 1.0);
+          CeedTensorContractApply(contract, A, B, C, J, is_grad ? grad_1d : interp_1d, t_mode, add, u, v);
+          CeedTensorContractApplyEvenOdd(contract, A, B, C, J, is_grad ? grad_1d_even : interp_1d_even, is_grad ? grad_1d_odd : interp_1d_odd,
+                                         is_grad ? -1 : 1, t_mode, add, u, v_even_odd);
+          for (CeedInt k = 0; k < A * J * C; k++) {
+            if (fabs(v[k] - v_even_odd[k]) > tol * (1 + fabs(v[k]))) {
+              // LCOV_EXCL_START
+              printf("P = %" CeedInt_FMT ", Q = %" CeedInt_FMT ", %s %s%s: v[%" CeedInt_FMT "] %f != %f\n", P, Q, is_grad ? "grad" : "interp",
+                     CeedTransposeModes[t_mode], add ? " add" : "", k, v_even_odd[k], v[k]);
+              // LCOV_EXCL_STOP
+            }
+          }
+        }
+        CeedBasisDestroy(&basis);
+      }
+    }
+  }
+
+  // Nodes without symmetry
+  {
+    const CeedInt     P = 2, Q = 2;
+    const CeedScalar  interp_1d[4] = {1.0, 0.0, 0.25, 0.75}, grad_1d[4] = {-1.0, 1.0, -0.5, 0.5}, q_ref_1d[2] = {-0.5, 0.5};
+    const CeedScalar  q_weight_1d[2] = {1.0, 1.0};
+    const CeedScalar *interp_1d_even, *interp_1d_odd, *grad_1d_even, *grad_1d_odd;
+    CeedBasis         basis;
+
+    CeedBasisCreateTensorH1(ceed, 1, 1, P, Q, interp_1d, grad_1d, q_ref_1d, q_weight_1d, &basis);
+    CeedBasisGetInterp1DEvenOdd(basis, &interp_1d_even, &interp_1d_odd);
+    CeedBasisGetGrad1DEvenOdd(basis, &grad_1d_even, &grad_1d_odd);
+    if (interp_1d_even || interp_1d_odd) printf("Even-odd decomposition of interpolation matrix without symmetry\n");
+    if (grad_1d_even || grad_1d_odd) printf("Even-odd decomposition of gradient matrix without symmetry\n");
+    CeedBasisDestroy(&basis);
+  }
+
+  // Nearly symmetric and zero matrices
+  {
+    const CeedInt P = 2, Q = 2;
+    CeedScalar    interp_1d[4] = {0.75, 0.25, 0.25, 0.75}, zero_1d[4] = {0.0};
+    CeedScalar   *mat_even, *mat_odd;
+
+    interp_1d[0] += 100 * CEED_EPSILON;
+    CeedMatrixFoldEvenOdd(interp_1d, Q, P, 1, &mat_even, &mat_odd);
+    if (mat_even || mat_odd) printf("Even-odd decomposition of nearly symmetric matrix\n");
+    CeedFree(&mat_even);
+    CeedFree(&mat_odd);
+    CeedMatrixFoldEvenOdd(zero_1d, Q, P, -1, &mat_even, &mat_odd);
+    if (mat_even || mat_odd) printf("Even-odd decomposition of zero matrix\n");
+    CeedFree(&mat_even);
+    CeedFree(&mat_odd);
+  }
+
+  CeedDestroy(&ceed);
+  return 0;
+}
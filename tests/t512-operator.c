@@ -0,0 +1,174 @@
+/// @file
+/// Test collection of statistics for each stage of mass matrix operator and composite operator application
+/// \test Test collection of statistics for each stage of mass matrix operator and composite operator application
+#include <ceed.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+int main(int argc, char **argv) {
+  Ceed                ceed;
+  CeedElemRestriction elem_restriction_x, elem_restriction_u, elem_restriction_q_data;
+  CeedBasis           basis_x, basis_u;
+  CeedQFunction       qf_setup, qf_mass;
+  CeedOperator        op_setup, op_mass, op_composite;
+  CeedVector          q_data, x, u, v;
+  CeedInt             num_elem = 15, p = 5, q = 8;
+  CeedInt             num_dofs_x = num_elem + 1, num_dofs_u = num_elem * (p - 1) + 1;
+  CeedInt             ind_x[num_elem * 2], ind_u[num_elem * p];
+
+  CeedInit(argv[1], &ceed);
+
+  CeedVectorCreate(ceed, num_dofs_x, &x);
+  {
+    CeedScalar x_array[num_dofs_x];
+
+    for (CeedInt i = 0; i < num_dofs_x; i++) x_array[i] = (CeedScalar)i / (num_dofs_x - 1);
+    CeedVectorSetArray(x, CEED_MEM_HOST, CEED_COPY_VALUES, x_array);
+  }
+  CeedVectorCreate(ceed, num_elem * q, &q_data);
+  CeedVectorCreate(ceed, num_dofs_u, &u);
+  CeedVectorCreate(ceed, num_dofs_u, &v);
+  CeedVectorSetValue(u, 1.0);
+
+  // Restrictions
+  for (CeedInt i = 0; i < num_elem; i++) {
+    ind_x[2 * i + 0] = i;
+    ind_x[2 * i + 1] = i + 1;
+  }
+  CeedElemRestrictionCreate(ceed, num_elem, 2, 1, 1, num_dofs_x, CEED_MEM_HOST, CEED_USE_POINTER, ind_x, &elem_restriction_x);
+
+  for (CeedInt i = 0; i < num_elem; i++) {
+    for (CeedInt j = 0; j < p; j++) ind_u[p * i + j] = i * (p - 1) + j;
+  }
+  CeedElemRestrictionCreate(ceed, num_elem, p, 1, 1, num_dofs_u, CEED_MEM_HOST, CEED_USE_POINTER, ind_u, &elem_restriction_u);
+
+  CeedInt strides_q_data[3] = {1, q, q};
+  CeedElemRestrictionCreateStrided(ceed, num_elem, q, 1, q * num_elem, strides_q_data, &elem_restriction_q_data);
+
+  // Bases
+  CeedBasisCreateTensorH1Lagrange(ceed, 1, 1, 2, q, CEED_GAUSS, &basis_x);
+  CeedBasisCreateTensorH1Lagrange(ceed, 1, 1, p, q, CEED_GAUSS, &basis_u);
+
+  // QFunctions
+  CeedQFunctionCreateInteriorByName(ceed, "Mass1DBuild", &qf_setup);
+  CeedQFunctionCreateInteriorByName(ceed, "MassApply", &qf_mass);
+  CeedQFunctionSetUserFlopsEstimate(qf_mass, 2);
+
+  // Operators
+  CeedOperatorCreate(ceed, qf_setup, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, &op_setup);
+  CeedOperatorSetField(op_setup, "weights", CEED_ELEMRESTRICTION_NONE, basis_x, CEED_VECTOR_NONE);
+  CeedOperatorSetField(op_setup, "dx", elem_restriction_x, basis_x, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_setup, "qdata", elem_restriction_q_data, CEED_BASIS_NONE, CEED_VECTOR_ACTIVE);
+
+  CeedOperatorCreate(ceed, qf_mass, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, &op_mass);
+  CeedOperatorSetField(op_mass, "u", elem_restriction_u, basis_u, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_mass, "qdata", elem_restriction_q_data, CEED_BASIS_NONE, q_data);
+  CeedOperatorSetField(op_mass, "v", elem_restriction_u, basis_u, CEED_VECTOR_ACTIVE);
+
+  CeedCompositeOperatorCreate(ceed, &op_composite);
+  CeedCompositeOperatorAddSub(op_composite, op_mass);
+
+  CeedOperatorApply(op_setup, x, q_data, CEED_REQUEST_IMMEDIATE);
+
+  // Apply twice collecting statistics
+  CeedOperatorSetCollectStats(op_mass, true);
+  for (CeedInt k = 0; k < 2; k++) CeedOperatorApply(op_mass, u, v, CEED_REQUEST_IMMEDIATE);
+  {
+    CeedSize num_calls[4], bytes[4], flops[4];
+    double   time[4];
+
+    for (CeedInt s = CEED_STAGE_OPERATOR; s <= CEED_STAGE_QFUNCTION; s++) {
+      CeedOperatorGetStats(op_mass, (CeedStageType)s, NULL, &num_calls[s], &time[s], &bytes[s], &flops[s]);
+      if (time[s] < 0.0) printf("Negative time for stage %s: %f\n", CeedStageTypes[s], time[s]);
+    }
+    if (num_calls[CEED_STAGE_OPERATOR] != 2) {
+      // LCOV_EXCL_START
+      printf("Incorrect number of operator applications: %" CeedSize_FMT " != 2\n", num_calls[CEED_STAGE_OPERATOR]);
+      // LCOV_EXCL_STOP
+    }
+    if (bytes[CEED_STAGE_OPERATOR] != bytes[CEED_STAGE_RESTRICTION] + bytes[CEED_STAGE_BASIS] + bytes[CEED_STAGE_QFUNCTION] ||
+        flops[CEED_STAGE_OPERATOR] != flops[CEED_STAGE_RESTRICTION] + flops[CEED_STAGE_BASIS] + flops[CEED_STAGE_QFUNCTION]) {
+      // LCOV_EXCL_START
+      printf("Operator estimates are not the sum of the stage estimates\n");
+      // LCOV_EXCL_STOP
+    }
+
+    // QFunction applications are recorded unless the backend fuses them into generated kernels
+    if (num_calls[CEED_STAGE_QFUNCTION] == 0 && !strstr(argv[1], "/gen")) printf("No QFunction applications recorded\n");
+
+    // QFunction applied to every quadrature point, with three fields of size 1 and two flops per point
+    if (num_calls[CEED_STAGE_QFUNCTION] > 0) {
+      const CeedSize num_qpts = bytes[CEED_STAGE_QFUNCTION] / (3 * (CeedSize)sizeof(CeedScalar));
+
+      if (num_qpts < 2 * num_elem * q || flops[CEED_STAGE_QFUNCTION] != 2 * num_qpts) {
+        // LCOV_EXCL_START
+        printf("Incorrect QFunction estimates: %" CeedSize_FMT " bytes, %" CeedSize_FMT " flops\n", bytes[CEED_STAGE_QFUNCTION],
+               flops[CEED_STAGE_QFUNCTION]);
+        // LCOV_EXCL_STOP
+      }
+    }
+
+    // Every restriction and basis application belongs to a field, and the active input and output fields are applied alike
+    for (CeedInt s = CEED_STAGE_RESTRICTION; s <= CEED_STAGE_BASIS; s++) {
+      CeedSize num_calls_u, num_calls_v, num_calls_q_data, bytes_u;
+
+      if (num_calls[s] == 0) continue;
+      CeedOperatorGetStats(op_mass, (CeedStageType)s, "u", &num_calls_u, NULL, &bytes_u, NULL);
+      CeedOperatorGetStats(op_mass, (CeedStageType)s, "v", &num_calls_v, NULL, NULL, NULL);
+      CeedOperatorGetStats(op_mass, (CeedStageType)s, "qdata", &num_calls_q_data, NULL, NULL, NULL);
+      if (num_calls_u != num_calls_v || (num_calls_u > 0 && bytes_u == 0) || num_calls_u + num_calls_v + num_calls_q_data != num_calls[s]) {
+        // LCOV_EXCL_START
+        printf("Incorrect %s statistics by field: u %" CeedSize_FMT ", v %" CeedSize_FMT ", qdata %" CeedSize_FMT " of %" CeedSize_FMT " calls\n",
+               CeedStageTypes[s], num_calls_u, num_calls_v, num_calls_q_data, num_calls[s]);
+        // LCOV_EXCL_STOP
+      }
+      if (s == CEED_STAGE_BASIS && num_calls_q_data != 0) printf("Basis applications attributed to field without basis\n");
+    }
+  }
+
+  // Composite operator sums over sub-operators
+  CeedOperatorSetCollectStats(op_composite, true);
+  CeedOperatorResetStats(op_composite);
+  CeedOperatorApply(op_composite, u, v, CEED_REQUEST_IMMEDIATE);
+  for (CeedInt s = CEED_STAGE_OPERATOR; s <= CEED_STAGE_QFUNCTION; s++) {
+    CeedSize num_calls, num_calls_sub, bytes, bytes_sub;
+
+    CeedOperatorGetStats(op_composite, (CeedStageType)s, NULL, &num_calls, NULL, &bytes, NULL);
+    CeedOperatorGetStats(op_mass, (CeedStageType)s, NULL, &num_calls_sub, NULL, &bytes_sub, NULL);
+    if ((s == CEED_STAGE_OPERATOR && num_calls != 1) || (s != CEED_STAGE_OPERATOR && num_calls != num_calls_sub) || bytes != bytes_sub) {
+      // LCOV_EXCL_START
+      printf("Incorrect composite %s statistics: %" CeedSize_FMT " calls, %" CeedSize_FMT " bytes\n", CeedStageTypes[s], num_calls, bytes);
+      // LCOV_EXCL_STOP
+    }
+  }
+
+  // Reset
+  CeedOperatorResetStats(op_composite);
+  for (CeedInt s = CEED_STAGE_OPERATOR; s <= CEED_STAGE_QFUNCTION; s++) {
+    CeedSize num_calls, bytes, flops;
+    double   time;
+
+    CeedOperatorGetStats(op_mass, (CeedStageType)s, NULL, &num_calls, &time, &bytes, &flops);
+    if (num_calls != 0 || time != 0.0 || bytes != 0 || flops != 0) printf("Statistics for stage %s not reset\n", CeedStageTypes[s]);
+  }
+
+  // Cleanup
+  CeedVectorDestroy(&x);
+  CeedVectorDestroy(&q_data);
+  CeedVectorDestroy(&u);
+  CeedVectorDestroy(&v);
+  CeedElemRestrictionDestroy(&elem_restriction_u);
+  CeedElemRestrictionDestroy(&elem_restriction_x);
+  CeedElemRestrictionDestroy(&elem_restriction_q_data);
+  CeedBasisDestroy(&basis_u);
+  CeedBasisDestroy(&basis_x);
+  CeedQFunctionDestroy(&qf_setup);
+  CeedQFunctionDestroy(&qf_mass);
+  CeedOperatorDestroy(&op_setup);
+  CeedOperatorDestroy(&op_mass);
+  CeedOperatorDestroy(&op_composite);
+  CeedDestroy(&ceed);
+  return 0;
+}
@@ -0,0 +1,167 @@
+/// @file
+/// Test estimates of compulsory memory traffic and roofline summary for mass matrix operator
+/// \test Test estimates of compulsory memory traffic and roofline summary for mass matrix operator
+#include <ceed.h>
+#include <ceed/backend.h>
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+int main(int argc, char **argv) {
+  Ceed                ceed;
+  CeedElemRestriction elem_restriction_x, elem_restriction_u, elem_restriction_q_data;
+  CeedBasis           basis_x, basis_u;
+  CeedQFunction       qf_setup, qf_mass;
+  CeedOperator        op_setup, op_mass, op_mass_bf16, op_composite;
+  CeedVector          q_data, x, u, v;
+  CeedInt             num_elem = 15, p = 5, q = 8;
+  CeedInt             num_dofs_x = num_elem + 1, num_dofs_u = num_elem * (p - 1) + 1;
+  CeedInt             ind_x[num_elem * 2], ind_u[num_elem * p];
+  CeedSize            bytes, bytes_bf16, bytes_composite, bytes_true;
+  const CeedSize      scalar_size = sizeof(CeedScalar);
+
+  CeedInit(argv[1], &ceed);
+
+  CeedVectorCreate(ceed, num_dofs_x, &x);
+  {
+    CeedScalar x_array[num_dofs_x];
+
+    for (CeedInt i = 0; i < num_dofs_x; i++) x_array[i] = (CeedScalar)i / (num_dofs_x - 1);
+    CeedVectorSetArray(x, CEED_MEM_HOST, CEED_COPY_VALUES, x_array);
+  }
+  CeedVectorCreate(ceed, num_elem * q, &q_data);
+  CeedVectorCreate(ceed, num_dofs_u, &u);
+  CeedVectorCreate(ceed, num_dofs_u, &v);
+  CeedVectorSetValue(u, 1.0);
+
+  // Restrictions
+  for (CeedInt i = 0; i < num_elem; i++) {
+    ind_x[2 * i + 0] = i;
+    ind_x[2 * i + 1] = i + 1;
+  }
+  CeedElemRestrictionCreate(ceed, num_elem, 2, 1, 1, num_dofs_x, CEED_MEM_HOST, CEED_USE_POINTER, ind_x, &elem_restriction_x);
+
+  for (CeedInt i = 0; i < num_elem; i++) {
+    for (CeedInt j = 0; j < p; j++) ind_u[p * i + j] = i * (p - 1) + j;
+  }
+  CeedElemRestrictionCreate(ceed, num_elem, p, 1, 1, num_dofs_u, CEED_MEM_HOST, CEED_USE_POINTER, ind_u, &elem_restriction_u);
+
+  CeedInt strides_q_data[3] = {1, q, q};
+  CeedElemRestrictionCreateStrided(ceed, num_elem, q, 1, q * num_elem, strides_q_data, &elem_restriction_q_data);
+
+  // Bases
+  CeedBasisCreateTensorH1Lagrange(ceed, 1, 1, 2, q, CEED_GAUSS, &basis_x);
+  CeedBasisCreateTensorH1Lagrange(ceed, 1, 1, p, q, CEED_GAUSS, &basis_u);
+
+  // QFunctions
+  CeedQFunctionCreateInteriorByName(ceed, "Mass1DBuild", &qf_setup);
+  CeedQFunctionCreateInteriorByName(ceed, "MassApply", &qf_mass);
+  CeedQFunctionSetUserFlopsEstimate(qf_mass, 2);
+
+  // Operators
+  CeedOperatorCreate(ceed, qf_setup, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, &op_setup);
+  CeedOperatorSetField(op_setup, "weights", CEED_ELEMRESTRICTION_NONE, basis_x, CEED_VECTOR_NONE);
+  CeedOperatorSetField(op_setup, "dx", elem_restriction_x, basis_x, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_setup, "qdata", elem_restriction_q_data, CEED_BASIS_NONE, CEED_VECTOR_ACTIVE);
+
+  CeedOperatorCreate(ceed, qf_mass, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, &op_mass);
+  CeedOperatorSetField(op_mass, "u", elem_restriction_u, basis_u, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_mass, "qdata", elem_restriction_q_data, CEED_BASIS_NONE, q_data);
+  CeedOperatorSetField(op_mass, "v", elem_restriction_u, basis_u, CEED_VECTOR_ACTIVE);
+
+  CeedOperatorCreate(ceed, qf_mass, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, &op_mass_bf16);
+  CeedOperatorSetField(op_mass_bf16, "u", elem_restriction_u, basis_u, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_mass_bf16, "qdata", elem_restriction_q_data, CEED_BASIS_NONE, q_data);
+  CeedOperatorSetField(op_mass_bf16, "v", elem_restriction_u, basis_u, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetFieldStorage(op_mass_bf16, "qdata", CEED_STORAGE_BF16);
+
+  CeedCompositeOperatorCreate(ceed, &op_composite);
+  CeedCompositeOperatorAddSub(op_composite, op_mass);
+  CeedCompositeOperatorAddSub(op_composite, op_mass_bf16);
+
+  CeedOperatorApply(op_setup, x, q_data, CEED_REQUEST_IMMEDIATE);
+
+  // Component estimates
+  {
+    CeedSize bytes_rstr, bytes_rstr_transpose, bytes_rstr_q_data, bytes_interp, bytes_weight, bytes_qf;
+
+    CeedElemRestrictionGetBytesEstimate(elem_restriction_u, CEED_NOTRANSPOSE, &bytes_rstr);
+    CeedElemRestrictionGetBytesEstimate(elem_restriction_u, CEED_TRANSPOSE, &bytes_rstr_transpose);
+    CeedElemRestrictionGetBytesEstimate(elem_restriction_q_data, CEED_NOTRANSPOSE, &bytes_rstr_q_data);
+    if (bytes_rstr != (num_elem * p + num_dofs_u) * scalar_size + num_elem * p * (CeedSize)sizeof(CeedInt) ||
+        bytes_rstr_transpose != bytes_rstr + num_dofs_u * scalar_size || bytes_rstr_q_data != 2 * num_elem * q * scalar_size) {
+      // LCOV_EXCL_START
+      printf("Incorrect restriction bytes estimates: %" CeedSize_FMT ", %" CeedSize_FMT ", %" CeedSize_FMT "\n", bytes_rstr, bytes_rstr_transpose,
+             bytes_rstr_q_data);
+      // LCOV_EXCL_STOP
+    }
+
+    CeedBasisGetBytesEstimate(basis_u, CEED_NOTRANSPOSE, CEED_EVAL_INTERP, false, 0, &bytes_interp);
+    CeedBasisGetBytesEstimate(basis_x, CEED_NOTRANSPOSE, CEED_EVAL_WEIGHT, false, 0, &bytes_weight);
+    if (bytes_interp != (p + q) * scalar_size || bytes_weight != q * scalar_size) {
+      // LCOV_EXCL_START
+      printf("Incorrect basis bytes estimates: %" CeedSize_FMT ", %" CeedSize_FMT "\n", bytes_interp, bytes_weight);
+      // LCOV_EXCL_STOP
+    }
+
+    CeedQFunctionGetBytesEstimate(qf_mass, &bytes_qf);
+    if (bytes_qf != 3 * scalar_size) printf("Incorrect QFunction bytes estimate: %" CeedSize_FMT "\n", bytes_qf);
+  }
+
+  // Operator estimates, reading u and q_data, reading and writing v, and reading the offsets once
+  CeedOperatorGetBytesEstimate(op_mass, &bytes);
+  bytes_true = 3 * num_dofs_u * scalar_size + num_elem * q * scalar_size + num_elem * p * (CeedSize)sizeof(CeedInt);
+  if (bytes != bytes_true) printf("Incorrect operator bytes estimate: %" CeedSize_FMT " != %" CeedSize_FMT "\n", bytes, bytes_true);
+  CeedOperatorGetBytesEstimate(op_mass_bf16, &bytes_bf16);
+  bytes_true = bytes - num_elem * q * (scalar_size - (CeedSize)sizeof(uint16_t));
+  if (bytes_bf16 != bytes_true) printf("Incorrect bfloat16 operator bytes estimate: %" CeedSize_FMT " != %" CeedSize_FMT "\n", bytes_bf16, bytes_true);
+  CeedOperatorGetBytesEstimate(op_composite, &bytes_composite);
+  if (bytes_composite != bytes + bytes_bf16) printf("Incorrect composite operator bytes estimate: %" CeedSize_FMT "\n", bytes_composite);
+
+  // Roofline
+  {
+    const double stream_bandwidth = 1e10;
+    double       intensity, bandwidth, fraction, time;
+    CeedSize     flops, num_calls;
+
+    CeedOperatorGetRoofline(op_mass, stream_bandwidth, NULL, &bandwidth, &fraction);
+    if (bandwidth != 0.0 || fraction != 0.0) printf("Nonzero bandwidth without statistics: %e, %e\n", bandwidth, fraction);
+
+    CeedOperatorSetCollectStats(op_mass, true);
+    for (CeedInt k = 0; k < 3; k++) CeedOperatorApply(op_mass, u, v, CEED_REQUEST_IMMEDIATE);
+    CeedOperatorGetStats(op_mass, CEED_STAGE_OPERATOR, NULL, &num_calls, &time, NULL, NULL);
+    CeedOperatorGetFlopsEstimate(op_mass, &flops);
+    CeedOperatorGetRoofline(op_mass, stream_bandwidth, &intensity, &bandwidth, &fraction);
+    if (fabs(intensity - (double)flops / bytes) > 1e-12 * intensity) {
+      // LCOV_EXCL_START
+      printf("Incorrect arithmetic intensity: %e != %e\n", intensity, (double)flops / bytes);
+      // LCOV_EXCL_STOP
+    }
+    if (time > 0.0 && (fabs(bandwidth * time - (double)num_calls * bytes) > 1e-12 * bandwidth * time ||
+                       fabs(fraction * stream_bandwidth - bandwidth) > 1e-12 * bandwidth)) {
+      // LCOV_EXCL_START
+      printf("Incorrect roofline bandwidth: %e bytes/s, %e of STREAM\n", bandwidth, fraction);
+      // LCOV_EXCL_STOP
+    }
+  }
+
+  // Cleanup
+  CeedVectorDestroy(&x);
+  CeedVectorDestroy(&q_data);
+  CeedVectorDestroy(&u);
+  CeedVectorDestroy(&v);
+  CeedElemRestrictionDestroy(&elem_restriction_u);
+  CeedElemRestrictionDestroy(&elem_restriction_x);
+  CeedElemRestrictionDestroy(&elem_restriction_q_data);
+  CeedBasisDestroy(&basis_u);
+  CeedBasisDestroy(&basis_x);
+  CeedQFunctionDestroy(&qf_setup);
+  CeedQFunctionDestroy(&qf_mass);
+  CeedOperatorDestroy(&op_setup);
+  CeedOperatorDestroy(&op_mass);
+  CeedOperatorDestroy(&op_mass_bf16);
+  CeedOperatorDestroy(&op_composite);
+  CeedDestroy(&ceed);
+  return 0;
+}
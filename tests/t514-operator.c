@@ -0,0 +1,217 @@
+/// @file
+/// Test tensor contraction tile shapes and autotuned block size for mass matrix operator
+/// \test Test tensor contraction tile shapes and autotuned block size for mass matrix operator
+#define _POSIX_C_SOURCE 200809L
+#include <ceed.h>
+#include <ceed/backend.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+int main(int argc, char **argv) {
+  Ceed                ceed;
+  CeedElemRestriction elem_restriction_x, elem_restriction_u, elem_restriction_q_data;
+  CeedBasis           basis_x, basis_u;
+  CeedQFunction       qf_setup, qf_mass;
+  CeedOperator        op_setup, op_mass, op_mass_tuned;
+  CeedVector          q_data, x, u, v, v_tuned;
+  CeedInt             num_elem = 15, p = 5, q = 8;
+  CeedInt             num_dofs_x = num_elem + 1, num_dofs_u = num_elem * (p - 1) + 1;
+  CeedInt             ind_x[num_elem * 2], ind_u[num_elem * p];
+  char                tuning_dir[] = "/tmp/ceed-t514-XXXXXX", tuning_file[64], tuning_lock_file[64];
+
+  // Use private tuning file
+  if (!mkdtemp(tuning_dir)) return 1;
+  snprintf(tuning_file, sizeof(tuning_file), "%s/tuning.txt", tuning_dir);
+  snprintf(tuning_lock_file, sizeof(tuning_lock_file), "%s.lock", tuning_file);
+  setenv("CEED_TUNING_FILE", tuning_file, 1);
+  unsetenv("CEED_AUTOTUNE");
+  CeedInit(argv[1], &ceed);
+
+  // Every tile shape gives the same contraction
+  {
+    const CeedInt      dim = 3, num_comp = 2, p_3d = 3, q_3d = 4, num_elem_3d = 13;
+    const CeedInt      e_size = num_elem_3d * num_comp * p_3d * p_3d * p_3d, q_size = num_elem_3d * num_comp * dim * q_3d * q_3d * q_3d;
+    CeedInt            num_tiles = 0;
+    CeedScalar         q_true[q_size], e_true[e_size];
+    CeedBasis          basis;
+    CeedTensorContract contract;
+
+    // Backends without tensor contraction objects have nothing to check
+    CeedBasisCreateTensorH1Lagrange(ceed, dim, num_comp, p_3d, q_3d, CEED_GAUSS, &basis);
+    CeedBasisGetTensorContract(basis, &contract);
+    if (contract) CeedTensorContractGetNumTiles(contract, &num_tiles);
+    if (contract && num_tiles < 1) printf("Incorrect number of tile shapes: %" CeedInt_FMT "\n", num_tiles);
+    for (CeedInt t = 0; t < num_tiles; t++) {
+      CeedVector e_vec, q_vec, e_vec_transpose;
+
+      CeedVectorCreate(ceed, e_size, &e_vec);
+      CeedVectorCreate(ceed, q_size, &q_vec);
+      CeedVectorCreate(ceed, e_size, &e_vec_transpose);
+      {
+        CeedScalar *e_array;
+
+        CeedVectorGetArrayWrite(e_vec, CEED_MEM_HOST, &e_array);
+        for (CeedInt i = 0; i < e_size; i++) e_array[i] = sin(i);
+        CeedVectorRestoreArray(e_vec, &e_array);
+      }
+      CeedTensorContractSetTile(contract, t);
+      CeedBasisApply(basis, num_elem_3d, CEED_NOTRANSPOSE, CEED_EVAL_GRAD, e_vec, q_vec);
+      CeedBasisApply(basis, num_elem_3d, CEED_TRANSPOSE, CEED_EVAL_GRAD, q_vec, e_vec_transpose);
+      {
+        const CeedScalar *q_array, *e_array;
+
+        CeedVectorGetArrayRead(q_vec, CEED_MEM_HOST, &q_array);
+        CeedVectorGetArrayRead(e_vec_transpose, CEED_MEM_HOST, &e_array);
+        for (CeedInt i = 0; i < q_size; i++) {
+          if (t == 0) q_true[i] = q_array[i];
+          else if (fabs(q_array[i] - q_true[i]) > 100. * CEED_EPSILON * fmax(1.0, fabs(q_true[i]))) {
+            // LCOV_EXCL_START
+            printf("Tile %" CeedInt_FMT ": Error in gradient [%" CeedInt_FMT "] = %f != %f\n", t, i, q_array[i], q_true[i]);
+            // LCOV_EXCL_STOP
+          }
+        }
+        for (CeedInt i = 0; i < e_size; i++) {
+          if (t == 0) e_true[i] = e_array[i];
+          else if (fabs(e_array[i] - e_true[i]) > 100. * CEED_EPSILON * fmax(1.0, fabs(e_true[i]))) {
+            // LCOV_EXCL_START
+            printf("Tile %" CeedInt_FMT ": Error in transpose gradient [%" CeedInt_FMT "] = %f != %f\n", t, i, e_array[i], e_true[i]);
+            // LCOV_EXCL_STOP
+          }
+        }
+        CeedVectorRestoreArrayRead(q_vec, &q_array);
+        CeedVectorRestoreArrayRead(e_vec_transpose, &e_array);
+      }
+      CeedVectorDestroy(&e_vec);
+      CeedVectorDestroy(&q_vec);
+      CeedVectorDestroy(&e_vec_transpose);
+    }
+    CeedBasisDestroy(&basis);
+  }
+
+  CeedVectorCreate(ceed, num_dofs_x, &x);
+  {
+    CeedScalar x_array[num_dofs_x];
+
+    for (CeedInt i = 0; i < num_dofs_x; i++) x_array[i] = (CeedScalar)i / (num_dofs_x - 1);
+    CeedVectorSetArray(x, CEED_MEM_HOST, CEED_COPY_VALUES, x_array);
+  }
+  CeedVectorCreate(ceed, num_elem * q, &q_data);
+  CeedVectorCreate(ceed, num_dofs_u, &u);
+  CeedVectorCreate(ceed, num_dofs_u, &v);
+  CeedVectorCreate(ceed, num_dofs_u, &v_tuned);
+  {
+    CeedScalar *u_array;
+
+    CeedVectorGetArrayWrite(u, CEED_MEM_HOST, &u_array);
+    for (CeedInt i = 0; i < num_dofs_u; i++) u_array[i] = cos(i);
+    CeedVectorRestoreArray(u, &u_array);
+  }
+
+  // Restrictions
+  for (CeedInt i = 0; i < num_elem; i++) {
+    ind_x[2 * i + 0] = i;
+    ind_x[2 * i + 1] = i + 1;
+  }
+  CeedElemRestrictionCreate(ceed, num_elem, 2, 1, 1, num_dofs_x, CEED_MEM_HOST, CEED_USE_POINTER, ind_x, &elem_restriction_x);
+
+  for (CeedInt i = 0; i < num_elem; i++) {
+    for (CeedInt j = 0; j < p; j++) ind_u[p * i + j] = i * (p - 1) + j;
+  }
+  CeedElemRestrictionCreate(ceed, num_elem, p, 1, 1, num_dofs_u, CEED_MEM_HOST, CEED_USE_POINTER, ind_u, &elem_restriction_u);
+
+  CeedInt strides_q_data[3] = {1, q, q};
+  CeedElemRestrictionCreateStrided(ceed, num_elem, q, 1, q * num_elem, strides_q_data, &elem_restriction_q_data);
+
+  // Bases
+  CeedBasisCreateTensorH1Lagrange(ceed, 1, 1, 2, q, CEED_GAUSS, &basis_x);
+  CeedBasisCreateTensorH1Lagrange(ceed, 1, 1, p, q, CEED_GAUSS, &basis_u);
+
+  // QFunctions
+  CeedQFunctionCreateInteriorByName(ceed, "Mass1DBuild", &qf_setup);
+  CeedQFunctionCreateInteriorByName(ceed, "MassApply", &qf_mass);
+
+  // Operators
+  CeedOperatorCreate(ceed, qf_setup, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, &op_setup);
+  CeedOperatorSetField(op_setup, "weights", CEED_ELEMRESTRICTION_NONE, basis_x, CEED_VECTOR_NONE);
+  CeedOperatorSetField(op_setup, "dx", elem_restriction_x, basis_x, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_setup, "qdata", elem_restriction_q_data, CEED_BASIS_NONE, CEED_VECTOR_ACTIVE);
+
+  CeedOperatorCreate(ceed, qf_mass, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, &op_mass);
+  CeedOperatorSetField(op_mass, "u", elem_restriction_u, basis_u, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_mass, "qdata", elem_restriction_q_data, CEED_BASIS_NONE, q_data);
+  CeedOperatorSetField(op_mass, "v", elem_restriction_u, basis_u, CEED_VECTOR_ACTIVE);
+
+  CeedOperatorCreate(ceed, qf_mass, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, &op_mass_tuned);
+  CeedOperatorSetField(op_mass_tuned, "u", elem_restriction_u, basis_u, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_mass_tuned, "qdata", elem_restriction_q_data, CEED_BASIS_NONE, q_data);
+  CeedOperatorSetField(op_mass_tuned, "v", elem_restriction_u, basis_u, CEED_VECTOR_ACTIVE);
+
+  CeedOperatorApply(op_setup, x, q_data, CEED_REQUEST_IMMEDIATE);
+  CeedOperatorApply(op_mass, u, v, CEED_REQUEST_IMMEDIATE);
+
+  // Autotuned operator gives the same result
+  setenv("CEED_AUTOTUNE", "1", 1);
+  CeedOperatorApply(op_mass_tuned, u, v_tuned, CEED_REQUEST_IMMEDIATE);
+  {
+    const CeedScalar *v_array, *v_tuned_array;
+
+    CeedVectorGetArrayRead(v, CEED_MEM_HOST, &v_array);
+    CeedVectorGetArrayRead(v_tuned, CEED_MEM_HOST, &v_tuned_array);
+    for (CeedInt i = 0; i < num_dofs_u; i++) {
+      if (fabs(v_array[i] - v_tuned_array[i]) > 100. * CEED_EPSILON) {
+        // LCOV_EXCL_START
+        printf("Error in autotuned operator v[%" CeedInt_FMT "] = %f != %f\n", i, v_tuned_array[i], v_array[i]);
+        // LCOV_EXCL_STOP
+      }
+    }
+    CeedVectorRestoreArrayRead(v, &v_array);
+    CeedVectorRestoreArrayRead(v_tuned, &v_tuned_array);
+  }
+
+  // Tuning file entries, if the backend is autotuned
+  {
+    char  line[2048];
+    FILE *file = fopen(tuning_file, "r");
+
+    while (file && fgets(line, sizeof(line), file)) {
+      char    resource[1024];
+      CeedInt dim, P_1d, Q_1d, num_comp, block_size, tile;
+
+      if (line[0] == '#') continue;
+      if (sscanf(line, "%1023s %" CeedInt_FMT " %" CeedInt_FMT " %" CeedInt_FMT " %" CeedInt_FMT " %" CeedInt_FMT " %" CeedInt_FMT, resource, &dim,
+                 &P_1d, &Q_1d, &num_comp, &block_size, &tile) != 7 ||
+          dim != 1 || P_1d != p || Q_1d != q || num_comp != 1 || block_size < 1 || tile < 0) {
+        // LCOV_EXCL_START
+        printf("Incorrect tuning file entry: %s", line);
+        // LCOV_EXCL_STOP
+      }
+    }
+    if (file) fclose(file);
+  }
+  unsetenv("CEED_AUTOTUNE");
+  unlink(tuning_file);
+  unlink(tuning_lock_file);
+  if (rmdir(tuning_dir)) printf("Unexpected files left in tuning directory\n");
+
+  // Cleanup
+  CeedVectorDestroy(&x);
+  CeedVectorDestroy(&q_data);
+  CeedVectorDestroy(&u);
+  CeedVectorDestroy(&v);
+  CeedVectorDestroy(&v_tuned);
+  CeedElemRestrictionDestroy(&elem_restriction_u);
+  CeedElemRestrictionDestroy(&elem_restriction_x);
+  CeedElemRestrictionDestroy(&elem_restriction_q_data);
+  CeedBasisDestroy(&basis_u);
+  CeedBasisDestroy(&basis_x);
+  CeedQFunctionDestroy(&qf_setup);
+  CeedQFunctionDestroy(&qf_mass);
+  CeedOperatorDestroy(&op_setup);
+  CeedOperatorDestroy(&op_mass);
+  CeedOperatorDestroy(&op_mass_tuned);
+  CeedDestroy(&ceed);
+  return 0;
+}
@@ -0,0 +1,117 @@
+/// @file
+/// Test vector mass matrix operator with structured element restrictions
+/// \test Test vector mass matrix operator with structured element restrictions
+#include <ceed.h>
+#include <math.h>
+#include <stdio.h>
+
+int main(int argc, char **argv) {
+  Ceed ceed;
+
+  CeedInit(argv[1], &ceed);
+
+  for (CeedInt dim = 2; dim <= 3; dim++) {
+    const CeedInt       num_comp = 3, p = 3, q = 4, num_elem_1d[3] = {3, 2, 2};
+    CeedInt             num_elem = 1, elem_size = 1, num_qpts = 1, num_nodes = 1, num_nodes_1d[3];
+    CeedElemRestriction elem_restriction_u, elem_restriction_u_structured, elem_restriction_q_data;
+    CeedBasis           basis_u;
+    CeedQFunction       qf_mass;
+    CeedOperator        op_mass, op_mass_structured;
+    CeedVector          q_data, u, v, v_structured;
+
+    for (CeedInt d = 0; d < dim; d++) {
+      num_nodes_1d[d] = num_elem_1d[d] * (p - 1) + 1;
+      num_elem *= num_elem_1d[d];
+      elem_size *= p;
+      num_qpts *= q;
+      num_nodes *= num_nodes_1d[d];
+    }
+
+    // Explicit offsets for the same Cartesian mesh
+    {
+      CeedInt ind_u[num_elem * elem_size];
+
+      for (CeedInt e = 0; e < num_elem; e++) {
+        const CeedInt e_xyz[3] = {e % num_elem_1d[0], (e / num_elem_1d[0]) % num_elem_1d[1], e / (num_elem_1d[0] * num_elem_1d[1])};
+
+        for (CeedInt n = 0; n < elem_size; n++) {
+          const CeedInt n_xyz[3] = {n % p, (n / p) % p, n / (p * p)};
+          CeedInt       node     = 0;
+
+          for (CeedInt d = dim - 1; d >= 0; d--) node = node * num_nodes_1d[d] + e_xyz[d] * (p - 1) + n_xyz[d];
+          ind_u[e * elem_size + n] = node;
+        }
+      }
+      CeedElemRestrictionCreate(ceed, num_elem, elem_size, num_comp, num_nodes, num_comp * num_nodes, CEED_MEM_HOST, CEED_COPY_VALUES, ind_u,
+                                &elem_restriction_u);
+    }
+    CeedElemRestrictionCreateStructured(ceed, dim, num_elem_1d, p, num_comp, num_nodes, num_comp * num_nodes, &elem_restriction_u_structured);
+    CeedElemRestrictionCreateStrided(ceed, num_elem, num_qpts, 1, num_elem * num_qpts, CEED_STRIDES_BACKEND, &elem_restriction_q_data);
+
+    CeedBasisCreateTensorH1Lagrange(ceed, dim, num_comp, p, q, CEED_GAUSS, &basis_u);
+
+    CeedVectorCreate(ceed, num_elem * num_qpts, &q_data);
+    {
+      CeedScalar *q_data_array;
+
+      CeedVectorGetArrayWrite(q_data, CEED_MEM_HOST, &q_data_array);
+      for (CeedInt i = 0; i < num_elem * num_qpts; i++) q_data_array[i] = 1.0 + 0.5 * sin(i);
+      CeedVectorRestoreArray(q_data, &q_data_array);
+    }
+    CeedVectorCreate(ceed, num_comp * num_nodes, &u);
+    {
+      CeedScalar *u_array;
+
+      CeedVectorGetArrayWrite(u, CEED_MEM_HOST, &u_array);
+      for (CeedInt i = 0; i < num_comp * num_nodes; i++) u_array[i] = cos(i);
+      CeedVectorRestoreArray(u, &u_array);
+    }
+    CeedVectorCreate(ceed, num_comp * num_nodes, &v);
+    CeedVectorCreate(ceed, num_comp * num_nodes, &v_structured);
+
+    CeedQFunctionCreateInteriorByName(ceed, "Vector3MassApply", &qf_mass);
+
+    CeedOperatorCreate(ceed, qf_mass, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, &op_mass);
+    CeedOperatorSetField(op_mass, "u", elem_restriction_u, basis_u, CEED_VECTOR_ACTIVE);
+    CeedOperatorSetField(op_mass, "qdata", elem_restriction_q_data, CEED_BASIS_NONE, q_data);
+    CeedOperatorSetField(op_mass, "v", elem_restriction_u, basis_u, CEED_VECTOR_ACTIVE);
+
+    CeedOperatorCreate(ceed, qf_mass, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, &op_mass_structured);
+    CeedOperatorSetField(op_mass_structured, "u", elem_restriction_u_structured, basis_u, CEED_VECTOR_ACTIVE);
+    CeedOperatorSetField(op_mass_structured, "qdata", elem_restriction_q_data, CEED_BASIS_NONE, q_data);
+    CeedOperatorSetField(op_mass_structured, "v", elem_restriction_u_structured, basis_u, CEED_VECTOR_ACTIVE);
+
+    // Structured and explicit offsets give the same result
+    CeedOperatorApply(op_mass, u, v, CEED_REQUEST_IMMEDIATE);
+    CeedOperatorApply(op_mass_structured, u, v_structured, CEED_REQUEST_IMMEDIATE);
+    {
+      const CeedScalar *v_array, *v_structured_array;
+
+      CeedVectorGetArrayRead(v, CEED_MEM_HOST, &v_array);
+      CeedVectorGetArrayRead(v_structured, CEED_MEM_HOST, &v_structured_array);
+      for (CeedInt i = 0; i < num_comp * num_nodes; i++) {
+        if (fabs(v_array[i] - v_structured_array[i]) > 100. * CEED_EPSILON * fmax(1.0, fabs(v_array[i]))) {
+          // LCOV_EXCL_START
+          printf("dim %" CeedInt_FMT ": v[%" CeedInt_FMT "] with structured restriction %f != %f\n", dim, i, v_structured_array[i], v_array[i]);
+          // LCOV_EXCL_STOP
+        }
+      }
+      CeedVectorRestoreArrayRead(v, &v_array);
+      CeedVectorRestoreArrayRead(v_structured, &v_structured_array);
+    }
+
+    CeedVectorDestroy(&q_data);
+    CeedVectorDestroy(&u);
+    CeedVectorDestroy(&v);
+    CeedVectorDestroy(&v_structured);
+    CeedElemRestrictionDestroy(&elem_restriction_u);
+    CeedElemRestrictionDestroy(&elem_restriction_u_structured);
+    CeedElemRestrictionDestroy(&elem_restriction_q_data);
+    CeedBasisDestroy(&basis_u);
+    CeedQFunctionDestroy(&qf_mass);
+    CeedOperatorDestroy(&op_mass);
+    CeedOperatorDestroy(&op_mass_structured);
+  }
+  CeedDestroy(&ceed);
+  return 0;
+}
@@ -0,0 +1,137 @@
+/// @file
+/// Test concurrent application of composite mass matrix operator
+/// \test Test concurrent application of composite mass matrix operator
+#include <ceed.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#define NUM_SUB 4
+
+int main(int argc, char **argv) {
+  Ceed                ceed;
+  CeedElemRestriction elem_restriction_x[NUM_SUB], elem_restriction_u[NUM_SUB], elem_restriction_q_data[NUM_SUB];
+  CeedBasis           basis_x, basis_u;
+  CeedQFunction       qf_setup, qf_mass[NUM_SUB];
+  CeedOperator        op_setup, op_mass[NUM_SUB], op_composite;
+  CeedVector          q_data[NUM_SUB], x, u, v, v_sequential;
+  CeedInt             num_elem_sub = 5, num_elem = NUM_SUB * num_elem_sub, p = 5, q = 8;
+  CeedInt             num_dofs_x = num_elem + 1, num_dofs_u = num_elem * (p - 1) + 1;
+  CeedInt             ind_x[NUM_SUB][num_elem_sub * 2], ind_u[NUM_SUB][num_elem_sub * p];
+
+  CeedInit(argv[1], &ceed);
+
+  CeedVectorCreate(ceed, num_dofs_x, &x);
+  {
+    CeedScalar x_array[num_dofs_x];
+
+    for (CeedInt i = 0; i < num_dofs_x; i++) x_array[i] = (CeedScalar)i / (num_dofs_x - 1);
+    CeedVectorSetArray(x, CEED_MEM_HOST, CEED_COPY_VALUES, x_array);
+  }
+  CeedVectorCreate(ceed, num_dofs_u, &u);
+  CeedVectorCreate(ceed, num_dofs_u, &v);
+  CeedVectorCreate(ceed, num_dofs_u, &v_sequential);
+
+  // Bases and QFunctions
+  CeedBasisCreateTensorH1Lagrange(ceed, 1, 1, 2, q, CEED_GAUSS, &basis_x);
+  CeedBasisCreateTensorH1Lagrange(ceed, 1, 1, p, q, CEED_GAUSS, &basis_u);
+  CeedQFunctionCreateInteriorByName(ceed, "Mass1DBuild", &qf_setup);
+
+  // One sub-operator per contiguous block of elements, neighboring blocks share a node
+  CeedCompositeOperatorCreate(ceed, &op_composite);
+  for (CeedInt s = 0; s < NUM_SUB; s++) {
+    CeedInt strides_q_data[3] = {1, q, q};
+
+    for (CeedInt e = 0; e < num_elem_sub; e++) {
+      CeedInt elem = s * num_elem_sub + e;
+
+      ind_x[s][2 * e + 0] = elem;
+      ind_x[s][2 * e + 1] = elem + 1;
+      for (CeedInt j = 0; j < p; j++) ind_u[s][p * e + j] = elem * (p - 1) + j;
+    }
+    CeedElemRestrictionCreate(ceed, num_elem_sub, 2, 1, 1, num_dofs_x, CEED_MEM_HOST, CEED_USE_POINTER, ind_x[s], &elem_restriction_x[s]);
+    CeedElemRestrictionCreate(ceed, num_elem_sub, p, 1, 1, num_dofs_u, CEED_MEM_HOST, CEED_USE_POINTER, ind_u[s], &elem_restriction_u[s]);
+    CeedElemRestrictionCreateStrided(ceed, num_elem_sub, q, 1, q * num_elem_sub, strides_q_data, &elem_restriction_q_data[s]);
+    CeedVectorCreate(ceed, q * num_elem_sub, &q_data[s]);
+
+    // Last sub-operator shares its QFunction with the first, so they may not run concurrently
+    if (s < NUM_SUB - 1) {
+      CeedQFunctionCreateInteriorByName(ceed, "MassApply", &qf_mass[s]);
+    } else {
+      qf_mass[s] = NULL;
+      CeedQFunctionReferenceCopy(qf_mass[0], &qf_mass[s]);
+    }
+
+    CeedOperatorCreate(ceed, qf_setup, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, &op_setup);
+    CeedOperatorSetField(op_setup, "weights", CEED_ELEMRESTRICTION_NONE, basis_x, CEED_VECTOR_NONE);
+    CeedOperatorSetField(op_setup, "dx", elem_restriction_x[s], basis_x, CEED_VECTOR_ACTIVE);
+    CeedOperatorSetField(op_setup, "qdata", elem_restriction_q_data[s], CEED_BASIS_NONE, CEED_VECTOR_ACTIVE);
+    CeedOperatorApply(op_setup, x, q_data[s], CEED_REQUEST_IMMEDIATE);
+    CeedOperatorDestroy(&op_setup);
+
+    CeedOperatorCreate(ceed, qf_mass[s], CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, &op_mass[s]);
+    CeedOperatorSetField(op_mass[s], "u", elem_restriction_u[s], basis_u, CEED_VECTOR_ACTIVE);
+    CeedOperatorSetField(op_mass[s], "qdata", elem_restriction_q_data[s], CEED_BASIS_NONE, q_data[s]);
+    CeedOperatorSetField(op_mass[s], "v", elem_restriction_u[s], basis_u, CEED_VECTOR_ACTIVE);
+    CeedCompositeOperatorAddSub(op_composite, op_mass[s]);
+  }
+
+  // Sequential reference
+  {
+    CeedScalar *u_array;
+
+    CeedVectorGetArrayWrite(u, CEED_MEM_HOST, &u_array);
+    for (CeedInt i = 0; i < num_dofs_u; i++) u_array[i] = 1.0 + sin(i);
+    CeedVectorRestoreArray(u, &u_array);
+  }
+  CeedOperatorApply(op_composite, u, v_sequential, CEED_REQUEST_IMMEDIATE);
+
+  // Concurrent, then concurrent and deterministic
+  for (CeedInt is_deterministic = 0; is_deterministic <= 1; is_deterministic++) {
+    CeedScalar v_first[num_dofs_u];
+
+    CeedCompositeOperatorSetConcurrent(op_composite, true, is_deterministic);
+    for (CeedInt k = 0; k < 2; k++) {
+      const CeedScalar *v_array, *v_sequential_array;
+
+      CeedOperatorApply(op_composite, u, v, CEED_REQUEST_IMMEDIATE);
+      CeedVectorGetArrayRead(v, CEED_MEM_HOST, &v_array);
+      CeedVectorGetArrayRead(v_sequential, CEED_MEM_HOST, &v_sequential_array);
+      for (CeedInt i = 0; i < num_dofs_u; i++) {
+        if (fabs(v_array[i] - v_sequential_array[i]) > 100. * CEED_EPSILON) {
+          // LCOV_EXCL_START
+          printf("Deterministic %" CeedInt_FMT ": [%" CeedInt_FMT "] %f != %f\n", is_deterministic, i, v_array[i], v_sequential_array[i]);
+          // LCOV_EXCL_STOP
+        }
+        if (is_deterministic && k == 1 && v_array[i] != v_first[i]) {
+          // LCOV_EXCL_START
+          printf("[%" CeedInt_FMT "] Deterministic result changed between applications: %f != %f\n", i, v_array[i], v_first[i]);
+          // LCOV_EXCL_STOP
+        }
+        v_first[i] = v_array[i];
+      }
+      CeedVectorRestoreArrayRead(v, &v_array);
+      CeedVectorRestoreArrayRead(v_sequential, &v_sequential_array);
+    }
+  }
+
+  // Cleanup
+  CeedVectorDestroy(&x);
+  CeedVectorDestroy(&u);
+  CeedVectorDestroy(&v);
+  CeedVectorDestroy(&v_sequential);
+  for (CeedInt s = 0; s < NUM_SUB; s++) {
+    CeedVectorDestroy(&q_data[s]);
+    CeedElemRestrictionDestroy(&elem_restriction_x[s]);
+    CeedElemRestrictionDestroy(&elem_restriction_u[s]);
+    CeedElemRestrictionDestroy(&elem_restriction_q_data[s]);
+    CeedQFunctionDestroy(&qf_mass[s]);
+    CeedOperatorDestroy(&op_mass[s]);
+  }
+  CeedBasisDestroy(&basis_x);
+  CeedBasisDestroy(&basis_u);
+  CeedQFunctionDestroy(&qf_setup);
+  CeedOperatorDestroy(&op_composite);
+  CeedDestroy(&ceed);
+  return 0;
+}
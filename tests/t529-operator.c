@@ -0,0 +1,131 @@
+/// @file
+/// Test mass matrix operator with quadrature point data stored in reduced precision
+/// \test Test mass matrix operator with quadrature point data stored in reduced precision
+#include <ceed.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+int main(int argc, char **argv) {
+  Ceed                ceed;
+  CeedElemRestriction elem_restriction_x, elem_restriction_u, elem_restriction_q_data;
+  CeedBasis           basis_x, basis_u;
+  CeedQFunction       qf_setup, qf_mass;
+  CeedOperator        op_setup, op_mass, op_mass_reduced[2];
+  CeedVector          q_data, x, u, v, v_reduced;
+  CeedInt             num_elem = 15, p = 5, q = 8;
+  CeedInt             num_dofs_x = num_elem + 1, num_dofs_u = num_elem * (p - 1) + 1;
+  CeedInt             ind_x[num_elem * 2], ind_u[num_elem * p];
+
+  // Use the fused element block kernel of the /cpu/self/opt backends
+  setenv("CEED_OPT_FUSED", "1", 1);
+  CeedInit(argv[1], &ceed);
+
+  CeedVectorCreate(ceed, num_dofs_x, &x);
+  CeedVectorCreate(ceed, num_elem * q, &q_data);
+  CeedVectorCreate(ceed, num_dofs_u, &u);
+  CeedVectorCreate(ceed, num_dofs_u, &v);
+  CeedVectorCreate(ceed, num_dofs_u, &v_reduced);
+  {
+    CeedScalar *u_array;
+
+    CeedVectorGetArrayWrite(u, CEED_MEM_HOST, &u_array);
+    for (CeedInt i = 0; i < num_dofs_u; i++) u_array[i] = 1.0 + sin(i);
+    CeedVectorRestoreArray(u, &u_array);
+  }
+
+  // Restrictions
+  for (CeedInt i = 0; i < num_elem; i++) {
+    ind_x[2 * i + 0] = i;
+    ind_x[2 * i + 1] = i + 1;
+  }
+  CeedElemRestrictionCreate(ceed, num_elem, 2, 1, 1, num_dofs_x, CEED_MEM_HOST, CEED_USE_POINTER, ind_x, &elem_restriction_x);
+
+  for (CeedInt i = 0; i < num_elem; i++) {
+    for (CeedInt j = 0; j < p; j++) ind_u[p * i + j] = i * (p - 1) + j;
+  }
+  CeedElemRestrictionCreate(ceed, num_elem, p, 1, 1, num_dofs_u, CEED_MEM_HOST, CEED_USE_POINTER, ind_u, &elem_restriction_u);
+
+  CeedInt strides_q_data[3] = {1, q, q};
+  CeedElemRestrictionCreateStrided(ceed, num_elem, q, 1, q * num_elem, strides_q_data, &elem_restriction_q_data);
+
+  // Bases
+  CeedBasisCreateTensorH1Lagrange(ceed, 1, 1, 2, q, CEED_GAUSS, &basis_x);
+  CeedBasisCreateTensorH1Lagrange(ceed, 1, 1, p, q, CEED_GAUSS, &basis_u);
+
+  // QFunctions
+  CeedQFunctionCreateInteriorByName(ceed, "Mass1DBuild", &qf_setup);
+  CeedQFunctionCreateInteriorByName(ceed, "MassApply", &qf_mass);
+
+  // Operators
+  CeedOperatorCreate(ceed, qf_setup, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, &op_setup);
+  CeedOperatorSetField(op_setup, "weights", CEED_ELEMRESTRICTION_NONE, basis_x, CEED_VECTOR_NONE);
+  CeedOperatorSetField(op_setup, "dx", elem_restriction_x, basis_x, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_setup, "qdata", elem_restriction_q_data, CEED_BASIS_NONE, CEED_VECTOR_ACTIVE);
+
+  CeedOperatorCreate(ceed, qf_mass, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, &op_mass);
+  CeedOperatorSetField(op_mass, "u", elem_restriction_u, basis_u, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_mass, "qdata", elem_restriction_q_data, CEED_BASIS_NONE, q_data);
+  CeedOperatorSetField(op_mass, "v", elem_restriction_u, basis_u, CEED_VECTOR_ACTIVE);
+
+  // Single precision, then bfloat16 quadrature point data
+  for (CeedInt c = 0; c < 2; c++) {
+    CeedOperatorCreate(ceed, qf_mass, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, &op_mass_reduced[c]);
+    CeedOperatorSetField(op_mass_reduced[c], "u", elem_restriction_u, basis_u, CEED_VECTOR_ACTIVE);
+    CeedOperatorSetField(op_mass_reduced[c], "qdata", elem_restriction_q_data, CEED_BASIS_NONE, q_data);
+    CeedOperatorSetField(op_mass_reduced[c], "v", elem_restriction_u, basis_u, CEED_VECTOR_ACTIVE);
+  }
+  CeedOperatorSetFieldStorage(op_mass_reduced[0], "qdata", CEED_STORAGE_FP32);
+  CeedOperatorSetFieldStorage(op_mass_reduced[1], "qdata", CEED_STORAGE_BF16);
+
+  // Apply with two meshes, so the reduced precision quadrature point data must be updated
+  for (CeedInt k = 1; k <= 2; k++) {
+    {
+      CeedScalar x_array[num_dofs_x];
+
+      for (CeedInt i = 0; i < num_dofs_x; i++) x_array[i] = k * (CeedScalar)i / (num_dofs_x - 1);
+      CeedVectorSetArray(x, CEED_MEM_HOST, CEED_COPY_VALUES, x_array);
+    }
+    CeedOperatorApply(op_setup, x, q_data, CEED_REQUEST_IMMEDIATE);
+    CeedOperatorApply(op_mass, u, v, CEED_REQUEST_IMMEDIATE);
+
+    // Check output, with tolerance for the precision of the stored quadrature point data
+    for (CeedInt c = 0; c < 2; c++) {
+      const CeedScalar  tol = c == 0 ? 1e-6 : 1e-2;
+      const CeedScalar *v_array, *v_reduced_array;
+
+      CeedOperatorApply(op_mass_reduced[c], u, v_reduced, CEED_REQUEST_IMMEDIATE);
+      CeedVectorGetArrayRead(v, CEED_MEM_HOST, &v_array);
+      CeedVectorGetArrayRead(v_reduced, CEED_MEM_HOST, &v_reduced_array);
+      for (CeedInt i = 0; i < num_dofs_u; i++) {
+        if (fabs(v_array[i] - v_reduced_array[i]) > tol * fabs(v_array[i]) + 100. * CEED_EPSILON) {
+          // LCOV_EXCL_START
+          printf("Mesh %" CeedInt_FMT ", operator %" CeedInt_FMT ": [%" CeedInt_FMT "] %f != %f\n", k, c, i, v_reduced_array[i], v_array[i]);
+          // LCOV_EXCL_STOP
+        }
+      }
+      CeedVectorRestoreArrayRead(v, &v_array);
+      CeedVectorRestoreArrayRead(v_reduced, &v_reduced_array);
+    }
+  }
+
+  // Cleanup
+  CeedVectorDestroy(&x);
+  CeedVectorDestroy(&q_data);
+  CeedVectorDestroy(&u);
+  CeedVectorDestroy(&v);
+  CeedVectorDestroy(&v_reduced);
+  CeedElemRestrictionDestroy(&elem_restriction_u);
+  CeedElemRestrictionDestroy(&elem_restriction_x);
+  CeedElemRestrictionDestroy(&elem_restriction_q_data);
+  CeedBasisDestroy(&basis_u);
+  CeedBasisDestroy(&basis_x);
+  CeedQFunctionDestroy(&qf_setup);
+  CeedQFunctionDestroy(&qf_mass);
+  CeedOperatorDestroy(&op_setup);
+  CeedOperatorDestroy(&op_mass);
+  CeedOperatorDestroy(&op_mass_reduced[0]);
+  CeedOperatorDestroy(&op_mass_reduced[1]);
+  CeedDestroy(&ceed);
+  return 0;
+}
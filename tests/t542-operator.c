@@ -0,0 +1,136 @@
+/// @file
+/// Test assembly of vector mass matrix operator diagonal and point block diagonal over many elements
+/// \test Test assembly of vector mass matrix operator diagonal and point block diagonal over many elements
+#include <ceed.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+int main(int argc, char **argv) {
+  Ceed                ceed;
+  CeedElemRestriction elem_restriction_x, elem_restriction_u, elem_restriction_q_data;
+  CeedBasis           basis_x, basis_u;
+  CeedQFunction       qf_setup, qf_mass;
+  CeedOperator        op_setup, op_mass;
+  CeedVector          q_data, x, assembled[2][2];
+  CeedInt             num_elem = 150, p = 4, q = 5, num_comp = 3;
+  CeedInt             num_dofs_x = num_elem + 1, num_dofs_u = num_elem * (p - 1) + 1;
+  CeedInt             ind_x[num_elem * 2], ind_u[num_elem * p];
+
+  CeedInit(argv[1], &ceed);
+
+  CeedVectorCreate(ceed, num_dofs_x, &x);
+  {
+    CeedScalar x_array[num_dofs_x];
+
+    for (CeedInt i = 0; i < num_dofs_x; i++) x_array[i] = (CeedScalar)i / (num_dofs_x - 1) + 0.1 * sin(i) / num_elem;
+    CeedVectorSetArray(x, CEED_MEM_HOST, CEED_COPY_VALUES, x_array);
+  }
+  CeedVectorCreate(ceed, num_elem * q, &q_data);
+
+  // Restrictions
+  for (CeedInt i = 0; i < num_elem; i++) {
+    ind_x[2 * i + 0] = i;
+    ind_x[2 * i + 1] = i + 1;
+  }
+  CeedElemRestrictionCreate(ceed, num_elem, 2, 1, 1, num_dofs_x, CEED_MEM_HOST, CEED_USE_POINTER, ind_x, &elem_restriction_x);
+
+  for (CeedInt i = 0; i < num_elem; i++) {
+    for (CeedInt j = 0; j < p; j++) ind_u[p * i + j] = i * (p - 1) + j;
+  }
+  CeedElemRestrictionCreate(ceed, num_elem, p, num_comp, num_dofs_u, num_comp * num_dofs_u, CEED_MEM_HOST, CEED_USE_POINTER, ind_u,
+                            &elem_restriction_u);
+
+  CeedInt strides_q_data[3] = {1, q, q};
+  CeedElemRestrictionCreateStrided(ceed, num_elem, q, 1, q * num_elem, strides_q_data, &elem_restriction_q_data);
+
+  // Bases
+  CeedBasisCreateTensorH1Lagrange(ceed, 1, 1, 2, q, CEED_GAUSS, &basis_x);
+  CeedBasisCreateTensorH1Lagrange(ceed, 1, num_comp, p, q, CEED_GAUSS, &basis_u);
+
+  // QFunctions
+  CeedQFunctionCreateInteriorByName(ceed, "Mass1DBuild", &qf_setup);
+  CeedQFunctionCreateInteriorByName(ceed, "Vector3MassApply", &qf_mass);
+
+  // Operators
+  CeedOperatorCreate(ceed, qf_setup, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, &op_setup);
+  CeedOperatorSetField(op_setup, "weights", CEED_ELEMRESTRICTION_NONE, basis_x, CEED_VECTOR_NONE);
+  CeedOperatorSetField(op_setup, "dx", elem_restriction_x, basis_x, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_setup, "qdata", elem_restriction_q_data, CEED_BASIS_NONE, CEED_VECTOR_ACTIVE);
+
+  CeedOperatorCreate(ceed, qf_mass, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, &op_mass);
+  CeedOperatorSetField(op_mass, "u", elem_restriction_u, basis_u, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_mass, "qdata", elem_restriction_q_data, CEED_BASIS_NONE, q_data);
+  CeedOperatorSetField(op_mass, "v", elem_restriction_u, basis_u, CEED_VECTOR_ACTIVE);
+
+  CeedOperatorApply(op_setup, x, q_data, CEED_REQUEST_IMMEDIATE);
+
+  // Assemble diagonal and point block diagonal, then again while reusing the assembled QFunction
+  for (CeedInt reuse = 0; reuse <= 1; reuse++) {
+    CeedOperatorSetQFunctionAssemblyReuse(op_mass, reuse);
+    CeedVectorCreate(ceed, num_comp * num_dofs_u, &assembled[reuse][0]);
+    CeedOperatorLinearAssembleDiagonal(op_mass, assembled[reuse][0], CEED_REQUEST_IMMEDIATE);
+    CeedVectorCreate(ceed, num_comp * num_comp * num_dofs_u, &assembled[reuse][1]);
+    CeedOperatorLinearAssemblePointBlockDiagonal(op_mass, assembled[reuse][1], CEED_REQUEST_IMMEDIATE);
+  }
+
+  // Check output
+  for (CeedInt k = 0; k < 2; k++) {
+    CeedSize          length;
+    const CeedScalar *assembled_array, *assembled_reuse_array;
+
+    CeedVectorGetLength(assembled[0][k], &length);
+    CeedVectorGetArrayRead(assembled[0][k], CEED_MEM_HOST, &assembled_array);
+    CeedVectorGetArrayRead(assembled[1][k], CEED_MEM_HOST, &assembled_reuse_array);
+    for (CeedSize i = 0; i < length; i++) {
+      if (fabs(assembled_array[i] - assembled_reuse_array[i]) > 100. * CEED_EPSILON) {
+        // LCOV_EXCL_START
+        printf("Point block %" CeedInt_FMT ": [%" CeedSize_FMT "] %f != %f\n", k, i, assembled_array[i], assembled_reuse_array[i]);
+        // LCOV_EXCL_STOP
+      }
+    }
+    // Point block diagonal of a vector mass matrix has no coupling between components
+    if (k == 1) {
+      const CeedScalar *diagonal_array;
+
+      CeedVectorGetArrayRead(assembled[0][0], CEED_MEM_HOST, &diagonal_array);
+      for (CeedInt i = 0; i < num_dofs_u; i++) {
+        for (CeedInt c_out = 0; c_out < num_comp; c_out++) {
+          for (CeedInt c_in = 0; c_in < num_comp; c_in++) {
+            const CeedScalar value    = assembled_array[(i * num_comp + c_out) * num_comp + c_in];
+            const CeedScalar expected = c_in == c_out ? diagonal_array[c_out * num_dofs_u + i] : 0.0;
+
+            if (fabs(value - expected) > 100. * CEED_EPSILON) {
+              // LCOV_EXCL_START
+              printf("[%" CeedInt_FMT ", %" CeedInt_FMT ", %" CeedInt_FMT "] Error in point block diagonal: %f != %f\n", i, c_out, c_in, value,
+                     expected);
+              // LCOV_EXCL_STOP
+            }
+          }
+        }
+      }
+      CeedVectorRestoreArrayRead(assembled[0][0], &diagonal_array);
+    }
+    CeedVectorRestoreArrayRead(assembled[0][k], &assembled_array);
+    CeedVectorRestoreArrayRead(assembled[1][k], &assembled_reuse_array);
+  }
+
+  // Cleanup
+  CeedVectorDestroy(&x);
+  CeedVectorDestroy(&q_data);
+  for (CeedInt reuse = 0; reuse <= 1; reuse++) {
+    CeedVectorDestroy(&assembled[reuse][0]);
+    CeedVectorDestroy(&assembled[reuse][1]);
+  }
+  CeedElemRestrictionDestroy(&elem_restriction_u);
+  CeedElemRestrictionDestroy(&elem_restriction_x);
+  CeedElemRestrictionDestroy(&elem_restriction_q_data);
+  CeedBasisDestroy(&basis_u);
+  CeedBasisDestroy(&basis_x);
+  CeedQFunctionDestroy(&qf_setup);
+  CeedQFunctionDestroy(&qf_mass);
+  CeedOperatorDestroy(&op_setup);
+  CeedOperatorDestroy(&op_mass);
+  CeedDestroy(&ceed);
+  return 0;
+}
@@ -0,0 +1,167 @@
+/// @file
+/// Test compressed sparse row and block compressed sparse row assembly of vector mass matrix operator
+/// \test Test compressed sparse row and block compressed sparse row assembly of vector mass matrix operator
+#include <ceed.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+int main(int argc, char **argv) {
+  Ceed                ceed;
+  CeedElemRestriction elem_restriction_x, elem_restriction_q_data, elem_restriction_u;
+  CeedBasis           basis_x, basis_u;
+  CeedQFunction       qf_setup, qf_mass;
+  CeedOperator        op_setup, op_mass;
+  CeedVector          q_data, x, assembled;
+  CeedInt             num_elem = 6, p = 3, q = 4, num_comp = 3;
+  CeedInt             num_dofs_x = num_elem + 1, num_dofs_u = num_elem * (p - 1) + 1, num_rows = num_comp * num_dofs_u;
+  CeedInt             ind_x[num_elem * 2], ind_u[num_elem * p];
+  CeedSize            num_entries;
+  CeedInt            *rows, *cols;
+  CeedScalar          assembled_true[num_rows * num_rows];
+
+  CeedInit(argv[1], &ceed);
+
+  CeedVectorCreate(ceed, num_dofs_x, &x);
+  {
+    CeedScalar x_array[num_dofs_x];
+
+    for (CeedInt i = 0; i < num_dofs_x; i++) x_array[i] = (CeedScalar)i / (num_dofs_x - 1);
+    CeedVectorSetArray(x, CEED_MEM_HOST, CEED_COPY_VALUES, x_array);
+  }
+  CeedVectorCreate(ceed, num_elem * q, &q_data);
+
+  // Restrictions
+  for (CeedInt i = 0; i < num_elem; i++) {
+    ind_x[2 * i + 0] = i;
+    ind_x[2 * i + 1] = i + 1;
+  }
+  CeedElemRestrictionCreate(ceed, num_elem, 2, 1, 1, num_dofs_x, CEED_MEM_HOST, CEED_USE_POINTER, ind_x, &elem_restriction_x);
+
+  // Interlaced components, so each node is one 3x3 block
+  for (CeedInt i = 0; i < num_elem; i++) {
+    for (CeedInt j = 0; j < p; j++) ind_u[p * i + j] = num_comp * (i * (p - 1) + j);
+  }
+  CeedElemRestrictionCreate(ceed, num_elem, p, num_comp, 1, num_rows, CEED_MEM_HOST, CEED_USE_POINTER, ind_u, &elem_restriction_u);
+
+  CeedInt strides_q_data[3] = {1, q, q};
+  CeedElemRestrictionCreateStrided(ceed, num_elem, q, 1, q * num_elem, strides_q_data, &elem_restriction_q_data);
+
+  // Bases
+  CeedBasisCreateTensorH1Lagrange(ceed, 1, 1, 2, q, CEED_GAUSS, &basis_x);
+  CeedBasisCreateTensorH1Lagrange(ceed, 1, num_comp, p, q, CEED_GAUSS, &basis_u);
+
+  // QFunctions
+  CeedQFunctionCreateInteriorByName(ceed, "Mass1DBuild", &qf_setup);
+  CeedQFunctionCreateInteriorByName(ceed, "Vector3MassApply", &qf_mass);
+
+  // Operators
+  CeedOperatorCreate(ceed, qf_setup, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, &op_setup);
+  CeedOperatorSetField(op_setup, "weights", CEED_ELEMRESTRICTION_NONE, basis_x, CEED_VECTOR_NONE);
+  CeedOperatorSetField(op_setup, "dx", elem_restriction_x, basis_x, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_setup, "qdata", elem_restriction_q_data, CEED_BASIS_NONE, CEED_VECTOR_ACTIVE);
+
+  CeedOperatorCreate(ceed, qf_mass, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, &op_mass);
+  CeedOperatorSetField(op_mass, "u", elem_restriction_u, basis_u, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_mass, "qdata", elem_restriction_q_data, CEED_BASIS_NONE, q_data);
+  CeedOperatorSetField(op_mass, "v", elem_restriction_u, basis_u, CEED_VECTOR_ACTIVE);
+
+  // Apply Setup Operator
+  CeedOperatorApply(op_setup, x, q_data, CEED_REQUEST_IMMEDIATE);
+
+  // Reference assembly in coordinate format
+  for (CeedInt k = 0; k < num_rows * num_rows; k++) assembled_true[k] = 0.0;
+  CeedOperatorLinearAssembleSymbolic(op_mass, &num_entries, &rows, &cols);
+  CeedVectorCreate(ceed, num_entries, &assembled);
+  CeedOperatorLinearAssemble(op_mass, assembled);
+  {
+    const CeedScalar *assembled_array;
+
+    CeedVectorGetArrayRead(assembled, CEED_MEM_HOST, &assembled_array);
+    for (CeedInt k = 0; k < num_entries; k++) assembled_true[rows[k] * num_rows + cols[k]] += assembled_array[k];
+    CeedVectorRestoreArrayRead(assembled, &assembled_array);
+  }
+  CeedVectorDestroy(&assembled);
+  free(rows);
+  free(cols);
+
+  // Compressed sparse row and block compressed sparse row assembly
+  for (CeedInt block_size = 1; block_size <= num_comp; block_size += num_comp - 1) {
+    CeedSize  num_block_rows, *row_offsets, num_values;
+    CeedInt  *block_cols;
+    CeedScalar assembled_values[num_rows * num_rows];
+
+    CeedOperatorLinearAssembleSymbolicCSR(op_mass, block_size, &num_block_rows, &row_offsets, &block_cols);
+    if (num_block_rows * block_size != num_rows) {
+      // LCOV_EXCL_START
+      printf("Block size %" CeedInt_FMT ": incorrect number of block rows %" CeedSize_FMT "\n", block_size, num_block_rows);
+      // LCOV_EXCL_STOP
+    }
+    num_values = row_offsets[num_block_rows] * block_size * block_size;
+    if (num_values >= num_entries) {
+      // LCOV_EXCL_START
+      printf("Block size %" CeedInt_FMT ": %" CeedSize_FMT " values not fewer than %" CeedSize_FMT " coordinate entries\n", block_size, num_values,
+             num_entries);
+      // LCOV_EXCL_STOP
+    }
+    for (CeedSize i = 0; i < num_block_rows; i++) {
+      for (CeedSize k = row_offsets[i] + 1; k < row_offsets[i + 1]; k++) {
+        // LCOV_EXCL_START
+        if (block_cols[k] <= block_cols[k - 1]) printf("Block size %" CeedInt_FMT ": block row %" CeedSize_FMT " not sorted\n", block_size, i);
+        // LCOV_EXCL_STOP
+      }
+    }
+
+    // Assemble twice to check values are not accumulated across calls
+    CeedVectorCreate(ceed, num_values, &assembled);
+    CeedOperatorLinearAssembleCSR(op_mass, assembled);
+    CeedOperatorLinearAssembleCSR(op_mass, assembled);
+    for (CeedInt k = 0; k < num_rows * num_rows; k++) assembled_values[k] = 0.0;
+    {
+      const CeedScalar *assembled_array;
+
+      CeedVectorGetArrayRead(assembled, CEED_MEM_HOST, &assembled_array);
+      for (CeedSize i = 0; i < num_block_rows; i++) {
+        for (CeedSize k = row_offsets[i]; k < row_offsets[i + 1]; k++) {
+          for (CeedInt b_i = 0; b_i < block_size; b_i++) {
+            for (CeedInt b_j = 0; b_j < block_size; b_j++) {
+              assembled_values[(i * block_size + b_i) * num_rows + block_cols[k] * block_size + b_j] =
+                  assembled_array[(k * block_size + b_i) * block_size + b_j];
+            }
+          }
+        }
+      }
+      CeedVectorRestoreArrayRead(assembled, &assembled_array);
+    }
+
+    // Check output
+    for (CeedInt i = 0; i < num_rows; i++) {
+      for (CeedInt j = 0; j < num_rows; j++) {
+        if (fabs(assembled_values[i * num_rows + j] - assembled_true[i * num_rows + j]) > 100. * CEED_EPSILON) {
+          // LCOV_EXCL_START
+          printf("Block size %" CeedInt_FMT ": [%" CeedInt_FMT ", %" CeedInt_FMT "] Error in assembly: %f != %f\n", block_size, i, j,
+                 assembled_values[i * num_rows + j], assembled_true[i * num_rows + j]);
+          // LCOV_EXCL_STOP
+        }
+      }
+    }
+    CeedVectorDestroy(&assembled);
+    free(row_offsets);
+    free(block_cols);
+  }
+
+  // Cleanup
+  CeedVectorDestroy(&x);
+  CeedVectorDestroy(&q_data);
+  CeedElemRestrictionDestroy(&elem_restriction_u);
+  CeedElemRestrictionDestroy(&elem_restriction_x);
+  CeedElemRestrictionDestroy(&elem_restriction_q_data);
+  CeedBasisDestroy(&basis_u);
+  CeedBasisDestroy(&basis_x);
+  CeedQFunctionDestroy(&qf_setup);
+  CeedQFunctionDestroy(&qf_mass);
+  CeedOperatorDestroy(&op_setup);
+  CeedOperatorDestroy(&op_mass);
+  CeedDestroy(&ceed);
+  return 0;
+}
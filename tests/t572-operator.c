@@ -0,0 +1,123 @@
+/// @file
+/// Test full assembly of vector mass matrix operator with a partial batch of elements
+/// \test Test full assembly of vector mass matrix operator with a partial batch of elements
+#include <ceed.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+int main(int argc, char **argv) {
+  Ceed                ceed;
+  CeedElemRestriction elem_restriction_u, elem_restriction_q_data;
+  CeedBasis           basis_u;
+  CeedQFunction       qf_mass;
+  CeedOperator        op_mass;
+  CeedVector          q_data, u, v, assembled;
+  // Element matrices are assembled in batches of 8 elements, so 13 elements give one full and one partial batch
+  const CeedInt       dim = 2, num_comp = 3, p = 3, q = 4, num_elem_1d[2] = {13, 1};
+  const CeedInt       num_elem = num_elem_1d[0] * num_elem_1d[1], elem_size = p * p, num_qpts = q * q;
+  const CeedInt       num_nodes_1d[2] = {num_elem_1d[0] * (p - 1) + 1, num_elem_1d[1] * (p - 1) + 1};
+  const CeedInt       num_nodes = num_nodes_1d[0] * num_nodes_1d[1], num_rows = num_comp * num_nodes;
+  CeedInt             ind_u[num_elem * elem_size];
+  CeedSize            num_entries;
+  CeedInt            *rows, *cols;
+  CeedScalar         *assembled_values = calloc(num_rows * num_rows, sizeof(CeedScalar));
+  CeedScalar         *assembled_true   = calloc(num_rows * num_rows, sizeof(CeedScalar));
+
+  CeedInit(argv[1], &ceed);
+
+  // Restrictions
+  for (CeedInt e = 0; e < num_elem; e++) {
+    const CeedInt e_x = e % num_elem_1d[0], e_y = e / num_elem_1d[0];
+
+    for (CeedInt n = 0; n < elem_size; n++) {
+      ind_u[e * elem_size + n] = (e_y * (p - 1) + n / p) * num_nodes_1d[0] + e_x * (p - 1) + n % p;
+    }
+  }
+  CeedElemRestrictionCreate(ceed, num_elem, elem_size, num_comp, num_nodes, num_rows, CEED_MEM_HOST, CEED_USE_POINTER, ind_u, &elem_restriction_u);
+  CeedElemRestrictionCreateStrided(ceed, num_elem, num_qpts, 1, num_elem * num_qpts, CEED_STRIDES_BACKEND, &elem_restriction_q_data);
+
+  // Bases
+  CeedBasisCreateTensorH1Lagrange(ceed, dim, num_comp, p, q, CEED_GAUSS, &basis_u);
+
+  // Quadrature data, varying over elements
+  CeedVectorCreate(ceed, num_elem * num_qpts, &q_data);
+  {
+    CeedScalar *q_data_array;
+
+    CeedVectorGetArrayWrite(q_data, CEED_MEM_HOST, &q_data_array);
+    for (CeedInt i = 0; i < num_elem * num_qpts; i++) q_data_array[i] = 1.0 + 0.5 * sin(i);
+    CeedVectorRestoreArray(q_data, &q_data_array);
+  }
+  CeedVectorCreate(ceed, num_rows, &u);
+  CeedVectorCreate(ceed, num_rows, &v);
+
+  // QFunction and operator
+  CeedQFunctionCreateInteriorByName(ceed, "Vector3MassApply", &qf_mass);
+
+  CeedOperatorCreate(ceed, qf_mass, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, &op_mass);
+  CeedOperatorSetField(op_mass, "u", elem_restriction_u, basis_u, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_mass, "qdata", elem_restriction_q_data, CEED_BASIS_NONE, q_data);
+  CeedOperatorSetField(op_mass, "v", elem_restriction_u, basis_u, CEED_VECTOR_ACTIVE);
+
+  // Fully assemble operator
+  CeedOperatorLinearAssembleSymbolic(op_mass, &num_entries, &rows, &cols);
+  CeedVectorCreate(ceed, num_entries, &assembled);
+  CeedOperatorLinearAssemble(op_mass, assembled);
+  {
+    const CeedScalar *assembled_array;
+
+    CeedVectorGetArrayRead(assembled, CEED_MEM_HOST, &assembled_array);
+    for (CeedSize k = 0; k < num_entries; k++) assembled_values[rows[k] * num_rows + cols[k]] += assembled_array[k];
+    CeedVectorRestoreArrayRead(assembled, &assembled_array);
+  }
+
+  // Manually assemble operator
+  CeedVectorSetValue(u, 0.0);
+  for (CeedInt j = 0; j < num_rows; j++) {
+    CeedScalar       *u_array;
+    const CeedScalar *v_array;
+
+    // Set input
+    CeedVectorGetArray(u, CEED_MEM_HOST, &u_array);
+    u_array[j] = 1.0;
+    if (j) u_array[j - 1] = 0.0;
+    CeedVectorRestoreArray(u, &u_array);
+
+    // Compute entries for column j
+    CeedOperatorApply(op_mass, u, v, CEED_REQUEST_IMMEDIATE);
+
+    CeedVectorGetArrayRead(v, CEED_MEM_HOST, &v_array);
+    for (CeedInt i = 0; i < num_rows; i++) assembled_true[i * num_rows + j] = v_array[i];
+    CeedVectorRestoreArrayRead(v, &v_array);
+  }
+
+  // Check output
+  for (CeedInt i = 0; i < num_rows; i++) {
+    for (CeedInt j = 0; j < num_rows; j++) {
+      if (fabs(assembled_values[i * num_rows + j] - assembled_true[i * num_rows + j]) > 100. * CEED_EPSILON) {
+        // LCOV_EXCL_START
+        printf("[%" CeedInt_FMT ", %" CeedInt_FMT "] Error in assembly: %f != %f\n", i, j, assembled_values[i * num_rows + j],
+               assembled_true[i * num_rows + j]);
+        // LCOV_EXCL_STOP
+      }
+    }
+  }
+
+  // Cleanup
+  free(rows);
+  free(cols);
+  free(assembled_values);
+  free(assembled_true);
+  CeedVectorDestroy(&q_data);
+  CeedVectorDestroy(&u);
+  CeedVectorDestroy(&v);
+  CeedVectorDestroy(&assembled);
+  CeedElemRestrictionDestroy(&elem_restriction_u);
+  CeedElemRestrictionDestroy(&elem_restriction_q_data);
+  CeedBasisDestroy(&basis_u);
+  CeedQFunctionDestroy(&qf_mass);
+  CeedOperatorDestroy(&op_mass);
+  CeedDestroy(&ceed);
+  return 0;
+}
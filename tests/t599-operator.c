@@ -0,0 +1,175 @@
+/// @file
+/// Test asynchronous mass matrix operator application with CeedRequest
+/// \test Test asynchronous mass matrix operator application with CeedRequest
+#include "t500-operator.h"
+
+#include <ceed.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+int main(int argc, char **argv) {
+  Ceed                ceed;
+  CeedElemRestriction elem_restriction_x, elem_restriction_u, elem_restriction_q_data;
+  CeedBasis           basis_x, basis_u;
+  CeedQFunction       qf_setup, qf_mass;
+  CeedOperator        op_setup, op_mass;
+  CeedRequest         request = NULL;
+  CeedVector          q_data, x, u, v, v_async, diag, diag_async;
+  CeedInt             num_elem = 15, p = 5, q = 8;
+  CeedInt             num_nodes_x = num_elem + 1, num_nodes_u = num_elem * (p - 1) + 1;
+  CeedInt             ind_x[num_elem * 2], ind_u[num_elem * p];
+  CeedScalar          x_array[num_nodes_x];
+
+  CeedInit(argv[1], &ceed);
+
+  for (CeedInt i = 0; i < num_nodes_x; i++) x_array[i] = (CeedScalar)i / (num_nodes_x - 1);
+  for (CeedInt i = 0; i < num_elem; i++) {
+    ind_x[2 * i + 0] = i;
+    ind_x[2 * i + 1] = i + 1;
+  }
+  CeedElemRestrictionCreate(ceed, num_elem, 2, 1, 1, num_nodes_x, CEED_MEM_HOST, CEED_USE_POINTER, ind_x, &elem_restriction_x);
+
+  for (CeedInt i = 0; i < num_elem; i++) {
+    for (CeedInt j = 0; j < p; j++) {
+      ind_u[p * i + j] = i * (p - 1) + j;
+    }
+  }
+  CeedElemRestrictionCreate(ceed, num_elem, p, 1, 1, num_nodes_u, CEED_MEM_HOST, CEED_USE_POINTER, ind_u, &elem_restriction_u);
+  CeedInt strides_q_data[3] = {1, q, q};
+  CeedElemRestrictionCreateStrided(ceed, num_elem, q, 1, q * num_elem, strides_q_data, &elem_restriction_q_data);
+
+  CeedBasisCreateTensorH1Lagrange(ceed, 1, 1, 2, q, CEED_GAUSS, &basis_x);
+  CeedBasisCreateTensorH1Lagrange(ceed, 1, 1, p, q, CEED_GAUSS, &basis_u);
+
+  CeedQFunctionCreateInterior(ceed, 1, setup, setup_loc, &qf_setup);
+  CeedQFunctionAddInput(qf_setup, "weight", 1, CEED_EVAL_WEIGHT);
+  CeedQFunctionAddInput(qf_setup, "dx", 1, CEED_EVAL_GRAD);
+  CeedQFunctionAddOutput(qf_setup, "rho", 1, CEED_EVAL_NONE);
+
+  CeedQFunctionCreateInterior(ceed, 1, mass, mass_loc, &qf_mass);
+  CeedQFunctionAddInput(qf_mass, "rho", 1, CEED_EVAL_NONE);
+  CeedQFunctionAddInput(qf_mass, "u", 1, CEED_EVAL_INTERP);
+  CeedQFunctionAddOutput(qf_mass, "v", 1, CEED_EVAL_INTERP);
+
+  CeedOperatorCreate(ceed, qf_setup, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, &op_setup);
+  CeedOperatorCreate(ceed, qf_mass, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, &op_mass);
+
+  CeedVectorCreate(ceed, num_nodes_x, &x);
+  CeedVectorSetArray(x, CEED_MEM_HOST, CEED_USE_POINTER, x_array);
+  CeedVectorCreate(ceed, num_elem * q, &q_data);
+
+  CeedOperatorSetField(op_setup, "weight", CEED_ELEMRESTRICTION_NONE, basis_x, CEED_VECTOR_NONE);
+  CeedOperatorSetField(op_setup, "dx", elem_restriction_x, basis_x, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_setup, "rho", elem_restriction_q_data, CEED_BASIS_NONE, CEED_VECTOR_ACTIVE);
+
+  CeedOperatorSetField(op_mass, "rho", elem_restriction_q_data, CEED_BASIS_NONE, q_data);
+  CeedOperatorSetField(op_mass, "u", elem_restriction_u, basis_u, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_mass, "v", elem_restriction_u, basis_u, CEED_VECTOR_ACTIVE);
+
+  CeedVectorCreate(ceed, num_nodes_u, &u);
+  CeedVectorSetValue(u, 1.0);
+  CeedVectorCreate(ceed, num_nodes_u, &v);
+  CeedVectorCreate(ceed, num_nodes_u, &v_async);
+  CeedVectorCreate(ceed, num_nodes_u, &diag);
+  CeedVectorCreate(ceed, num_nodes_u, &diag_async);
+  CeedVectorSetValue(diag_async, 0.0);
+
+  // Ordered setup followed by non-blocking application
+  CeedOperatorApply(op_setup, x, q_data, CEED_REQUEST_ORDERED);
+  CeedOperatorApply(op_mass, u, v_async, CEED_REQUEST_ORDERED);
+  CeedOperatorLinearAssembleAddDiagonal(op_mass, diag_async, &request);
+  CeedRequestWait(&request);
+  if (request) printf("CeedRequestWait did not zero request\n");
+
+  // Synchronous reference
+  CeedOperatorApply(op_mass, u, v, CEED_REQUEST_IMMEDIATE);
+  CeedOperatorLinearAssembleDiagonal(op_mass, diag, CEED_REQUEST_IMMEDIATE);
+
+  // Check output
+  {
+    const CeedScalar *v_array, *v_async_array, *diag_array, *diag_async_array;
+    CeedScalar        sum = 0.;
+
+    CeedVectorGetArrayRead(v, CEED_MEM_HOST, &v_array);
+    CeedVectorGetArrayRead(v_async, CEED_MEM_HOST, &v_async_array);
+    CeedVectorGetArrayRead(diag, CEED_MEM_HOST, &diag_array);
+    CeedVectorGetArrayRead(diag_async, CEED_MEM_HOST, &diag_async_array);
+    for (CeedInt i = 0; i < num_nodes_u; i++) {
+      sum += v_async_array[i];
+      if (fabs(v_array[i] - v_async_array[i]) > 100. * CEED_EPSILON) {
+        printf("[%" CeedInt_FMT "] v %f != v_async %f\n", i, v_array[i], v_async_array[i]);
+      }
+      if (fabs(diag_array[i] - diag_async_array[i]) > 100. * CEED_EPSILON) {
+        printf("[%" CeedInt_FMT "] diag %f != diag_async %f\n", i, diag_array[i], diag_async_array[i]);
+      }
+    }
+    if (fabs(sum - 1.) > 1000. * CEED_EPSILON) printf("Computed Area: %f != True Area: 1.0\n", sum);
+    CeedVectorRestoreArrayRead(v, &v_array);
+    CeedVectorRestoreArrayRead(v_async, &v_async_array);
+    CeedVectorRestoreArrayRead(diag, &diag_array);
+    CeedVectorRestoreArrayRead(diag_async, &diag_async_array);
+  }
+
+  // Non-blocking application followed by AXPY
+  CeedOperatorApply(op_mass, u, v_async, &request);
+  CeedVectorAXPY(v_async, -1.0, v);
+  CeedRequestWait(&request);
+  {
+    const CeedScalar *v_async_array;
+
+    CeedVectorGetArrayRead(v_async, CEED_MEM_HOST, &v_async_array);
+    for (CeedInt i = 0; i < num_nodes_u; i++) {
+      if (fabs(v_async_array[i]) > 100. * CEED_EPSILON) printf("[%" CeedInt_FMT "] v_async - v %f != 0.0\n", i, v_async_array[i]);
+    }
+    CeedVectorRestoreArrayRead(v_async, &v_async_array);
+  }
+
+  // Non-blocking application followed by a norm, without waiting
+  CeedOperatorApply(op_mass, u, v_async, CEED_REQUEST_ORDERED);
+  {
+    CeedScalar sum;
+
+    CeedVectorNorm(v_async, CEED_NORM_1, &sum);
+    if (fabs(sum - 1.) > 1000. * CEED_EPSILON) printf("Computed Area after CeedVectorNorm: %f != True Area: 1.0\n", sum);
+  }
+
+  // Non-blocking application followed by dot products, without waiting
+  CeedOperatorApply(op_mass, u, v_async, CEED_REQUEST_ORDERED);
+  {
+    CeedScalar sum, sums[2];
+    CeedVector y[2] = {u, u};
+
+    CeedVectorDot(v_async, u, &sum);
+    if (fabs(sum - 1.) > 1000. * CEED_EPSILON) printf("Computed Area after CeedVectorDot: %f != True Area: 1.0\n", sum);
+    CeedOperatorApply(op_mass, u, v_async, CEED_REQUEST_ORDERED);
+    CeedVectorMDot(v_async, 2, y, sums);
+    for (CeedInt k = 0; k < 2; k++) {
+      if (fabs(sums[k] - 1.) > 1000. * CEED_EPSILON) printf("Computed Area after CeedVectorMDot: %f != True Area: 1.0\n", sums[k]);
+    }
+  }
+
+  // Request outstanding when the Ceed context is destroyed
+  CeedOperatorApply(op_mass, u, v_async, &request);
+
+  CeedVectorDestroy(&x);
+  CeedVectorDestroy(&u);
+  CeedVectorDestroy(&v);
+  CeedVectorDestroy(&v_async);
+  CeedVectorDestroy(&diag);
+  CeedVectorDestroy(&diag_async);
+  CeedVectorDestroy(&q_data);
+  CeedElemRestrictionDestroy(&elem_restriction_x);
+  CeedElemRestrictionDestroy(&elem_restriction_u);
+  CeedElemRestrictionDestroy(&elem_restriction_q_data);
+  CeedBasisDestroy(&basis_x);
+  CeedBasisDestroy(&basis_u);
+  CeedQFunctionDestroy(&qf_setup);
+  CeedQFunctionDestroy(&qf_mass);
+  CeedOperatorDestroy(&op_setup);
+  CeedOperatorDestroy(&op_mass);
+  CeedDestroy(&ceed);
+  CeedRequestWait(&request);
+  if (request) printf("CeedRequestWait did not zero request after CeedDestroy\n");
+  return 0;
+}